@@ -37,6 +37,12 @@
     "test/cxx/Core/ApplicationPool/ProcessTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/PoolTest.o" =>
     "test/cxx/Core/ApplicationPool/PoolTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/AutoscalerTest.o" =>
+    "test/cxx/Core/ApplicationPool/AutoscalerTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/MemoryRecyclingTest.o" =>
+    "test/cxx/Core/ApplicationPool/MemoryRecyclingTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/CapacitySchedulerTest.o" =>
+    "test/cxx/Core/ApplicationPool/CapacitySchedulerTest.cpp",
 
   "#{TEST_OUTPUT_DIR}cxx/Core/SpawningKit/ConfigTest.o" =>
     "test/cxx/Core/SpawningKit/ConfigTest.cpp",
@@ -71,6 +77,8 @@
     "test/cxx/ServerKit/FileBufferedChannelTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/HeaderTableTest.o" =>
     "test/cxx/ServerKit/HeaderTableTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/ServerKit/HpackTest.o" =>
+    "test/cxx/ServerKit/HpackTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/ServerTest.o" =>
     "test/cxx/ServerKit/ServerTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/HttpServerTest.o" =>
@@ -94,12 +102,18 @@
     "test/cxx/MemoryKit/MbufTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/MemoryKit/PallocTest.o" =>
     "test/cxx/MemoryKit/PallocTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Algorithms/LatencyHistogramTest.o" =>
+    "test/cxx/Algorithms/LatencyHistogramTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/LStringTest.o" =>
     "test/cxx/DataStructures/LStringTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/StringKeyTableTest.o" =>
     "test/cxx/DataStructures/StringKeyTableTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/StringMapTest.o" =>
     "test/cxx/DataStructures/StringMapTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/SafeLibevTest.o" =>
+    "test/cxx/SafeLibevTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/EventLoopStallDetectorTest.o" =>
+    "test/cxx/EventLoopStallDetectorTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/FileTools/PathSecurityCheckTest.o" =>
     "test/cxx/FileTools/PathSecurityCheckTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOTools/MessageSerializationTest.o" =>
@@ -110,12 +124,16 @@
     "test/cxx/FileChangeCheckerTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/FileDescriptorTest.o" =>
     "test/cxx/FileDescriptorTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/SystemTools/CpuTopologyTest.o" =>
+    "test/cxx/SystemTools/CpuTopologyTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/SystemTools/ProcessMetricsCollectorTest.o" =>
     "test/cxx/SystemTools/ProcessMetricsCollectorTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/SystemTools/SystemTimeTest.o" =>
     "test/cxx/SystemTools/SystemTimeTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/CachedFileStatTest.o" =>
     "test/cxx/CachedFileStatTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/AppTypeDetector/DetectorTest.o" =>
+    "test/cxx/AppTypeDetector/DetectorTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOTools/BufferedIOTest.o" =>
     "test/cxx/IOTools/BufferedIOTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOTools/IOUtilsTest.o" =>
@@ -291,3 +309,148 @@
     ].flatten
   )
 end
+
+
+### C++ components microbenchmarks ###
+
+TEST_CXX_BENCH_TARGET = "#{TEST_OUTPUT_DIR}cxx/bench"
+TEST_CXX_BENCH_OBJECTS = {
+  "#{TEST_OUTPUT_DIR}cxx_bench/CxxBenchMain.o" =>
+    "test/cxx_bench/CxxBenchMain.cpp",
+  "#{TEST_OUTPUT_DIR}cxx_bench/BenchSupport.o" =>
+    "test/cxx_bench/BenchSupport.cpp",
+  "#{TEST_OUTPUT_DIR}cxx_bench/ApplicationPoolBench.o" =>
+    "test/cxx_bench/ApplicationPoolBench.cpp",
+  "#{TEST_OUTPUT_DIR}cxx_bench/DataStructuresBench.o" =>
+    "test/cxx_bench/DataStructuresBench.cpp",
+  "#{TEST_OUTPUT_DIR}cxx_bench/MemoryKitBench.o" =>
+    "test/cxx_bench/MemoryKitBench.cpp",
+  "#{TEST_OUTPUT_DIR}cxx_bench/ServerKitBench.o" =>
+    "test/cxx_bench/ServerKitBench.cpp",
+  "#{TEST_OUTPUT_DIR}cxx_bench/ResponseCacheBench.o" =>
+    "test/cxx_bench/ResponseCacheBench.cpp"
+}
+
+# The benchmarks themselves are always compiled with optimizations, but the
+# code under test is linked in from the regular build, so pass OPTIMIZE=1 to
+# get numbers that are representative of a release build.
+TEST_CXX_BENCH_OBJECTS.each_pair do |object, source|
+  define_cxx_object_compilation_task(
+    object,
+    source,
+    lambda { {
+      :include_paths => [
+        'test/cxx_bench',
+        'test/support',
+        'src/agent',
+        *CXX_SUPPORTLIB_INCLUDE_PATHS
+      ],
+      :flags => ['-O2'] + basic_test_cxx_flags
+    } }
+  )
+end
+
+dependencies = [
+  TEST_CXX_BENCH_OBJECTS.keys,
+  LIBEV_TARGET,
+  LIBUV_TARGET,
+  TEST_BOOST_OXT_LIBRARY,
+  TEST_COMMON_LIBRARY.link_objects,
+  AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT]
+].flatten.compact
+file(TEST_CXX_BENCH_TARGET => dependencies) do
+  create_cxx_executable(
+    TEST_CXX_BENCH_TARGET,
+    TEST_CXX_BENCH_OBJECTS.keys + AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT],
+    :flags => test_cxx_ldflags
+  )
+end
+
+desc "Run microbenchmarks for the C++ components"
+task 'test:cxx:bench' => TEST_CXX_BENCH_TARGET do
+  args = ENV['GROUPS'].to_s.split(";").map{ |name| "-g #{name}" }
+  if samples = string_option('SAMPLES')
+    args << "-n #{samples}"
+  end
+  if json = string_option('BENCH_JSON')
+    args << "-j #{File.expand_path(json)}"
+  end
+  sh "cd test && exec #{File.expand_path(TEST_CXX_BENCH_TARGET)} #{args.join(' ')}".strip
+end
+
+
+### Core end-to-end load benchmark ###
+
+TEST_CXX_CORE_LOAD_BENCH_TARGET = "#{TEST_OUTPUT_DIR}cxx/core_load_bench"
+TEST_CXX_CORE_LOAD_BENCH_OBJECT = "#{TEST_OUTPUT_DIR}cxx_bench/CoreLoadBench.o"
+TEST_CXX_BENCH_STUB_APP_TARGET = "#{TEST_OUTPUT_DIR}cxx/bench_stub_app"
+TEST_CXX_BENCH_STUB_APP_OBJECT = "#{TEST_OUTPUT_DIR}cxx_bench/StubApp.o"
+
+define_cxx_object_compilation_task(
+  TEST_CXX_CORE_LOAD_BENCH_OBJECT,
+  'test/cxx_bench/CoreLoadBench.cpp',
+  lambda { {
+    :include_paths => [
+      'test/cxx_bench',
+      'test/support',
+      'src/agent',
+      *CXX_SUPPORTLIB_INCLUDE_PATHS
+    ],
+    :flags => ['-O2'] + basic_test_cxx_flags
+  } }
+)
+
+# The stub app only depends on libc and pthreads, so that the
+# benchmark measures the Core instead of the app.
+define_cxx_object_compilation_task(
+  TEST_CXX_BENCH_STUB_APP_OBJECT,
+  'test/cxx_bench/StubApp.cpp',
+  :flags => ['-O2']
+)
+
+file(TEST_CXX_BENCH_STUB_APP_TARGET => TEST_CXX_BENCH_STUB_APP_OBJECT) do
+  create_cxx_executable(
+    TEST_CXX_BENCH_STUB_APP_TARGET,
+    TEST_CXX_BENCH_STUB_APP_OBJECT,
+    :flags => PlatformInfo.portability_cxx_ldflags
+  )
+end
+
+dependencies = [
+  TEST_CXX_CORE_LOAD_BENCH_OBJECT,
+  TEST_CXX_BENCH_STUB_APP_TARGET,
+  LIBEV_TARGET,
+  LIBUV_TARGET,
+  TEST_BOOST_OXT_LIBRARY,
+  TEST_COMMON_LIBRARY.link_objects,
+  AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT]
+].flatten.compact
+file(TEST_CXX_CORE_LOAD_BENCH_TARGET => dependencies) do
+  create_cxx_executable(
+    TEST_CXX_CORE_LOAD_BENCH_TARGET,
+    [TEST_CXX_CORE_LOAD_BENCH_OBJECT] + AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT],
+    :flags => test_cxx_ldflags
+  )
+end
+
+desc "Run the end-to-end Core load benchmark"
+task 'test:cxx:core_load_bench' => TEST_CXX_CORE_LOAD_BENCH_TARGET do
+  args = []
+  {
+    'CLIENTS' => '-c',
+    'DURATION' => '-d',
+    'RATE' => '-r',
+    'THREADS' => '-t',
+    'SOCKETS' => '-s',
+    'PROTOCOL' => '-P',
+    'PROCESSES' => '-p'
+  }.each_pair do |name, option|
+    if value = string_option(name)
+      args << "#{option} #{value}"
+    end
+  end
+  if json = string_option('BENCH_JSON')
+    args << "-j #{File.expand_path(json)}"
+  end
+  sh "cd test && exec #{File.expand_path(TEST_CXX_CORE_LOAD_BENCH_TARGET)} #{args.join(' ')}".strip
+end
@@ -4,11 +4,14 @@
   ["src/cxx_supportlib/Constants.h"],
  "src/agent/Core/AdminPanelConnector.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -18,6 +21,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -42,6 +47,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
@@ -54,8 +60,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -98,6 +106,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -107,11 +117,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -149,11 +161,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApiServer.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -164,6 +179,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -190,8 +207,10 @@
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -201,9 +220,12 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -243,6 +265,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -252,11 +276,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -300,6 +326,9 @@
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/Autoscaler.h"=>
+  ["src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
  "src/agent/Core/ApplicationPool/BasicGroupInfo.h"=>
   ["src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -355,6 +384,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -441,6 +471,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -471,6 +502,8 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/CapacityScheduler.h"=>
+  [],
  "src/agent/Core/ApplicationPool/Common.h"=>
   ["src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Options.h",
@@ -527,6 +560,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -610,6 +644,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -642,10 +677,13 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -671,6 +709,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -680,6 +719,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -705,6 +745,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -739,11 +780,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/InitializationAndShutdown.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -769,6 +813,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -778,6 +823,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -803,6 +849,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -837,11 +884,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/InternalUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -867,6 +917,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -876,6 +927,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -901,6 +953,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -935,11 +988,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/LifetimeAndBasics.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -965,6 +1021,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -974,6 +1031,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -999,6 +1057,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1033,11 +1092,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1063,6 +1125,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1072,6 +1135,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1097,6 +1161,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1131,11 +1196,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/OutOfBandWork.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1161,6 +1229,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1170,6 +1239,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1196,6 +1266,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1230,11 +1301,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/ProcessListManagement.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1260,6 +1334,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1269,6 +1344,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1294,6 +1370,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1328,11 +1405,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/SessionManagement.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1358,6 +1438,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1367,6 +1448,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1392,6 +1474,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1426,11 +1509,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/SpawningAndRestarting.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1456,6 +1542,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1465,6 +1552,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1490,6 +1578,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1524,11 +1613,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/StateInspection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1554,6 +1646,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1563,6 +1656,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1588,6 +1682,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1622,11 +1717,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Group/Verification.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1652,6 +1750,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1661,6 +1760,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1686,6 +1786,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1720,8 +1821,10 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Implementation.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
@@ -1735,6 +1838,7 @@
    "src/agent/Core/ApplicationPool/Group/SpawningAndRestarting.cpp",
    "src/agent/Core/ApplicationPool/Group/StateInspection.cpp",
    "src/agent/Core/ApplicationPool/Group/Verification.cpp",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Pool/AnalyticsCollection.cpp",
@@ -1771,6 +1875,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1809,6 +1914,7 @@
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/StrIntTools/Template.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1842,6 +1948,32 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/MemoryRecycling.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Options.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Constants.h",
@@ -1864,11 +1996,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -1894,6 +2029,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -1903,6 +2039,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -1928,6 +2065,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -1963,11 +2101,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/AnalyticsCollection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -1994,6 +2135,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2003,6 +2145,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2028,6 +2171,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2063,11 +2207,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/GarbageCollection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2094,6 +2241,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2103,6 +2251,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2128,6 +2277,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2163,11 +2313,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/GeneralUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2194,6 +2347,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2203,6 +2357,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2228,6 +2383,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2263,11 +2419,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/GroupUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2294,6 +2453,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2303,6 +2463,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2328,6 +2489,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2363,11 +2525,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/InitializationAndShutdown.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2394,6 +2559,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2403,6 +2569,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2428,6 +2595,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2463,11 +2631,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2494,6 +2665,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2503,6 +2675,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2528,6 +2701,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2563,11 +2737,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2594,6 +2771,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2603,6 +2781,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2628,6 +2807,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2663,11 +2843,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -2694,6 +2877,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2703,6 +2887,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2728,6 +2913,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2763,11 +2949,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Process.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -2793,6 +2982,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -2802,6 +2992,7 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -2827,6 +3018,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -2865,6 +3057,7 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
@@ -2922,6 +3115,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3015,6 +3209,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3103,6 +3298,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3161,11 +3357,14 @@
   ["src/agent/Core/AdminPanelConnector.h",
    "src/agent/Core/ApiServer.h",
    "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -3176,6 +3375,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3204,8 +3405,10 @@
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -3218,9 +3421,12 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -3263,6 +3469,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -3272,11 +3480,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3317,11 +3527,14 @@
   ["src/agent/Core/AdminPanelConnector.h",
    "src/agent/Core/ApiServer.h",
    "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -3333,6 +3546,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3361,8 +3576,10 @@
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -3375,9 +3592,12 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -3420,6 +3640,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -3429,11 +3651,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3471,7 +3695,11 @@
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ConfigChange.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+  ["src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
@@ -3482,27 +3710,38 @@
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -3511,6 +3750,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3535,6 +3776,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -3546,8 +3788,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -3586,6 +3830,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -3595,11 +3841,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3646,6 +3894,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -3673,6 +3922,7 @@
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -3698,11 +3948,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/BufferBody.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -3712,6 +3965,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3736,6 +3991,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -3747,8 +4003,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -3787,6 +4045,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -3796,11 +4056,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3837,11 +4099,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/CheckoutSession.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -3851,6 +4116,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3876,6 +4143,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -3890,6 +4158,7 @@
    "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -3929,6 +4198,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -3938,12 +4209,14 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/StrIntTools/Template.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -3980,11 +4253,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/Client.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4025,8 +4301,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -4063,6 +4341,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4072,10 +4352,12 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4112,11 +4394,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/Config.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4126,6 +4411,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -4150,6 +4437,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4161,8 +4449,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -4201,6 +4491,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4210,11 +4502,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4250,7 +4544,8 @@
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/Config.h"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+  ["src/agent/Core/ApplicationPool/Options.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -4263,9 +4558,11 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
@@ -4277,6 +4574,7 @@
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
@@ -4290,6 +4588,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4299,6 +4599,7 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -4307,6 +4608,7 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
@@ -4328,11 +4630,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/ForwardResponse.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4342,6 +4647,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -4366,6 +4673,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4377,8 +4685,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -4417,6 +4727,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4426,11 +4738,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4467,11 +4781,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/Hooks.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4481,6 +4798,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -4505,6 +4824,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4516,8 +4836,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -4556,6 +4878,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4565,11 +4889,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4606,11 +4932,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/Implementation.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4628,10 +4957,13 @@
    "src/agent/Core/Controller/InitRequest.cpp",
    "src/agent/Core/Controller/InitializationAndShutdown.cpp",
    "src/agent/Core/Controller/InternalUtils.cpp",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Miscellaneous.cpp",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/SendRequest.cpp",
    "src/agent/Core/Controller/StateInspection.cpp",
+   "src/agent/Core/Controller/Tunnel.cpp",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -4656,6 +4988,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/AppTypeDetector/Detector.h",
@@ -4671,6 +5004,7 @@
    "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4710,6 +5044,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4719,12 +5055,14 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/StrIntTools/Template.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4739,6 +5077,7 @@
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -4762,11 +5101,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/InitRequest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4776,6 +5118,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -4800,6 +5144,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/AppTypeDetector/Detector.h",
@@ -4815,6 +5160,7 @@
    "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4854,6 +5200,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -4863,11 +5211,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -4882,6 +5232,7 @@
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -4905,11 +5256,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/InitializationAndShutdown.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -4919,6 +5273,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -4943,6 +5299,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -4954,8 +5311,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -4994,6 +5353,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5003,11 +5364,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5044,11 +5407,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/InternalUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -5058,6 +5424,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -5082,6 +5450,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5093,8 +5462,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -5133,6 +5504,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5142,11 +5515,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5181,13 +5556,27 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/Controller/LatencyStats.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/agent/Core/Controller/Metrics.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
  "src/agent/Core/Controller/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -5197,6 +5586,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -5221,6 +5612,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5232,8 +5624,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -5272,6 +5666,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5281,11 +5677,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5322,11 +5720,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/Request.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -5366,8 +5767,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -5404,6 +5807,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5413,10 +5818,12 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5453,11 +5860,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/SendRequest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -5467,6 +5877,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -5491,6 +5903,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5502,8 +5915,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -5542,6 +5957,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5551,11 +5968,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5592,11 +6011,165 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/Controller/StateInspection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/Controller/Tunnel.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -5606,6 +6179,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -5630,6 +6205,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -5641,8 +6217,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -5681,6 +6259,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5690,11 +6270,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5742,6 +6324,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -5760,6 +6343,7 @@
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
@@ -5788,11 +6372,14 @@
   ["src/agent/Core/AdminPanelConnector.h",
    "src/agent/Core/ApiServer.h",
    "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -5805,6 +6392,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/OptionParser.h",
@@ -5836,6 +6425,7 @@
    "src/agent/Shared/Fundamentals/AbortHandler.h",
    "src/agent/Shared/Fundamentals/Initialization.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/AppTypeDetector/Detector.h",
@@ -5857,8 +6447,10 @@
    "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -5904,6 +6496,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -5913,11 +6507,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -5934,6 +6530,7 @@
    "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/OptionParsing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -6361,6 +6958,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -6755,6 +7353,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -6884,11 +7483,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/TelemetryCollector.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -6898,6 +7500,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -6922,6 +7526,7 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -6933,8 +7538,10 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -6973,6 +7580,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -6982,11 +7591,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -7094,6 +7705,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -7124,6 +7736,7 @@
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -7386,6 +7999,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
@@ -7448,6 +8062,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -7478,6 +8093,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -7487,6 +8104,7 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -7515,11 +8133,14 @@
   ["src/agent/Core/AdminPanelConnector.h",
    "src/agent/Core/ApiServer.h",
    "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -7531,6 +8152,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -7560,8 +8183,10 @@
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/agent/Watchdog/ApiServer.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -7574,9 +8199,12 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -7619,6 +8247,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -7628,11 +8258,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -7703,11 +8335,14 @@
   ["src/agent/Core/AdminPanelConnector.h",
    "src/agent/Core/ApiServer.h",
    "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -7719,6 +8354,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/OptionParser.h",
@@ -7756,6 +8393,7 @@
    "src/agent/Watchdog/CoreWatcher.cpp",
    "src/agent/Watchdog/InstanceDirToucher.cpp",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -7771,9 +8409,12 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -7818,6 +8459,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -7827,12 +8470,14 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ContainerHelpers.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -8208,6 +8853,7 @@
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -8270,6 +8916,7 @@
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/WatchdogLauncher.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
@@ -8334,6 +8981,8 @@
   ["src/cxx_supportlib/Algorithms/Hasher.h"],
  "src/cxx_supportlib/Algorithms/Hasher.h"=>
   [],
+ "src/cxx_supportlib/Algorithms/LatencyHistogram.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/Algorithms/MovingAverage.h"=>
   ["src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/AppLocalConfigFileUtils.h"=>
@@ -8384,6 +9033,7 @@
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/WrapperRegistry/CBindings.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
@@ -8425,6 +9075,7 @@
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -8439,6 +9090,7 @@
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -8446,6 +9098,7 @@
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -8632,6 +9285,8 @@
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/DataStructures/MpscQueue.h"=>
+  [],
  "src/cxx_supportlib/DataStructures/StringKeyTable.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
@@ -8641,6 +9296,34 @@
   ["src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/EventLoopStallDetector.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/cxx_supportlib/Exceptions.cpp"=>
   ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
@@ -8690,6 +9373,7 @@
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -9192,6 +9876,7 @@
  "src/cxx_supportlib/SafeLibev.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -9276,6 +9961,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9293,6 +9979,7 @@
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9326,6 +10013,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9348,6 +10036,7 @@
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9413,6 +10102,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9428,6 +10118,7 @@
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9474,6 +10165,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9492,6 +10184,7 @@
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9525,6 +10218,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9543,6 +10237,7 @@
    "src/cxx_supportlib/ServerKit/Config.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -9576,6 +10271,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9595,6 +10291,7 @@
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9629,6 +10326,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9649,6 +10347,7 @@
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9686,6 +10385,34 @@
    "src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/ServerKit/Hooks.h"=>
   [],
+ "src/cxx_supportlib/ServerKit/Hpack.cpp"=>
+  ["src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/Hpack.h"=>
+  ["src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/Http2Session.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h"=>
   ["src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
@@ -9704,6 +10431,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9732,6 +10460,7 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9767,6 +10496,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9795,6 +10525,7 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9841,6 +10572,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9868,6 +10600,7 @@
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9906,6 +10639,7 @@
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -9933,6 +10667,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -9941,6 +10677,7 @@
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -9982,6 +10719,7 @@
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -10006,6 +10744,7 @@
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
@@ -10029,6 +10768,42 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/SpoolArena.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/cxx_supportlib/ServerKit/http_parser.cpp"=>
   ["src/cxx_supportlib/ServerKit/http_parser.h"],
  "src/cxx_supportlib/ServerKit/http_parser.h"=>
@@ -10069,6 +10844,12 @@
  "src/cxx_supportlib/SystemTools/ContainerHelpers.h"=>
   ["src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/SystemTools/CpuTopology.h"=>
+  ["src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
@@ -10185,13 +10966,16 @@
  "src/cxx_supportlib/Utils/BlockingQueue.h"=>
   [],
  "src/cxx_supportlib/Utils/CachedFileStat.cpp"=>
-  ["src/cxx_supportlib/DataStructures/HashMap.h",
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/CachedFileStat.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
@@ -10200,11 +10984,14 @@
  "src/cxx_supportlib/Utils/CachedFileStat.h"=>
   [],
  "src/cxx_supportlib/Utils/CachedFileStat.hpp"=>
-  ["src/cxx_supportlib/DataStructures/HashMap.h",
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
@@ -10225,12 +11012,15 @@
  "src/cxx_supportlib/Utils/FastStringStream.h"=>
   ["src/cxx_supportlib/oxt/macros.hpp"],
  "src/cxx_supportlib/Utils/FileChangeChecker.h"=>
-  ["src/cxx_supportlib/DataStructures/HashMap.h",
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
@@ -10271,6 +11061,17 @@
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/SharedFileStatCache.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/cxx_supportlib/Utils/SpeedMeter.h"=>
   ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -10732,11 +11533,14 @@
   ["src/agent/Core/AdminPanelConnector.h",
    "src/agent/Core/ApiServer.h",
    "src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
@@ -10748,6 +11552,8 @@
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
    "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -10778,8 +11584,10 @@
    "src/agent/Watchdog/ApiServer.h",
    "src/agent/Watchdog/Config.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/AsyncUtils.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
@@ -10792,9 +11600,12 @@
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -10837,6 +11648,8 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
@@ -10846,11 +11659,13 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -10887,8 +11702,9 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "test/cxx/Base64DecodingTest.cpp"=>
+ "test/cxx/Algorithms/LatencyHistogramTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
@@ -10929,16 +11745,20 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/CachedFileStatTest.cpp"=>
+ "test/cxx/AppTypeDetector/DetectorTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/AppTypeDetector/Detector.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
@@ -10957,6 +11777,10 @@
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -10974,10 +11798,9 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ConfigKit/ErrorTest.cpp"=>
+ "test/cxx/Base64DecodingTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -11017,19 +11840,13 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ConfigKit/NestedSchemaTest.cpp"=>
+ "test/cxx/CachedFileStatTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -11048,8 +11865,10 @@
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -11067,17 +11886,12 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ConfigKit/SchemaTest.cpp"=>
+ "test/cxx/ConfigKit/ErrorTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -11115,10 +11929,11 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ConfigKit/StoreTest.cpp"=>
+ "test/cxx/ConfigKit/NestedSchemaTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
@@ -11164,15 +11979,12 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ConfigKit/SubSchemaTest.cpp"=>
+ "test/cxx/ConfigKit/SchemaTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
@@ -11215,13 +12027,15 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ConfigKit/TranslationTest.cpp"=>
+ "test/cxx/ConfigKit/StoreTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
-   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -11262,44 +12076,15 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/ApplicationPool/OptionsTest.cpp"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+ "test/cxx/ConfigKit/SubSchemaTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
@@ -11308,42 +12093,23 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -11361,95 +12127,169 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/ApplicationPool/PoolTest.cpp"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+ "test/cxx/ConfigKit/TranslationTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/PrefixTranslator.h",
+   "src/cxx_supportlib/ConfigKit/TableTranslator.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/ApplicationPool/AutoscalerTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/ApplicationPool/CapacitySchedulerTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/ApplicationPool/MemoryRecyclingTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -11460,7 +12300,6 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -11468,12 +12307,13 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/ApplicationPool/ProcessTest.cpp"=>
+ "test/cxx/Core/ApplicationPool/OptionsTest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
@@ -11521,8 +12361,6 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
@@ -11536,6 +12374,7 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -11569,26 +12408,21 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/ControllerTest.cpp"=>
+ "test/cxx/Core/ApplicationPool/PoolTest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
    "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/ApplicationPool/TestSession.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -11617,13 +12451,12 @@
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -11635,48 +12468,24 @@
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -11685,7 +12494,6 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
@@ -11713,22 +12521,17 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/ResponseCacheTest.cpp"=>
+ "test/cxx/Core/ApplicationPool/ProcessTest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
@@ -11750,72 +12553,44 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
    "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -11824,10 +12599,8 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -11844,7 +12617,6 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -11852,157 +12624,127 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/SecurityUpdateCheckerTest.cpp"=>
-  ["src/agent/Core/SecurityUpdateChecker.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/Crypto.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "test/cxx/TestSupport.h",
-   "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/ConfigTest.cpp"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "test/cxx/TestSupport.h",
-   "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/DirectSpawnerTest.cpp"=>
-  ["src/agent/Core/ApplicationPool/Options.h",
+ "test/cxx/Core/ControllerTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/TestSession.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Handshake/Perform.h",
    "src/agent/Core/SpawningKit/Handshake/Prepare.h",
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
@@ -12010,7 +12752,10 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -12027,68 +12772,138 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "test/cxx/Core/SpawningKit/SpawnerTestCases.cpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/HandshakePerformTest.cpp"=>
-  ["src/agent/Core/SpawningKit/Config.h",
+ "test/cxx/Core/ResponseCacheTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Handshake/Perform.h",
    "src/agent/Core/SpawningKit/Handshake/Prepare.h",
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Config.h",
-   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -12105,6 +12920,7 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -12112,17 +12928,8 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/HandshakePrepareTest.cpp"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+ "test/cxx/Core/SecurityUpdateCheckerTest.cpp"=>
+  ["src/agent/Core/SecurityUpdateChecker.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
@@ -12138,11 +12945,8 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -12151,23 +12955,15 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/SecurityKit/Crypto.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12185,19 +12981,19 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/JourneyTest.cpp"=>
-  ["src/agent/Core/SpawningKit/Journey.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
+ "test/cxx/Core/SpawningKit/ConfigTest.cpp"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -12206,7 +13002,6 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -12214,8 +13009,6 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12233,11 +13026,12 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/SmartSpawnerTest.cpp"=>
+ "test/cxx/Core/SpawningKit/DirectSpawnerTest.cpp"=>
   ["src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
    "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Handshake/Perform.h",
@@ -12245,10 +13039,8 @@
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
@@ -12268,7 +13060,6 @@
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
@@ -12288,7 +13079,6 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
@@ -12321,15 +13111,23 @@
    "test/cxx/Core/SpawningKit/SpawnerTestCases.cpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/SpawningKit/SpawnerTestCases.cpp"=>
-  [],
- "test/cxx/Core/SpawningKit/UserSwitchingRulesTest.cpp"=>
-  ["src/agent/Core/ApplicationPool/Options.h",
+ "test/cxx/Core/SpawningKit/HandshakePerformTest.cpp"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
@@ -12347,6 +13145,8 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
@@ -12357,12 +13157,17 @@
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/WrapperRegistry/Entry.h",
    "src/cxx_supportlib/WrapperRegistry/Registry.h",
@@ -12383,127 +13188,56 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/Core/TelemetryCollectorTest.cpp"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Config.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
-   "src/agent/Core/SpawningKit/Config.h",
+ "test/cxx/Core/SpawningKit/HandshakePrepareTest.cpp"=>
+  ["src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
    "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Handshake/Perform.h",
    "src/agent/Core/SpawningKit/Handshake/Prepare.h",
    "src/agent/Core/SpawningKit/Handshake/Session.h",
    "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
    "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/TelemetryCollector.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/ConfigKit/Common.h",
    "src/cxx_supportlib/ConfigKit/ConfigKit.h",
    "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
    "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
    "src/cxx_supportlib/ConfigKit/Store.h",
    "src/cxx_supportlib/ConfigKit/Translator.h",
    "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/IOTools/MessageIO.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/LveLoggingDecorator.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Lock.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/Timer.h",
@@ -12520,7 +13254,6 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -12528,28 +13261,19 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/CxxTestMain.cpp"=>
-  ["src/agent/Shared/Fundamentals/AbortHandler.h",
-   "src/agent/Shared/Fundamentals/Initialization.h",
-   "src/agent/Shared/Fundamentals/Utils.h",
+ "test/cxx/Core/SpawningKit/JourneyTest.cpp"=>
+  ["src/agent/Core/SpawningKit/Journey.h",
    "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -12558,6 +13282,7 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -12565,6 +13290,8 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12575,43 +13302,84 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
-   "test/tut/tut.h",
-   "test/tut/tut_reporter.h"],
- "test/cxx/DataStructures/LStringTest.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "test/tut/tut.h"],
+ "test/cxx/Core/SpawningKit/SmartSpawnerTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Config.h",
+   "src/cxx_supportlib/LoggingKit/Context.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12627,19 +13395,34 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Core/SpawningKit/SpawnerTestCases.cpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/DataStructures/StringKeyTableTest.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "test/cxx/Core/SpawningKit/SpawnerTestCases.cpp"=>
+  [],
+ "test/cxx/Core/SpawningKit/UserSwitchingRulesTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -12648,6 +13431,7 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -12655,6 +13439,10 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12672,76 +13460,145 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/DataStructures/StringMapTest.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/LoggingKit/Assert.h",
-   "src/cxx_supportlib/LoggingKit/Forward.h",
-   "src/cxx_supportlib/LoggingKit/Logging.h",
-   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/ProcessManagement/Spawn.h",
-   "src/cxx_supportlib/ProcessManagement/Utils.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/SystemTools/SystemTime.h",
-   "src/cxx_supportlib/SystemTools/UserDatabase.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "test/cxx/TestSupport.h",
-   "test/tut/tut.h"],
- "test/cxx/DateParsingTest.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "test/cxx/Core/TelemetryCollectorTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/TelemetryCollector.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12752,6 +13609,7 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -12759,16 +13617,26 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/FileChangeCheckerTest.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "test/cxx/CxxTestMain.cpp"=>
+  ["src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/agent/Shared/Fundamentals/Utils.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
@@ -12784,9 +13652,7 @@
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/FileChangeChecker.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -12798,18 +13664,21 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
-   "test/tut/tut.h"],
- "test/cxx/FileDescriptorTest.cpp"=>
+   "test/tut/tut.h",
+   "test/tut/tut_reporter.h"],
+ "test/cxx/DataStructures/LStringTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -12819,6 +13688,8 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
@@ -12847,15 +13718,15 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/FileTools/PathSecurityCheckTest.cpp"=>
+ "test/cxx/DataStructures/StringKeyTableTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
@@ -12890,15 +13761,16 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/IOTools/BufferedIOTest.cpp"=>
+ "test/cxx/DataStructures/StringMapTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
@@ -12916,7 +13788,6 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -12934,7 +13805,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/IOTools/IOUtilsTest.cpp"=>
+ "test/cxx/DateParsingTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -12953,6 +13824,7 @@
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
@@ -12976,16 +13848,18 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/IOTools/MessageIOTest.cpp"=>
+ "test/cxx/EventLoopStallDetectorTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/EventLoopStallDetector.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -12995,7 +13869,7 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13003,7 +13877,6 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13021,16 +13894,17 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/IOTools/MessageSerializationTest.cpp"=>
+ "test/cxx/FileChangeCheckerTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -13040,14 +13914,16 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/FileChangeChecker.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/SharedFileStatCache.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13065,7 +13941,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/MemoryKit/MbufTest.cpp"=>
+ "test/cxx/FileDescriptorTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -13079,7 +13955,6 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
@@ -13108,7 +13983,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/MemoryKit/PallocTest.cpp"=>
+ "test/cxx/FileTools/PathSecurityCheckTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -13116,13 +13991,13 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathSecurityCheck.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
@@ -13151,7 +14026,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/MessagePassingTest.cpp"=>
+ "test/cxx/IOTools/BufferedIOTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -13159,6 +14034,7 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
@@ -13176,7 +14052,6 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -13195,42 +14070,24 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ServerKit/ChannelTest.cpp"=>
+ "test/cxx/IOTools/IOUtilsTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13238,8 +14095,6 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13257,28 +14112,26 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ServerKit/CookieUtilsTest.cpp"=>
+ "test/cxx/IOTools/MessageIOTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13286,6 +14139,7 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13303,45 +14157,26 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ServerKit/FileBufferedChannelTest.cpp"=>
+ "test/cxx/IOTools/MessageSerializationTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13349,8 +14184,6 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13368,12 +14201,11 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ServerKit/HeaderTableTest.cpp"=>
+ "test/cxx/MemoryKit/MbufTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -13384,12 +14216,10 @@
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13414,74 +14244,32 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ServerKit/HttpServerTest.cpp"=>
+ "test/cxx/MemoryKit/PallocTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
-   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13499,51 +14287,24 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/ServerKit/ServerTest.cpp"=>
+ "test/cxx/MessagePassingTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Config.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13551,8 +14312,8 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13570,37 +14331,17 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/SpawnEnvSetupperTest.cpp"=>
-  ["src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
-   "src/agent/Core/SpawningKit/Context.h",
-   "src/agent/Core/SpawningKit/Exceptions.h",
-   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
-   "src/agent/Core/SpawningKit/Handshake/Session.h",
-   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
-   "src/agent/Core/SpawningKit/Journey.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
-   "src/cxx_supportlib/Algorithms/Hasher.h",
+ "test/cxx/SafeLibevTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/ConfigKit/Common.h",
-   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
-   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
-   "src/cxx_supportlib/ConfigKit/Schema.h",
-   "src/cxx_supportlib/ConfigKit/Store.h",
-   "src/cxx_supportlib/ConfigKit/Translator.h",
-   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
-   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -13609,23 +14350,14 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WrapperRegistry/Entry.h",
-   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13643,24 +14375,44 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/StaticStringTest.cpp"=>
+ "test/cxx/ServerKit/ChannelTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13668,6 +14420,8 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13685,11 +14439,12 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/StrIntTools/StrIntUtilsTest.cpp"=>
+ "test/cxx/ServerKit/CookieUtilsTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -13699,10 +14454,13 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13727,34 +14485,56 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/StrIntTools/TemplateTest.cpp"=>
+ "test/cxx/ServerKit/FileBufferedChannelTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashMap.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringMap.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/Template.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13772,11 +14552,12 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/SystemTools/ProcessMetricsCollectorTest.cpp"=>
+ "test/cxx/ServerKit/HeaderTableTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
@@ -13786,20 +14567,20 @@
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
-   "src/cxx_supportlib/StrIntTools/StringScanning.h",
-   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13817,7 +14598,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/SystemTools/SystemTimeTest.cpp"=>
+ "test/cxx/ServerKit/HpackTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -13835,6 +14616,9 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13859,32 +14643,78 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/TestSupport.cpp"=>
+ "test/cxx/ServerKit/HttpServerTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13901,26 +14731,54 @@
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
-   "test/support/valgrind.h",
    "test/tut/tut.h"],
- "test/cxx/TestSupport.h"=>
+ "test/cxx/ServerKit/ServerTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
    "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/ProcessManagement/Spawn.h",
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
@@ -13928,6 +14786,8 @@
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13943,18 +14803,39 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/UtilsTest.cpp"=>
-  ["src/cxx_supportlib/Algorithms/Hasher.h",
+ "test/cxx/SpawnEnvSetupperTest.cpp"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/FileTools/PathManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
    "src/cxx_supportlib/LoggingKit/Logging.h",
@@ -13966,11 +14847,20 @@
    "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -13988,7 +14878,179 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
- "test/cxx/VariantMapTest.cpp"=>
+ "test/cxx/StaticStringTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/StrIntTools/StrIntUtilsTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/StrIntTools/TemplateTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringMap.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/Template.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/SystemTools/CpuTopologyTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/SystemTools/ProcessMetricsCollectorTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/Hasher.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -13997,7 +15059,6 @@
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/FileTools/FileManip.h",
    "src/cxx_supportlib/IOTools/IOUtils.h",
-   "src/cxx_supportlib/IOTools/MessageIO.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/LoggingKit/Assert.h",
    "src/cxx_supportlib/LoggingKit/Forward.h",
@@ -14007,16 +15068,16 @@
    "src/cxx_supportlib/ProcessManagement/Utils.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
-   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
    "src/cxx_supportlib/SystemTools/SystemTime.h",
    "src/cxx_supportlib/SystemTools/UserDatabase.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
@@ -14034,6 +15095,768 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/TestSupport.h",
    "test/tut/tut.h"],
+ "test/cxx/SystemTools/SystemTimeTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/TestSupport.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/support/valgrind.h",
+   "test/tut/tut.h"],
+ "test/cxx/TestSupport.h"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/tut/tut.h"],
+ "test/cxx/UtilsTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx/VariantMapTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/TestSupport.h",
+   "test/tut/tut.h"],
+ "test/cxx_bench/ApplicationPoolBench.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/BenchSupport.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/BenchSupport.h"=>
+  [],
+ "test/cxx_bench/CoreLoadBench.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/LatencyStats.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/LatencyHistogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/IOTools/MessageSerialization.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "test/cxx_bench/CxxBenchMain.cpp"=>
+  ["src/agent/Shared/Fundamentals/AbortHandler.h",
+   "src/agent/Shared/Fundamentals/Initialization.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/DataStructuresBench.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/MemoryKitBench.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/ResponseCacheBench.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/Autoscaler.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/CapacityScheduler.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/MemoryRecycling.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Config.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/Config/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/Context.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Exceptions.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Handshake/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Handshake/Perform.h",
+   "src/agent/Core/SpawningKit/Handshake/Prepare.h",
+   "src/agent/Core/SpawningKit/Handshake/Session.h",
+   "src/agent/Core/SpawningKit/Handshake/WorkDir.h",
+   "src/agent/Core/SpawningKit/Journey.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/Result/AutoGeneratedCode.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppLocalConfigFileUtils.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/SchemaUtils.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashMap.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/FileManip.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/IOTools/BufferedIO.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/LveLoggingDecorator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ProcessManagement/Spawn.h",
+   "src/cxx_supportlib/ProcessManagement/Utils.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/Hpack.h",
+   "src/cxx_supportlib/ServerKit/Http2Session.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/DateParsing.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/StrIntTools/StringScanning.h",
+   "src/cxx_supportlib/SystemTools/CpuTopology.h",
+   "src/cxx_supportlib/SystemTools/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemMetricsCollector.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/SystemTools/UserDatabase.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/AsyncSignalSafeUtils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WrapperRegistry/Entry.h",
+   "src/cxx_supportlib/WrapperRegistry/Registry.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/ServerKitBench.cpp"=>
+  ["src/cxx_supportlib/Algorithms/Hasher.h",
+   "src/cxx_supportlib/ConfigKit/Common.h",
+   "src/cxx_supportlib/ConfigKit/ConfigKit.h",
+   "src/cxx_supportlib/ConfigKit/DummyTranslator.h",
+   "src/cxx_supportlib/ConfigKit/Schema.h",
+   "src/cxx_supportlib/ConfigKit/Store.h",
+   "src/cxx_supportlib/ConfigKit/Translator.h",
+   "src/cxx_supportlib/ConfigKit/Utils.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/MpscQueue.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/FileTools/PathManip.h",
+   "src/cxx_supportlib/IOTools/IOUtils.h",
+   "src/cxx_supportlib/IOTools/MessageIO.h",
+   "src/cxx_supportlib/JsonTools/JsonUtils.h",
+   "src/cxx_supportlib/LoggingKit/Assert.h",
+   "src/cxx_supportlib/LoggingKit/Forward.h",
+   "src/cxx_supportlib/LoggingKit/Logging.h",
+   "src/cxx_supportlib/LoggingKit/LoggingKit.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/SecurityKit/MemZeroGuard.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Config.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/SpoolArena.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StrIntTools/StrIntUtils.h",
+   "src/cxx_supportlib/SystemTools/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx_bench/BenchSupport.h"],
+ "test/cxx_bench/StubApp.cpp"=>
+  [],
  "test/oxt/backtrace_test.cpp"=>
   ["src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
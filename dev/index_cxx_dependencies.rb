@@ -8,12 +8,14 @@
   "src/cxx_supportlib/vendor-copy",
   "src/cxx_supportlib/vendor-copy/websocketpp",
   "src/cxx_supportlib/vendor-modified",
-  "test/cxx"
+  "test/cxx",
+  "test/cxx_bench"
 ]
 SCAN_FILES = Dir[
   "src/**/*.{c,cpp,h,hpp}",
   "test/oxt/**/*.{c,cpp,h,hpp}",
-  "test/cxx/**/*.{c,cpp,h,hpp}"
+  "test/cxx/**/*.{c,cpp,h,hpp}",
+  "test/cxx_bench/**/*.{c,cpp,h,hpp}"
 ]
 EXCLUDE_FILES = Dir[
   "src/cxx_supportlib/vendor-copy/**/*",
@@ -45,6 +45,7 @@
 #include <Shared/ApiAccountUtils.h>
 #include <ServerKit/HttpServer.h>
 #include <DataStructures/LString.h>
+#include <EventLoopStallDetector.h>
 #include <Exceptions.h>
 #include <StaticString.h>
 #include <LoggingKit/LoggingKit.h>
@@ -69,6 +70,7 @@ using namespace std;
  *   accept_burst_count             unsigned integer   -   default(32)
  *   authorizations                 array              -   default("[FILTERED]"),secret
  *   client_freelist_limit          unsigned integer   -   default(0)
+ *   http2                          boolean            -   default(false)
  *   instance_dir                   string             -   -
  *   min_spare_clients              unsigned integer   -   default(0)
  *   request_freelist_limit         unsigned integer   -   default(1024)
@@ -117,6 +119,8 @@ public:
 	Authorization authorization;
 	unsigned int controllerStatesGathered;
 	vector<Json::Value> controllerStates;
+	boost::shared_ptr<LatencyStats::Snapshot> latencyStats;
+	vector<ControllerMetrics> controllerMetrics;
 
 	DEFINE_SERVER_KIT_BASE_HTTP_REQUEST_FOOTER(Passenger::Core::ApiServer::Request);
 };
@@ -159,6 +163,12 @@ private:
 			processServerStatus(client, req);
 		} else if (regex_match(path, serverConnectionPath)) {
 			processServerConnectionOperation(client, req);
+		} else if (path == P_STATIC_STRING("/latency_histograms.json")
+			|| path == P_STATIC_STRING("/latency_histograms.txt"))
+		{
+			processLatencyHistograms(client, req);
+		} else if (path == P_STATIC_STRING("/metrics")) {
+			processMetrics(client, req);
 		} else if (path == P_STATIC_STRING("/pool.xml")) {
 			processPoolStatusXml(client, req);
 		} else if (path == P_STATIC_STRING("/pool.txt")) {
@@ -263,6 +273,9 @@ private:
 				string key = "thread" + toString(i + 1);
 				response[key] = req->controllerStates[i];
 			}
+			if (eventLoopStallDetector != NULL) {
+				response["event_loop_stalls"] = eventLoopStallDetector->inspectStateAsJson();
+			}
 
 			writeSimpleResponse(client, 200, &headers,
 				psg_pstrdup(req->pool, response.toStyledString()));
@@ -289,6 +302,137 @@ private:
 		}
 	}
 
+	void gatherLatencyStats(Client *client, Request *req, Controller *controller) {
+		LatencyStats::Snapshot snapshot = controller->getLatencyStatsSnapshot();
+		getContext()->libev->runLater(boost::bind(&ApiServer::latencyStatsGathered,
+			this, client, req, snapshot));
+	}
+
+	void latencyStatsGathered(Client *client, Request *req,
+		const LatencyStats::Snapshot &snapshot)
+	{
+		if (req->ended()) {
+			unrefRequest(req, __FILE__, __LINE__);
+			return;
+		}
+
+		req->controllerStatesGathered++;
+		req->latencyStats->merge(snapshot);
+
+		if (req->controllerStatesGathered == controllers.size()) {
+			HeaderTable headers;
+			string body;
+
+			if (req->getPathWithoutQueryString() == P_STATIC_STRING("/latency_histograms.txt")) {
+				stringstream stream;
+				req->latencyStats->writePrometheusText(stream,
+					P_STATIC_STRING("passenger_request_latency_seconds"));
+				body = stream.str();
+				headers.insert(req->pool, "Content-Type", "text/plain; version=0.0.4");
+			} else {
+				body = req->latencyStats->inspectAsJson().toStyledString();
+				headers.insert(req->pool, "Content-Type", "application/json");
+			}
+
+			writeSimpleResponse(client, 200, &headers, psg_pstrdup(req->pool, body));
+			if (!req->ended()) {
+				Request *req2 = req;
+				endRequest(&client, &req2);
+			}
+		}
+
+		unrefRequest(req, __FILE__, __LINE__);
+	}
+
+	void processLatencyHistograms(Client *client, Request *req) {
+		if (authorizeStateInspectionOperation(this, client, req)) {
+			req->latencyStats = boost::make_shared<LatencyStats::Snapshot>();
+			for (unsigned int i = 0; i < controllers.size(); i++) {
+				refRequest(req, __FILE__, __LINE__);
+				controllers[i]->getContext()->libev->runLater(boost::bind(
+					&ApiServer::gatherLatencyStats, this,
+					client, req, controllers[i]));
+			}
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
+	void gatherControllerMetrics(Client *client, Request *req,
+		Controller *controller, unsigned int i)
+	{
+		ControllerMetrics metrics = controller->collectMetrics();
+		LatencyStats::Snapshot snapshot = controller->getLatencyStatsSnapshot();
+		getContext()->libev->runLater(boost::bind(&ApiServer::controllerMetricsGathered,
+			this, client, req, i, metrics, snapshot));
+	}
+
+	void controllerMetricsGathered(Client *client, Request *req,
+		unsigned int i, const ControllerMetrics &metrics,
+		const LatencyStats::Snapshot &snapshot)
+	{
+		if (req->ended()) {
+			unrefRequest(req, __FILE__, __LINE__);
+			return;
+		}
+
+		req->controllerStatesGathered++;
+		req->controllerMetrics[i] = metrics;
+		req->latencyStats->merge(snapshot);
+
+		if (req->controllerStatesGathered == controllers.size()) {
+			respondWithMetrics(client, req);
+		}
+
+		unrefRequest(req, __FILE__, __LINE__);
+	}
+
+	void respondWithMetrics(Client *client, Request *req) {
+		const Authorization &auth = req->authorization;
+		HeaderTable headers;
+		stringstream stream;
+		ApplicationPool2::Pool::AuthenticationOptions options;
+
+		options.uid = auth.uid;
+		options.apiKey = auth.apiKey;
+		appPool->writePrometheusMetrics(stream, options);
+		if (auth.canInspectState) {
+			writeControllerMetrics(stream, req->controllerMetrics);
+			req->latencyStats->writePrometheusText(stream,
+				P_STATIC_STRING("passenger_request_latency_seconds"));
+		}
+
+		headers.insert(req->pool, "Content-Type", "text/plain; version=0.0.4");
+		writeSimpleResponse(client, 200, &headers, psg_pstrdup(req->pool, stream.str()));
+		if (!req->ended()) {
+			endRequest(&client, &req);
+		}
+	}
+
+	/**
+	 * Reports pool, server and latency metrics in the Prometheus text
+	 * exposition format. Clients that may read the pool but not inspect
+	 * the server state only get the pool metrics of the groups that they
+	 * are authorized for.
+	 */
+	void processMetrics(Client *client, Request *req) {
+		req->authorization = authorize(this, client, req);
+		if (!req->authorization.canReadPool) {
+			apiServerRespondWith401(this, client, req);
+		} else if (!req->authorization.canInspectState) {
+			respondWithMetrics(client, req);
+		} else {
+			req->controllerMetrics.resize(controllers.size());
+			req->latencyStats = boost::make_shared<LatencyStats::Snapshot>();
+			for (unsigned int i = 0; i < controllers.size(); i++) {
+				refRequest(req, __FILE__, __LINE__);
+				controllers[i]->getContext()->libev->runLater(boost::bind(
+					&ApiServer::gatherControllerMetrics, this,
+					client, req, controllers[i], i));
+			}
+		}
+	}
+
 	void processPoolStatusXml(Client *client, Request *req) {
 		Authorization auth(authorize(this, client, req));
 		if (auth.canReadPool) {
@@ -674,6 +818,8 @@ protected:
 		}
 		req->authorization = Authorization();
 		req->controllerStates.clear();
+		req->latencyStats.reset();
+		req->controllerMetrics.clear();
 		ParentClass::deinitializeRequest(client, req);
 	}
 
@@ -684,13 +830,16 @@ public:
 	vector<Controller *> controllers;
 	ApplicationPool2::PoolPtr appPool;
 	EventFd *exitEvent;
+	/** Optional. */
+	EventLoopStallDetector *eventLoopStallDetector;
 
 	ApiServer(ServerKit::Context *context, const Schema &schema,
 		const Json::Value &initialConfig,
 		const ConfigKit::Translator &translator = ConfigKit::DummyTranslator())
 		: ParentClass(context, schema, initialConfig, translator),
 		  serverConnectionPath("^/server/(.+)\\.json$"),
-		  exitEvent(NULL)
+		  exitEvent(NULL),
+		  eventLoopStallDetector(NULL)
 	{
 		apiAccountDatabase = ApiAccountUtils::ApiAccountDatabase(
 			config["authorizations"]);
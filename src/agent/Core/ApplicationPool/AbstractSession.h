@@ -50,6 +50,11 @@ public:
 	virtual pid_t getPid() const = 0;
 	virtual StaticString getGupid() const = 0;
 	virtual StaticString getProtocol() const = 0;
+	/**
+	 * Whether the app accepts a buffered request body as a file descriptor
+	 * passed along with the session protocol header.
+	 */
+	virtual bool acceptsBodyFd() const = 0;
 	virtual unsigned int getStickySessionId() const = 0;
 	virtual const ApiKey &getApiKey() const = 0;
 	virtual int fd() const = 0;
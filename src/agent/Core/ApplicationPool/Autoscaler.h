@@ -0,0 +1,305 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2014-2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_AUTOSCALER_H_
+#define _PASSENGER_APPLICATION_POOL2_AUTOSCALER_H_
+
+#include <algorithm>
+#include <deque>
+#include <ostream>
+#include <cmath>
+#include <Algorithms/MovingAverage.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+struct AutoscalerConfig {
+	bool enabled;
+	/** Lower bound on the number of processes that the autoscaler keeps per group,
+	 * in addition to the group's own minProcesses. The default of 0 means that
+	 * only the latter applies, so groups with a minProcesses of 0 may scale
+	 * down to zero processes. */
+	unsigned int minProcesses;
+	/** Upper bound on the number of processes that the autoscaler keeps per group.
+	 * 0 means that only the group's own limits and the pool size apply. */
+	unsigned int maxProcesses;
+	/** Time (usec) between evaluations. */
+	unsigned long long interval;
+	/** Number of consecutive evaluations that must predict a lower demand
+	 * before the autoscaler lowers its target by one process. */
+	unsigned int scaleDownDelay;
+
+	AutoscalerConfig()
+		: enabled(false),
+		  minProcesses(0),
+		  maxProcesses(0),
+		  interval(5000000),
+		  scaleDownDelay(12)
+		{ }
+};
+
+/**
+ * Predicts the number of processes that a group needs, so that the pool can
+ * spawn processes before requests have to wait for them and reap them
+ * gradually once demand goes down.
+ *
+ * Every evaluation samples the group's concurrency (open sessions plus queued
+ * requests) and its request arrival rate, and maintains moving averages of
+ * both. The predicted concurrency is the average concurrency plus two
+ * standard deviations, scaled up if the arrival rate is rising. The target
+ * number of processes follows a rise in predicted demand immediately, but only
+ * goes down by one process at a time, and only after `scaleDownDelay`
+ * consecutive evaluations have predicted a lower demand.
+ *
+ * The pool uses the target as an additional lower limit on the group's
+ * process count. This class is not thread-safe; the pool protects it with
+ * its lock.
+ */
+class Autoscaler {
+public:
+	enum Decision {
+		AD_NONE,
+		AD_SCALE_UP,
+		AD_SCALE_DOWN
+	};
+
+	struct DecisionRecord {
+		unsigned long long time;
+		Decision decision;
+		unsigned int oldTarget;
+		unsigned int newTarget;
+		double predictedConcurrency;
+	};
+
+	static const unsigned int MAX_DECISION_RECORDS = 10;
+
+private:
+	DiscExpMovingAverageWithStddev<300, 10000000, 10000000> concurrencyAverage;
+	DiscExpMovingAverage<300, 10000000, 10000000> arrivalRateAverage;
+	unsigned long long lastEvaluatedAt;
+	unsigned int requestsSinceLastEvaluation;
+	unsigned int target;
+	unsigned int surplusEvaluations;
+	double processConcurrency;
+	double predictedConcurrency;
+	double arrivalRate;
+	deque<DecisionRecord> decisions;
+
+	Decision recordDecision(unsigned long long now, Decision decision,
+		unsigned int oldTarget)
+	{
+		DecisionRecord record;
+		record.time = now;
+		record.decision = decision;
+		record.oldTarget = oldTarget;
+		record.newTarget = target;
+		record.predictedConcurrency = predictedConcurrency;
+		decisions.push_back(record);
+		if (decisions.size() > MAX_DECISION_RECORDS) {
+			decisions.pop_front();
+		}
+		return decision;
+	}
+
+	double getConcurrencyStddev() const {
+		double result = concurrencyAverage.stddev();
+		// Rounding errors may cause the variance to be slightly negative.
+		if (result > 0) {
+			return result;
+		} else {
+			return 0;
+		}
+	}
+
+public:
+	Autoscaler() {
+		reset();
+	}
+
+	void reset() {
+		concurrencyAverage = DiscExpMovingAverageWithStddev<300, 10000000, 10000000>();
+		arrivalRateAverage = DiscExpMovingAverage<300, 10000000, 10000000>();
+		lastEvaluatedAt = 0;
+		requestsSinceLastEvaluation = 0;
+		target = 0;
+		surplusEvaluations = 0;
+		processConcurrency = 0;
+		predictedConcurrency = 0;
+		arrivalRate = 0;
+		decisions.clear();
+	}
+
+	void recordRequest() {
+		requestsSinceLastEvaluation++;
+	}
+
+	bool shouldEvaluate(const AutoscalerConfig &config, unsigned long long now) const {
+		return lastEvaluatedAt == 0 || now >= lastEvaluatedAt + config.interval;
+	}
+
+	unsigned long long getNextEvaluationTime(const AutoscalerConfig &config) const {
+		return lastEvaluatedAt + config.interval;
+	}
+
+	/**
+	 * Updates the moving averages and the target number of processes.
+	 *
+	 * @param concurrency The number of open sessions plus the number of queued requests.
+	 * @param currentProcessConcurrency The average number of concurrent requests that
+	 *    the group's processes can handle, or <= 0 if unknown or unlimited. In the
+	 *    latter case the last known value is used. If there is none, e.g. because the
+	 *    app's processes handle an unlimited number of concurrent requests, then any
+	 *    one process can absorb the predicted concurrency and the target only follows
+	 *    the bounds.
+	 * @param minBound, maxBound The bounds for the target. A `maxBound` of 0 means unbounded.
+	 */
+	Decision evaluate(const AutoscalerConfig &config, unsigned long long now,
+		unsigned int concurrency, double currentProcessConcurrency,
+		unsigned int minBound, unsigned int maxBound)
+	{
+		if (lastEvaluatedAt != 0 && now > lastEvaluatedAt) {
+			arrivalRate = requestsSinceLastEvaluation / ((now - lastEvaluatedAt) / 1000000.0);
+			arrivalRateAverage.update(arrivalRate, now);
+		}
+		concurrencyAverage.update(concurrency, now);
+		lastEvaluatedAt = now;
+		requestsSinceLastEvaluation = 0;
+		if (currentProcessConcurrency > 0) {
+			processConcurrency = currentProcessConcurrency;
+		}
+
+		predictedConcurrency = concurrencyAverage.average() + 2 * getConcurrencyStddev();
+		if (arrivalRateAverage.available() && arrivalRateAverage.average() > 0
+		 && arrivalRate > arrivalRateAverage.average())
+		{
+			predictedConcurrency *= arrivalRate / arrivalRateAverage.average();
+		}
+		predictedConcurrency = std::max(predictedConcurrency, (double) concurrency);
+
+		// The moving averages only approach zero, so treat a negligible
+		// predicted concurrency as no demand at all. Otherwise the target
+		// could never drop to zero processes.
+		unsigned int desired;
+		if (processConcurrency > 0 && predictedConcurrency >= 0.5) {
+			desired = (unsigned int) ceil(predictedConcurrency / processConcurrency);
+		} else {
+			desired = 0;
+		}
+		if (maxBound != 0) {
+			desired = std::min(desired, maxBound);
+		}
+		desired = std::max(desired, minBound);
+
+		unsigned int oldTarget = target;
+		if (desired > target) {
+			target = desired;
+			surplusEvaluations = 0;
+			return recordDecision(now, AD_SCALE_UP, oldTarget);
+		} else if (maxBound != 0 && target > maxBound) {
+			target = std::max(maxBound, minBound);
+			surplusEvaluations = 0;
+			return recordDecision(now, AD_SCALE_DOWN, oldTarget);
+		} else if (desired < target) {
+			surplusEvaluations++;
+			if (surplusEvaluations >= config.scaleDownDelay) {
+				target--;
+				return recordDecision(now, AD_SCALE_DOWN, oldTarget);
+			} else {
+				return AD_NONE;
+			}
+		} else {
+			surplusEvaluations = 0;
+			return AD_NONE;
+		}
+	}
+
+	unsigned long long getLastEvaluatedAt() const {
+		return lastEvaluatedAt;
+	}
+
+	unsigned int getTarget() const {
+		return target;
+	}
+
+	double getPredictedConcurrency() const {
+		return predictedConcurrency;
+	}
+
+	static const char *decisionToString(Decision decision) {
+		switch (decision) {
+		case AD_NONE:
+			return "none";
+		case AD_SCALE_UP:
+			return "scale_up";
+		case AD_SCALE_DOWN:
+			return "scale_down";
+		default:
+			return "unknown";
+		}
+	}
+
+	void inspectXml(ostream &stream) const {
+		deque<DecisionRecord>::const_iterator it, end = decisions.end();
+
+		stream << "<autoscaler>";
+		stream << "<target>" << target << "</target>";
+		stream << "<last_evaluated_at>" << lastEvaluatedAt << "</last_evaluated_at>";
+		if (concurrencyAverage.available()) {
+			stream << "<concurrency_average>" << concurrencyAverage.average() << "</concurrency_average>";
+			stream << "<concurrency_stddev>" << getConcurrencyStddev() << "</concurrency_stddev>";
+		}
+		if (arrivalRateAverage.available()) {
+			stream << "<arrival_rate>" << arrivalRate << "</arrival_rate>";
+			stream << "<arrival_rate_average>" << arrivalRateAverage.average() << "</arrival_rate_average>";
+		}
+		stream << "<predicted_concurrency>" << predictedConcurrency << "</predicted_concurrency>";
+		if (processConcurrency > 0) {
+			stream << "<process_concurrency>" << processConcurrency << "</process_concurrency>";
+		} else {
+			stream << "<process_concurrency>unlimited</process_concurrency>";
+		}
+		stream << "<decisions>";
+		for (it = decisions.begin(); it != end; it++) {
+			stream << "<decision>";
+			stream << "<time>" << it->time << "</time>";
+			stream << "<action>" << decisionToString(it->decision) << "</action>";
+			stream << "<old_target>" << it->oldTarget << "</old_target>";
+			stream << "<new_target>" << it->newTarget << "</new_target>";
+			stream << "<predicted_concurrency>" << it->predictedConcurrency << "</predicted_concurrency>";
+			stream << "</decision>";
+		}
+		stream << "</decisions>";
+		stream << "</autoscaler>";
+	}
+};
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_AUTOSCALER_H_ */
@@ -0,0 +1,176 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2014-2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_CAPACITY_SCHEDULER_H_
+#define _PASSENGER_APPLICATION_POOL2_CAPACITY_SCHEDULER_H_
+
+#include <vector>
+#include <algorithm>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+/**
+ * How long (usec) a group waits before looking for capacity to take from
+ * other groups again, after an attempt that found none.
+ */
+static const unsigned long long CAPACITY_REBALANCE_RETRY_INTERVAL = 1000000ULL;
+
+struct CapacitySchedulerConfig {
+	/**
+	 * Anti-thrashing hysteresis, in microseconds. When the pool is full, a
+	 * group may take capacity away from another group that uses more than
+	 * its share, but only from processes that are at least this old, and
+	 * only if it has not itself lost a process in this way during this
+	 * period. 0 disables rebalancing between groups that already have
+	 * processes; groups without processes can always claim one.
+	 */
+	unsigned long long rebalanceHysteresis;
+
+	CapacitySchedulerConfig()
+		: rebalanceHysteresis(30 * 1000000ULL)
+		{ }
+};
+
+/**
+ * A group's claim on the pool's capacity, as input to and output of
+ * `computeCapacityShares()`. All amounts are numbers of processes.
+ */
+struct CapacityClaim {
+	/** Relative weight, like cgroup CPU shares. Treated as 1 if 0. */
+	unsigned int weight;
+	/** The number of processes that the group is guaranteed to get if it
+	 * wants them, regardless of weights. */
+	unsigned int reservation;
+	/** The maximum number of processes, or 0 for no limit. */
+	unsigned int limit;
+	/** The number of processes that the group currently needs. */
+	unsigned int demand;
+
+	/** Output: the number of processes that the group is entitled to. */
+	unsigned int share;
+
+	CapacityClaim()
+		: weight(1),
+		  reservation(0),
+		  limit(0),
+		  demand(0),
+		  share(0)
+		{ }
+};
+
+/**
+ * Raises the shares of the given claims towards the given targets, dividing
+ * `remaining` in proportion to the claims' weights. Claims that reach their
+ * target stop taking part, so their unused portion goes to the others.
+ */
+inline void
+_fillCapacityShares(vector<CapacityClaim> &claims, const vector<unsigned int> &targets,
+	unsigned int &remaining)
+{
+	while (remaining > 0) {
+		unsigned long long totalWeight = 0;
+		unsigned int i, granted = 0;
+
+		for (i = 0; i < claims.size(); i++) {
+			if (claims[i].share < targets[i]) {
+				totalWeight += std::max(claims[i].weight, 1u);
+			}
+		}
+		if (totalWeight == 0) {
+			return;
+		}
+
+		unsigned int available = remaining;
+		for (i = 0; i < claims.size(); i++) {
+			CapacityClaim &claim = claims[i];
+			if (claim.share < targets[i]) {
+				unsigned int quota = (unsigned int) (available
+					* (unsigned long long) std::max(claim.weight, 1u) / totalWeight);
+				unsigned int grant = std::min(quota, targets[i] - claim.share);
+				claim.share += grant;
+				granted += grant;
+			}
+		}
+		remaining -= granted;
+
+		if (granted == 0) {
+			// Less than one process per claim is left. Hand out the
+			// rest one by one, to whoever has the least per unit of
+			// weight.
+			int best = -1;
+			for (i = 0; i < claims.size(); i++) {
+				if (claims[i].share < targets[i]
+				 && (best == -1
+				     || (unsigned long long) claims[i].share * std::max(claims[best].weight, 1u)
+				        < (unsigned long long) claims[best].share * std::max(claims[i].weight, 1u)))
+				{
+					best = i;
+				}
+			}
+			claims[best].share++;
+			remaining--;
+		}
+	}
+}
+
+/**
+ * Divides `capacity` processes over the given claims using weighted max-min
+ * fairness. First every claim gets its reservation (or as much of it as it
+ * needs), then the rest is divided by weight among the claims that need
+ * more. No claim gets more than its demand or limit, so the shares may add
+ * up to less than `capacity`. If the reservations add up to more than
+ * `capacity`, they are themselves divided by weight.
+ */
+inline void
+computeCapacityShares(vector<CapacityClaim> &claims, unsigned int capacity) {
+	vector<unsigned int> reserved, wanted;
+	unsigned int remaining = capacity;
+
+	reserved.reserve(claims.size());
+	wanted.reserve(claims.size());
+	for (unsigned int i = 0; i < claims.size(); i++) {
+		CapacityClaim &claim = claims[i];
+		unsigned int want = std::max(claim.demand, claim.reservation);
+		if (claim.limit > 0) {
+			want = std::min(want, claim.limit);
+		}
+		claim.share = 0;
+		wanted.push_back(want);
+		reserved.push_back(std::min(claim.reservation, want));
+	}
+
+	_fillCapacityShares(claims, reserved, remaining);
+	_fillCapacityShares(claims, wanted, remaining);
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_CAPACITY_SCHEDULER_H_ */
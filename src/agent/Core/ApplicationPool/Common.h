@@ -28,6 +28,7 @@
 
 #include <boost/thread.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/intrusive_ptr.hpp>
 #include <boost/function.hpp>
 #include <oxt/tracable_exception.hpp>
@@ -183,15 +184,52 @@ struct GetCallback {
 	}
 };
 
+/**
+ * A queued get() action. If the Options were marked as `ownedByCaller` then
+ * the waiter merely references them, otherwise it holds a persistent copy.
+ * Either way, copying a GetWaiter is cheap, which matters because the wait
+ * lists shuffle waiters around while holding the pool lock.
+ */
 struct GetWaiter {
-	Options options;
+	const Options *options;
+	boost::shared_ptr<Options> persistedOptions;
 	GetCallback callback;
-
-	GetWaiter(const Options &o, const GetCallback &cb)
-		: options(o),
-		  callback(cb)
+	/** Time (usec) at which this get action was queued. */
+	unsigned long long queuedAt;
+	/** Time (usec) after which this get action is aborted, or 0 if never. */
+	unsigned long long deadline;
+	/** Position in the group's weighted fair queue. See Group::enqueueGetWaiter(). */
+	unsigned long long fairQueueTag;
+	/** The sticky session ID to route to, or 0. See Pool::asyncGet(). */
+	unsigned int stickySessionId;
+	RequestPriority priority;
+
+	GetWaiter(const Options &o, const GetCallback &cb, unsigned long long now,
+		unsigned int _stickySessionId = 0)
+		: callback(cb),
+		  queuedAt(now),
+		  deadline(0),
+		  fairQueueTag(0),
+		  stickySessionId(_stickySessionId != 0 ? _stickySessionId : o.stickySessionId),
+		  priority(o.requestPriority)
 	{
-		options.persist(o);
+		if (o.ownedByCaller) {
+			options = &o;
+		} else {
+			persistedOptions = boost::make_shared<Options>(o.copyAndPersist());
+			options = persistedOptions.get();
+		}
+		if (o.maxRequestQueueTime > 0) {
+			deadline = now + o.maxRequestQueueTime * 1000000ull;
+		}
+	}
+
+	bool expired(unsigned long long now) const {
+		return deadline != 0 && now >= deadline;
+	}
+
+	bool matches(const GetCallback &cb) const {
+		return callback.func == cb.func && callback.userData == cb.userData;
 	}
 };
 
@@ -30,6 +30,7 @@
 #include <boost/thread.hpp>
 #include <boost/pool/object_pool.hpp>
 #include <Exceptions.h>
+#include <SystemTools/CpuTopology.h>
 #include <Core/SpawningKit/Factory.h>
 
 namespace Passenger {
@@ -66,6 +67,11 @@ public:
 
 	SpawningKit::FactoryPtr spawningKitFactory;
 	Json::Value agentConfig;
+	/**
+	 * Set when NUMA-aware placement is enabled. Groups then spread their
+	 * processes over the nodes in this topology.
+	 */
+	CpuTopologyPtr cpuTopology;
 
 
 	Context()
@@ -46,6 +46,7 @@
 #include <cstdlib>
 #include <cassert>
 #include <MemoryKit/palloc.h>
+#include <DataStructures/HashMap.h>
 #include <WrapperRegistry/Registry.h>
 #include <Hooks.h>
 #include <Utils.h>
@@ -54,6 +55,8 @@
 #include <Core/ApplicationPool/BasicGroupInfo.h>
 #include <Core/ApplicationPool/Process.h>
 #include <Core/ApplicationPool/Options.h>
+#include <Core/ApplicationPool/Autoscaler.h>
+#include <Core/ApplicationPool/CapacityScheduler.h>
 #include <Core/SpawningKit/Factory.h>
 #include <Core/SpawningKit/Result.h>
 #include <Core/SpawningKit/UserSwitchingRules.h>
@@ -79,6 +82,7 @@ public:
 	struct GetAction {
 		GetCallback callback;
 		SessionPtr session;
+		ExceptionPtr exception;
 	};
 
 	struct DisableWaiter {
@@ -118,6 +122,20 @@ public:
 		SHUT_DOWN
 	};
 
+	/**
+	 * Inspection output that only depends on the group's options. It is
+	 * computed once per options change instead of on every inspection,
+	 * because it involves looking up the user and group databases.
+	 */
+	struct InspectionCache {
+		SpawningKit::UserSwitchingInfo usInfo;
+		string optionsXml;
+		Json::Value adminPanelProperties;
+		Json::Value adminPanelConfig;
+	};
+
+	typedef boost::shared_ptr<const InspectionCache> InspectionCachePtr;
+
 	BasicGroupInfo info;
 
 	/**
@@ -176,6 +194,10 @@ public:
 	 */
 	bool m_restarting: 1;
 	bool alwaysRestartFileExists: 1;
+	/** Whether capacityDeniedSpawns has been incremented since this group last
+	 * started spawning a process. See capacityDenied().
+	 */
+	bool m_capacityDenied: 1;
 
 	/** Contains the spawn loop thread and the restarter thread. */
 	dynamic_thread_group interruptableThreads;
@@ -191,6 +213,8 @@ public:
 	boost::condition_variable detachedProcessesCheckerCond;
 	Callback shutdownCallback;
 	GroupPtr selfPointer;
+	/** Lazily created by `getInspectionCache()`, reset when the options change. */
+	mutable InspectionCachePtr inspectionCache;
 
 
 	/****** Initialization and shutdown ******/
@@ -203,7 +227,7 @@ public:
 
 	/****** Session management ******/
 
-	RouteResult route(const Options &options) const;
+	RouteResult route(const Options &options, unsigned int stickySessionId) const;
 	SessionPtr newSession(Process *process, unsigned long long now = 0);
 	static void _onSessionInitiateFailure(Session *session);
 	static void _onSessionClose(Session *session);
@@ -224,16 +248,23 @@ public:
 
 	Process *findProcessWithStickySessionId(unsigned int id) const;
 	Process *findProcessWithStickySessionIdOrLowestBusyness(unsigned int id) const;
+	Process *findProcessOnStickySessionRing(unsigned int id) const;
 	Process *findProcessWithLowestBusyness(const ProcessList &processes) const;
 	Process *findEnabledProcessWithLowestBusyness() const;
+	Process *findEnabledProcessOnNumaNodeWithLowestBusyness(int numaNode) const;
+	int pickNumaNodeForSpawn() const;
 
 	void addProcessToList(const ProcessPtr &process, ProcessList &destination);
 	void removeProcessFromList(const ProcessPtr &process, ProcessList &source);
+	void rebuildStickySessionRing();
 	void removeFromDisableWaitlist(const ProcessPtr &p, DisableResult result,
 		boost::container::vector<Callback> &postLockActions);
 	void clearDisableWaitlist(DisableResult result,
 		boost::container::vector<Callback> &postLockActions);
 	void enableAllDisablingProcesses(boost::container::vector<Callback> &postLockActions);
+	void lockAndFinishRecycling(const ProcessPtr &process, DisableResult result, GroupPtr self);
+	void finishRecycling(const ProcessPtr &process,
+		boost::container::vector<Callback> &postLockActions);
 
 	void startCheckingDetachedProcesses(bool immediately);
 	void detachedProcessesCheckerMain(GroupPtr self);
@@ -262,21 +293,41 @@ public:
 	void runDetachHooks(const ProcessPtr process) const;
 	void setupAttachOrDetachHook(const ProcessPtr process, HookScriptOptions &options) const;
 
+	static boost::uint32_t stickySessionRingPosition(unsigned int id, unsigned int replica);
+	bool stickySessionIdInUse(unsigned int id) const;
 	unsigned int generateStickySessionId();
+	void vacateStickySessionId(const Process *process);
 	ProcessPtr createNullProcessObject();
 	ProcessPtr createProcessObject(const SpawningKit::Spawner &spawner, const SpawningKit::Result &spawnResult);
 	bool poolAtFullCapacity() const;
 	ProcessPtr poolForceFreeCapacity(const Group *exclude, boost::container::vector<Callback> &postLockActions);
+	ProcessPtr poolRebalanceCapacity(boost::container::vector<Callback> &postLockActions);
+	void capacityDenied();
 	void wakeUpGarbageCollector();
 	bool anotherGroupIsWaitingForCapacity() const;
 	Group *findOtherGroupWaitingForCapacity() const;
 	bool pushGetWaiter(const Options &newOptions, const GetCallback &callback,
+		unsigned long long now, unsigned int stickySessionId,
+		boost::container::vector<Callback> &postLockActions);
+	void enqueueGetWaiter(const GetWaiter &waiter);
+	void removeGetWaiter(unsigned int index);
+	bool displaceLowerPriorityGetWaiter(RequestPriority priority,
 		boost::container::vector<Callback> &postLockActions);
+	void markGetWaiterDispatched(const GetWaiter &waiter);
+	unsigned int abortExpiredGetWaiters(unsigned long long now,
+		boost::container::vector<Callback> &postLockActions, bool headOnly = false);
+	bool cancelGetWaiter(const GetCallback &callback);
 	template<typename Lock> void assignSessionsToGetWaitersQuickly(Lock &lock);
 	void assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions);
 	bool testOverflowRequestQueue() const;
 	void callAbortLongRunningConnectionsCallback(const ProcessPtr &process);
 
+	/****** State inspection ******/
+
+	void createAdminPanelProperties(const SpawningKit::UserSwitchingInfo &usInfo,
+		Json::Value &result) const;
+	void createAdminPanelConfig(Json::Value &result) const;
+
 	/****** Correctness verification ******/
 
 	bool selfCheckingEnabled() const;
@@ -368,6 +419,41 @@ public:
 	 * when there are a large number of processes.
 	 */
 	boost::container::vector<int> enabledProcessBusynessLevels;
+	/**
+	 * Maps the sticky session IDs of enabled processes to those processes,
+	 * so that sticky requests are routed without scanning `enabledProcesses`.
+	 *
+	 * Invariant:
+	 *    stickySessionIndex.size() == enabledCount
+	 *    for all process in enabledProcesses:
+	 *       stickySessionIndex[process->getStickySessionId()] == process
+	 */
+	HashMap<unsigned int, Process *> stickySessionIndex;
+	/**
+	 * The consistent hashing ring of enabled processes, sorted by position.
+	 * Every enabled process occupies `STICKY_SESSION_RING_REPLICAS` positions,
+	 * which are derived from its sticky session ID. Only maintained when
+	 * `options.stickySessionsConsistentHashing` is set.
+	 *
+	 * Invariant:
+	 *    if options.stickySessionsConsistentHashing:
+	 *       stickySessionRing.size() == enabledCount * STICKY_SESSION_RING_REPLICAS
+	 */
+	boost::container::vector< pair<boost::uint32_t, Process *> > stickySessionRing;
+	/**
+	 * Sticky session IDs of processes that have been detached while consistent
+	 * hashing is enabled, oldest first. Newly attached processes take over these
+	 * IDs, and with them the ring positions and users of the processes they
+	 * replace. Bounded by the pool's capacity.
+	 */
+	deque<unsigned int> vacatedStickySessionIds;
+	static const unsigned int STICKY_SESSION_RING_REPLICAS = 32;
+	/**
+	 * A process on the NUMA node of the requesting thread is preferred over
+	 * the least busy process, as long as it has at most this many more
+	 * sessions than that process would have at the same busyness.
+	 */
+	static const int NUMA_ROUTING_SESSION_MARGIN = 1;
 
 	/**
 	 * get() requests for this group that cannot be immediately satisfied are
@@ -382,7 +468,7 @@ public:
 	 *    if getWaitlist is non-empty:
 	 *       enabledProcesses.empty() || (no request in getWaitlist is routeable)
 	 *
-	 * Here, "routeable" is defined as `route(options).process != NULL`.
+	 * Here, "routeable" is defined as `route(options, stickySessionId).process != NULL`.
 	 *
 	 * ### Invariant 2 (progress)
 	 *
@@ -401,6 +487,20 @@ public:
 	 *       !enabledProcesses.empty() || m_spawning || restarting() || poolAtFullCapacity()
 	 */
 	deque<GetWaiter> getWaitlist;
+	/**
+	 * Weighted fair queueing state for `getWaitlist`. `fairQueueVirtualTime`
+	 * is the tag of the most recently dispatched waiter, and
+	 * `fairQueueFinishTags` contains, for each request priority class, the
+	 * tag that the previously queued waiter of that class finishes at.
+	 * See enqueueGetWaiter().
+	 */
+	unsigned long long fairQueueVirtualTime;
+	unsigned long long fairQueueFinishTags[RP_COUNT];
+	/**
+	 * The number of waiters of each request priority class in `getWaitlist`.
+	 * Only meaningful while `getWaitlist` is non-empty; see getWaitlistSize().
+	 */
+	unsigned int getWaitlistClassSizes[RP_COUNT];
 	/**
 	 * Disable() commands that couldn't finish immediately will put their callbacks
 	 * in this queue. Note that there may be multiple DisableWaiters pointing to the
@@ -410,6 +510,43 @@ public:
 	 *    disableWaitlist.size() >= disablingCount
 	 */
 	deque<DisableWaiter> disableWaitlist;
+	/**
+	 * Predicts how many processes this group needs. Only evaluated by the
+	 * pool's garbage collector when autoscaling is enabled; otherwise its
+	 * target stays 0. See getProcessLowerLimit().
+	 */
+	Autoscaler autoscaler;
+	/**
+	 * The number of processes that have been replaced because they
+	 * exceeded `options.memoryLimit`. See recycle().
+	 */
+	unsigned int memoryRecycles;
+	/**
+	 * The memory limit (in MB) for which it has been logged that processes
+	 * already exceed it when they start, or 0. See Pool::enforceMemoryLimits().
+	 */
+	unsigned int memoryLimitExceededAtStartLogged;
+	/**
+	 * The number of times that this group wanted to spawn a process for a
+	 * request while the pool was full, but was not given the capacity.
+	 * Requests that keep arriving while the group is still waiting for
+	 * capacity are not counted separately; see capacityDenied().
+	 */
+	unsigned int capacityDeniedSpawns;
+	/**
+	 * The number of processes that were shut down to give their capacity
+	 * to other groups, and the time (usec) at which that last happened.
+	 * See Pool::forceFreeCapacity() and Pool::rebalanceCapacity().
+	 */
+	unsigned int capacityEvictions;
+	unsigned long long lastCapacityEvictionTime;
+	/**
+	 * The time (usec) at which this group last took capacity from another
+	 * group, and the time at which it last looked for capacity to take.
+	 * See Pool::rebalanceCapacity().
+	 */
+	unsigned long long lastCapacityRebalanceTime;
+	unsigned long long lastCapacityRebalanceAttemptTime;
 
 	/**
 	 * Invariant:
@@ -444,13 +581,14 @@ public:
 	/****** Session management ******/
 
 	SessionPtr get(const Options &newOptions, const GetCallback &callback,
-		boost::container::vector<Callback> &postLockActions);
+		boost::container::vector<Callback> &postLockActions, unsigned long long now = 0,
+		unsigned int stickySessionId = 0);
 
 	/****** Spawning and restarting ******/
 
 	void restart(const Options &options, RestartMethod method = RM_DEFAULT);
 	bool restarting() const;
-	bool needsRestart(const Options &options);
+	bool needsRestart(unsigned long long now);
 
 	SpawnResult spawn();
 	bool spawning() const;
@@ -469,22 +607,72 @@ public:
 	void enable(const ProcessPtr &process,
 		boost::container::vector<Callback> &postLockActions);
 	DisableResult disable(const ProcessPtr &process, const DisableCallback &callback);
+	bool recycle(const ProcessPtr &process,
+		boost::container::vector<Callback> &postLockActions);
 
 	/****** State inspection ******/
 
 	unsigned int getProcessCount() const;
+	unsigned int getProcessLowerLimit() const;
 	bool processLowerLimitsSatisfied() const;
 	bool processUpperLimitsReached() const;
 	bool allEnabledProcessesAreTotallyBusy() const;
 
 	unsigned int capacityUsed() const;
+	unsigned int getCapacityDemand() const;
+	CapacityClaim getCapacityClaim() const;
+	bool shouldRebalanceCapacityForGetAction() const;
+	unsigned int getWaitlistSize(RequestPriority priority) const;
 	bool isWaitingForCapacity() const;
 	bool garbageCollectable(unsigned long long now = 0) const;
 
+	const InspectionCachePtr &getInspectionCache() const;
 	void inspectXml(std::ostream &stream, bool includeSecrets = true) const;
 	void inspectPropertiesInAdminPanelFormat(Json::Value &result) const;
 	void inspectConfigInAdminPanelFormat(Json::Value &result) const;
 
+	/**
+	 * A plain copy of the group state that the pool's inspection functions
+	 * report. Taking a snapshot requires the pool lock, but rendering it
+	 * does not.
+	 */
+	struct Snapshot {
+		string name;
+		ApiKey apiKey;
+		string appRoot;
+		string appType;
+		string environment;
+		string uuid;
+		int enabledCount;
+		int disablingCount;
+		int disabledCount;
+		unsigned int processCount;
+		unsigned int capacityUsed;
+		unsigned int getWaitlistSize;
+		unsigned int getWaitlistSizeByPriority[RP_COUNT];
+		unsigned int disableWaitlistSize;
+		short processesBeingSpawned;
+		bool spawning;
+		bool restarting;
+		LifeStatus lifeStatus;
+		string autoscalerXml;
+		unsigned int memoryRecycles;
+		unsigned int capacityWeight;
+		unsigned int capacityDemand;
+		/** Set by Pool::createStateSnapshotUnlocked(). */
+		unsigned int capacityShare;
+		unsigned int capacityDeniedSpawns;
+		unsigned int capacityEvictions;
+		InspectionCachePtr inspectionCache;
+		/** Enabled, disabling, disabled and detached processes, in that order. */
+		vector<Process::Snapshot> processes;
+
+		Snapshot(const Group &group);
+		bool authorizeByUid(uid_t uid) const;
+		bool authorizeByApiKey(const ApiKey &key) const;
+		void inspectXml(std::ostream &stream, bool includeSecrets = true) const;
+	};
+
 	/****** Out-of-band work ******/
 
 	void requestOOBW(const ProcessPtr &process);
@@ -85,6 +85,7 @@ Group::finishShutdown(boost::container::vector<Callback> &postLockActions) {
 	postLockActions.push_back(boost::bind(interruptAndJoinAllThreads,
 		shared_from_this()));
 	this->lifeStatus.store(SHUT_DOWN, boost::memory_order_seq_cst);
+	pool->structureChanged();
 	selfPointer.reset();
 }
 
@@ -109,11 +110,24 @@ Group::Group(Pool *_pool, const Options &_options)
 	disablingCount = 0;
 	disabledCount  = 0;
 	nEnabledProcessesTotallyBusy = 0;
+	fairQueueVirtualTime = 0;
+	for (unsigned int i = 0; i < RP_COUNT; i++) {
+		fairQueueFinishTags[i] = 0;
+		getWaitlistClassSizes[i] = 0;
+	}
 	spawner        = getContext()->spawningKitFactory->create(options);
 	restartsInitiated = 0;
 	processesBeingSpawned = 0;
+	memoryRecycles = 0;
+	memoryLimitExceededAtStartLogged = 0;
+	capacityDeniedSpawns = 0;
+	capacityEvictions = 0;
+	lastCapacityEvictionTime = 0;
+	lastCapacityRebalanceTime = 0;
+	lastCapacityRebalanceAttemptTime = 0;
 	m_spawning     = false;
 	m_restarting   = false;
+	m_capacityDenied = false;
 	lifeStatus.store(ALIVE, boost::memory_order_relaxed);
 	lastRestartFileMtime = 0;
 	lastRestartFileCheckTime = 0;
@@ -174,6 +188,7 @@ Group::shutdown(const Callback &callback,
 	selfPointer = shared_from_this();
 	assert(disableWaitlist.empty());
 	lifeStatus.store(SHUTTING_DOWN, boost::memory_order_seq_cst);
+	pool->structureChanged();
 }
 
 
@@ -23,7 +23,9 @@
  *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  *  THE SOFTWARE.
  */
+#include <algorithm>
 #include <Core/ApplicationPool/Group.h>
+#include <Algorithms/Hasher.h>
 
 /*************************************************************************
  *
@@ -77,6 +79,10 @@ Group::resetOptions(const Options &newOptions, Options *destination) {
 	destination->clearPerRequestFields();
 	destination->apiKey    = getApiKey().toStaticString();
 	destination->groupUuid = uuid;
+	if (destination == &this->options) {
+		inspectionCache.reset();
+		rebuildStickySessionRing();
+	}
 }
 
 /**
@@ -84,10 +90,24 @@ Group::resetOptions(const Options &newOptions, Options *destination) {
  */
 void
 Group::mergeOptions(const Options &other) {
+	if (options.maxRequests != other.maxRequests
+	 || options.minProcesses != other.minProcesses
+	 || options.statThrottleRate != other.statThrottleRate
+	 || options.maxPreloaderIdleTime != other.maxPreloaderIdleTime
+	 || options.memoryLimit != other.memoryLimit
+	 || options.capacityWeight != other.capacityWeight
+	 || options.capacityReservation != other.capacityReservation)
+	{
+		inspectionCache.reset();
+		pool->structureChanged();
+	}
 	options.maxRequests      = other.maxRequests;
 	options.minProcesses     = other.minProcesses;
 	options.statThrottleRate = other.statThrottleRate;
 	options.maxPreloaderIdleTime = other.maxPreloaderIdleTime;
+	options.memoryLimit      = other.memoryLimit;
+	options.capacityWeight   = other.capacityWeight;
+	options.capacityReservation = other.capacityReservation;
 }
 
 /* Given a hook name like "queue_full_error", we return HookScriptOptions filled in with this name and a spec
@@ -130,13 +150,54 @@ Group::setupAttachOrDetachHook(const ProcessPtr process, HookScriptOptions &opti
 	options.environment.push_back(make_pair("PASSENGER_APP_ROOT", this->options.appRoot));
 }
 
+boost::uint32_t
+Group::stickySessionRingPosition(unsigned int id, unsigned int replica) {
+	Hasher hasher;
+	hasher.update((const char *) &id, sizeof(id));
+	hasher.update((const char *) &replica, sizeof(replica));
+	return hasher.finalize();
+}
+
+bool
+Group::stickySessionIdInUse(unsigned int id) const {
+	if (findProcessWithStickySessionId(id) != NULL) {
+		return true;
+	}
+	foreach (const ProcessPtr &process, disablingProcesses) {
+		if (process->getStickySessionId() == id) {
+			return true;
+		}
+	}
+	foreach (const ProcessPtr &process, disabledProcesses) {
+		if (process->getStickySessionId() == id) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * In consistent hashing mode, new processes take over the sticky session IDs
+ * of previously detached processes first, so that their users keep being
+ * routed to the same place in the ring.
+ */
 unsigned int
 Group::generateStickySessionId() {
 	unsigned int result;
 
+	if (options.stickySessionsConsistentHashing) {
+		while (!vacatedStickySessionIds.empty()) {
+			result = vacatedStickySessionIds.front();
+			vacatedStickySessionIds.pop_front();
+			if (!stickySessionIdInUse(result)) {
+				return result;
+			}
+		}
+	}
+
 	while (true) {
 		result = (unsigned int) rand();
-		if (result != 0 && findProcessWithStickySessionId(result) == NULL) {
+		if (result != 0 && !stickySessionIdInUse(result)) {
 			return result;
 		}
 	}
@@ -144,6 +205,16 @@ Group::generateStickySessionId() {
 	return 0;
 }
 
+void
+Group::vacateStickySessionId(const Process *process) {
+	if (options.stickySessionsConsistentHashing) {
+		vacatedStickySessionIds.push_back(process->getStickySessionId());
+		while (vacatedStickySessionIds.size() > std::max(getPool()->max, 1u)) {
+			vacatedStickySessionIds.pop_front();
+		}
+	}
+}
+
 ProcessPtr
 Group::createNullProcessObject() {
 	struct Guard {
@@ -232,6 +303,26 @@ Group::poolForceFreeCapacity(const Group *exclude,
 	return getPool()->forceFreeCapacity(exclude, postLockActions);
 }
 
+ProcessPtr
+Group::poolRebalanceCapacity(boost::container::vector<Callback> &postLockActions) {
+	return getPool()->rebalanceCapacity(this, postLockActions);
+}
+
+/**
+ * Called when this group wanted to spawn a process for a request but the
+ * pool did not give it the capacity. Every request that arrives until the
+ * group manages to spawn again runs into the same denial, so only the first
+ * one is counted in `capacityDeniedSpawns`.
+ */
+void
+Group::capacityDenied() {
+	if (!m_capacityDenied) {
+		m_capacityDenied = true;
+		capacityDeniedSpawns++;
+		getPool()->structureChanged();
+	}
+}
+
 void
 Group::wakeUpGarbageCollector() {
 	getPool()->garbageCollectionCond.notify_all();
@@ -262,15 +353,32 @@ Group::findOtherGroupWaitingForCapacity() const {
 
 bool
 Group::pushGetWaiter(const Options &newOptions, const GetCallback &callback,
+	unsigned long long now, unsigned int stickySessionId,
 	boost::container::vector<Callback> &postLockActions)
 {
+	if (now == 0) {
+		now = SystemTime::getUsec();
+	}
+
+	if (newOptions.maxRequestQueueTime > 0 && !getWaitlist.empty()) {
+		// Shed requests that have been waiting for too long before deciding
+		// whether there is room for this one, so that a backlog of stale
+		// requests doesn't cause fresh requests to be rejected.
+		abortExpiredGetWaiters(now, postLockActions, true);
+	}
+
+	// The queue size limit is shared by all priority classes. When the queue
+	// is full, a request may still take the place of a lower priority one.
 	if (OXT_LIKELY(!testOverflowRequestQueue()
 		&& (newOptions.maxRequestQueueSize == 0
-		    || getWaitlist.size() < newOptions.maxRequestQueueSize)))
+		    || getWaitlist.size() < newOptions.maxRequestQueueSize
+		    || displaceLowerPriorityGetWaiter(newOptions.requestPriority, postLockActions))))
 	{
-		getWaitlist.push_back(GetWaiter(
-			newOptions.copyAndPersist(),
-			callback));
+		GetWaiter waiter(newOptions, callback, now, stickySessionId);
+		enqueueGetWaiter(waiter);
+		if (waiter.deadline != 0) {
+			getPool()->scheduleGarbageCollectionBefore(waiter.deadline);
+		}
 		return true;
 	} else {
 		postLockActions.push_back(boost::bind(GetCallback::call,
@@ -286,6 +394,166 @@ Group::pushGetWaiter(const Options &newOptions, const GetCallback &callback,
 	}
 }
 
+/**
+ * Inserts a waiter into the getWaitlist according to start-time fair queueing.
+ * Each priority class has a weight; a waiter is tagged with the time at which
+ * it would start being served if every class with waiters got service in
+ * proportion to its weight, and the getWaitlist is kept sorted by that tag.
+ * The dispatching code can therefore keep processing the getWaitlist from
+ * front to back. When only one class has waiters this degenerates to FIFO.
+ */
+void
+Group::enqueueGetWaiter(const GetWaiter &waiter) {
+	// Costs are inversely proportional to the weights 4 (high), 2 (normal) and 1 (low).
+	static const unsigned int costs[RP_COUNT] = { 1, 2, 4 };
+	RequestPriority priority = waiter.priority;
+
+	getPool()->structureChanged();
+	if (getWaitlist.empty()) {
+		// Don't let a class be penalized for service that it received
+		// during a previous busy period.
+		fairQueueVirtualTime = 0;
+		for (unsigned int i = 0; i < RP_COUNT; i++) {
+			fairQueueFinishTags[i] = 0;
+			getWaitlistClassSizes[i] = 0;
+		}
+	}
+
+	unsigned long long tag = std::max(fairQueueVirtualTime, fairQueueFinishTags[priority]);
+	fairQueueFinishTags[priority] = tag + costs[priority];
+	getWaitlistClassSizes[priority]++;
+
+	if (getWaitlist.empty() || getWaitlist.back().fairQueueTag <= tag) {
+		getWaitlist.push_back(waiter);
+		getWaitlist.back().fairQueueTag = tag;
+	} else {
+		deque<GetWaiter>::iterator it = getWaitlist.end();
+		while (it != getWaitlist.begin() && (it - 1)->fairQueueTag > tag) {
+			it--;
+		}
+		it = getWaitlist.insert(it, waiter);
+		it->fairQueueTag = tag;
+	}
+}
+
+/**
+ * Removes the waiter at the given position from the getWaitlist, without
+ * calling its callback.
+ */
+void
+Group::removeGetWaiter(unsigned int index) {
+	assert(getWaitlistClassSizes[getWaitlist[index].priority] > 0);
+	getWaitlistClassSizes[getWaitlist[index].priority]--;
+	getWaitlist.erase(getWaitlist.begin() + index);
+	getPool()->structureChanged();
+}
+
+/**
+ * Called when the getWaitlist is full. If it contains a waiter of a lower
+ * priority class than `priority`, then the most recently queued waiter of
+ * the lowest such class is rejected with a RequestQueueFullException to make
+ * room. Returns whether a waiter was rejected.
+ */
+bool
+Group::displaceLowerPriorityGetWaiter(RequestPriority priority,
+	boost::container::vector<Callback> &postLockActions)
+{
+	int victimPriority = RP_COUNT - 1;
+	while (victimPriority > (int) priority && getWaitlistSize((RequestPriority) victimPriority) == 0) {
+		victimPriority--;
+	}
+	if (victimPriority <= (int) priority) {
+		return false;
+	}
+
+	unsigned int i = getWaitlist.size();
+	while (getWaitlist[i - 1].priority != (RequestPriority) victimPriority) {
+		i--;
+	}
+	const GetWaiter &waiter = getWaitlist[i - 1];
+	P_DEBUG("Request queue of group " << info.name << " is full; rejecting a "
+		<< requestPriorityToString(waiter.priority) << " priority request in favor of a "
+		<< requestPriorityToString(priority) << " priority one");
+	postLockActions.push_back(boost::bind(GetCallback::call,
+		waiter.callback, SessionPtr(),
+		boost::make_shared<RequestQueueFullException>(waiter.options->maxRequestQueueSize)));
+	removeGetWaiter(i - 1);
+	return true;
+}
+
+/**
+ * Advances the weighted fair queueing virtual time. Must be called when
+ * a waiter is removed from the getWaitlist because it got a session.
+ */
+void
+Group::markGetWaiterDispatched(const GetWaiter &waiter) {
+	fairQueueVirtualTime = std::max(fairQueueVirtualTime, waiter.fairQueueTag);
+}
+
+/**
+ * Aborts get waiters whose deadline has passed with a RequestQueueTimeoutException.
+ * If `headOnly` is true then it only looks at the oldest waiters of each priority
+ * class, stopping once it has found a waiter of every class present that hasn't
+ * expired yet. Waiters of one class are queued in FIFO order, so this is cheap and
+ * good enough if all waiters have the same max queue time.
+ * Returns the number of aborted waiters.
+ */
+unsigned int
+Group::abortExpiredGetWaiters(unsigned long long now,
+	boost::container::vector<Callback> &postLockActions, bool headOnly)
+{
+	unsigned int i = 0;
+	unsigned int aborted = 0;
+	unsigned int classesLeft = 0;
+	bool classSeen[RP_COUNT];
+
+	for (unsigned int c = 0; c < RP_COUNT; c++) {
+		classSeen[c] = false;
+		if (getWaitlistSize((RequestPriority) c) > 0) {
+			classesLeft++;
+		}
+	}
+
+	while (i < getWaitlist.size()) {
+		const GetWaiter &waiter = getWaitlist[i];
+		if (waiter.expired(now)) {
+			P_DEBUG("Request waited for more than " << waiter.options->maxRequestQueueTime <<
+				" seconds in the queue of group " << info.name << "; aborting it");
+			postLockActions.push_back(boost::bind(GetCallback::call,
+				waiter.callback, SessionPtr(),
+				boost::make_shared<RequestQueueTimeoutException>(
+					waiter.options->maxRequestQueueTime)));
+			removeGetWaiter(i);
+			aborted++;
+		} else {
+			if (headOnly && !classSeen[waiter.priority]) {
+				classSeen[waiter.priority] = true;
+				if (--classesLeft == 0) {
+					break;
+				}
+			}
+			i++;
+		}
+	}
+
+	return aborted;
+}
+
+/**
+ * Removes the get waiter with the given callback from the wait list, without
+ * calling the callback. Returns whether such a waiter was found.
+ */
+bool
+Group::cancelGetWaiter(const GetCallback &callback) {
+	for (unsigned int i = 0; i < getWaitlist.size(); i++) {
+		if (getWaitlist[i].matches(callback)) {
+			removeGetWaiter(i);
+			return true;
+		}
+	}
+	return false;
+}
+
 template<typename Lock>
 void
 Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
@@ -298,17 +566,34 @@ Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
 	boost::container::small_vector<GetAction, 8> actions;
 	unsigned int i = 0;
 	bool done = false;
+	unsigned long long now = 0;
 
 	actions.reserve(getWaitlist.size());
 
 	while (!done && i < getWaitlist.size()) {
 		const GetWaiter &waiter = getWaitlist[i];
-		RouteResult result = route(waiter.options);
+		if (waiter.deadline != 0) {
+			if (now == 0) {
+				now = SystemTime::getUsec();
+			}
+			if (waiter.expired(now)) {
+				GetAction action;
+				action.callback  = waiter.callback;
+				action.exception = boost::make_shared<RequestQueueTimeoutException>(
+					waiter.options->maxRequestQueueTime);
+				removeGetWaiter(i);
+				actions.push_back(action);
+				continue;
+			}
+		}
+
+		RouteResult result = route(*waiter.options, waiter.stickySessionId);
 		if (result.process != NULL) {
 			GetAction action;
 			action.callback = waiter.callback;
 			action.session  = newSession(result.process);
-			getWaitlist.erase(getWaitlist.begin() + i);
+			markGetWaiterDispatched(waiter);
+			removeGetWaiter(i);
 			actions.push_back(action);
 		} else {
 			done = result.finished;
@@ -322,7 +607,7 @@ Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
 	lock.unlock();
 	boost::container::small_vector<GetAction, 50>::const_iterator it, end = actions.end();
 	for (it = actions.begin(); it != end; it++) {
-		it->callback(it->session, ExceptionPtr());
+		it->callback(it->session, it->exception);
 	}
 }
 
@@ -330,17 +615,35 @@ void
 Group::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions) {
 	unsigned int i = 0;
 	bool done = false;
+	unsigned long long now = 0;
 
 	while (!done && i < getWaitlist.size()) {
 		const GetWaiter &waiter = getWaitlist[i];
-		RouteResult result = route(waiter.options);
+		if (waiter.deadline != 0) {
+			if (now == 0) {
+				now = SystemTime::getUsec();
+			}
+			if (waiter.expired(now)) {
+				postLockActions.push_back(boost::bind(
+					GetCallback::call,
+					waiter.callback,
+					SessionPtr(),
+					boost::make_shared<RequestQueueTimeoutException>(
+						waiter.options->maxRequestQueueTime)));
+				removeGetWaiter(i);
+				continue;
+			}
+		}
+
+		RouteResult result = route(*waiter.options, waiter.stickySessionId);
 		if (result.process != NULL) {
 			postLockActions.push_back(boost::bind(
 				GetCallback::call,
 				waiter.callback,
 				newSession(result.process),
 				ExceptionPtr()));
-			getWaitlist.erase(getWaitlist.begin() + i);
+			markGetWaiterDispatched(waiter);
+			removeGetWaiter(i);
 		} else {
 			done = result.finished;
 			if (!result.finished) {
@@ -53,8 +53,7 @@ Group::cleanupSpawner(boost::container::vector<Callback> &postLockActions) {
 
 bool
 Group::authorizeByUid(uid_t uid) const {
-	return uid == 0 || SpawningKit::prepareUserSwitching(options,
-		getWrapperRegistry()).uid == uid;
+	return uid == 0 || getInspectionCache()->usInfo.uid == uid;
 }
 
 bool
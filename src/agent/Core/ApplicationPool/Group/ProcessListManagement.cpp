@@ -23,6 +23,7 @@
  *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  *  THE SOFTWARE.
  */
+#include <algorithm>
 #include <Core/ApplicationPool/Group.h>
 
 /*************************************************************************
@@ -47,38 +48,50 @@ using namespace boost;
 
 Process *
 Group::findProcessWithStickySessionId(unsigned int id) const {
-	ProcessList::const_iterator it, end = enabledProcesses.end();
-	for (it = enabledProcesses.begin(); it != end; it++) {
-		Process *process = it->get();
-		if (process->getStickySessionId() == id) {
-			return process;
-		}
+	HashMap<unsigned int, Process *>::const_iterator it = stickySessionIndex.find(id);
+	if (it == stickySessionIndex.end()) {
+		return NULL;
+	} else {
+		return it->second;
 	}
-	return NULL;
 }
 
+/**
+ * Routes a sticky request. If no enabled process has the given sticky session ID,
+ * then the request is routed to the least busy process, or in consistent hashing
+ * mode, to the process that owns the ID's position on the ring (unless that
+ * process cannot accept it right now).
+ */
 Process *
 Group::findProcessWithStickySessionIdOrLowestBusyness(unsigned int id) const {
-	int leastBusyProcessIndex = -1;
-	int lowestBusyness = 0;
-	unsigned int i, size = enabledProcessBusynessLevels.size();
-	const int *enabledProcessBusynessLevels = &this->enabledProcessBusynessLevels[0];
+	Process *process = findProcessWithStickySessionId(id);
+	if (process != NULL) {
+		return process;
+	}
 
-	for (i = 0; i < size; i++) {
-		Process *process = enabledProcesses[i].get();
-		if (process->getStickySessionId() == id) {
+	if (options.stickySessionsConsistentHashing) {
+		process = findProcessOnStickySessionRing(id);
+		if (process != NULL && process->canBeRoutedTo()) {
 			return process;
-		} else if (leastBusyProcessIndex == -1 || enabledProcessBusynessLevels[i] < lowestBusyness) {
-			leastBusyProcessIndex = i;
-			lowestBusyness = enabledProcessBusynessLevels[i];
 		}
 	}
+	return findEnabledProcessWithLowestBusyness();
+}
 
-	if (leastBusyProcessIndex == -1) {
+Process *
+Group::findProcessOnStickySessionRing(unsigned int id) const {
+	if (stickySessionRing.empty()) {
 		return NULL;
-	} else {
-		return enabledProcesses[leastBusyProcessIndex].get();
 	}
+
+	boost::container::vector< pair<boost::uint32_t, Process *> >::const_iterator it =
+		std::lower_bound(stickySessionRing.begin(), stickySessionRing.end(),
+			make_pair(stickySessionRingPosition(id, 0), (Process *) NULL));
+	if (it == stickySessionRing.end()) {
+		// Wrap around.
+		it = stickySessionRing.begin();
+	}
+	return it->second;
 }
 
 Process *
@@ -125,6 +138,64 @@ Group::findEnabledProcessWithLowestBusyness() const {
 	return enabledProcesses[leastBusyProcessIndex].get();
 }
 
+/**
+ * Like findEnabledProcessWithLowestBusyness(), but only considers processes
+ * on the given NUMA node. Returns NULL if there are none.
+ */
+Process *
+Group::findEnabledProcessOnNumaNodeWithLowestBusyness(int numaNode) const {
+	int leastBusyProcessIndex = -1;
+	int lowestBusyness = 0;
+	unsigned int i, size = enabledProcessBusynessLevels.size();
+
+	for (i = 0; i < size; i++) {
+		if (enabledProcesses[i]->numaNode == numaNode
+		 && (leastBusyProcessIndex == -1 || enabledProcessBusynessLevels[i] < lowestBusyness))
+		{
+			leastBusyProcessIndex = i;
+			lowestBusyness = enabledProcessBusynessLevels[i];
+		}
+	}
+	if (leastBusyProcessIndex == -1) {
+		return NULL;
+	} else {
+		return enabledProcesses[leastBusyProcessIndex].get();
+	}
+}
+
+/**
+ * Returns the NUMA node on which the next process should be spawned: the one
+ * that currently hosts the fewest of this group's processes. Returns -1 if
+ * NUMA-aware placement is disabled.
+ */
+int
+Group::pickNumaNodeForSpawn() const {
+	const CpuTopologyPtr &topology = getContext()->cpuTopology;
+	if (topology == NULL) {
+		return -1;
+	}
+
+	vector<unsigned int> counts(topology->getNodeCount(), 0);
+	const ProcessList *lists[] = { &enabledProcesses, &disablingProcesses, &disabledProcesses };
+	for (unsigned int i = 0; i < sizeof(lists) / sizeof(lists[0]); i++) {
+		ProcessList::const_iterator it, end = lists[i]->end();
+		for (it = lists[i]->begin(); it != end; it++) {
+			int numaNode = (*it)->numaNode;
+			if (numaNode >= 0 && (unsigned int) numaNode < counts.size()) {
+				counts[numaNode]++;
+			}
+		}
+	}
+
+	unsigned int best = 0;
+	for (unsigned int i = 1; i < counts.size(); i++) {
+		if (counts[i] < counts[best]) {
+			best = i;
+		}
+	}
+	return best;
+}
+
 /**
  * Adds a process to the given list (enabledProcess, disablingProcesses, disabledProcesses)
  * and sets the process->enabled flag accordingly.
@@ -133,6 +204,7 @@ Group::findEnabledProcessWithLowestBusyness() const {
  */
 void
 Group::addProcessToList(const ProcessPtr &process, ProcessList &destination) {
+	getPool()->structureChanged();
 	destination.push_back(process);
 	process->setIndex(destination.size() - 1);
 	if (&destination == &enabledProcesses) {
@@ -142,6 +214,8 @@ Group::addProcessToList(const ProcessPtr &process, ProcessList &destination) {
 		if (process->isTotallyBusy()) {
 			nEnabledProcessesTotallyBusy++;
 		}
+		stickySessionIndex[process->getStickySessionId()] = process.get();
+		rebuildStickySessionRing();
 	} else if (&destination == &disablingProcesses) {
 		process->enabled = Process::DISABLING;
 		disablingCount++;
@@ -173,6 +247,7 @@ void
 Group::removeProcessFromList(const ProcessPtr &process, ProcessList &source) {
 	ProcessPtr p = process; // Keep an extra reference count just in case.
 
+	getPool()->structureChanged();
 	source.erase(source.begin() + process->getIndex());
 	process->setIndex(-1);
 
@@ -183,6 +258,7 @@ Group::removeProcessFromList(const ProcessPtr &process, ProcessList &source) {
 		if (process->isTotallyBusy()) {
 			nEnabledProcessesTotallyBusy--;
 		}
+		stickySessionIndex.erase(process->getStickySessionId());
 		break;
 	case Process::DISABLING:
 		assert(&source == &disablingProcesses);
@@ -215,7 +291,30 @@ Group::removeProcessFromList(const ProcessPtr &process, ProcessList &source) {
 			enabledProcessBusynessLevels.push_back(process->busyness());
 		}
 		enabledProcessBusynessLevels.shrink_to_fit();
+		rebuildStickySessionRing();
+	}
+}
+
+/**
+ * Recomputes `stickySessionRing` from `enabledProcesses`. Only called when
+ * the set of enabled processes changes, which is rare compared to routing.
+ */
+void
+Group::rebuildStickySessionRing() {
+	stickySessionRing.clear();
+	if (!options.stickySessionsConsistentHashing) {
+		return;
 	}
+
+	stickySessionRing.reserve(enabledProcesses.size() * STICKY_SESSION_RING_REPLICAS);
+	foreach (const ProcessPtr &process, enabledProcesses) {
+		for (unsigned int i = 0; i < STICKY_SESSION_RING_REPLICAS; i++) {
+			stickySessionRing.push_back(make_pair(
+				stickySessionRingPosition(process->getStickySessionId(), i),
+				process.get()));
+		}
+	}
+	std::sort(stickySessionRing.begin(), stickySessionRing.end());
 }
 
 void
@@ -243,6 +342,9 @@ Group::clearDisableWaitlist(DisableResult result,
 	// This function may be called after processes in the disableWaitlist
 	// have been disabled or enabled, so do not assume any value for
 	// waiter.process->enabled in this function.
+	if (!disableWaitlist.empty()) {
+		getPool()->structureChanged();
+	}
 	postLockActions.reserve(postLockActions.size() + disableWaitlist.size());
 	while (!disableWaitlist.empty()) {
 		const DisableWaiter &waiter = disableWaitlist.front();
@@ -328,6 +430,7 @@ Group::detachedProcessesCheckerMain(GroupPtr self) {
 							" has 0 active sessions now. Triggering shutdown.");
 						process->triggerShutdown();
 						assert(process->getLifeStatus() == Process::SHUTDOWN_TRIGGERED);
+						pool->structureChanged();
 					}
 					break;
 				case Process::SHUTDOWN_TRIGGERED:
@@ -497,6 +600,7 @@ Group::detach(const ProcessPtr &process, boost::container::vector<Callback> &pos
 	}
 
 	addProcessToList(process, detachedProcesses);
+	vacateStickySessionId(process.get());
 	startCheckingDetachedProcesses(false);
 
 	postLockActions.push_back(boost::bind(&Group::runDetachHooks, this, process));
@@ -513,18 +617,23 @@ Group::detachAll(boost::container::vector<Callback> &postLockActions) {
 
 	foreach (ProcessPtr process, enabledProcesses) {
 		addProcessToList(process, detachedProcesses);
+		vacateStickySessionId(process.get());
 	}
 	foreach (ProcessPtr process, disablingProcesses) {
 		addProcessToList(process, detachedProcesses);
+		vacateStickySessionId(process.get());
 	}
 	foreach (ProcessPtr process, disabledProcesses) {
 		addProcessToList(process, detachedProcesses);
+		vacateStickySessionId(process.get());
 	}
 
 	enabledProcesses.clear();
 	disablingProcesses.clear();
 	disabledProcesses.clear();
 	enabledProcessBusynessLevels.clear();
+	stickySessionIndex.clear();
+	stickySessionRing.clear();
 	enabledCount = 0;
 	disablingCount = 0;
 	disabledCount = 0;
@@ -602,6 +711,7 @@ Group::disable(const ProcessPtr &process, const DisableCallback &callback) {
 	} else if (process->enabled == Process::DISABLING) {
 		assert(disablingCount > 0);
 		disableWaitlist.push_back(DisableWaiter(process, callback));
+		getPool()->structureChanged();
 		P_DEBUG("Disabling DISABLING process " << process->inspect() <<
 			info.name << "; command queued, deferring disable command completion");
 		return DR_DEFERRED;
@@ -613,6 +723,91 @@ Group::disable(const ProcessPtr &process, const DisableCallback &callback) {
 	}
 }
 
+/**
+ * Gracefully replaces the given process because it uses more memory than
+ * `options.memoryLimit` allows: the process is disabled so that it gets no
+ * new requests, and once its current requests are done it is detached and
+ * a new process is spawned in its place. Returns whether recycling has been
+ * initiated.
+ */
+bool
+Group::recycle(const ProcessPtr &process,
+	boost::container::vector<Callback> &postLockActions)
+{
+	assert(process->getGroup() == this);
+	assert(process->isAlive());
+	assert(isAlive());
+
+	if (process->recycling) {
+		return false;
+	}
+
+	process->recycling = true;
+	getPool()->structureChanged();
+	DisableResult result = disable(process,
+		boost::bind(&Group::lockAndFinishRecycling, this,
+			_1, _2, shared_from_this()));
+	switch (result) {
+	case DR_SUCCESS:
+		memoryRecycles++;
+		finishRecycling(process, postLockActions);
+		return true;
+	case DR_DEFERRED:
+		// lockAndFinishRecycling() will eventually be called.
+		memoryRecycles++;
+		return true;
+	case DR_ERROR:
+	case DR_NOOP:
+		process->recycling = false;
+		getPool()->structureChanged();
+		return false;
+	default:
+		P_BUG("Unexpected disable() result " << result);
+		return false;
+	}
+}
+
+void
+Group::lockAndFinishRecycling(const ProcessPtr &process, DisableResult result, GroupPtr self) {
+	TRACE_POINT();
+	boost::container::vector<Callback> actions;
+
+	{
+		Pool *pool = getPool();
+		boost::unique_lock<boost::mutex> lock(pool->syncher);
+		if (OXT_UNLIKELY(!process->isAlive() || !isAlive())) {
+			return;
+		}
+
+		if (result == DR_SUCCESS && process->enabled == Process::DISABLED) {
+			finishRecycling(process, actions);
+		} else {
+			// We do not re-enable or detach the process because it's likely
+			// that the administrator has explicitly changed the state.
+			P_DEBUG("Recycling of process " << process->inspect() << " aborted "
+				"because the process could not be disabled");
+			process->recycling = false;
+			pool->structureChanged();
+		}
+	}
+
+	runAllActions(actions);
+}
+
+void
+Group::finishRecycling(const ProcessPtr &process,
+	boost::container::vector<Callback> &postLockActions)
+{
+	P_INFO("Process " << process->inspect() << " has been drained; "
+		"replacing it because it exceeded the memory limit of group " << info.name);
+	getPool()->detachProcessUnlocked(process, postLockActions);
+	// The detached process no longer counts towards the pool's capacity,
+	// so there is room for its replacement.
+	if (isAlive() && !restarting()) {
+		spawn();
+	}
+}
+
 
 } // namespace ApplicationPool2
 } // namespace Passenger
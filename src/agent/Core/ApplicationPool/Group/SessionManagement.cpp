@@ -55,10 +55,24 @@ using namespace boost;
  * until more processes have been spawned.
  */
 Group::RouteResult
-Group::route(const Options &options) const {
+Group::route(const Options &options, unsigned int stickySessionId) const {
 	if (OXT_LIKELY(enabledCount > 0)) {
-		if (options.stickySessionId == 0) {
+		if (stickySessionId == 0) {
 			Process *process = findEnabledProcessWithLowestBusyness();
+			if (options.numaNode >= 0 && process->numaNode != options.numaNode) {
+				// Prefer a process on the same NUMA node as the Controller
+				// thread, but never wait for one, and don't let it pile
+				// up requests while processes elsewhere are idle.
+				Process *local = findEnabledProcessOnNumaNodeWithLowestBusyness(
+					options.numaNode);
+				if (local != NULL && local->canBeRoutedTo()
+				 && Process::calculateBusyness(local->getConcurrency(),
+					std::max(local->sessions - NUMA_ROUTING_SESSION_MARGIN, 0))
+				    <= process->busyness())
+				{
+					return RouteResult(local);
+				}
+			}
 			if (process->canBeRoutedTo()) {
 				return RouteResult(process);
 			} else {
@@ -66,7 +80,7 @@ Group::route(const Options &options) const {
 			}
 		} else {
 			Process *process = findProcessWithStickySessionIdOrLowestBusyness(
-				options.stickySessionId);
+				stickySessionId);
 			if (process != NULL) {
 				if (process->canBeRoutedTo()) {
 					return RouteResult(process);
@@ -252,14 +266,31 @@ Group::onSessionClose(Process *process, Session *session) {
  ****************************/
 
 
+/**
+ * `now` is the time (usec) at which the caller started this get action, or 0
+ * to use `newOptions.currentTime`. If that is 0 too, the clock is read when
+ * needed. Likewise, a `stickySessionId` of 0 means `newOptions.stickySessionId`.
+ */
 SessionPtr
 Group::get(const Options &newOptions, const GetCallback &callback,
-	boost::container::vector<Callback> &postLockActions)
+	boost::container::vector<Callback> &postLockActions, unsigned long long now,
+	unsigned int stickySessionId)
 {
 	assert(isAlive());
 
+	if (now == 0) {
+		now = newOptions.currentTime;
+	}
+	if (stickySessionId == 0) {
+		stickySessionId = newOptions.stickySessionId;
+	}
+
+	if (!newOptions.noop) {
+		autoscaler.recordRequest();
+	}
+
 	if (OXT_LIKELY(!restarting())) {
-		if (OXT_UNLIKELY(needsRestart(newOptions))) {
+		if (OXT_UNLIKELY(needsRestart(now))) {
 			restart(newOptions);
 		} else {
 			mergeOptions(newOptions);
@@ -279,8 +310,19 @@ Group::get(const Options &newOptions, const GetCallback &callback,
 				} else {
 					P_INFO("There are no processes right now that are eligible "
 						"for shutdown. Will try again later.");
+					capacityDenied();
 				}
 			}
+		} else if (OXT_UNLIKELY(!newOptions.noop && shouldRebalanceCapacityForGetAction())) {
+			// We need another process but the pool is full. Take one
+			// from a group that uses more than its share, if any.
+			if (poolRebalanceCapacity(postLockActions) != NULL) {
+				SpawnResult result = spawn();
+				assert(result == SR_OK);
+				(void) result;
+			} else {
+				capacityDenied();
+			}
 		}
 	}
 
@@ -307,28 +349,28 @@ Group::get(const Options &newOptions, const GetCallback &callback,
 			Process *process = findProcessWithLowestBusyness(disablingProcesses);
 			assert(process != NULL);
 			if (!process->isTotallyBusy()) {
-				return newSession(process, newOptions.currentTime);
+				return newSession(process, now);
 			}
 		}
 
-		if (pushGetWaiter(newOptions, callback, postLockActions)) {
+		if (pushGetWaiter(newOptions, callback, now, stickySessionId, postLockActions)) {
 			P_DEBUG("No session checked out yet: group is spawning or restarting");
 		}
 		return SessionPtr();
 	} else {
-		RouteResult result = route(newOptions);
+		RouteResult result = route(newOptions, stickySessionId);
 		if (result.process == NULL) {
 			/* Looks like all processes are totally busy.
 			 * Wait until a new one has been spawned or until
 			 * resources have become free.
 			 */
-			if (pushGetWaiter(newOptions, callback, postLockActions)) {
+			if (pushGetWaiter(newOptions, callback, now, stickySessionId, postLockActions)) {
 				P_DEBUG("No session checked out yet: all processes are at full capacity");
 			}
 			return SessionPtr();
 		} else {
 			P_DEBUG("Session checked out from process " << result.process->inspect());
-			return newSession(result.process, newOptions.currentTime);
+			return newSession(result.process, now);
 		}
 	}
 }
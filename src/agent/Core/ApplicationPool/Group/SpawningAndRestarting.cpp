@@ -89,6 +89,12 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 			shouldFail = message->name == "Fail spawn loop iteration " + iteration;
 		}
 
+		int numaNode = -1;
+		if (getContext()->cpuTopology != NULL) {
+			LockGuard l(pool->syncher);
+			numaNode = pickNumaNodeForSpawn();
+		}
+
 		ProcessPtr process;
 		ExceptionPtr exception;
 		try {
@@ -103,6 +109,13 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 					journey, &config);
 				e.setSummary("Simulated failure");
 				throw e.finalize();
+			} else if (numaNode >= 0) {
+				const CpuTopology::Node &node = getContext()->cpuTopology->getNode(numaNode);
+				string cpuAffinity = CpuTopology::formatCpuList(node.cpus);
+				Options spawnOptions = options;
+				spawnOptions.cpuAffinity = cpuAffinity;
+				process = createProcessObject(*spawner, spawner->spawn(spawnOptions));
+				process->numaNode = numaNode;
 			} else {
 				process = createProcessObject(*spawner, spawner->spawn(options));
 			}
@@ -153,6 +166,7 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 
 		processesBeingSpawned--;
 		assert(processesBeingSpawned == 0);
+		pool->structureChanged();
 
 		UPDATE_TRACE_POINT();
 		boost::container::vector<Callback> actions;
@@ -271,6 +285,7 @@ Group::finalizeRestart(GroupPtr self,
 	spawner    = newSpawner;
 
 	m_restarting = false;
+	pool->structureChanged();
 	if (shouldSpawn()) {
 		spawn();
 	} else if (isWaitingForCapacity()) {
@@ -316,8 +331,10 @@ Group::restart(const Options &options, RestartMethod method) {
 	processesBeingSpawned = 0;
 	m_spawning   = false;
 	m_restarting = true;
+	getPool()->structureChanged();
 	uuid         = generateUuid(pool);
 	this->options.groupUuid = uuid;
+	inspectionCache.reset();
 	detachAll(actions);
 	getPool()->interruptableThreads.create_thread(
 		boost::bind(&Group::finalizeRestart, this, shared_from_this(),
@@ -336,15 +353,15 @@ Group::restarting() const {
 }
 
 bool
-Group::needsRestart(const Options &options) {
+Group::needsRestart(unsigned long long currentTime) {
 	if (m_restarting) {
 		return false;
 	} else {
 		time_t now;
 		struct stat buf;
 
-		if (options.currentTime != 0) {
-			now = options.currentTime / 1000000;
+		if (currentTime != 0) {
+			now = currentTime / 1000000;
 		} else {
 			now = SystemTime::get();
 		}
@@ -442,7 +459,9 @@ Group::spawn() {
 			"Group process spawner: " + info.name,
 			POOL_HELPER_THREAD_STACK_SIZE);
 		m_spawning = true;
+		m_capacityDenied = false;
 		processesBeingSpawned++;
+		getPool()->structureChanged();
 		return SR_OK;
 	}
 }
@@ -471,6 +490,22 @@ Group::shouldSpawnForGetAction() const {
 	return enabledCount == 0 || shouldSpawn();
 }
 
+/**
+ * Whether, in the specific case that another get action is to be performed,
+ * this group needs another process but cannot spawn one only because the
+ * pool is full. The pool may then take capacity away from another group;
+ * see Pool::rebalanceCapacity().
+ */
+bool
+Group::shouldRebalanceCapacityForGetAction() const {
+	return enabledCount > 0
+		&& !m_spawning
+		&& !restarting()
+		&& (allEnabledProcessesAreTotallyBusy() || !getWaitlist.empty())
+		&& !processUpperLimitsReached()
+		&& poolAtFullCapacity();
+}
+
 /**
  * Whether a new process is allowed to be spawned for this group,
  * i.e. whether the upper processes limits have not been reached.
@@ -53,6 +53,15 @@ Group::getProcessCount() const {
 	return enabledCount + disablingCount + disabledCount;
 }
 
+/**
+ * Returns the number of processes that this group should have at least:
+ * `minProcesses`, or the autoscaler's target if that is higher.
+ */
+unsigned int
+Group::getProcessLowerLimit() const {
+	return std::max<unsigned int>(options.minProcesses, autoscaler.getTarget());
+}
+
 /**
  * Returns whether the lower bound of the group-specific process limits
  * have been satisfied. Note that even if the result is false, the pool limits
@@ -60,7 +69,7 @@ Group::getProcessCount() const {
  */
 bool
 Group::processLowerLimitsSatisfied() const {
-	return capacityUsed() >= options.minProcesses;
+	return capacityUsed() >= getProcessLowerLimit();
 }
 
 /**
@@ -94,6 +103,63 @@ Group::capacityUsed() const {
 	return enabledCount + disablingCount + disabledCount + processesBeingSpawned;
 }
 
+/**
+ * Returns the number of processes that this group currently needs: the
+ * processes that are handling requests plus enough processes for the queued
+ * requests, but at least the process lower limit. Used by the pool to
+ * divide its capacity among groups; see computeCapacityShares().
+ */
+unsigned int
+Group::getCapacityDemand() const {
+	unsigned int busy = 0;
+	ProcessList::const_iterator it, end = enabledProcesses.end();
+	for (it = enabledProcesses.begin(); it != end; it++) {
+		if ((*it)->sessions > 0) {
+			busy++;
+		}
+	}
+
+	unsigned int queued = getWaitlist.size();
+	if (queued > 0) {
+		int concurrency = enabledProcesses.empty() ? 1 : enabledProcesses[0]->getConcurrency();
+		if (concurrency == 0) {
+			// Unlimited concurrency: one process can take them all.
+			busy++;
+		} else if (concurrency < 0) {
+			busy += queued;
+		} else {
+			busy += (queued + concurrency - 1) / concurrency;
+		}
+	}
+
+	return std::max(busy, getProcessLowerLimit());
+}
+
+CapacityClaim
+Group::getCapacityClaim() const {
+	CapacityClaim claim;
+	claim.weight = options.capacityWeight;
+	claim.reservation = options.capacityReservation;
+	claim.limit = options.maxProcesses;
+	claim.demand = getCapacityDemand();
+	return claim;
+}
+
+/**
+ * Returns the number of requests of the given priority class that are
+ * queued in the getWaitlist.
+ */
+unsigned int
+Group::getWaitlistSize(RequestPriority priority) const {
+	if (getWaitlist.empty()) {
+		// The counters are not maintained when the getWaitlist is
+		// emptied in bulk; they are reset upon the next enqueue.
+		return 0;
+	} else {
+		return getWaitlistClassSizes[priority];
+	}
+}
+
 /**
  * Checks whether this group is waiting for capacity on the pool to
  * become available before it can continue processing requests.
@@ -120,34 +186,154 @@ Group::garbageCollectable(unsigned long long now) const {
 	return false;
 }
 
+const Group::InspectionCachePtr &
+Group::getInspectionCache() const {
+	if (inspectionCache == NULL) {
+		boost::shared_ptr<InspectionCache> cache = boost::make_shared<InspectionCache>();
+		stringstream optionsXml;
+
+		cache->usInfo = SpawningKit::prepareUserSwitching(options, getWrapperRegistry());
+		options.toXml(optionsXml, getResourceLocator(), getWrapperRegistry());
+		cache->optionsXml = optionsXml.str();
+		createAdminPanelProperties(cache->usInfo, cache->adminPanelProperties);
+		createAdminPanelConfig(cache->adminPanelConfig);
+		inspectionCache = cache;
+	}
+	return inspectionCache;
+}
+
 void
 Group::inspectXml(std::ostream &stream, bool includeSecrets) const {
+	Snapshot(*this).inspectXml(stream, includeSecrets);
+}
+
+void
+Group::inspectPropertiesInAdminPanelFormat(Json::Value &result) const {
+	result = getInspectionCache()->adminPanelProperties;
+}
+
+void
+Group::inspectConfigInAdminPanelFormat(Json::Value &result) const {
+	result = getInspectionCache()->adminPanelConfig;
+}
+
+
+/****************************
+ *
+ * Snapshot methods
+ *
+ ****************************/
+
+
+Group::Snapshot::Snapshot(const Group &group)
+	: name(group.info.name),
+	  apiKey(group.getApiKey()),
+	  appRoot(group.options.appRoot.data(), group.options.appRoot.size()),
+	  appType(group.options.appType.data(), group.options.appType.size()),
+	  environment(group.options.environment.data(), group.options.environment.size()),
+	  uuid(group.uuid),
+	  enabledCount(group.enabledCount),
+	  disablingCount(group.disablingCount),
+	  disabledCount(group.disabledCount),
+	  processCount(group.getProcessCount()),
+	  capacityUsed(group.capacityUsed()),
+	  getWaitlistSize(group.getWaitlist.size()),
+	  disableWaitlistSize(group.disableWaitlist.size()),
+	  processesBeingSpawned(group.processesBeingSpawned),
+	  spawning(group.spawning()),
+	  restarting(group.restarting()),
+	  lifeStatus((LifeStatus) group.lifeStatus.load(boost::memory_order_relaxed)),
+	  memoryRecycles(group.memoryRecycles),
+	  capacityWeight(group.options.capacityWeight),
+	  capacityDemand(group.getCapacityDemand()),
+	  capacityShare(0),
+	  capacityDeniedSpawns(group.capacityDeniedSpawns),
+	  capacityEvictions(group.capacityEvictions),
+	  inspectionCache(group.getInspectionCache())
+{
+	const ProcessList *lists[] = {
+		&group.enabledProcesses,
+		&group.disablingProcesses,
+		&group.disabledProcesses,
+		&group.detachedProcesses
+	};
 	ProcessList::const_iterator it;
+	unsigned int i;
+
+	for (i = 0; i < RP_COUNT; i++) {
+		getWaitlistSizeByPriority[i] = group.getWaitlistSize((RequestPriority) i);
+	}
+	if (group.autoscaler.getLastEvaluatedAt() != 0) {
+		stringstream stream;
+		group.autoscaler.inspectXml(stream);
+		autoscalerXml = stream.str();
+	}
 
-	stream << "<name>" << escapeForXml(info.name) << "</name>";
-	stream << "<component_name>" << escapeForXml(info.name) << "</component_name>";
-	stream << "<app_root>" << escapeForXml(options.appRoot) << "</app_root>";
-	stream << "<app_type>" << escapeForXml(options.appType) << "</app_type>";
-	stream << "<environment>" << escapeForXml(options.environment) << "</environment>";
-	stream << "<uuid>" << toString(uuid) << "</uuid>";
+	processes.reserve(processCount + group.detachedProcesses.size());
+	for (i = 0; i < sizeof(lists) / sizeof(ProcessList *); i++) {
+		for (it = lists[i]->begin(); it != lists[i]->end(); it++) {
+			processes.push_back(Process::Snapshot(**it));
+		}
+	}
+}
+
+bool
+Group::Snapshot::authorizeByUid(uid_t uid) const {
+	return uid == 0 || inspectionCache->usInfo.uid == uid;
+}
+
+bool
+Group::Snapshot::authorizeByApiKey(const ApiKey &key) const {
+	return key.isSuper() || key == apiKey;
+}
+
+void
+Group::Snapshot::inspectXml(std::ostream &stream, bool includeSecrets) const {
+	vector<Process::Snapshot>::const_iterator it;
+
+	stream << "<name>" << escapeForXml(name) << "</name>";
+	stream << "<component_name>" << escapeForXml(name) << "</component_name>";
+	stream << "<app_root>" << escapeForXml(appRoot) << "</app_root>";
+	stream << "<app_type>" << escapeForXml(appType) << "</app_type>";
+	stream << "<environment>" << escapeForXml(environment) << "</environment>";
+	stream << "<uuid>" << uuid << "</uuid>";
 	stream << "<enabled_process_count>" << enabledCount << "</enabled_process_count>";
 	stream << "<disabling_process_count>" << disablingCount << "</disabling_process_count>";
 	stream << "<disabled_process_count>" << disabledCount << "</disabled_process_count>";
-	stream << "<capacity_used>" << capacityUsed() << "</capacity_used>";
-	stream << "<get_wait_list_size>" << getWaitlist.size() << "</get_wait_list_size>";
-	stream << "<disable_wait_list_size>" << disableWaitlist.size() << "</disable_wait_list_size>";
+	stream << "<capacity_used>" << capacityUsed << "</capacity_used>";
+	stream << "<capacity_weight>" << capacityWeight << "</capacity_weight>";
+	stream << "<capacity_demand>" << capacityDemand << "</capacity_demand>";
+	stream << "<capacity_share>" << capacityShare << "</capacity_share>";
+	if (capacityDeniedSpawns > 0) {
+		stream << "<capacity_denied_spawns>" << capacityDeniedSpawns << "</capacity_denied_spawns>";
+	}
+	if (capacityEvictions > 0) {
+		stream << "<capacity_evictions>" << capacityEvictions << "</capacity_evictions>";
+	}
+	stream << "<get_wait_list_size>" << getWaitlistSize << "</get_wait_list_size>";
+	stream << "<get_wait_list_size_by_priority>";
+	for (unsigned int i = 0; i < RP_COUNT; i++) {
+		const char *name = requestPriorityToString((RequestPriority) i);
+		stream << "<" << name << ">" << getWaitlistSizeByPriority[i]
+			<< "</" << name << ">";
+	}
+	stream << "</get_wait_list_size_by_priority>";
+	stream << "<disable_wait_list_size>" << disableWaitlistSize << "</disable_wait_list_size>";
 	stream << "<processes_being_spawned>" << processesBeingSpawned << "</processes_being_spawned>";
-	if (m_spawning) {
+	stream << autoscalerXml;
+	if (memoryRecycles > 0) {
+		stream << "<memory_recycles>" << memoryRecycles << "</memory_recycles>";
+	}
+	if (spawning) {
 		stream << "<spawning/>";
 	}
-	if (restarting()) {
+	if (restarting) {
 		stream << "<restarting/>";
 	}
 	if (includeSecrets) {
-		stream << "<secret>" << escapeForXml(getApiKey().toStaticString()) << "</secret>";
-		stream << "<api_key>" << escapeForXml(getApiKey().toStaticString()) << "</api_key>";
+		stream << "<secret>" << escapeForXml(apiKey.toStaticString()) << "</secret>";
+		stream << "<api_key>" << escapeForXml(apiKey.toStaticString()) << "</api_key>";
 	}
-	LifeStatus lifeStatus = (LifeStatus) this->lifeStatus.load(boost::memory_order_relaxed);
 	switch (lifeStatus) {
 	case ALIVE:
 		stream << "<life_status>ALIVE</life_status>";
@@ -162,54 +348,43 @@ Group::inspectXml(std::ostream &stream, bool includeSecrets) const {
 		P_BUG("Unknown 'lifeStatus' state " << lifeStatus);
 	}
 
-	SpawningKit::UserSwitchingInfo usInfo(SpawningKit::prepareUserSwitching(options,
-		getWrapperRegistry()));
+	const SpawningKit::UserSwitchingInfo &usInfo = inspectionCache->usInfo;
 	stream << "<user>" << escapeForXml(usInfo.username) << "</user>";
 	stream << "<uid>" << usInfo.uid << "</uid>";
 	stream << "<group>" << escapeForXml(usInfo.groupname) << "</group>";
 	stream << "<gid>" << usInfo.gid << "</gid>";
 
 	stream << "<options>";
-	options.toXml(stream, getResourceLocator(), getWrapperRegistry());
+	stream << inspectionCache->optionsXml;
 	stream << "</options>";
 
 	stream << "<processes>";
-
-	for (it = enabledProcesses.begin(); it != enabledProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
-	}
-	for (it = disablingProcesses.begin(); it != disablingProcesses.end(); it++) {
+	for (it = processes.begin(); it != processes.end(); it++) {
 		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
+		it->inspectXml(stream, includeSecrets);
 		stream << "</process>";
 	}
-	for (it = disabledProcesses.begin(); it != disabledProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
-	}
-	for (it = detachedProcesses.begin(); it != detachedProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
-	}
-
 	stream << "</processes>";
 }
 
+
+/****************************
+ *
+ * Private methods
+ *
+ ****************************/
+
+
 void
-Group::inspectPropertiesInAdminPanelFormat(Json::Value &result) const {
+Group::createAdminPanelProperties(const SpawningKit::UserSwitchingInfo &usInfo,
+	Json::Value &result) const
+{
 	result["path"] = absolutizePath(options.appRoot);
 	result["startup_file"] = absolutizePath(options.getStartupFile(getWrapperRegistry()),
 		absolutizePath(options.appRoot));
 	result["start_command"] = options.getStartCommand(getResourceLocator(),
 		getWrapperRegistry());
 	result["type"] = getWrapperRegistry().lookup(options.appType).language.toString();
-
-	SpawningKit::UserSwitchingInfo usInfo(SpawningKit::prepareUserSwitching(options,
-		getWrapperRegistry()));
 	result["user"]["username"] = usInfo.username;
 	result["user"]["uid"] = (Json::Int) usInfo.uid;
 	result["group"]["groupname"] = usInfo.groupname;
@@ -219,7 +394,7 @@ Group::inspectPropertiesInAdminPanelFormat(Json::Value &result) const {
 }
 
 void
-Group::inspectConfigInAdminPanelFormat(Json::Value &result) const {
+Group::createAdminPanelConfig(Json::Value &result) const {
 	#define VAL Pool::makeSingleValueJsonConfigFormat
 	#define SVAL Pool::makeSingleStrValueJsonConfigFormat
 	#define NON_EMPTY_SVAL Pool::makeSingleNonEmptyStrValueJsonConfigFormat
@@ -257,11 +432,16 @@ Group::inspectConfigInAdminPanelFormat(Json::Value &result) const {
 	result["load_shell_envvars"] = VAL(options.loadShellEnvvars); // TODO: default value depends on integration mode
 	result["max_request_queue_size"] = VAL(options.maxRequestQueueSize,
 		(Json::UInt) DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+	result["max_request_queue_time"] = VAL(options.maxRequestQueueTime, 0u);
 	result["max_requests"] = VAL((Json::UInt) options.maxRequests, 0u);
+	result["memory_limit"] = VAL(options.memoryLimit, 0u);
+	result["capacity_weight"] = VAL(options.capacityWeight, 1u);
+	result["capacity_reservation"] = VAL(options.capacityReservation, 0u);
 	result["abort_websockets_on_process_shutdown"] = VAL(options.abortWebsocketsOnProcessShutdown);
 	result["force_max_concurrent_requests_per_process"] = VAL(options.forceMaxConcurrentRequestsPerProcess, -1);
 	result["restart_dir"] = NON_EMPTY_SVAL(options.restartDir);
 	result["sticky_sessions_cookie_attributes"] = SVAL(options.stickySessionsCookieAttributes, DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES);
+	result["sticky_sessions_consistent_hashing"] = VAL(options.stickySessionsConsistentHashing, false);
 
 	if (!options.environmentVariables.empty()) {
 		DynamicBuffer envvarsData(options.environmentVariables.size() * 3 / 4);
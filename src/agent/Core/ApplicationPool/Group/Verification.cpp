@@ -70,6 +70,8 @@ Group::verifyInvariants() const {
 	assert((lifeStatus == ALIVE) == (spawner != NULL));
 
 	// Verify getWaitlist invariants.
+	assert(!( !getWaitlist.empty() ) || ( getWaitlistClassSizes[RP_HIGH]
+		+ getWaitlistClassSizes[RP_NORMAL] + getWaitlistClassSizes[RP_LOW] == getWaitlist.size() ));
 	assert(!( !getWaitlist.empty() ) || ( enabledProcesses.empty() || verifyNoRequestsOnGetWaitlistAreRoutable() ));
 	assert(!( enabledProcesses.empty() && !m_spawning && !restarting() && !poolAtFullCapacity() ) || ( getWaitlist.empty() ));
 	assert(!( !getWaitlist.empty() ) || ( !enabledProcesses.empty() || m_spawning || restarting() || poolAtFullCapacity() ));
@@ -94,6 +96,9 @@ Group::verifyInvariants() const {
 	assert((int) disablingProcesses.size() == disablingCount);
 	assert((int) disabledProcesses.size() == disabledCount);
 	assert(nEnabledProcessesTotallyBusy <= enabledCount);
+	assert((int) stickySessionIndex.size() == enabledCount);
+	assert(!( options.stickySessionsConsistentHashing )
+		|| ( stickySessionRing.size() == enabledProcesses.size() * STICKY_SESSION_RING_REPLICAS ));
 	#endif
 }
 
@@ -112,6 +117,7 @@ Group::verifyExpensiveInvariants() const {
 	for (it = enabledProcesses.begin(); it != end; it++) {
 		const ProcessPtr &process = *it;
 		assert(process->enabled == Process::ENABLED);
+		assert(findProcessWithStickySessionId(process->getStickySessionId()) == process.get());
 		assert(process->isAlive());
 		assert(process->oobwStatus == Process::OOBW_NOT_ACTIVE
 			|| process->oobwStatus == Process::OOBW_REQUESTED);
@@ -147,7 +153,7 @@ Group::verifyNoRequestsOnGetWaitlistAreRoutable() const {
 	deque<GetWaiter>::const_iterator it, end = getWaitlist.end();
 
 	for (it = getWaitlist.begin(); it != end; it++) {
-		if (route(it->options).process != NULL) {
+		if (route(*it->options, it->stickySessionId).process != NULL) {
 			return false;
 		}
 	}
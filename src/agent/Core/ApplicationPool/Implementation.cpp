@@ -94,6 +94,7 @@ copyException(const tracable_exception &e) {
 	TRY_COPY_EXCEPTION(ConfigurationException);
 
 	TRY_COPY_EXCEPTION(RequestQueueFullException);
+	TRY_COPY_EXCEPTION(RequestQueueTimeoutException);
 	TRY_COPY_EXCEPTION(GetAbortedException);
 	TRY_COPY_EXCEPTION(SpawningKit::SpawnException);
 
@@ -137,6 +138,7 @@ rethrowException(const ExceptionPtr &e) {
 
 	TRY_RETHROW_EXCEPTION(SpawningKit::SpawnException);
 	TRY_RETHROW_EXCEPTION(RequestQueueFullException);
+	TRY_RETHROW_EXCEPTION(RequestQueueTimeoutException);
 	TRY_RETHROW_EXCEPTION(GetAbortedException);
 
 	TRY_RETHROW_EXCEPTION(InvalidModeStringException);
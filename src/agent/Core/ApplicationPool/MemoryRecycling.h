@@ -0,0 +1,204 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2014-2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_MEMORY_RECYCLING_H_
+#define _PASSENGER_APPLICATION_POOL2_MEMORY_RECYCLING_H_
+
+#include <cstddef>
+#include <SystemTools/ProcessMetricsCollector.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+struct MemoryRecyclingConfig {
+	/** Whether memory limits are compared against the PSS (plus swap) of a
+	 * process instead of its private dirty RSS (plus swap). If the PSS is
+	 * unknown, the private dirty RSS is used anyway. */
+	bool usePss;
+	/** The maximum number of processes in the entire pool that may be
+	 * recycled because of their memory usage at the same time.
+	 * 0 means unlimited. */
+	unsigned int maxConcurrentRecycles;
+	/** The number of consecutive samples in which a process must exceed its
+	 * memory limit before it is recycled, so that a short spike doesn't
+	 * cause a recycle. */
+	unsigned int minSamplesOverLimit;
+
+	MemoryRecyclingConfig()
+		: usePss(false),
+		  maxConcurrentRecycles(1),
+		  minSamplesOverLimit(3)
+		{ }
+
+	/** Returns the memory usage (in KB) to compare against memory limits. */
+	size_t measure(const ProcessMetrics &metrics) const {
+		if (usePss && metrics.pss != -1) {
+			return metrics.pss + (metrics.swap != -1 ? metrics.swap : 0);
+		} else {
+			return metrics.realMemory();
+		}
+	}
+};
+
+/**
+ * Keeps the memory usage samples of a process that were taken during the
+ * last few analytics collection rounds, so that a steadily growing process
+ * can be told apart from one that merely has a high but stable footprint.
+ *
+ * This class is not thread-safe; the pool protects it with its lock.
+ */
+class MemoryTrend {
+public:
+	static const unsigned int MAX_SAMPLES = 12;
+
+private:
+	unsigned long long times[MAX_SAMPLES];
+	size_t values[MAX_SAMPLES];
+	unsigned int first;
+	unsigned int count;
+	size_t initial;
+	size_t peak;
+
+	unsigned int indexOf(unsigned int i) const {
+		return (first + i) % MAX_SAMPLES;
+	}
+
+public:
+	MemoryTrend()
+		: first(0),
+		  count(0),
+		  initial(0),
+		  peak(0)
+		{ }
+
+	/**
+	 * Records that the process used `kb` KB of memory at time `now` (usec).
+	 */
+	void addSample(unsigned long long now, size_t kb) {
+		unsigned int index;
+
+		if (count == 0) {
+			initial = kb;
+		}
+		if (count < MAX_SAMPLES) {
+			index = indexOf(count);
+			count++;
+		} else {
+			index = first;
+			first = indexOf(1);
+		}
+		times[index] = now;
+		values[index] = kb;
+		if (kb > peak) {
+			peak = kb;
+		}
+	}
+
+	unsigned int getSampleCount() const {
+		return count;
+	}
+
+	/** The last recorded memory usage in KB, or 0 if there are no samples. */
+	size_t getCurrent() const {
+		if (count == 0) {
+			return 0;
+		} else {
+			return values[indexOf(count - 1)];
+		}
+	}
+
+	/** The first memory usage ever recorded in KB, or 0 if there are no samples. */
+	size_t getInitial() const {
+		return initial;
+	}
+
+	/**
+	 * The number of most recent samples, up to MAX_SAMPLES, in which the
+	 * memory usage was above `kb` KB.
+	 */
+	unsigned int countRecentSamplesAbove(size_t kb) const {
+		unsigned int result = 0;
+		while (result < count && values[indexOf(count - 1 - result)] > kb) {
+			result++;
+		}
+		return result;
+	}
+
+	/** The highest recorded memory usage in KB. */
+	size_t getPeak() const {
+		return peak;
+	}
+
+	/**
+	 * The rate at which the memory usage changes, in KB per minute. This is the
+	 * slope of the least squares fit through the recorded samples, so a single
+	 * spike does not dominate it. Returns 0 if there are fewer than 2 samples.
+	 */
+	double getGrowthRate() const {
+		if (count < 2) {
+			return 0;
+		}
+
+		// Use times relative to the first sample, in minutes, to keep the
+		// sums small enough for a double.
+		unsigned long long base = times[first];
+		double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+		for (unsigned int i = 0; i < count; i++) {
+			unsigned int index = indexOf(i);
+			double x = (times[index] - base) / 60000000.0;
+			double y = values[index];
+			sumX += x;
+			sumY += y;
+			sumXX += x * x;
+			sumXY += x * y;
+		}
+
+		double denominator = count * sumXX - sumX * sumX;
+		if (denominator <= 0) {
+			return 0;
+		} else {
+			return (count * sumXY - sumX * sumY) / denominator;
+		}
+	}
+
+	template<typename Stream>
+	void inspectXml(Stream &stream) const {
+		stream << "<memory_trend>";
+		stream << "<current>" << getCurrent() << "</current>";
+		stream << "<peak>" << peak << "</peak>";
+		stream << "<growth_rate>" << getGrowthRate() << "</growth_rate>";
+		stream << "<samples>" << count << "</samples>";
+		stream << "</memory_trend>";
+	}
+};
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_MEMORY_RECYCLING_H_ */
@@ -44,6 +44,50 @@ namespace ApplicationPool2 {
 using namespace std;
 using namespace boost;
 
+/**
+ * Priority class of a get() request. When no process can serve a request
+ * immediately, requests wait in their group's getWaitlist, where the
+ * priority classes share dispatching by weighted fair queueing: under
+ * contention, high priority requests are dispatched at twice the rate of
+ * normal priority requests, which in turn are dispatched at twice the rate
+ * of low priority requests. No class is ever starved completely.
+ */
+enum RequestPriority {
+	RP_HIGH,
+	RP_NORMAL,
+	RP_LOW,
+
+	RP_COUNT
+};
+
+inline const char *
+requestPriorityToString(RequestPriority priority) {
+	switch (priority) {
+	case RP_HIGH:
+		return "high";
+	case RP_NORMAL:
+		return "normal";
+	case RP_LOW:
+		return "low";
+	default:
+		return "unknown";
+	}
+}
+
+/**
+ * Parses "high", "normal" or "low". Returns RP_NORMAL for anything else.
+ */
+inline RequestPriority
+parseRequestPriority(const StaticString &value) {
+	if (value == P_STATIC_STRING("high")) {
+		return RP_HIGH;
+	} else if (value == P_STATIC_STRING("low")) {
+		return RP_LOW;
+	} else {
+		return RP_NORMAL;
+	}
+}
+
 /**
  * This struct encapsulates information for ApplicationPool::get() and for
  * Spawner::spawn(), such as which application is to be spawned.
@@ -113,6 +157,7 @@ private:
 		result.push_back(&options.environmentVariables);
 		result.push_back(&options.apiKey);
 		result.push_back(&options.groupUuid);
+		result.push_back(&options.cpuAffinity);
 		result.push_back(&options.hostName);
 		result.push_back(&options.uri);
 
@@ -352,10 +397,22 @@ public:
 
 	/**
 	 * The maximum number of requests that may live in the Group.getWaitlist queue.
+	 * This limit is shared by all request priority classes. When the queue is
+	 * full, a request takes the place of the most recently queued request of
+	 * the lowest priority class below its own, if any, so that a flood of low
+	 * priority requests cannot cause high priority requests to be rejected.
 	 * A value of 0 means unlimited.
 	 */
 	unsigned int maxRequestQueueSize;
 
+	/**
+	 * The maximum number of seconds that a request may spend in the
+	 * Group.getWaitlist queue. Requests that wait longer are aborted with
+	 * a RequestQueueTimeoutException instead of being routed to a process.
+	 * A value of 0 means unlimited.
+	 */
+	unsigned int maxRequestQueueTime;
+
 	/**
 	 * Whether websocket connections should be aborted on process shutdown
 	 * or restart.
@@ -368,6 +425,37 @@ public:
 	 */
 	StaticString stickySessionsCookieAttributes;
 
+	/**
+	 * Whether sticky sessions are routed with consistent hashing. In this
+	 * mode, requests whose sticky session ID no longer belongs to a process
+	 * are routed to the same process every time, and processes that replace
+	 * detached ones take over their sticky session IDs.
+	 * See Group::route().
+	 */
+	bool stickySessionsConsistentHashing;
+
+	/**
+	 * The maximum amount of memory (in MB) that a single process in this
+	 * group may use. Processes that use more are gracefully replaced; see
+	 * Pool::enforceMemoryLimits(). A value of 0 means unlimited.
+	 */
+	unsigned int memoryLimit;
+
+	/**
+	 * The weight of this group when the pool's capacity is divided among
+	 * groups that compete for it, like cgroup CPU shares. A group with
+	 * weight 2 is entitled to twice as many processes as a group with
+	 * weight 1. See Pool::findBestProcessToEvict().
+	 */
+	unsigned int capacityWeight;
+
+	/**
+	 * The number of processes that this group is guaranteed to keep (and
+	 * to get, when it needs them) when the pool is full, regardless of
+	 * weights. The upper limit is `maxProcesses`.
+	 */
+	unsigned int capacityReservation;
+
 	/*-----------------*/
 
 
@@ -388,6 +476,22 @@ public:
 	 */
 	unsigned int stickySessionId;
 
+	/**
+	 * The priority class of this request. Only has effect when the request
+	 * has to wait in the Group.getWaitlist queue. RP_NORMAL by default.
+	 */
+	RequestPriority requestPriority;
+
+	/**
+	 * The NUMA node (an index into the pool context's CpuTopology) of the
+	 * Controller thread that handles this request, or -1 if unknown.
+	 * Requests are preferably routed to processes on the same node.
+	 * See Group::route(). Because every Controller thread caches its own
+	 * options, this is set once when the options are created and is not
+	 * reset by clearPerRequestFields().
+	 */
+	int numaNode;
+
 	/**
 	 * A throttling rate for file stats. When set to a non-zero value N,
 	 * restart.txt and other files which are usually stat()ted on every
@@ -417,6 +521,16 @@ public:
 	 */
 	bool noop;
 
+	/**
+	 * When true, the caller guarantees that this Options object, and all the
+	 * strings it points to, stay valid and unmodified until the get callback
+	 * has been called or until the get action has been canceled with
+	 * Pool::cancelAsyncGet(). The Pool then queues the get action by
+	 * reference instead of making a persistent copy of these options.
+	 * False by default.
+	 */
+	bool ownedByCaller;
+
 	/*-----------------*/
 	/*-----------------*/
 
@@ -436,6 +550,13 @@ public:
 	 */
 	StaticString groupUuid;
 
+	/**
+	 * The CPUs that the spawned process is to be bound to, in the Linux
+	 * cpulist format. Empty means that the CPU affinity is not changed.
+	 * Set by Group when NUMA-aware placement is enabled.
+	 */
+	StaticString cpuAffinity;
+
 
 	/*********************************/
 
@@ -468,14 +589,22 @@ public:
 		  maxPreloaderIdleTime(-1),
 		  maxOutOfBandWorkInstances(1),
 		  maxRequestQueueSize(DEFAULT_MAX_REQUEST_QUEUE_SIZE),
+		  maxRequestQueueTime(0),
 		  abortWebsocketsOnProcessShutdown(true),
 		  stickySessionsCookieAttributes(DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES, sizeof(DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES) - 1),
+		  stickySessionsConsistentHashing(false),
+		  memoryLimit(0),
+		  capacityWeight(1),
+		  capacityReservation(0),
 
 		  stickySessionId(0),
+		  requestPriority(RP_NORMAL),
+		  numaNode(-1),
 		  statThrottleRate(DEFAULT_STAT_THROTTLE_RATE),
 		  maxRequests(0),
 		  currentTime(0),
-		  noop(false)
+		  noop(false),
+		  ownedByCaller(false)
 		  /*********************************/
 	{
 		/*********************************/
@@ -488,6 +617,7 @@ public:
 	Options copyAndPersist() const {
 		Options cpy(*this);
 		cpy.persist(*this);
+		cpy.ownedByCaller = false;
 		return cpy;
 	}
 
@@ -545,8 +675,10 @@ public:
 		hostName = StaticString();
 		uri      = StaticString();
 		stickySessionId = 0;
+		requestPriority = RP_NORMAL;
 		currentTime     = 0;
 		noop     = false;
+		ownedByCaller = false;
 		return *this;
 	}
 
@@ -601,6 +733,10 @@ public:
 			appendKeyValue2(vec, "max_preloader_idle_time", maxPreloaderIdleTime);
 			appendKeyValue3(vec, "max_out_of_band_work_instances", maxOutOfBandWorkInstances);
 			appendKeyValue (vec, "sticky_sessions_cookie_attributes", stickySessionsCookieAttributes);
+			appendKeyValue4(vec, "sticky_sessions_consistent_hashing", stickySessionsConsistentHashing);
+			appendKeyValue3(vec, "memory_limit",        memoryLimit);
+			appendKeyValue3(vec, "capacity_weight",     capacityWeight);
+			appendKeyValue3(vec, "capacity_reservation", capacityReservation);
 		}
 
 		/*********************************/
@@ -37,6 +37,8 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/function.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/foreach.hpp>
 #include <boost/pool/object_pool.hpp>
 // We use boost::container::vector instead of std::vector, because the
@@ -63,6 +65,7 @@
 #include <Core/ApplicationPool/Context.h>
 #include <Core/ApplicationPool/Process.h>
 #include <Core/ApplicationPool/Group.h>
+#include <Core/ApplicationPool/CapacityScheduler.h>
 #include <Core/ApplicationPool/Session.h>
 #include <Core/ApplicationPool/Options.h>
 #include <Core/SpawningKit/Factory.h>
@@ -198,6 +201,25 @@ public:
 		}
 	};
 
+	/**
+	 * An immutable copy of the pool state, from which all state inspection
+	 * functions render their output. Snapshots are taken while holding the
+	 * lock, which only involves copying, and are reused until the pool
+	 * structure changes; see `getStateSnapshot()`.
+	 */
+	struct StateSnapshot {
+		/** The value of `Pool::stateGeneration` when this snapshot was taken. */
+		boost::uint64_t generation;
+		unsigned int max;
+		unsigned int capacityUsed;
+		unsigned int processCount;
+		/** App group names of the requests in the top-level queue. */
+		vector<string> getWaitlist;
+		vector<Group::Snapshot> groups;
+	};
+
+	typedef boost::shared_ptr<const StateSnapshot> StateSnapshotPtr;
+
 
 // Actually private, but marked public so that unit tests can access the fields.
 public:
@@ -209,6 +231,9 @@ public:
 	unsigned int max;
 	unsigned long long maxIdleTime;
 	bool selfchecking;
+	AutoscalerConfig autoscalerConfig;
+	MemoryRecyclingConfig memoryRecyclingConfig;
+	CapacitySchedulerConfig capacitySchedulerConfig;
 
 	Context *context;
 
@@ -234,6 +259,22 @@ public:
 	mutable GroupMap groups;
 	psg_pool_t *palloc;
 
+	/**
+	 * Incremented, while holding `syncher`, whenever something that state
+	 * snapshots contain changes: groups, process lists, spawning and
+	 * restarting, wait lists, configuration and collected metrics. The
+	 * counters that change with every session are not included; snapshots
+	 * read those from Process::LiveCounters instead. See `structureChanged()`.
+	 */
+	boost::atomic<boost::uint64_t> stateGeneration;
+
+	/**
+	 * The last snapshot taken by `getStateSnapshot()`. Protected by
+	 * `stateSnapshotSyncher`, which is never acquired while holding `syncher`.
+	 */
+	mutable boost::mutex stateSnapshotSyncher;
+	mutable StateSnapshotPtr stateSnapshot;
+
 	/**
 	 * get() requests that...
 	 * - cannot be immediately satisfied because the pool is at full
@@ -320,7 +361,11 @@ public:
 	static void collectPids(const ProcessList &processes, vector<pid_t> &pids);
 	static void updateProcessMetrics(const ProcessList &processes,
 		const ProcessMetricMap &allMetrics,
+		const MemoryRecyclingConfig &memoryRecyclingConfig,
+		unsigned long long now,
 		vector<ProcessPtr> &processesToDetach);
+	unsigned int countRecyclingProcesses() const;
+	void enforceMemoryLimits(boost::container::vector<Callback> &postLockActions);
 	void realCollectAnalytics();
 
 
@@ -333,6 +378,9 @@ public:
 	};
 
 	boost::condition_variable garbageCollectionCond;
+	/** Time (usec) at which the garbage collector is scheduled to run next,
+	 * or 0 if unknown. */
+	unsigned long long nextGarbageCollectionTime;
 
 	void initializeGarbageCollection();
 	static void garbageCollect(PoolPtr self);
@@ -342,8 +390,11 @@ public:
 	void garbageCollectProcessesInGroup(GarbageCollectorState &state,
 		const GroupPtr &group);
 	void maybeCleanPreloader(GarbageCollectorState &state, const GroupPtr &group);
+	void abortExpiredGetWaiters(GarbageCollectorState &state);
+	void autoscaleGroup(GarbageCollectorState &state, const GroupPtr &group);
 	unsigned long long realGarbageCollect();
 	void wakeupGarbageCollector();
+	void scheduleGarbageCollectionBefore(unsigned long long time);
 
 
 	/****** General utilities ******/
@@ -382,7 +433,8 @@ public:
 	Group *findMatchingGroup(const Options &options);
 	GroupPtr createGroup(const Options &options);
 	GroupPtr createGroupAndAsyncGetFromIt(const Options &options,
-		const GetCallback &callback, boost::container::vector<Callback> &postLockActions);
+		const GetCallback &callback, boost::container::vector<Callback> &postLockActions,
+		unsigned long long now = 0, unsigned int stickySessionId = 0);
 	void forceDetachGroup(const GroupPtr &group,
 		const Callback &callback,
 		boost::container::vector<Callback> &postLockActions);
@@ -403,10 +455,18 @@ public:
 		}
 	};
 
-	ProcessPtr findOldestIdleProcess(const Group *exclude = NULL) const;
-	ProcessPtr findBestProcessToTrash() const;
+	static bool compareCapacitySurplus(const pair<int, Group *> &a,
+		const pair<int, Group *> &b);
+	void collectCapacityClaims(vector<Group *> &groupList, vector<CapacityClaim> &claims,
+		const Group *requester = NULL) const;
+	ProcessPtr findBestProcessToEvict(const Group *requester, bool rebalancing,
+		unsigned long long now) const;
+	void evictProcessForCapacity(const ProcessPtr &process, unsigned long long now,
+		boost::container::vector<Callback> &postLockActions);
 	ProcessPtr forceFreeCapacity(const Group *exclude,
 		boost::container::vector<Callback> &postLockActions);
+	ProcessPtr rebalanceCapacity(Group *requester,
+		boost::container::vector<Callback> &postLockActions);
 	bool detachProcessUnlocked(const ProcessPtr &process,
 		boost::container::vector<Callback> &postLockActions);
 	static void syncDisableProcessCallback(const ProcessPtr &process, DisableResult result,
@@ -424,8 +484,12 @@ public:
 	static Json::Value makeSingleNonEmptyStrValueJsonConfigFormat(const StaticString &val);
 	unsigned int capacityUsedUnlocked() const;
 	bool atFullCapacityUnlocked() const;
-	void inspectProcessList(const InspectOptions &options, stringstream &result,
-		const Group *group, const ProcessList &processes) const;
+	void structureChanged();
+	StateSnapshotPtr createStateSnapshotUnlocked() const;
+	static bool authorizeSnapshot(const StateSnapshot &snapshot,
+		const AuthenticationOptions &options);
+	static void inspectProcessList(const InspectOptions &options, stringstream &result,
+		const Group::Snapshot &group, Process::EnabledStatus enabled);
 
 public:
 	typedef void (*AbortLongRunningConnectionsCallback)(const ProcessPtr &process);
@@ -480,20 +544,28 @@ public:
 	bool atFullCapacity() const;
 	unsigned int getProcessCount(bool lock = true) const;
 	unsigned int getGroupCount() const;
+	StateSnapshotPtr getStateSnapshot() const;
 	string inspect(const InspectOptions &options = InspectOptions::makeAuthorized(),
 		bool lock = true) const;
 	string toXml(const ToXmlOptions &options = ToXmlOptions::makeAuthorized(),
 		bool lock = true) const;
+	void writePrometheusMetrics(ostream &stream,
+		const AuthenticationOptions &options = AuthenticationOptions::makeAuthorized()) const;
 	Json::Value inspectPropertiesInAdminPanelFormat(const ToJsonOptions &options = ToJsonOptions::makeAuthorized()) const;
 	Json::Value inspectConfigInAdminPanelFormat(const ToJsonOptions &options = ToJsonOptions::makeAuthorized()) const;
 
 
 	/****** Miscellaneous ******/
 
-	void asyncGet(const Options &options, const GetCallback &callback, bool lockNow = true);
+	void asyncGet(const Options &options, const GetCallback &callback, bool lockNow = true,
+		unsigned long long now = 0, unsigned int stickySessionId = 0);
+	bool cancelAsyncGet(const Options &options, const GetCallback &callback);
 	SessionPtr get(const Options &options, Ticket *ticket);
 	void setMax(unsigned int max);
 	void setMaxIdleTime(unsigned long long value);
+	void setAutoscalerConfig(const AutoscalerConfig &config);
+	void setMemoryRecyclingConfig(const MemoryRecyclingConfig &config);
+	void setCapacitySchedulerConfig(const CapacitySchedulerConfig &config);
 	void enableSelfChecking(bool enabled);
 	bool isSpawning(bool lock = true) const;
 	bool authorizeByApiKey(const ApiKey &key, bool lock = true) const;
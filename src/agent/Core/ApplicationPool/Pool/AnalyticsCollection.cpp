@@ -87,6 +87,8 @@ Pool::collectPids(const ProcessList &processes, vector<pid_t> &pids) {
 void
 Pool::updateProcessMetrics(const ProcessList &processes,
 	const ProcessMetricMap &allMetrics,
+	const MemoryRecyclingConfig &memoryRecyclingConfig,
+	unsigned long long now,
 	vector<ProcessPtr> &processesToDetach)
 {
 	foreach (const ProcessPtr &process, processes) {
@@ -94,6 +96,8 @@ Pool::updateProcessMetrics(const ProcessList &processes,
 			allMetrics.find(process->getPid());
 		if (metrics_it != allMetrics.end()) {
 			process->metrics = metrics_it->second;
+			process->memoryTrend.addSample(now,
+				memoryRecyclingConfig.measure(metrics_it->second));
 		// If the process is missing from 'allMetrics' then either 'ps'
 		// failed or the process really is gone. We double check by sending
 		// it a signal.
@@ -105,6 +109,119 @@ Pool::updateProcessMetrics(const ProcessList &processes,
 	}
 }
 
+/**
+ * Returns the number of processes that are being recycled because they
+ * exceeded their group's memory limit, including the ones that have been
+ * detached but haven't exited yet.
+ */
+unsigned int
+Pool::countRecyclingProcesses() const {
+	unsigned int result = 0;
+	GroupMap::ConstIterator g_it(groups);
+
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		const ProcessList *lists[] = {
+			&group->disablingProcesses,
+			&group->disabledProcesses,
+			&group->detachedProcesses
+		};
+		for (unsigned int i = 0; i < sizeof(lists) / sizeof(ProcessList *); i++) {
+			foreach (const ProcessPtr &process, *lists[i]) {
+				if (process->recycling) {
+					result++;
+				}
+			}
+		}
+		g_it.next();
+	}
+	return result;
+}
+
+/**
+ * Recycles the enabled processes that use more memory than their group's
+ * `memoryLimit` allows, largest first. A process is only recycled once it
+ * has exceeded the limit in `memoryRecyclingConfig.minSamplesOverLimit`
+ * consecutive samples. At most `memoryRecyclingConfig.maxConcurrentRecycles`
+ * processes are recycled at the same time, so that the pool doesn't lose too
+ * much capacity at once; the remaining offenders are dealt with in a later
+ * analytics collection round.
+ *
+ * Processes that already exceeded the limit in their first sample are not
+ * recycled: their replacements would exceed it too. This is logged once per
+ * group and limit.
+ */
+void
+Pool::enforceMemoryLimits(boost::container::vector<Callback> &postLockActions) {
+	vector< pair<size_t, ProcessPtr> > offenders;
+	GroupMap::ConstIterator g_it(groups);
+	unsigned int minSamples = std::max(memoryRecyclingConfig.minSamplesOverLimit, 1u);
+
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		if (group->options.memoryLimit > 0 && group->isAlive() && !group->restarting()) {
+			size_t limit = (size_t) group->options.memoryLimit * 1024;
+			foreach (const ProcessPtr &process, group->enabledProcesses) {
+				const MemoryTrend &trend = process->memoryTrend;
+				if (process->recycling
+				 || process->oobwStatus != Process::OOBW_NOT_ACTIVE
+				 || trend.getSampleCount() == 0
+				 || trend.getCurrent() <= limit)
+				{
+					continue;
+				}
+
+				if (trend.getInitial() > limit) {
+					if (group->memoryLimitExceededAtStartLogged != group->options.memoryLimit) {
+						P_WARN("Process " << process->inspect() << " already used " <<
+							(trend.getInitial() / 1024) << " MB of memory when it started, "
+							"which exceeds the memory limit of " << group->options.memoryLimit <<
+							" MB of group " << group->getName() << ". Processes like this "
+							"are not recycled, because their replacements would exceed "
+							"the limit too. Please raise the memory limit");
+						group->memoryLimitExceededAtStartLogged = group->options.memoryLimit;
+					}
+				} else if (trend.countRecentSamplesAbove(limit) >= minSamples) {
+					offenders.push_back(make_pair(trend.getCurrent(), process));
+				}
+			}
+		}
+		g_it.next();
+	}
+
+	if (offenders.empty()) {
+		return;
+	}
+
+	std::sort(offenders.begin(), offenders.end(),
+		std::greater< pair<size_t, ProcessPtr> >());
+	unsigned int max = memoryRecyclingConfig.maxConcurrentRecycles;
+	unsigned int recycling = countRecyclingProcesses();
+	vector< pair<size_t, ProcessPtr> >::const_iterator it;
+
+	for (it = offenders.begin(); it != offenders.end(); it++) {
+		const ProcessPtr &process = it->second;
+		if (max != 0 && recycling >= max) {
+			P_DEBUG((offenders.end() - it) << " process(es) exceed their memory limit, "
+				"but " << recycling << " process(es) are already being recycled; "
+				"deferring");
+			break;
+		}
+		if (!process->isAlive() || process->enabled != Process::ENABLED) {
+			continue;
+		}
+
+		Group *group = process->getGroup();
+		P_WARN("Process " << process->inspect() << " uses " << (it->first / 1024) <<
+			" MB of memory (growing by " << (long long) process->memoryTrend.getGrowthRate() <<
+			" KB/min), which exceeds the memory limit of " << group->options.memoryLimit <<
+			" MB of group " << group->getName() << ". Recycling it");
+		if (group->recycle(process, postLockActions)) {
+			recycling++;
+		}
+	}
+}
+
 void
 Pool::realCollectAnalytics() {
 	TRACE_POINT();
@@ -159,17 +276,22 @@ Pool::realCollectAnalytics() {
 		UPDATE_TRACE_POINT();
 		vector<ProcessPtr> processesToDetach;
 		boost::container::vector<Callback> actions;
+		unsigned long long now = SystemTime::getUsec();
 		ScopedLock l(syncher);
 		GroupMap::ConstIterator g_it(groups);
 
 		UPDATE_TRACE_POINT();
 		while (*g_it != NULL) {
 			const GroupPtr &group = g_it.getValue();
-			updateProcessMetrics(group->enabledProcesses, processMetrics, processesToDetach);
-			updateProcessMetrics(group->disablingProcesses, processMetrics, processesToDetach);
-			updateProcessMetrics(group->disabledProcesses, processMetrics, processesToDetach);
+			updateProcessMetrics(group->enabledProcesses, processMetrics,
+				memoryRecyclingConfig, now, processesToDetach);
+			updateProcessMetrics(group->disablingProcesses, processMetrics,
+				memoryRecyclingConfig, now, processesToDetach);
+			updateProcessMetrics(group->disabledProcesses, processMetrics,
+				memoryRecyclingConfig, now, processesToDetach);
 			g_it.next();
 		}
+		structureChanged();
 
 		UPDATE_TRACE_POINT();
 		foreach (const ProcessPtr process, processesToDetach) {
@@ -178,6 +300,9 @@ Pool::realCollectAnalytics() {
 		UPDATE_TRACE_POINT();
 		processesToDetach.clear();
 
+		UPDATE_TRACE_POINT();
+		enforceMemoryLimits(actions);
+
 		l.unlock();
 
 		UPDATE_TRACE_POINT();
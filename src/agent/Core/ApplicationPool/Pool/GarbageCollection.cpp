@@ -113,7 +113,7 @@ Pool::garbageCollectProcessesInGroup(GarbageCollectorState &state,
 	p_it  = processesToGc.begin();
 	p_end = processesToGc.end();
 	while (p_it != p_end
-	 && (unsigned long) group->getProcessCount() > group->options.minProcesses)
+	 && (unsigned long) group->getProcessCount() > group->getProcessLowerLimit())
 	{
 		ProcessPtr process = *p_it;
 		P_DEBUG("Garbage collect idle process: " << process->inspect() <<
@@ -138,6 +138,127 @@ Pool::maybeCleanPreloader(GarbageCollectorState &state, const GroupPtr &group) {
 	}
 }
 
+void
+Pool::abortExpiredGetWaiters(GarbageCollectorState &state) {
+	GroupMap::ConstIterator g_it(groups);
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		group->abortExpiredGetWaiters(state.now, state.actions);
+		foreach (const GetWaiter &waiter, group->getWaitlist) {
+			if (waiter.deadline != 0) {
+				maybeUpdateNextGcRuntime(state, waiter.deadline);
+			}
+		}
+		g_it.next();
+	}
+
+	vector<GetWaiter>::iterator it = getWaitlist.begin();
+	while (it != getWaitlist.end()) {
+		if (it->expired(state.now)) {
+			P_DEBUG("Request waited for more than " << it->options->maxRequestQueueTime <<
+				" seconds in the top-level queue; aborting it");
+			state.actions.push_back(boost::bind(GetCallback::call,
+				it->callback, SessionPtr(),
+				boost::make_shared<RequestQueueTimeoutException>(
+					it->options->maxRequestQueueTime)));
+			it = getWaitlist.erase(it);
+			structureChanged();
+		} else {
+			if (it->deadline != 0) {
+				maybeUpdateNextGcRuntime(state, it->deadline);
+			}
+			it++;
+		}
+	}
+}
+
+/**
+ * Lets the group's autoscaler predict how many processes the group needs.
+ * Raising the target makes the group spawn up to it, because the target acts
+ * as a lower process limit. When the target goes down, the least recently
+ * used idle process above the target is detached. Busy processes are never
+ * detached by the autoscaler.
+ */
+void
+Pool::autoscaleGroup(GarbageCollectorState &state, const GroupPtr &group) {
+	Autoscaler &autoscaler = group->autoscaler;
+
+	if (!group->isAlive() || group->restarting()) {
+		return;
+	}
+	if (!autoscaler.shouldEvaluate(autoscalerConfig, state.now)) {
+		maybeUpdateNextGcRuntime(state, autoscaler.getNextEvaluationTime(autoscalerConfig));
+		return;
+	}
+
+	// Processes may differ in how many concurrent requests they can handle,
+	// e.g. after a restart with different settings, so average over all
+	// enabled processes. Processes that handle an unlimited number of
+	// concurrent requests (0) or that haven't told us yet (-1) are left out.
+	unsigned int concurrency = group->getWaitlist.size();
+	unsigned int totalProcessConcurrency = 0;
+	unsigned int limitedProcesses = 0;
+	ProcessList::const_iterator p_it, p_end = group->enabledProcesses.end();
+	for (p_it = group->enabledProcesses.begin(); p_it != p_end; p_it++) {
+		concurrency += (*p_it)->sessions;
+		if ((*p_it)->getConcurrency() > 0) {
+			totalProcessConcurrency += (*p_it)->getConcurrency();
+			limitedProcesses++;
+		}
+	}
+	double processConcurrency = 0;
+	if (limitedProcesses > 0) {
+		processConcurrency = totalProcessConcurrency / (double) limitedProcesses;
+	}
+
+	unsigned int minBound = std::max<unsigned int>(autoscalerConfig.minProcesses,
+		group->options.minProcesses);
+	unsigned int maxBound = max;
+	if (autoscalerConfig.maxProcesses != 0) {
+		maxBound = std::min(maxBound, autoscalerConfig.maxProcesses);
+	}
+	if (group->options.maxProcesses != 0) {
+		maxBound = std::min<unsigned int>(maxBound, group->options.maxProcesses);
+	}
+	minBound = std::min(minBound, maxBound);
+
+	unsigned int oldTarget = autoscaler.getTarget();
+	Autoscaler::Decision decision = autoscaler.evaluate(autoscalerConfig, state.now,
+		concurrency, processConcurrency, minBound, maxBound);
+	structureChanged();
+	if (decision != Autoscaler::AD_NONE) {
+		P_INFO("Autoscaler for group " << group->getName() << ": " <<
+			Autoscaler::decisionToString(decision) << " from " << oldTarget <<
+			" to " << autoscaler.getTarget() << " processes (predicted concurrency: " <<
+			autoscaler.getPredictedConcurrency() << ")");
+	}
+
+	if (decision == Autoscaler::AD_SCALE_UP) {
+		if (group->shouldSpawn()) {
+			group->spawn();
+		}
+	} else if (decision == Autoscaler::AD_SCALE_DOWN
+		&& group->getProcessCount() > group->getProcessLowerLimit())
+	{
+		ProcessPtr oldestIdleProcess;
+		for (p_it = group->enabledProcesses.begin(); p_it != p_end; p_it++) {
+			const ProcessPtr &process = *p_it;
+			if (process->sessions == 0
+			 && (oldestIdleProcess == NULL || process->lastUsed < oldestIdleProcess->lastUsed))
+			{
+				oldestIdleProcess = process;
+			}
+		}
+		if (oldestIdleProcess != NULL) {
+			P_DEBUG("Autoscaler detaching idle process: " << oldestIdleProcess->inspect() <<
+				", group=" << group->getName());
+			group->detach(oldestIdleProcess, state.actions);
+		}
+	}
+
+	maybeUpdateNextGcRuntime(state, autoscaler.getNextEvaluationTime(autoscalerConfig));
+}
+
 unsigned long long
 Pool::realGarbageCollect() {
 	TRACE_POINT();
@@ -159,6 +280,11 @@ Pool::realGarbageCollect() {
 			garbageCollectProcessesInGroup(state, group);
 		}
 
+		if (autoscalerConfig.enabled) {
+			// ...spawn or detach processes as predicted by the autoscaler.
+			autoscaleGroup(state, group);
+		}
+
 		group->verifyInvariants();
 
 		// ...cleanup the spawner if it's been idle for more than preloaderIdleTime.
@@ -167,8 +293,10 @@ Pool::realGarbageCollect() {
 		g_it.next();
 	}
 
+	// ...abort get actions that have been queued for longer than allowed.
+	abortExpiredGetWaiters(state);
+
 	verifyInvariants();
-	lock.unlock();
 
 	// Schedule next garbage collection run.
 	unsigned long long sleepTime;
@@ -181,6 +309,8 @@ Pool::realGarbageCollect() {
 	} else {
 		sleepTime = state.nextGcRunTime - state.now;
 	}
+	nextGarbageCollectionTime = state.now + sleepTime;
+	lock.unlock();
 	P_DEBUG("Garbage collection done; next garbage collect in " <<
 		std::fixed << std::setprecision(3) << (sleepTime / 1000000.0) << " sec");
 
@@ -196,6 +326,20 @@ Pool::wakeupGarbageCollector() {
 	garbageCollectionCond.notify_all();
 }
 
+/**
+ * Ensures that the garbage collector runs no later than the given time (usec).
+ * Only wakes up the garbage collector if it wasn't going to run by then anyway,
+ * so this is cheap to call on every queued request.
+ * Must be called while holding the lock.
+ */
+void
+Pool::scheduleGarbageCollectionBefore(unsigned long long time) {
+	if (nextGarbageCollectionTime == 0 || time < nextGarbageCollectionTime) {
+		nextGarbageCollectionTime = time;
+		garbageCollectionCond.notify_all();
+	}
+}
+
 
 } // namespace ApplicationPool2
 } // namespace Passenger
@@ -122,7 +122,7 @@ Pool::verifyExpensiveInvariants() const {
 	for (it = getWaitlist.begin(); it != end; it++) {
 		const GetWaiter &waiter = *it;
 		const GroupPtr *group;
-		assert(!groups.lookup(waiter.options.getAppGroupName(), &group));
+		assert(!groups.lookup(waiter.options->getAppGroupName(), &group));
 	}
 	#endif
 }
@@ -152,16 +152,30 @@ Pool::fullVerifyInvariants() const {
 void
 Pool::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions) {
 	bool done = false;
+	unsigned long long now = 0;
 	vector<GetWaiter>::iterator it, end = getWaitlist.end();
 	vector<GetWaiter> newWaitlist;
 
 	for (it = getWaitlist.begin(); it != end && !done; it++) {
 		GetWaiter &waiter = *it;
 
-		Group *group = findMatchingGroup(waiter.options);
+		if (waiter.deadline != 0) {
+			if (now == 0) {
+				now = SystemTime::getUsec();
+			}
+			if (waiter.expired(now)) {
+				postLockActions.push_back(boost::bind(GetCallback::call,
+					waiter.callback, SessionPtr(),
+					boost::make_shared<RequestQueueTimeoutException>(
+						waiter.options->maxRequestQueueTime)));
+				continue;
+			}
+		}
+
+		Group *group = findMatchingGroup(*waiter.options);
 		if (group != NULL) {
-			SessionPtr session = group->get(waiter.options, waiter.callback,
-				postLockActions);
+			SessionPtr session = group->get(*waiter.options, waiter.callback,
+				postLockActions, waiter.queuedAt, waiter.stickySessionId);
 			if (session != NULL) {
 				postLockActions.push_back(boost::bind(GetCallback::call,
 					waiter.callback, session, ExceptionPtr()));
@@ -170,8 +184,8 @@ Pool::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockAct
 			 *       the group's get wait list.
 			 */
 		} else if (!atFullCapacityUnlocked()) {
-			createGroupAndAsyncGetFromIt(waiter.options, waiter.callback,
-				postLockActions);
+			createGroupAndAsyncGetFromIt(*waiter.options, waiter.callback,
+				postLockActions, waiter.queuedAt, waiter.stickySessionId);
 		} else {
 			/* Still cannot satisfy this get request. Keep it on the get
 			 * wait list and try again later.
@@ -180,6 +194,9 @@ Pool::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockAct
 		}
 	}
 
+	if (getWaitlist.size() != newWaitlist.size()) {
+		structureChanged();
+	}
 	std::swap(getWaitlist, newWaitlist);
 }
 
@@ -83,17 +83,19 @@ Pool::createGroup(const Options &options) {
 	GroupPtr group = boost::make_shared<Group>(this, options);
 	group->initialize();
 	groups.insert(options.getAppGroupName(), group);
+	structureChanged();
 	wakeupGarbageCollector();
 	return group;
 }
 
 GroupPtr
 Pool::createGroupAndAsyncGetFromIt(const Options &options,
-	const GetCallback &callback, boost::container::vector<Callback> &postLockActions)
+	const GetCallback &callback, boost::container::vector<Callback> &postLockActions,
+	unsigned long long now, unsigned int stickySessionId)
 {
 	GroupPtr group = createGroup(options);
 	SessionPtr session = group->get(options, callback,
-		postLockActions);
+		postLockActions, now, stickySessionId);
 	/* If !options.noop, then the callback should now have been put on the
 	 * wait list, unless something has changed and we forgot to update
 	 * some code here...
@@ -40,6 +40,7 @@ using namespace boost;
 
 Pool::Pool(Context *_context)
 	: context(_context),
+	  stateGeneration(0),
 	  abortLongRunningConnectionsCallback(NULL)
 {
 	try {
@@ -52,6 +53,7 @@ Pool::Pool(Context *_context)
 	max          = 6;
 	maxIdleTime  = 60 * 1000000;
 	selfchecking = true;
+	nextGarbageCollectionTime = 0;
 	palloc       = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
 
 	// The following code only serve to instantiate certain inline methods
@@ -95,11 +97,15 @@ Pool::prepareForShutdown() {
 	ScopedLock lock(syncher);
 	assert(lifeStatus == ALIVE);
 	lifeStatus = PREPARED_FOR_SHUTDOWN;
+	structureChanged();
 	if (abortLongRunningConnectionsCallback) {
 		vector<ProcessPtr> processes = getProcesses(false);
+		autoscalerConfig.enabled = false;
 		foreach (ProcessPtr process, processes) {
 			// Ensure that the process is not immediately respawned.
 			process->getGroup()->options.minProcesses = 0;
+			process->getGroup()->inspectionCache.reset();
+			process->getGroup()->autoscaler.reset();
 			abortLongRunningConnectionsCallback(process);
 		}
 	}
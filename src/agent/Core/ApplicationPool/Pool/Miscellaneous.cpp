@@ -40,8 +40,18 @@ using namespace boost;
 
 // 'lockNow == false' may only be used during unit tests. Normally we
 // should never call the callback while holding the lock.
+//
+// 'now' is the time (usec) at which the caller started this get action. It
+// overrides `options.currentTime`, so that callers that share one Options
+// object between requests can still save the pool from reading the clock
+// while holding the lock. If both are 0, the pool reads the clock itself.
+//
+// 'stickySessionId' likewise overrides `options.stickySessionId`, so that
+// sticky requests don't need a private copy of shared Options.
 void
-Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow) {
+Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow,
+	unsigned long long now, unsigned int stickySessionId)
+{
 	DynamicScopedLock lock(syncher, lockNow);
 
 	assert(lifeStatus == ALIVE || lifeStatus == PREPARED_FOR_SHUTDOWN);
@@ -55,7 +65,8 @@ Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow
 		/* Best case: the app group is already in the pool. Let's use it. */
 		P_TRACE(2, "Found existing Group");
 		existingGroup->verifyInvariants();
-		SessionPtr session = existingGroup->get(options, callback, actions);
+		SessionPtr session = existingGroup->get(options, callback, actions, now,
+			stickySessionId);
 		existingGroup->verifyInvariants();
 		verifyInvariants();
 		P_TRACE(2, "asyncGet() finished");
@@ -72,7 +83,7 @@ Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow
 		 */
 		P_DEBUG("Spawning new Group");
 		GroupPtr group = createGroupAndAsyncGetFromIt(options,
-			callback, actions);
+			callback, actions, now, stickySessionId);
 		group->verifyInvariants();
 		verifyInvariants();
 		P_DEBUG("asyncGet() finished");
@@ -92,9 +103,21 @@ Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow
 			 * become available.
 			 */
 			P_DEBUG("Could not free a process; putting request to top-level getWaitlist");
-			getWaitlist.push_back(GetWaiter(
-				options.copyAndPersist(),
-				callback));
+			if (now == 0) {
+				now = (options.currentTime != 0) ? options.currentTime : SystemTime::getUsec();
+			}
+			GetWaiter waiter(options, callback, now, stickySessionId);
+			// Keep the top-level getWaitlist ordered by request priority,
+			// and FIFO within a priority class.
+			vector<GetWaiter>::iterator it = getWaitlist.begin();
+			while (it != getWaitlist.end() && it->priority <= waiter.priority) {
+				it++;
+			}
+			getWaitlist.insert(it, waiter);
+			structureChanged();
+			if (waiter.deadline != 0) {
+				scheduleGarbageCollectionBefore(waiter.deadline);
+			}
 		} else {
 			/* Now that a process has been trashed we can create
 			 * the missing Group.
@@ -102,7 +125,7 @@ Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow
 			P_DEBUG("Creating new Group");
 			GroupPtr group = createGroup(options);
 			SessionPtr session = group->get(options, callback,
-				actions);
+				actions, now, stickySessionId);
 			/* The Group is now spawning a process so the callback
 			 * should now have been put on the wait list,
 			 * unless something has changed and we forgot to update
@@ -138,6 +161,41 @@ Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow
 	}
 }
 
+/**
+ * Cancels a get action that was previously started with asyncGet() using
+ * the given options and callback, if it is still queued. Returns true if the
+ * action was canceled, in which case the callback will never be called.
+ * Returns false if the callback has already been called or is about to be
+ * called.
+ *
+ * This must be called before `options` become invalid if they were marked
+ * as `ownedByCaller`.
+ */
+bool
+Pool::cancelAsyncGet(const Options &options, const GetCallback &callback) {
+	LockGuard l(syncher);
+
+	Group *group = findMatchingGroup(options);
+	if (group != NULL && group->cancelGetWaiter(callback)) {
+		P_TRACE(2, "Canceled queued get action for group " << group->getName());
+		group->verifyInvariants();
+		return true;
+	}
+
+	vector<GetWaiter>::iterator it, end = getWaitlist.end();
+	for (it = getWaitlist.begin(); it != end; it++) {
+		if (it->matches(callback)) {
+			getWaitlist.erase(it);
+			structureChanged();
+			P_TRACE(2, "Canceled queued get action in top-level queue");
+			verifyInvariants();
+			return true;
+		}
+	}
+
+	return false;
+}
+
 // TODO: 'ticket' should be a boost::shared_ptr for interruption-safety.
 SessionPtr
 Pool::get(const Options &options, Ticket *ticket) {
@@ -172,6 +230,7 @@ Pool::setMax(unsigned int max) {
 	fullVerifyInvariants();
 	bool bigger = max > this->max;
 	this->max = max;
+	structureChanged();
 	if (bigger) {
 		/* If there are clients waiting for resources
 		 * to become free, spawn more processes now that
@@ -201,6 +260,34 @@ Pool::setMaxIdleTime(unsigned long long value) {
 	wakeupGarbageCollector();
 }
 
+void
+Pool::setAutoscalerConfig(const AutoscalerConfig &config) {
+	LockGuard l(syncher);
+	autoscalerConfig = config;
+	structureChanged();
+	if (!config.enabled) {
+		GroupMap::ConstIterator g_it(groups);
+		while (*g_it != NULL) {
+			g_it.getValue()->autoscaler.reset();
+			g_it.next();
+		}
+	}
+	wakeupGarbageCollector();
+}
+
+void
+Pool::setMemoryRecyclingConfig(const MemoryRecyclingConfig &config) {
+	LockGuard l(syncher);
+	memoryRecyclingConfig = config;
+}
+
+void
+Pool::setCapacitySchedulerConfig(const CapacitySchedulerConfig &config) {
+	LockGuard l(syncher);
+	capacitySchedulerConfig = config;
+	structureChanged();
+}
+
 void
 Pool::enableSelfChecking(bool enabled) {
 	LockGuard l(syncher);
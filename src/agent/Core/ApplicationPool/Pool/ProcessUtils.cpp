@@ -45,54 +45,124 @@ using namespace boost;
  ****************************/
 
 
-ProcessPtr
-Pool::findOldestIdleProcess(const Group *exclude) const {
-	ProcessPtr oldestIdleProcess;
+bool
+Pool::compareCapacitySurplus(const pair<int, Group *> &a, const pair<int, Group *> &b) {
+	return a.first < b.first;
+}
 
+/**
+ * Collects the capacity claims of all groups (in `groupList`, in the same
+ * order) and divides the pool's capacity over them. If `requester` is given,
+ * then that group is assumed to need at least one process more than it has.
+ */
+void
+Pool::collectCapacityClaims(vector<Group *> &groupList, vector<CapacityClaim> &claims,
+	const Group *requester) const
+{
 	GroupMap::ConstIterator g_it(groups);
+
+	groupList.reserve(groups.size());
+	claims.reserve(groups.size());
 	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (group.get() == exclude) {
-			g_it.next();
-			continue;
-		}
-		const ProcessList &processes = group->enabledProcesses;
-		ProcessList::const_iterator p_it, p_end = processes.end();
-		for (p_it = processes.begin(); p_it != p_end; p_it++) {
-			const ProcessPtr process = *p_it;
-			if (process->busyness() == 0
-			     && (oldestIdleProcess == NULL
-			         || process->lastUsed < oldestIdleProcess->lastUsed)
-			) {
-				oldestIdleProcess = process;
-			}
+		Group *group = g_it.getValue().get();
+		CapacityClaim claim = group->getCapacityClaim();
+		if (group == requester) {
+			claim.demand = std::max(claim.demand, group->capacityUsed() + 1);
 		}
+		groupList.push_back(group);
+		claims.push_back(claim);
 		g_it.next();
 	}
 
-	return oldestIdleProcess;
+	computeCapacityShares(claims, max);
 }
 
+/**
+ * Finds an idle process whose capacity can be given to `requester` (which
+ * may be NULL if the requesting group doesn't exist yet). Processes are
+ * taken from the group that exceeds its share of the capacity the most,
+ * and within that group, the one that has been idle the longest. Groups
+ * never lose processes that they have reserved.
+ *
+ * If `rebalancing` is true, `requester` already has processes and wants
+ * more. The capacity is then only taken if `requester` is below its share,
+ * and only from a group that is above its share (so that the victim is
+ * not entitled to win the process back right away), and only from
+ * processes older than the anti-thrashing hysteresis.
+ */
 ProcessPtr
-Pool::findBestProcessToTrash() const {
-	ProcessPtr oldestProcess;
+Pool::findBestProcessToEvict(const Group *requester, bool rebalancing,
+	unsigned long long now) const
+{
+	vector<Group *> groupList;
+	vector<CapacityClaim> claims;
+	ProcessPtr bestProcess;
+	int bestSurplus = 0;
+	unsigned int i;
+
+	collectCapacityClaims(groupList, claims, rebalancing ? requester : NULL);
+
+	if (rebalancing) {
+		for (i = 0; i < groupList.size(); i++) {
+			if (groupList[i] == requester
+			 && requester->capacityUsed() >= claims[i].share)
+			{
+				return ProcessPtr();
+			}
+		}
+	}
+
+	for (i = 0; i < groupList.size(); i++) {
+		const Group *group = groupList[i];
+		unsigned int used = group->capacityUsed();
+		int surplus = (int) used - (int) claims[i].share;
+
+		if (group == requester
+		 || used <= group->options.capacityReservation
+		 || (rebalancing && surplus <= 0))
+		{
+			continue;
+		}
 
-	GroupMap::ConstIterator g_it(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
 		const ProcessList &processes = group->enabledProcesses;
 		ProcessList::const_iterator p_it, p_end = processes.end();
 		for (p_it = processes.begin(); p_it != p_end; p_it++) {
-			const ProcessPtr process = *p_it;
-			if (oldestProcess == NULL
-			 || process->lastUsed < oldestProcess->lastUsed) {
-				oldestProcess = process;
+			const ProcessPtr &process = *p_it;
+			if (process->busyness() != 0) {
+				continue;
+			}
+			if (rebalancing && process->getSpawnEndTime()
+				+ capacitySchedulerConfig.rebalanceHysteresis > now)
+			{
+				continue;
+			}
+			if (bestProcess == NULL
+			 || surplus > bestSurplus
+			 || (surplus == bestSurplus && process->lastUsed < bestProcess->lastUsed))
+			{
+				bestProcess = process;
+				bestSurplus = surplus;
 			}
 		}
-		g_it.next();
 	}
 
-	return oldestProcess;
+	return bestProcess;
+}
+
+/**
+ * Calls Group::detach() so be sure to fix up the invariants afterwards.
+ */
+void
+Pool::evictProcessForCapacity(const ProcessPtr &process, unsigned long long now,
+	boost::container::vector<Callback> &postLockActions)
+{
+	Group *group = process->getGroup();
+	assert(group != NULL);
+	assert(group->getWaitlist.empty());
+
+	group->capacityEvictions++;
+	group->lastCapacityEvictionTime = now;
+	group->detach(process, postLockActions);
 }
 
 /**
@@ -103,16 +173,67 @@ ProcessPtr
 Pool::forceFreeCapacity(const Group *exclude,
 	boost::container::vector<Callback> &postLockActions)
 {
-	ProcessPtr process = findOldestIdleProcess(exclude);
+	unsigned long long now = SystemTime::getUsec();
+	ProcessPtr process = findBestProcessToEvict(exclude, false, now);
 	if (process != NULL) {
 		P_DEBUG("Forcefully detaching process " << process->inspect() <<
 			" in order to free capacity in the pool");
+		evictProcessForCapacity(process, now, postLockActions);
+	}
+	return process;
+}
 
-		Group *group = process->getGroup();
-		assert(group != NULL);
-		assert(group->getWaitlist.empty());
+/**
+ * Called when `requester` needs another process while the pool is full.
+ * Detaches a process of another group if `requester` is below its share of
+ * the capacity; see findBestProcessToEvict(). A group that recently lost a
+ * process in this way cannot take one back until the hysteresis period has
+ * passed, which keeps groups from trading processes back and forth. A
+ * group that took a process cannot take another one within that period
+ * either.
+ *
+ * Finding a process to detach means going over all groups, so after a
+ * failed attempt a group waits CAPACITY_REBALANCE_RETRY_INTERVAL (or the
+ * hysteresis, if shorter) before trying again. Requests that arrive in
+ * between simply wait for capacity.
+ *
+ * Calls Group::detach() so be sure to fix up the invariants afterwards.
+ */
+ProcessPtr
+Pool::rebalanceCapacity(Group *requester,
+	boost::container::vector<Callback> &postLockActions)
+{
+	unsigned long long hysteresis = capacitySchedulerConfig.rebalanceHysteresis;
+	if (hysteresis == 0) {
+		return ProcessPtr();
+	}
 
-		group->detach(process, postLockActions);
+	unsigned long long now = SystemTime::getUsec();
+	if (requester->lastCapacityEvictionTime != 0
+	 && requester->lastCapacityEvictionTime + hysteresis > now)
+	{
+		return ProcessPtr();
+	}
+	if (requester->lastCapacityRebalanceTime != 0
+	 && requester->lastCapacityRebalanceTime + hysteresis > now)
+	{
+		return ProcessPtr();
+	}
+	if (requester->lastCapacityRebalanceAttemptTime != 0
+	 && requester->lastCapacityRebalanceAttemptTime
+	    + std::min<unsigned long long>(hysteresis, CAPACITY_REBALANCE_RETRY_INTERVAL) > now)
+	{
+		return ProcessPtr();
+	}
+	requester->lastCapacityRebalanceAttemptTime = now;
+
+	ProcessPtr process = findBestProcessToEvict(requester, true, now);
+	if (process != NULL) {
+		requester->lastCapacityRebalanceTime = now;
+		P_INFO("Detaching process " << process->inspect() << " of group "
+			<< process->getGroup()->getName() << " to give its capacity to group "
+			<< requester->getName() << ", which is below its share of the pool");
+		evictProcessForCapacity(process, now, postLockActions);
 	}
 	return process;
 }
@@ -168,19 +289,28 @@ Pool::possiblySpawnMoreProcessesForExistingGroups() {
 		g_it.next();
 	}
 	/* Now look for Groups that haven't maximized their allowed capacity
-	 * yet, and spawn processes in those groups.
+	 * yet, and spawn processes in those groups. The groups that are the
+	 * furthest below their share of the capacity go first.
 	 */
-	g_it = GroupMap::ConstIterator(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (group->shouldSpawn()) {
-			P_DEBUG("Group " << group->getName() << " requests more processes to be spawned");
-			group->spawn();
-			if (atFullCapacityUnlocked()) {
-				return;
-			}
+	vector<Group *> groupList;
+	vector<CapacityClaim> claims;
+	vector< pair<int, Group *> > candidates;
+	collectCapacityClaims(groupList, claims);
+	for (unsigned int i = 0; i < groupList.size(); i++) {
+		if (groupList[i]->shouldSpawn()) {
+			candidates.push_back(make_pair(
+				(int) groupList[i]->capacityUsed() - (int) claims[i].share,
+				groupList[i]));
+		}
+	}
+	std::stable_sort(candidates.begin(), candidates.end(), compareCapacitySurplus);
+	for (unsigned int i = 0; i < candidates.size(); i++) {
+		Group *group = candidates[i].second;
+		P_DEBUG("Group " << group->getName() << " requests more processes to be spawned");
+		group->spawn();
+		if (atFullCapacityUnlocked()) {
+			return;
 		}
-		g_it.next();
 	}
 }
 
@@ -68,21 +68,82 @@ Pool::atFullCapacityUnlocked() const {
 	return capacityUsedUnlocked() >= max;
 }
 
+/**
+ * Must be called, while holding the lock, after changing anything that
+ * `createStateSnapshotUnlocked()` copies, so that `getStateSnapshot()`
+ * takes a new snapshot. Changes to the counters in Process::LiveCounters
+ * don't need this.
+ */
+void
+Pool::structureChanged() {
+	stateGeneration.fetch_add(1, boost::memory_order_relaxed);
+}
+
+Pool::StateSnapshotPtr
+Pool::createStateSnapshotUnlocked() const {
+	boost::shared_ptr<StateSnapshot> snapshot = boost::make_shared<StateSnapshot>();
+	GroupMap::ConstIterator g_it(groups);
+
+	snapshot->generation = stateGeneration.load(boost::memory_order_relaxed);
+	snapshot->max = max;
+	snapshot->capacityUsed = capacityUsedUnlocked();
+	snapshot->processCount = getProcessCount(false);
+
+	snapshot->getWaitlist.reserve(getWaitlist.size());
+	foreach (const GetWaiter &waiter, getWaitlist) {
+		snapshot->getWaitlist.push_back(waiter.options->getAppGroupName());
+	}
+
+	snapshot->groups.reserve(groups.size());
+	while (*g_it != NULL) {
+		snapshot->groups.push_back(Group::Snapshot(*g_it.getValue()));
+		g_it.next();
+	}
+
+	vector<Group *> groupList;
+	vector<CapacityClaim> claims;
+	collectCapacityClaims(groupList, claims);
+	for (unsigned int i = 0; i < claims.size(); i++) {
+		snapshot->groups[i].capacityShare = claims[i].share;
+	}
+
+	return snapshot;
+}
+
+bool
+Pool::authorizeSnapshot(const StateSnapshot &snapshot, const AuthenticationOptions &options) {
+	vector<Group::Snapshot>::const_iterator it, end = snapshot.groups.end();
+
+	if (options.apiKey.isSuper() || options.uid == 0 || options.uid == geteuid()) {
+		return true;
+	}
+	for (it = snapshot.groups.begin(); it != end; it++) {
+		if (it->authorizeByUid(options.uid) || it->authorizeByApiKey(options.apiKey)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void
 Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
-	const Group *group, const ProcessList &processes) const
+	const Group::Snapshot &group, Process::EnabledStatus enabled)
 {
-	ProcessList::const_iterator p_it;
-	for (p_it = processes.begin(); p_it != processes.end(); p_it++) {
-		const ProcessPtr &process = *p_it;
+	vector<Process::Snapshot>::const_iterator p_it;
+	for (p_it = group.processes.begin(); p_it != group.processes.end(); p_it++) {
+		const Process::Snapshot &process = *p_it;
 		char buf[128];
 		char cpubuf[10];
 		char membuf[10];
 
-		 if (process->metrics.isValid()) {
-			snprintf(cpubuf, sizeof(cpubuf), "%d%%", (int) process->metrics.cpu);
+		if (process.enabled != enabled) {
+			continue;
+		}
+
+		 if (process.metrics.isValid()) {
+			snprintf(cpubuf, sizeof(cpubuf), "%d%%", (int) process.metrics.cpu);
 			snprintf(membuf, sizeof(membuf), "%ldM",
-				(unsigned long) (process->metrics.realMemory() / 1024));
+				(unsigned long) (process.metrics.realMemory() / 1024));
 		} else {
 			snprintf(cpubuf, sizeof(cpubuf), "0%%");
 			snprintf(membuf, sizeof(membuf), "0M");
@@ -90,32 +151,31 @@ Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
 		snprintf(buf, sizeof(buf),
 			"  * PID: %-5lu   Sessions: %-2u      Processed: %-5u   Uptime: %s\n"
 			"    CPU: %-5s   Memory  : %-5s   Last used: %s ago",
-			(unsigned long) process->getPid(),
-			process->sessions,
-			process->processed,
-			process->uptime().c_str(),
+			(unsigned long) process.pid,
+			process.sessions,
+			process.processed,
+			process.uptime().c_str(),
 			cpubuf,
 			membuf,
-			distanceOfTimeInWords(process->lastUsed / 1000000).c_str());
+			distanceOfTimeInWords(process.lastUsed / 1000000).c_str());
 		result << buf << endl;
 
-		if (process->enabled == Process::DISABLING) {
+		if (process.enabled == Process::DISABLING) {
 			result << "    Disabling..." << endl;
-		} else if (process->enabled == Process::DISABLED) {
+		} else if (process.enabled == Process::DISABLED) {
 			result << "    DISABLED" << endl;
-		} else if (process->enabled == Process::DETACHED) {
+		} else if (process.enabled == Process::DETACHED) {
 			result << "    Shutting down..." << endl;
 		}
 
-		const Socket *socket;
-		if (options.verbose && (socket = process->getSockets().findFirstSocketWithProtocol("http")) != NULL) {
+		const Process::Snapshot::SocketInfo *socket;
+		if (options.verbose && (socket = process.findFirstSocketWithProtocol("http")) != NULL) {
 			result << "    URL     : http://" << replaceString(socket->address, "tcp://", "") << endl;
-			result << "    Password: " << group->getApiKey().toStaticString() << endl;
+			result << "    Password: " << group.apiKey.toStaticString() << endl;
 		}
 	}
 }
 
-
 /****************************
  *
  * Public methods
@@ -125,80 +185,71 @@ Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
 
 string
 Pool::inspect(const InspectOptions &options, bool lock) const {
-	DynamicScopedLock l(syncher, lock);
+	StateSnapshotPtr snapshot = lock
+		? getStateSnapshot()
+		: createStateSnapshotUnlocked();
 	stringstream result;
 	const char *headerColor = maybeColorize(options, ANSI_COLOR_YELLOW ANSI_COLOR_BLUE_BG ANSI_COLOR_BOLD);
 	const char *resetColor  = maybeColorize(options, ANSI_COLOR_RESET);
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
-	{
+	if (!authorizeSnapshot(*snapshot, options)) {
 		throw SecurityException("Operation unauthorized");
 	}
 
 	result << headerColor << "----------- General information -----------" << resetColor << endl;
-	result << "Max pool size : " << max << endl;
-	result << "App groups    : " << groups.size() << endl;
-	result << "Processes     : " << getProcessCount(false) << endl;
-	result << "Requests in top-level queue : " << getWaitlist.size() << endl;
+	result << "Max pool size : " << snapshot->max << endl;
+	result << "App groups    : " << snapshot->groups.size() << endl;
+	result << "Processes     : " << snapshot->processCount << endl;
+	result << "Requests in top-level queue : " << snapshot->getWaitlist.size() << endl;
 	if (options.verbose) {
 		unsigned int i = 0;
-		foreach (const GetWaiter &waiter, getWaitlist) {
-			result << "  " << i << ": " << waiter.options.getAppGroupName() << endl;
+		foreach (const string &appGroupName, snapshot->getWaitlist) {
+			result << "  " << i << ": " << appGroupName << endl;
 			i++;
 		}
 	}
 	result << endl;
 
 	result << headerColor << "----------- Application groups -----------" << resetColor << endl;
-	GroupMap::ConstIterator g_it(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+	foreach (const Group::Snapshot &group, snapshot->groups) {
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
-		ProcessList::const_iterator p_it;
-
-		result << group->getName() << ":" << endl;
-		result << "  App root: " << group->options.appRoot << endl;
-		if (group->restarting()) {
+		result << group.name << ":" << endl;
+		result << "  App root: " << group.appRoot << endl;
+		if (group.restarting) {
 			result << "  (restarting...)" << endl;
 		}
-		if (group->spawning()) {
-			if (group->processesBeingSpawned == 0) {
+		if (group.spawning) {
+			if (group.processesBeingSpawned == 0) {
 				result << "  (spawning...)" << endl;
 			} else {
-				result << "  (spawning " << group->processesBeingSpawned << " new " <<
-					maybePluralize(group->processesBeingSpawned, "process", "processes") <<
+				result << "  (spawning " << group.processesBeingSpawned << " new " <<
+					maybePluralize(group.processesBeingSpawned, "process", "processes") <<
 					"...)" << endl;
 			}
 		}
-		result << "  Requests in queue: " << group->getWaitlist.size() << endl;
-		inspectProcessList(options, result, group.get(), group->enabledProcesses);
-		inspectProcessList(options, result, group.get(), group->disablingProcesses);
-		inspectProcessList(options, result, group.get(), group->disabledProcesses);
-		inspectProcessList(options, result, group.get(), group->detachedProcesses);
+		result << "  Requests in queue: " << group.getWaitlistSize << endl;
+		inspectProcessList(options, result, group, Process::ENABLED);
+		inspectProcessList(options, result, group, Process::DISABLING);
+		inspectProcessList(options, result, group, Process::DISABLED);
+		inspectProcessList(options, result, group, Process::DETACHED);
 		result << endl;
-
-		g_it.next();
 	}
 	return result.str();
 }
 
 string
 Pool::toXml(const ToXmlOptions &options, bool lock) const {
-	DynamicScopedLock l(syncher, lock);
+	StateSnapshotPtr snapshot = lock
+		? getStateSnapshot()
+		: createStateSnapshotUnlocked();
 	stringstream result;
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
-	{
+	if (!authorizeSnapshot(*snapshot, options)) {
 		throw SecurityException("Operation unauthorized");
 	}
 
@@ -206,51 +257,44 @@ Pool::toXml(const ToXmlOptions &options, bool lock) const {
 	result << "<info version=\"3\">";
 
 	result << "<passenger_version>" << PASSENGER_VERSION << "</passenger_version>";
-	result << "<group_count>" << groups.size() << "</group_count>";
-	result << "<process_count>" << getProcessCount(false) << "</process_count>";
-	result << "<max>" << max << "</max>";
-	result << "<capacity_used>" << capacityUsedUnlocked() << "</capacity_used>";
-	result << "<get_wait_list_size>" << getWaitlist.size() << "</get_wait_list_size>";
+	result << "<group_count>" << snapshot->groups.size() << "</group_count>";
+	result << "<process_count>" << snapshot->processCount << "</process_count>";
+	result << "<max>" << snapshot->max << "</max>";
+	result << "<capacity_used>" << snapshot->capacityUsed << "</capacity_used>";
+	result << "<get_wait_list_size>" << snapshot->getWaitlist.size() << "</get_wait_list_size>";
 
 	if (options.secrets) {
-		vector<GetWaiter>::const_iterator w_it, w_end = getWaitlist.end();
-
 		result << "<get_wait_list>";
-		for (w_it = getWaitlist.begin(); w_it != w_end; w_it++) {
-			const GetWaiter &waiter = *w_it;
+		foreach (const string &appGroupName, snapshot->getWaitlist) {
 			result << "<item>";
-			result << "<app_group_name>" << escapeForXml(waiter.options.getAppGroupName()) << "</app_group_name>";
+			result << "<app_group_name>" << escapeForXml(appGroupName) << "</app_group_name>";
 			result << "</item>";
 		}
 		result << "</get_wait_list>";
 	}
 
 	result << "<supergroups>";
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+	foreach (const Group::Snapshot &group, snapshot->groups) {
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
 		result << "<supergroup>";
-		result << "<name>" << escapeForXml(group->getName()) << "</name>";
+		result << "<name>" << escapeForXml(group.name) << "</name>";
 		result << "<state>READY</state>";
 		result << "<get_wait_list_size>0</get_wait_list_size>";
-		result << "<capacity_used>" << group->capacityUsed() << "</capacity_used>";
+		result << "<capacity_used>" << group.capacityUsed << "</capacity_used>";
 		if (options.secrets) {
-			result << "<secret>" << escapeForXml(group->getApiKey().toStaticString()) << "</secret>";
+			result << "<secret>" << escapeForXml(group.apiKey.toStaticString()) << "</secret>";
 		}
 
 		result << "<group default=\"true\">";
-		group->inspectXml(result, options.secrets);
+		group.inspectXml(result, options.secrets);
 		result << "</group>";
 
 		result << "</supergroup>";
-
-		g_it.next();
 	}
 	result << "</supergroups>";
 
@@ -258,42 +302,187 @@ Pool::toXml(const ToXmlOptions &options, bool lock) const {
 	return result.str();
 }
 
+/**
+ * Writes pool, group and process metrics in the Prometheus text exposition
+ * format, rendered from a state snapshot.
+ */
+void
+Pool::writePrometheusMetrics(ostream &stream, const AuthenticationOptions &options) const {
+	StateSnapshotPtr snapshot = getStateSnapshot();
+	vector<const Group::Snapshot *> groupSamples;
+	vector<string> groupLabels;
+	unsigned int i;
+
+	if (!authorizeSnapshot(*snapshot, options)) {
+		throw SecurityException("Operation unauthorized");
+	}
+
+	groupSamples.reserve(snapshot->groups.size());
+	groupLabels.reserve(snapshot->groups.size());
+	foreach (const Group::Snapshot &group, snapshot->groups) {
+		if (group.authorizeByUid(options.uid)
+		 || group.authorizeByApiKey(options.apiKey))
+		{
+			groupSamples.push_back(&group);
+			groupLabels.push_back("app_group=\"" + escapePrometheusLabelValue(group.name)
+				+ "\"");
+		}
+	}
+
+	stream << "# HELP passenger_pool_max Maximum number of application processes.\n";
+	stream << "# TYPE passenger_pool_max gauge\n";
+	stream << "passenger_pool_max " << snapshot->max << "\n";
+	stream << "# HELP passenger_pool_capacity_used Number of process slots in use.\n";
+	stream << "# TYPE passenger_pool_capacity_used gauge\n";
+	stream << "passenger_pool_capacity_used " << snapshot->capacityUsed << "\n";
+	stream << "# HELP passenger_pool_processes Number of application processes.\n";
+	stream << "# TYPE passenger_pool_processes gauge\n";
+	stream << "passenger_pool_processes " << snapshot->processCount << "\n";
+	stream << "# HELP passenger_pool_groups Number of application groups.\n";
+	stream << "# TYPE passenger_pool_groups gauge\n";
+	stream << "passenger_pool_groups " << snapshot->groups.size() << "\n";
+	stream << "# HELP passenger_pool_queue_size Number of requests in the top-level queue.\n";
+	stream << "# TYPE passenger_pool_queue_size gauge\n";
+	stream << "passenger_pool_queue_size " << snapshot->getWaitlist.size() << "\n";
+
+	stream << "# HELP passenger_group_processes Number of processes in the application group.\n";
+	stream << "# TYPE passenger_group_processes gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_processes{" << groupLabels[i] << "} "
+			<< groupSamples[i]->processCount << "\n";
+	}
+	stream << "# HELP passenger_group_capacity_used Number of process slots used by the application group.\n";
+	stream << "# TYPE passenger_group_capacity_used gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_capacity_used{" << groupLabels[i] << "} "
+			<< groupSamples[i]->capacityUsed << "\n";
+	}
+	stream << "# HELP passenger_group_queue_size Number of requests waiting for a process of the application group.\n";
+	stream << "# TYPE passenger_group_queue_size gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_queue_size{" << groupLabels[i] << "} "
+			<< groupSamples[i]->getWaitlistSize << "\n";
+	}
+	stream << "# HELP passenger_group_disable_queue_size Number of pending process disable operations.\n";
+	stream << "# TYPE passenger_group_disable_queue_size gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_disable_queue_size{" << groupLabels[i] << "} "
+			<< groupSamples[i]->disableWaitlistSize << "\n";
+	}
+	stream << "# HELP passenger_group_processes_being_spawned Number of processes being spawned.\n";
+	stream << "# TYPE passenger_group_processes_being_spawned gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_processes_being_spawned{" << groupLabels[i] << "} "
+			<< groupSamples[i]->processesBeingSpawned << "\n";
+	}
+	stream << "# HELP passenger_group_memory_recycles_total Number of processes replaced because they exceeded the memory limit.\n";
+	stream << "# TYPE passenger_group_memory_recycles_total counter\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_memory_recycles_total{" << groupLabels[i] << "} "
+			<< groupSamples[i]->memoryRecycles << "\n";
+	}
+	stream << "# HELP passenger_group_capacity_share Number of process slots that the application group is entitled to.\n";
+	stream << "# TYPE passenger_group_capacity_share gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_capacity_share{" << groupLabels[i] << "} "
+			<< groupSamples[i]->capacityShare << "\n";
+	}
+	stream << "# HELP passenger_group_capacity_denied_spawns_total Number of times that the pool was too full to spawn a process for the application group.\n";
+	stream << "# TYPE passenger_group_capacity_denied_spawns_total counter\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_capacity_denied_spawns_total{" << groupLabels[i] << "} "
+			<< groupSamples[i]->capacityDeniedSpawns << "\n";
+	}
+	stream << "# HELP passenger_group_capacity_evictions_total Number of processes shut down to free capacity for other application groups.\n";
+	stream << "# TYPE passenger_group_capacity_evictions_total counter\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		stream << "passenger_group_capacity_evictions_total{" << groupLabels[i] << "} "
+			<< groupSamples[i]->capacityEvictions << "\n";
+	}
+
+	stream << "# HELP passenger_process_sessions Number of open sessions.\n";
+	stream << "# TYPE passenger_process_sessions gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		foreach (const Process::Snapshot &process, groupSamples[i]->processes) {
+			stream << "passenger_process_sessions{" << groupLabels[i]
+				<< ",pid=\"" << process.pid << "\"} " << process.sessions << "\n";
+		}
+	}
+	stream << "# HELP passenger_process_busyness Busyness of the process, 0 meaning idle.\n";
+	stream << "# TYPE passenger_process_busyness gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		foreach (const Process::Snapshot &process, groupSamples[i]->processes) {
+			stream << "passenger_process_busyness{" << groupLabels[i]
+				<< ",pid=\"" << process.pid << "\"} " << process.busyness << "\n";
+		}
+	}
+	stream << "# HELP passenger_process_requests_total Number of requests processed.\n";
+	stream << "# TYPE passenger_process_requests_total counter\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		foreach (const Process::Snapshot &process, groupSamples[i]->processes) {
+			stream << "passenger_process_requests_total{" << groupLabels[i]
+				<< ",pid=\"" << process.pid << "\"} " << process.processed << "\n";
+		}
+	}
+	stream << "# HELP passenger_process_cpu_percent CPU usage of the process.\n";
+	stream << "# TYPE passenger_process_cpu_percent gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		foreach (const Process::Snapshot &process, groupSamples[i]->processes) {
+			if (process.metrics.isValid()) {
+				stream << "passenger_process_cpu_percent{" << groupLabels[i]
+					<< ",pid=\"" << process.pid << "\"} "
+					<< (unsigned int) process.metrics.cpu << "\n";
+			}
+		}
+	}
+	stream << "# HELP passenger_process_memory_bytes Real memory usage of the process (private RSS plus swap).\n";
+	stream << "# TYPE passenger_process_memory_bytes gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		foreach (const Process::Snapshot &process, groupSamples[i]->processes) {
+			if (process.metrics.isValid()) {
+				stream << "passenger_process_memory_bytes{" << groupLabels[i]
+					<< ",pid=\"" << process.pid << "\"} "
+					<< (unsigned long long) process.metrics.realMemory() * 1024 << "\n";
+			}
+		}
+	}
+	stream << "# HELP passenger_process_memory_growth_bytes_per_minute Rate at which the memory usage of the process changes, over the last samples.\n";
+	stream << "# TYPE passenger_process_memory_growth_bytes_per_minute gauge\n";
+	for (i = 0; i < groupSamples.size(); i++) {
+		foreach (const Process::Snapshot &process, groupSamples[i]->processes) {
+			if (process.memoryTrend.getSampleCount() >= 2) {
+				stream << "passenger_process_memory_growth_bytes_per_minute{" << groupLabels[i]
+					<< ",pid=\"" << process.pid << "\"} "
+					<< (long long) (process.memoryTrend.getGrowthRate() * 1024) << "\n";
+			}
+		}
+	}
+}
+
 Json::Value
 Pool::inspectPropertiesInAdminPanelFormat(const ToJsonOptions &options) const {
-	ScopedLock l(syncher);
+	StateSnapshotPtr snapshot = getStateSnapshot();
 	Json::Value result(Json::objectValue);
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
-	{
+	if (!authorizeSnapshot(*snapshot, options)) {
 		throw SecurityException("Operation unauthorized");
 	}
 
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-
+	foreach (const Group::Snapshot &group, snapshot->groups) {
 		if (options.hasApplicationIdsFilter) {
 			const bool *tmp;
-			if (!options.applicationIdsFilter.lookup(group->info.name, &tmp)) {
-				g_it.next();
+			if (!options.applicationIdsFilter.lookup(group.name, &tmp)) {
 				continue;
 			}
 		}
 
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
-		Json::Value groupDoc(Json::objectValue);
-		group->inspectPropertiesInAdminPanelFormat(groupDoc);
-		result[group->info.name] = groupDoc;
-
-		g_it.next();
+		result[group.name] = group.inspectionCache->adminPanelProperties;
 	}
 
 	return result;
@@ -301,40 +490,28 @@ Pool::inspectPropertiesInAdminPanelFormat(const ToJsonOptions &options) const {
 
 Json::Value
 Pool::inspectConfigInAdminPanelFormat(const ToJsonOptions &options) const {
-	ScopedLock l(syncher);
+	StateSnapshotPtr snapshot = getStateSnapshot();
 	Json::Value result(Json::objectValue);
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
-	{
+	if (!authorizeSnapshot(*snapshot, options)) {
 		throw SecurityException("Operation unauthorized");
 	}
 
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-
+	foreach (const Group::Snapshot &group, snapshot->groups) {
 		if (options.hasApplicationIdsFilter) {
 			const bool *tmp;
-			if (!options.applicationIdsFilter.lookup(group->info.name, &tmp)) {
-				g_it.next();
+			if (!options.applicationIdsFilter.lookup(group.name, &tmp)) {
 				continue;
 			}
 		}
 
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
-		Json::Value groupDoc(Json::objectValue);
-		group->inspectConfigInAdminPanelFormat(groupDoc);
-		result[group->info.name] = groupDoc;
-
-		g_it.next();
+		result[group.name] = group.inspectionCache->adminPanelConfig;
 	}
 
 	return result;
@@ -424,6 +601,37 @@ Pool::getGroupCount() const {
 	return groups.size();
 }
 
+/**
+ * Returns a snapshot of the pool state. The pool lock is only acquired
+ * if the pool structure changed since the last snapshot was taken (see
+ * `structureChanged()`); concurrent callers then wait for that snapshot
+ * instead of each taking their own. Otherwise the last snapshot is
+ * reused, with its session counters read from Process::LiveCounters.
+ */
+Pool::StateSnapshotPtr
+Pool::getStateSnapshot() const {
+	boost::shared_ptr<StateSnapshot> result;
+
+	{
+		boost::lock_guard<boost::mutex> l(stateSnapshotSyncher);
+		if (stateSnapshot == NULL
+		 || stateSnapshot->generation != stateGeneration.load(boost::memory_order_relaxed))
+		{
+			LockGuard l2(syncher);
+			stateSnapshot = createStateSnapshotUnlocked();
+			return stateSnapshot;
+		}
+		result = boost::make_shared<StateSnapshot>(*stateSnapshot);
+	}
+
+	foreach (Group::Snapshot &group, result->groups) {
+		foreach (Process::Snapshot &process, group.processes) {
+			process.refreshCounters();
+		}
+	}
+	return result;
+}
+
 
 } // namespace ApplicationPool2
 } // namespace Passenger
@@ -30,6 +30,10 @@
 #include <vector>
 #include <algorithm>
 #include <boost/intrusive_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/atomic.hpp>
 #include <boost/move/core.hpp>
 #include <boost/container/vector.hpp>
 #include <oxt/system_calls.hpp>
@@ -48,6 +52,7 @@
 #include <StrIntTools/StrIntUtils.h>
 #include <Utils/Lock.h>
 #include <Core/ApplicationPool/Common.h>
+#include <Core/ApplicationPool/MemoryRecycling.h>
 #include <Core/ApplicationPool/Socket.h>
 #include <Core/ApplicationPool/Session.h>
 #include <Core/SpawningKit/PipeWatcher.h>
@@ -102,6 +107,33 @@ class Process {
 public:
 	static const unsigned int MAX_SOCKETS_ACCEPTING_HTTP_REQUESTS = 3;
 
+	/**
+	 * Copies of the counters that change with every session: `sessions`,
+	 * `processed`, `lastUsed` and the `sessions` of every socket. They are
+	 * updated together with the originals, and Pool::getStateSnapshot()
+	 * reads them without holding the pool lock. State snapshots share
+	 * ownership, so reading them stays safe after this Process is gone.
+	 */
+	struct LiveCounters {
+		boost::atomic<int> sessions;
+		boost::atomic<unsigned int> processed;
+		boost::atomic<unsigned long long> lastUsed;
+		boost::scoped_array< boost::atomic<int> > socketSessions;
+
+		LiveCounters(unsigned int socketCount, unsigned long long _lastUsed)
+			: sessions(0),
+			  processed(0),
+			  lastUsed(_lastUsed),
+			  socketSessions(new boost::atomic<int>[socketCount])
+		{
+			for (unsigned int i = 0; i < socketCount; i++) {
+				socketSessions[i].store(0, boost::memory_order_relaxed);
+			}
+		}
+	};
+
+	typedef boost::shared_ptr<const LiveCounters> LiveCountersPtr;
+
 private:
 	/*************************************************************
 	 * Read-only fields, set once during initialization and never
@@ -111,6 +143,7 @@ private:
 	BasicProcessInfo info;
 	DynamicBuffer stringBuffer;
 	SocketList sockets;
+	boost::shared_ptr<LiveCounters> liveCounters;
 
 	/**
 	 * The maximum amount of concurrent sessions this process can handle.
@@ -285,7 +318,8 @@ private:
 				StaticString(base + log.socketStringOffsets[i].description.offset,
 					log.socketStringOffsets[i].description.size),
 				getJsonIntField(socket, "concurrency"),
-				getJsonBoolField(socket, "accept_http_requests")
+				getJsonBoolField(socket, "accept_http_requests"),
+				socket.isMember("accept_body_fd") && socket["accept_body_fd"].asBool()
 			);
 		}
 
@@ -441,10 +475,23 @@ public:
 	/** Caches whether or not the OS process still exists. */
 	mutable bool m_osProcessExists: 1;
 	bool longRunningConnectionsAborted: 1;
+	/**
+	 * Whether the pool is replacing this process because it exceeded the
+	 * group's memory limit. See Group::recycle().
+	 */
+	bool recycling: 1;
 	/** Time at which shutdown began. */
 	time_t shutdownStartTime;
 	/** Collected by Pool::collectAnalytics(). */
 	ProcessMetrics metrics;
+	/** Collected by Pool::collectAnalytics(). */
+	MemoryTrend memoryTrend;
+	/**
+	 * The NUMA node (an index into the pool context's CpuTopology) that
+	 * this process is bound to, or -1 if it is not bound to any.
+	 * Set by Group when NUMA-aware placement is enabled.
+	 */
+	int numaNode;
 
 
 	Process(const BasicGroupInfo *groupInfo, const Json::Value &args)
@@ -465,10 +512,13 @@ public:
 		  oobwStatus(OOBW_NOT_ACTIVE),
 		  m_osProcessExists(true),
 		  longRunningConnectionsAborted(false),
-		  shutdownStartTime(0)
+		  recycling(false),
+		  shutdownStartTime(0),
+		  numaNode(-1)
 	{
 		initializeSocketsAndStringFields(args);
 		indexSocketsAcceptingHttpRequests();
+		liveCounters = boost::make_shared<LiveCounters>(sockets.size(), lastUsed);
 	}
 
 	Process(const BasicGroupInfo *groupInfo, const SpawningKit::Result &skResult,
@@ -490,10 +540,13 @@ public:
 		  oobwStatus(OOBW_NOT_ACTIVE),
 		  m_osProcessExists(true),
 		  longRunningConnectionsAborted(false),
-		  shutdownStartTime(0)
+		  recycling(false),
+		  shutdownStartTime(0),
+		  numaNode(-1)
 	{
 		initializeSocketsAndStringFields(skResult);
 		indexSocketsAcceptingHttpRequests();
+		liveCounters = boost::make_shared<LiveCounters>(sockets.size(), lastUsed);
 
 		inputPipe = skResult.stdinFd;
 		outputPipe = skResult.stdoutAndErrFd;
@@ -669,10 +722,22 @@ public:
 		return info.stickySessionId;
 	}
 
+	/**
+	 * The maximum number of concurrent sessions this process can handle.
+	 * 0 means unlimited, -1 means unknown.
+	 */
+	int getConcurrency() const {
+		return concurrency;
+	}
+
 	unsigned long long getSpawnerCreationTime() const {
 		return spawnerCreationTime;
 	}
 
+	unsigned long long getSpawnEndTime() const {
+		return spawnEndTime;
+	}
+
 	bool isDummy() const {
 		return type == SpawningKit::Result::DUMMY;
 	}
@@ -745,6 +810,10 @@ public:
 	}
 
 	int busyness() const {
+		return calculateBusyness(concurrency, sessions);
+	}
+
+	static int calculateBusyness(int concurrency, int sessions) {
 		/* Different processes within a Group may have different
 		 * 'concurrency' values. We want:
 		 * - the process with the smallest busyness to be be picked for routing.
@@ -804,6 +873,7 @@ public:
 			} else {
 				lastUsed = SystemTime::getUsec();
 			}
+			updateLiveCounters(socket);
 			return createSessionObject(socket);
 		}
 	}
@@ -847,9 +917,18 @@ public:
 		socket->sessions--;
 		this->sessions--;
 		processed++;
+		updateLiveCounters(socket);
 		assert(!isTotallyBusy());
 	}
 
+	void updateLiveCounters(const Socket *socket) {
+		liveCounters->sessions.store(sessions, boost::memory_order_relaxed);
+		liveCounters->processed.store(processed, boost::memory_order_relaxed);
+		liveCounters->lastUsed.store(lastUsed, boost::memory_order_relaxed);
+		liveCounters->socketSessions[socket - &sockets[0]].store(socket->sessions,
+			boost::memory_order_relaxed);
+	}
+
 	/**
 	 * Returns the uptime of this process so far, as a string.
 	 */
@@ -866,83 +945,202 @@ public:
 
 	template<typename Stream>
 	void inspectXml(Stream &stream, bool includeSockets = true) const {
-		stream << "<pid>" << getPid() << "</pid>";
-		stream << "<sticky_session_id>" << getStickySessionId() << "</sticky_session_id>";
-		stream << "<gupid>" << getGupid() << "</gupid>";
-		stream << "<concurrency>" << concurrency << "</concurrency>";
-		stream << "<sessions>" << sessions << "</sessions>";
-		stream << "<busyness>" << busyness() << "</busyness>";
-		stream << "<processed>" << processed << "</processed>";
-		stream << "<spawner_creation_time>" << spawnerCreationTime << "</spawner_creation_time>";
-		stream << "<spawn_start_time>" << spawnStartTime << "</spawn_start_time>";
-		stream << "<spawn_end_time>" << spawnEndTime << "</spawn_end_time>";
-		stream << "<last_used>" << lastUsed << "</last_used>";
-		stream << "<last_used_desc>" << distanceOfTimeInWords(lastUsed / 1000000).c_str() << " ago</last_used_desc>";
-		stream << "<uptime>" << uptime() << "</uptime>";
-		if (!codeRevision.empty()) {
-			stream << "<code_revision>" << escapeForXml(codeRevision) << "</code_revision>";
+		Snapshot(*this).inspectXml(stream, includeSockets);
+	}
+
+	/**
+	 * A plain copy of the state that `inspectXml()` reports. Taking a snapshot
+	 * requires the same synchronization as reading the fields directly, but
+	 * the snapshot can be rendered after releasing the pool lock.
+	 */
+	struct Snapshot {
+		struct SocketInfo {
+			string address;
+			string protocol;
+			string description;
+			int concurrency;
+			bool acceptHttpRequests;
+			bool acceptBodyFd;
+			int sessions;
+		};
+
+		pid_t pid;
+		unsigned int stickySessionId;
+		string gupid;
+		int concurrency;
+		int sessions;
+		int busyness;
+		unsigned int processed;
+		unsigned long long spawnerCreationTime;
+		unsigned long long spawnStartTime;
+		unsigned long long spawnEndTime;
+		unsigned long long lastUsed;
+		string codeRevision;
+		LifeStatus lifeStatus;
+		EnabledStatus enabled;
+		ProcessMetrics metrics;
+		MemoryTrend memoryTrend;
+		bool recycling;
+		int numaNode;
+		vector<SocketInfo> sockets;
+		LiveCountersPtr liveCounters;
+
+		Snapshot(const Process &process)
+			: pid(process.getPid()),
+			  stickySessionId(process.getStickySessionId()),
+			  gupid(process.getGupid().data(), process.getGupid().size()),
+			  concurrency(process.concurrency),
+			  sessions(process.sessions),
+			  busyness(process.busyness()),
+			  processed(process.processed),
+			  spawnerCreationTime(process.spawnerCreationTime),
+			  spawnStartTime(process.spawnStartTime),
+			  spawnEndTime(process.spawnEndTime),
+			  lastUsed(process.lastUsed),
+			  codeRevision(process.codeRevision.data(), process.codeRevision.size()),
+			  lifeStatus(process.lifeStatus),
+			  enabled(process.enabled),
+			  metrics(process.metrics),
+			  memoryTrend(process.memoryTrend),
+			  recycling(process.recycling),
+			  numaNode(process.numaNode),
+			  liveCounters(process.liveCounters)
+		{
+			SocketList::const_iterator it, end = process.sockets.end();
+
+			sockets.reserve(process.sockets.size());
+			for (it = process.sockets.begin(); it != end; it++) {
+				SocketInfo info;
+				info.address = it->address;
+				info.protocol = it->protocol;
+				info.description = it->description;
+				info.concurrency = it->concurrency;
+				info.acceptHttpRequests = it->acceptHttpRequests;
+				info.acceptBodyFd = it->acceptBodyFd;
+				info.sessions = it->sessions;
+				sockets.push_back(info);
+			}
 		}
-		switch (lifeStatus) {
-		case ALIVE:
-			stream << "<life_status>ALIVE</life_status>";
-			break;
-		case SHUTDOWN_TRIGGERED:
-			stream << "<life_status>SHUTDOWN_TRIGGERED</life_status>";
-			break;
-		case DEAD:
-			stream << "<life_status>DEAD</life_status>";
-			break;
-		default:
-			P_BUG("Unknown 'lifeStatus' state " << (int) lifeStatus);
+
+		/**
+		 * Replaces the session counters with the process's current ones.
+		 * Does not require the pool lock.
+		 */
+		void refreshCounters() {
+			sessions = liveCounters->sessions.load(boost::memory_order_relaxed);
+			busyness = calculateBusyness(concurrency, sessions);
+			processed = liveCounters->processed.load(boost::memory_order_relaxed);
+			lastUsed = liveCounters->lastUsed.load(boost::memory_order_relaxed);
+			for (unsigned int i = 0; i < sockets.size(); i++) {
+				sockets[i].sessions = liveCounters->socketSessions[i].load(
+					boost::memory_order_relaxed);
+			}
 		}
-		switch (enabled) {
-		case ENABLED:
-			stream << "<enabled>ENABLED</enabled>";
-			break;
-		case DISABLING:
-			stream << "<enabled>DISABLING</enabled>";
-			break;
-		case DISABLED:
-			stream << "<enabled>DISABLED</enabled>";
-			break;
-		case DETACHED:
-			stream << "<enabled>DETACHED</enabled>";
-			break;
-		default:
-			P_BUG("Unknown 'enabled' state " << (int) enabled);
+
+		const SocketInfo *findFirstSocketWithProtocol(const StaticString &protocol) const {
+			vector<SocketInfo>::const_iterator it, end = sockets.end();
+			for (it = sockets.begin(); it != end; it++) {
+				if (it->protocol == protocol) {
+					return &(*it);
+				}
+			}
+			return NULL;
 		}
-		if (metrics.isValid()) {
-			stream << "<has_metrics>true</has_metrics>";
-			stream << "<cpu>" << (int) metrics.cpu << "</cpu>";
-			stream << "<rss>" << metrics.rss << "</rss>";
-			stream << "<pss>" << metrics.pss << "</pss>";
-			stream << "<private_dirty>" << metrics.privateDirty << "</private_dirty>";
-			stream << "<swap>" << metrics.swap << "</swap>";
-			stream << "<real_memory>" << metrics.realMemory() << "</real_memory>";
-			stream << "<vmsize>" << metrics.vmsize << "</vmsize>";
-			stream << "<process_group_id>" << metrics.processGroupId << "</process_group_id>";
-			stream << "<command>" << escapeForXml(metrics.command) << "</command>";
+
+		string uptime() const {
+			return distanceOfTimeInWords(spawnEndTime / 1000000);
 		}
-		if (includeSockets) {
-			SocketList::const_iterator it;
-
-			stream << "<sockets>";
-			for (it = sockets.begin(); it != sockets.end(); it++) {
-				const Socket &socket = *it;
-				stream << "<socket>";
-				stream << "<address>" << escapeForXml(socket.address) << "</address>";
-				stream << "<protocol>" << escapeForXml(socket.protocol) << "</protocol>";
-				if (!socket.description.empty()) {
-					stream << "<description>" << escapeForXml(socket.description) << "</description>";
+
+		template<typename Stream>
+		void inspectXml(Stream &stream, bool includeSockets = true) const {
+			stream << "<pid>" << pid << "</pid>";
+			stream << "<sticky_session_id>" << stickySessionId << "</sticky_session_id>";
+			stream << "<gupid>" << gupid << "</gupid>";
+			stream << "<concurrency>" << concurrency << "</concurrency>";
+			stream << "<sessions>" << sessions << "</sessions>";
+			stream << "<busyness>" << busyness << "</busyness>";
+			stream << "<processed>" << processed << "</processed>";
+			stream << "<spawner_creation_time>" << spawnerCreationTime << "</spawner_creation_time>";
+			stream << "<spawn_start_time>" << spawnStartTime << "</spawn_start_time>";
+			stream << "<spawn_end_time>" << spawnEndTime << "</spawn_end_time>";
+			stream << "<last_used>" << lastUsed << "</last_used>";
+			stream << "<last_used_desc>" << distanceOfTimeInWords(lastUsed / 1000000).c_str() << " ago</last_used_desc>";
+			stream << "<uptime>" << uptime() << "</uptime>";
+			if (!codeRevision.empty()) {
+				stream << "<code_revision>" << escapeForXml(codeRevision) << "</code_revision>";
+			}
+			switch (lifeStatus) {
+			case ALIVE:
+				stream << "<life_status>ALIVE</life_status>";
+				break;
+			case SHUTDOWN_TRIGGERED:
+				stream << "<life_status>SHUTDOWN_TRIGGERED</life_status>";
+				break;
+			case DEAD:
+				stream << "<life_status>DEAD</life_status>";
+				break;
+			default:
+				P_BUG("Unknown 'lifeStatus' state " << (int) lifeStatus);
+			}
+			switch (enabled) {
+			case ENABLED:
+				stream << "<enabled>ENABLED</enabled>";
+				break;
+			case DISABLING:
+				stream << "<enabled>DISABLING</enabled>";
+				break;
+			case DISABLED:
+				stream << "<enabled>DISABLED</enabled>";
+				break;
+			case DETACHED:
+				stream << "<enabled>DETACHED</enabled>";
+				break;
+			default:
+				P_BUG("Unknown 'enabled' state " << (int) enabled);
+			}
+			if (metrics.isValid()) {
+				stream << "<has_metrics>true</has_metrics>";
+				stream << "<cpu>" << (int) metrics.cpu << "</cpu>";
+				stream << "<rss>" << metrics.rss << "</rss>";
+				stream << "<pss>" << metrics.pss << "</pss>";
+				stream << "<private_dirty>" << metrics.privateDirty << "</private_dirty>";
+				stream << "<swap>" << metrics.swap << "</swap>";
+				stream << "<real_memory>" << metrics.realMemory() << "</real_memory>";
+				stream << "<vmsize>" << metrics.vmsize << "</vmsize>";
+				stream << "<process_group_id>" << metrics.processGroupId << "</process_group_id>";
+				stream << "<command>" << escapeForXml(metrics.command) << "</command>";
+			}
+			if (memoryTrend.getSampleCount() > 0) {
+				memoryTrend.inspectXml(stream);
+			}
+			if (recycling) {
+				stream << "<recycling>true</recycling>";
+			}
+			if (numaNode >= 0) {
+				stream << "<numa_node>" << numaNode << "</numa_node>";
+			}
+			if (includeSockets) {
+				vector<SocketInfo>::const_iterator it;
+
+				stream << "<sockets>";
+				for (it = sockets.begin(); it != sockets.end(); it++) {
+					const SocketInfo &socket = *it;
+					stream << "<socket>";
+					stream << "<address>" << escapeForXml(socket.address) << "</address>";
+					stream << "<protocol>" << escapeForXml(socket.protocol) << "</protocol>";
+					if (!socket.description.empty()) {
+						stream << "<description>" << escapeForXml(socket.description) << "</description>";
+					}
+					stream << "<concurrency>" << socket.concurrency << "</concurrency>";
+					stream << "<accept_http_requests>" << socket.acceptHttpRequests << "</accept_http_requests>";
+					stream << "<accept_body_fd>" << socket.acceptBodyFd << "</accept_body_fd>";
+					stream << "<sessions>" << socket.sessions << "</sessions>";
+					stream << "</socket>";
 				}
-				stream << "<concurrency>" << socket.concurrency << "</concurrency>";
-				stream << "<accept_http_requests>" << socket.acceptHttpRequests << "</accept_http_requests>";
-				stream << "<sessions>" << socket.sessions << "</sessions>";
-				stream << "</socket>";
+				stream << "</sockets>";
 			}
-			stream << "</sockets>";
 		}
-	}
+	};
 };
 
 
@@ -33,6 +33,7 @@
 #include <oxt/backtrace.hpp>
 #include <Utils/ScopeGuard.h>
 #include <Utils/Lock.h>
+#include <StrIntTools/StrIntUtils.h>
 #include <Core/ApplicationPool/Context.h>
 #include <Core/ApplicationPool/BasicProcessInfo.h>
 #include <Core/ApplicationPool/BasicGroupInfo.h>
@@ -180,6 +181,13 @@ public:
 		return getSocket()->protocol;
 	}
 
+	virtual bool acceptsBodyFd() const {
+		// File descriptors can only be passed over Unix domain sockets.
+		const Socket *socket = getSocket();
+		return socket->acceptBodyFd
+			&& startsWith(socket->address, P_STATIC_STRING("unix:"));
+	}
+
 
 	virtual void initiate(bool blocking = true) {
 		assert(!closed);
@@ -109,6 +109,11 @@ public:
 	 */
 	int concurrency;
 	bool acceptHttpRequests;
+	/**
+	 * Whether the app accepts a buffered request body as a file descriptor
+	 * passed along with the session protocol header.
+	 */
+	bool acceptBodyFd;
 
 	// Private. In public section as alignment optimization.
 	int totalConnections;
@@ -120,17 +125,20 @@ public:
 	Socket()
 		: pid(-1),
 		  concurrency(-1),
-		  acceptHttpRequests(0)
+		  acceptHttpRequests(0),
+		  acceptBodyFd(false)
 		{ }
 
 	Socket(pid_t _pid, const StaticString &_address, const StaticString &_protocol,
-		const StaticString &_description, int _concurrency, bool _acceptHttpRequests)
+		const StaticString &_description, int _concurrency, bool _acceptHttpRequests,
+		bool _acceptBodyFd = false)
 		: address(_address),
 		  protocol(_protocol),
 		  description(_description),
 		  pid(_pid),
 		  concurrency(_concurrency),
 		  acceptHttpRequests(_acceptHttpRequests),
+		  acceptBodyFd(_acceptBodyFd),
 		  totalConnections(0),
 		  totalIdleConnections(0),
 		  sessions(0)
@@ -144,6 +152,7 @@ public:
 		  pid(other.pid),
 		  concurrency(other.concurrency),
 		  acceptHttpRequests(other.acceptHttpRequests),
+		  acceptBodyFd(other.acceptBodyFd),
 		  totalConnections(other.totalConnections),
 		  totalIdleConnections(other.totalIdleConnections),
 		  sessions(other.sessions)
@@ -159,6 +168,7 @@ public:
 		pid = other.pid;
 		concurrency = other.concurrency;
 		acceptHttpRequests = other.acceptHttpRequests;
+		acceptBodyFd = other.acceptBodyFd;
 		sessions = other.sessions;
 		return *this;
 	}
@@ -266,10 +276,11 @@ public:
 class SocketList: public boost::container::small_vector<Socket, 1> {
 public:
 	void add(pid_t pid, const StaticString &address, const StaticString &protocol,
-		const StaticString &description, int concurrency, bool acceptHttpRequests)
+		const StaticString &description, int concurrency, bool acceptHttpRequests,
+		bool acceptBodyFd = false)
 	{
 		push_back(Socket(pid, address, protocol, description, concurrency,
-			acceptHttpRequests));
+			acceptHttpRequests, acceptBodyFd));
 	}
 
 	const Socket *findFirstSocketWithProtocol(const StaticString &protocol) const {
@@ -50,6 +50,7 @@ private:
 	pid_t pid;
 	string gupid;
 	string protocol;
+	bool bodyFdAccepted;
 	ApiKey apiKey;
 	SocketPair connection;
 	BufferedIO peerBufferedIO;
@@ -64,12 +65,28 @@ public:
 		  pid(123),
 		  gupid("gupid-123"),
 		  protocol("session"),
+		  bodyFdAccepted(false),
 		  stickySessionId(0),
 		  closed(false),
 		  success(false),
 		  wantKeepAlive(false)
 		{ }
 
+	/**
+	 * Makes this object usable for another request, after the previous
+	 * request's Controller has released it.
+	 */
+	void reset() {
+		boost::lock_guard<boost::mutex> l(syncher);
+		refcount = 1;
+		connection.first.close();
+		connection.second.close();
+		peerBufferedIO = BufferedIO();
+		closed = false;
+		success = false;
+		wantKeepAlive = false;
+	}
+
 	virtual void ref() const {
 		boost::lock_guard<boost::mutex> l(syncher);
 		assert(refcount > 0);
@@ -119,6 +136,16 @@ public:
 		protocol = v;
 	}
 
+	virtual bool acceptsBodyFd() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return bodyFdAccepted;
+	}
+
+	void setAcceptsBodyFd(bool v) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		bodyFdAccepted = v;
+	}
+
 	virtual unsigned int getStickySessionId() const {
 		boost::lock_guard<boost::mutex> l(syncher);
 		return stickySessionId;
@@ -88,9 +88,16 @@ using namespace std;
  *   api_server_file_buffered_channel_auto_truncate_file             boolean            -          default(true)
  *   api_server_file_buffered_channel_buffer_dir                     string             -          default
  *   api_server_file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -          default(0)
+ *   api_server_file_buffered_channel_max_disk_buffering             unsigned integer   -          default(0)
  *   api_server_file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -          default(0)
+ *   api_server_file_buffered_channel_spool_arena                    boolean            -          default(false)
+ *   api_server_file_buffered_channel_spool_extent_size              unsigned integer   -          default(1048576)
  *   api_server_file_buffered_channel_threshold                      unsigned integer   -          default(131072)
+ *   api_server_http2                                                boolean            -          default(false)
  *   api_server_mbuf_block_chunk_size                                unsigned integer   -          default(4096),read_only
+ *   api_server_mbuf_block_size_classes                              unsigned integer   -          default(3),read_only
+ *   api_server_mbuf_pool_huge_pages                                 boolean            -          default(false),read_only
+ *   api_server_mbuf_pool_max_spare_memory                           unsigned integer   -          default(8388608)
  *   api_server_min_spare_clients                                    unsigned integer   -          default(0)
  *   api_server_request_freelist_limit                               unsigned integer   -          default(1024)
  *   api_server_start_reading_after_accept                           boolean            -          default(true)
@@ -105,9 +112,16 @@ using namespace std;
  *   controller_file_buffered_channel_auto_truncate_file             boolean            -          default(true)
  *   controller_file_buffered_channel_buffer_dir                     string             -          default
  *   controller_file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_max_disk_buffering             unsigned integer   -          default(0)
  *   controller_file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_spool_arena                    boolean            -          default(true)
+ *   controller_file_buffered_channel_spool_extent_size              unsigned integer   -          default(1048576)
  *   controller_file_buffered_channel_threshold                      unsigned integer   -          default(131072)
+ *   controller_http2                                                boolean            -          default(false)
  *   controller_mbuf_block_chunk_size                                unsigned integer   -          default(4096),read_only
+ *   controller_mbuf_block_size_classes                              unsigned integer   -          default(3),read_only
+ *   controller_mbuf_pool_huge_pages                                 boolean            -          default(false),read_only
+ *   controller_mbuf_pool_max_spare_memory                           unsigned integer   -          default(8388608)
  *   controller_min_spare_clients                                    unsigned integer   -          default(0)
  *   controller_request_freelist_limit                               unsigned integer   -          default(1024)
  *   controller_secure_headers_password                              any                -          secret
@@ -117,6 +131,8 @@ using namespace std;
  *   default_abort_websockets_on_process_shutdown                    boolean            -          default(true)
  *   default_app_file_descriptor_ulimit                              unsigned integer   -          -
  *   default_bind_address                                            string             -          default("127.0.0.1")
+ *   default_capacity_reservation                                    unsigned integer   -          default(0)
+ *   default_capacity_weight                                         unsigned integer   -          default(1)
  *   default_environment                                             string             -          default("production")
  *   default_force_max_concurrent_requests_per_process               integer            -          default(-1)
  *   default_friendly_error_pages                                    string             -          default("auto")
@@ -124,20 +140,25 @@ using namespace std;
  *   default_load_shell_envvars                                      boolean            -          default(false)
  *   default_max_preloader_idle_time                                 unsigned integer   -          default(300)
  *   default_max_request_queue_size                                  unsigned integer   -          default(100)
+ *   default_max_request_queue_time                                  unsigned integer   -          default(0)
  *   default_max_requests                                            unsigned integer   -          default(0)
+ *   default_memory_limit                                            unsigned integer   -          default(0)
  *   default_meteor_app_settings                                     string             -          -
  *   default_min_instances                                           unsigned integer   -          default(1)
  *   default_nodejs                                                  string             -          default("node")
  *   default_python                                                  string             -          default("python")
+ *   default_request_priority                                        string             -          default("normal")
  *   default_ruby                                                    string             -          default("ruby")
  *   default_server_name                                             string             -          default
  *   default_server_port                                             unsigned integer   -          default
  *   default_spawn_method                                            string             -          default("smart")
  *   default_sticky_sessions                                         boolean            -          default(false)
+ *   default_sticky_sessions_consistent_hashing                      boolean            -          default(false)
  *   default_sticky_sessions_cookie_attributes                       string             -          default("SameSite=Lax; Secure;")
  *   default_sticky_sessions_cookie_name                             string             -          default("_passenger_route")
  *   default_user                                                    string             -          default("nobody")
  *   disable_log_prefix                                              boolean            -          default(false)
+ *   event_loop_stall_threshold                                      unsigned integer   -          default(100),read_only
  *   file_descriptor_log_target                                      any                -          -
  *   file_descriptor_ulimit                                          unsigned integer   -          default(0),read_only
  *   graceful_exit                                                   boolean            -          default(true)
@@ -152,12 +173,21 @@ using namespace std;
  *   max_instances_per_app                                           unsigned integer   -          read_only
  *   max_pool_size                                                   unsigned integer   -          default(6)
  *   multi_app                                                       boolean            -          default(false),read_only
+ *   numa_aware_placement                                            boolean            -          default(false),read_only
  *   oom_score                                                       string             -          read_only
  *   passenger_root                                                  string             required   read_only
  *   pid_file                                                        string             -          read_only
+ *   pool_autoscale                                                  boolean            -          default(false)
+ *   pool_autoscale_max_processes                                    unsigned integer   -          default(0)
+ *   pool_autoscale_min_processes                                    unsigned integer   -          default(0)
+ *   pool_capacity_rebalance_hysteresis                              unsigned integer   -          default(30)
  *   pool_idle_time                                                  unsigned integer   -          default(300)
+ *   pool_max_concurrent_memory_recycles                             unsigned integer   -          default(1)
+ *   pool_memory_limit_metric                                        string             -          default("private_dirty")
+ *   pool_memory_limit_min_samples                                   unsigned integer   -          default(3)
  *   pool_selfchecks                                                 boolean            -          default(false)
  *   prestart_urls                                                   array of strings   -          default([]),read_only
+ *   request_priority_rules                                          array of strings   -          default([])
  *   response_buffer_high_watermark                                  unsigned integer   -          default(134217728)
  *   security_update_checker_certificate_path                        string             -          -
  *   security_update_checker_disabled                                boolean            -          default(false)
@@ -313,6 +343,11 @@ private:
 		if (config["max_pool_size"].asUInt() < 1) {
 			errors.push_back(Error("'{{max_pool_size}}' must be at least 1"));
 		}
+
+		string metric = config["pool_memory_limit_metric"].asString();
+		if (metric != "private_dirty" && metric != "pss") {
+			errors.push_back(Error("'{{pool_memory_limit_metric}}' must be either 'private_dirty' or 'pss'"));
+		}
 	}
 
 	static void validateController(const ConfigKit::Store &config, vector<ConfigKit::Error> &errors) {
@@ -479,6 +514,9 @@ public:
 		override("admin_panel_url", STRING_TYPE, OPTIONAL | READ_ONLY);
 		override("instance_dir", STRING_TYPE, OPTIONAL | READ_ONLY);
 		override("multi_app", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
+		// Only the Controller buffers enough bodies to disk for a shared
+		// spool arena to pay off.
+		override("controller_file_buffered_channel_spool_arena", BOOL_TYPE, OPTIONAL, true);
 		overrideWithDynamicDefault("default_server_name", STRING_TYPE, OPTIONAL, getDefaultServerName);
 		overrideWithDynamicDefault("default_server_port", UINT_TYPE, OPTIONAL, getDefaultServerPort);
 
@@ -492,13 +530,22 @@ public:
 		add("max_pool_size", UINT_TYPE, OPTIONAL, DEFAULT_MAX_POOL_SIZE);
 		add("pool_idle_time", UINT_TYPE, OPTIONAL, Json::UInt(DEFAULT_POOL_IDLE_TIME));
 		add("pool_selfchecks", BOOL_TYPE, OPTIONAL, false);
+		add("pool_autoscale", BOOL_TYPE, OPTIONAL, false);
+		add("pool_autoscale_min_processes", UINT_TYPE, OPTIONAL, 0);
+		add("pool_autoscale_max_processes", UINT_TYPE, OPTIONAL, 0);
+		add("pool_memory_limit_metric", STRING_TYPE, OPTIONAL, "private_dirty");
+		add("pool_memory_limit_min_samples", UINT_TYPE, OPTIONAL, 3);
+		add("pool_max_concurrent_memory_recycles", UINT_TYPE, OPTIONAL, 1);
+		add("pool_capacity_rebalance_hysteresis", UINT_TYPE, OPTIONAL, 30);
 		add("prestart_urls", STRING_ARRAY_TYPE, OPTIONAL | READ_ONLY, Json::arrayValue);
 		add("controller_secure_headers_password", ANY_TYPE, OPTIONAL | SECRET);
 		add("controller_socket_backlog", UINT_TYPE, OPTIONAL | READ_ONLY, DEFAULT_SOCKET_BACKLOG);
 		add("controller_addresses", STRING_ARRAY_TYPE, OPTIONAL | READ_ONLY, getDefaultControllerAddresses());
 		add("api_server_addresses", STRING_ARRAY_TYPE, OPTIONAL | READ_ONLY, Json::arrayValue);
 		add("controller_cpu_affine", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
+		add("numa_aware_placement", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
 		add("file_descriptor_ulimit", UINT_TYPE, OPTIONAL | READ_ONLY, 0);
+		add("event_loop_stall_threshold", UINT_TYPE, OPTIONAL | READ_ONLY, 100);
 
 		add("hook_attached_process", STRING_TYPE, OPTIONAL | READ_ONLY);
 		add("hook_detached_process", STRING_TYPE, OPTIONAL | READ_ONLY);
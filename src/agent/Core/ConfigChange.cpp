@@ -303,6 +303,9 @@ asyncCommitConfigChange(ConfigChangeRequest *req, const CommitConfigChangeCallba
 	wo->appPool->setMax(coreConfig->get("max_pool_size").asInt());
 	wo->appPool->setMaxIdleTime(coreConfig->get("pool_idle_time").asInt() * 1000000ULL);
 	wo->appPool->enableSelfChecking(coreConfig->get("pool_selfchecks").asBool());
+	wo->appPool->setAutoscalerConfig(createAutoscalerConfig(*coreConfig));
+	wo->appPool->setMemoryRecyclingConfig(createMemoryRecyclingConfig(*coreConfig));
+	wo->appPool->setCapacitySchedulerConfig(createCapacitySchedulerConfig(*coreConfig));
 	{
 		LockGuard l(wo->appPoolContext->agentConfigSyncher);
 		wo->appPoolContext->agentConfig = coreConfig->inspectEffectiveValues();
@@ -365,6 +368,31 @@ manipulateLoggingKitConfig(const ConfigKit::Store &coreConfig,
 	return result;
 }
 
+ApplicationPool2::AutoscalerConfig
+createAutoscalerConfig(const ConfigKit::Store &coreConfig) {
+	ApplicationPool2::AutoscalerConfig result;
+	result.enabled = coreConfig["pool_autoscale"].asBool();
+	result.minProcesses = coreConfig["pool_autoscale_min_processes"].asUInt();
+	result.maxProcesses = coreConfig["pool_autoscale_max_processes"].asUInt();
+	return result;
+}
+
+ApplicationPool2::MemoryRecyclingConfig
+createMemoryRecyclingConfig(const ConfigKit::Store &coreConfig) {
+	ApplicationPool2::MemoryRecyclingConfig result;
+	result.usePss = coreConfig["pool_memory_limit_metric"].asString() == "pss";
+	result.maxConcurrentRecycles = coreConfig["pool_max_concurrent_memory_recycles"].asUInt();
+	result.minSamplesOverLimit = coreConfig["pool_memory_limit_min_samples"].asUInt();
+	return result;
+}
+
+ApplicationPool2::CapacitySchedulerConfig
+createCapacitySchedulerConfig(const ConfigKit::Store &coreConfig) {
+	ApplicationPool2::CapacitySchedulerConfig result;
+	result.rebalanceHysteresis = coreConfig["pool_capacity_rebalance_hysteresis"].asUInt() * 1000000ULL;
+	return result;
+}
+
 
 } // namespace Core
 } // namespace Passenger
@@ -30,6 +30,9 @@
 #include <boost/config.hpp>
 #include <boost/function.hpp>
 #include <ConfigKit/ConfigKit.h>
+#include <Core/ApplicationPool/Autoscaler.h>
+#include <Core/ApplicationPool/MemoryRecycling.h>
+#include <Core/ApplicationPool/CapacityScheduler.h>
 
 namespace Passenger {
 namespace Core {
@@ -49,6 +52,9 @@ Json::Value inspectConfig();
 
 Json::Value manipulateLoggingKitConfig(const ConfigKit::Store &coreConfig,
 	const Json::Value &loggingKitConfig);
+ApplicationPool2::AutoscalerConfig createAutoscalerConfig(const ConfigKit::Store &coreConfig);
+ApplicationPool2::MemoryRecyclingConfig createMemoryRecyclingConfig(const ConfigKit::Store &coreConfig);
+ApplicationPool2::CapacitySchedulerConfig createCapacitySchedulerConfig(const ConfigKit::Store &coreConfig);
 
 
 } // namespace Core
@@ -54,6 +54,7 @@
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <utility>
+#include <new>
 #include <typeinfo>
 #include <cstdio>
 #include <cstdlib>
@@ -79,10 +80,13 @@
 #include <JsonTools/JsonUtils.h>
 #include <Utils/HttpConstants.h>
 #include <Utils/Timer.h>
+#include <Utils/CachedFileStat.hpp>
 #include <Core/Controller/Config.h>
 #include <Core/Controller/Client.h>
 #include <Core/Controller/AppResponse.h>
 #include <Core/Controller/TurboCaching.h>
+#include <Core/Controller/LatencyStats.h>
+#include <Core/Controller/Metrics.h>
 
 namespace Passenger {
 
@@ -116,10 +120,15 @@ private:
 	ControllerMainConfig mainConfig;
 	ControllerRequestConfigPtr requestConfig;
 	StringKeyTable< boost::shared_ptr<Options> > poolOptionsCache;
+	// Per app group, the part of the session protocol header that is the
+	// same for all requests. See Controller/SendRequest.cpp.
+	struct SessionHeaderPrefix;
+	StringKeyTable< boost::shared_ptr<SessionHeaderPrefix> > sessionHeaderPrefixCache;
 
 	HashedStaticString PASSENGER_APP_GROUP_NAME;
 	HashedStaticString PASSENGER_ENV_VARS;
 	HashedStaticString PASSENGER_MAX_REQUESTS;
+	HashedStaticString PASSENGER_REQUEST_PRIORITY;
 	HashedStaticString PASSENGER_SHOW_VERSION_IN_HEADER;
 	HashedStaticString PASSENGER_STICKY_SESSIONS;
 	HashedStaticString PASSENGER_STICKY_SESSIONS_COOKIE_NAME;
@@ -143,6 +152,7 @@ private:
 	friend class ResponseCache<Request>;
 	struct ev_check checkWatcher;
 	TurboCaching<Request> turboCaching;
+	LatencyStats latencyStats;
 	ConfigKit::Store *singleAppModeConfig;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
@@ -165,6 +175,8 @@ private:
 	void initializePoolOptions(Client *client, Request *req, RequestAnalysis &analysis);
 	void fillPoolOptionsFromConfigCaches(Options &options, psg_pool_t *pool,
 		const ControllerRequestConfigPtr &requestConfigCache);
+	static RequestPriority lookupRequestPriorityRule(Request *req,
+		RequestPriority defaultPriority);
 	static void fillPoolOption(Request *req, StaticString &field,
 		const HashedStaticString &name);
 	static void fillPoolOption(Request *req, int &field,
@@ -181,6 +193,8 @@ private:
 		const HashedStaticString &name);
 	void createNewPoolOptions(Client *client, Request *req,
 		const HashedStaticString &appGroupName);
+	static Options &getWritablePoolOptions(Request *req);
+	static void destroyPrivatePoolOptions(Request *req);
 	void setStickySessionId(Client *client, Request *req);
 	const LString *getStickySessionCookieName(Request *req);
 
@@ -191,11 +205,14 @@ private:
 	Channel::Result whenBufferingBody_onRequestBody(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer, int errcode);
 	static void _bodyBufferFlushed(FileBufferedChannel *_channel);
+	bool mayPassBufferedBodyFdToApp(Request *req);
+	static void _bodyBufferWriterTerminated(FileBufferedChannel *_channel);
 
 
 	/****** Stage: checkout session ******/
 
 	void checkoutSession(Client *client, Request *req);
+	void cancelCheckoutSession(Client *client, Request *req);
 	static void sessionCheckedOut(const AbstractSessionPtr &session,
 		const ExceptionPtr &e, void *userData);
 	void sessionCheckedOutFromAnotherThread(Client *client, Request *req,
@@ -207,8 +224,11 @@ private:
 	static void checkoutSessionLater(Request *req);
 	void reportSessionCheckoutError(Client *client, Request *req,
 		const ExceptionPtr &e);
+	int getRequestQueueOverflowStatusCode(Request *req);
 	void writeRequestQueueFullExceptionErrorResponse(Client *client,
 		Request *req, const boost::shared_ptr<RequestQueueFullException> &e);
+	void writeRequestQueueTimeoutExceptionErrorResponse(Client *client,
+		Request *req, const boost::shared_ptr<RequestQueueTimeoutException> &e);
 	void writeSpawnExceptionErrorResponse(Client *client, Request *req,
 		const boost::shared_ptr<SpawningKit::SpawnException> &e);
 	void writeOtherExceptionErrorResponse(Client *client, Request *req,
@@ -224,8 +244,12 @@ private:
 	struct HttpHeaderConstructionCache;
 
 	void sendHeaderToApp(Client *client, Request *req);
-	void sendHeaderToAppWithSessionProtocol(Client *client, Request *req);
+	void sendHeaderToAppWithSessionProtocol(Client *client, Request *req,
+		bool passBodyFd = true);
+	bool sendHeaderWithBodyFdToApp(Client *client, Request *req,
+		const MemoryKit::mbuf &header, int bodyFd);
 	static void sendBodyToAppWhenAppSinkIdle(Channel *_channel, unsigned int size);
+	const SessionHeaderPrefix &getSessionHeaderPrefix(Request *req);
 	unsigned int determineMaxHeaderSizeForSessionProtocol(Request *req,
 		SessionProtocolWorkingState &state, string delta_monotonic);
 	bool constructHeaderForSessionProtocol(Request *req, char * restrict buffer,
@@ -293,6 +317,15 @@ private:
 	void storeAppResponseInTurboCache(Client *client, Request *req);
 
 
+	/****** Stage: tunnel upgraded connection ******/
+
+	void maybeSwitchToTunnel(Client *client, Request *req);
+	void switchToTunnel(Client *client, Request *req);
+	static size_t getTunnelPoolSize(const Request *req);
+	static void copyLStringIntoPool(LString *dest, const LString *src,
+		psg_pool_t *pool);
+
+
 	/***** Hooks ******/
 
 	static Channel::Result onBodyBufferData(Channel *_channel,
@@ -306,9 +339,9 @@ private:
 	/****** Internal utility functions ******/
 
 	void disconnectWithClientSocketWriteError(Client **client, int e);
-	void disconnectWithAppSocketIncompleteResponseError(Client **client);
-	void disconnectWithAppSocketReadError(Client **client, int e);
-	void disconnectWithAppSocketWriteError(Client **client, int e);
+	void disconnectWithAppSocketIncompleteResponseError(Client **client, Request **req);
+	void disconnectWithAppSocketReadError(Client **client, Request **req, int e);
+	void disconnectWithAppSocketWriteError(Client **client, Request **req, int e);
 	void endRequestWithAppSocketIncompleteResponse(Client **client,
 		Request **req);
 	void endRequestWithAppSocketReadError(Client **client, Request **req,
@@ -327,6 +360,7 @@ private:
 	static LString *resolveSymlink(const StaticString &path, psg_pool_t *pool);
 	void parseCookieHeader(psg_pool_t *pool, const LString *headerValue,
 		vector< pair<StaticString, StaticString> > &cookies) const;
+	void recordLatencyStats(Client *client, Request *req);
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		void reportLargeTimeDiff(Client *client, const char *name,
 			ev_tstamp fromTime, ev_tstamp toTime);
@@ -342,18 +376,22 @@ protected:
 	/****** Hooks ******/
 
 	virtual void onClientAccepted(Client *client);
+	virtual Channel::Result onClientDataReceived(Client *client,
+		const MemoryKit::mbuf &buffer, int errcode);
 	virtual void onRequestObjectCreated(Client *client, Request *req);
 	virtual void deinitializeClient(Client *client);
 	virtual void reinitializeRequest(Client *client, Request *req);
 	virtual void deinitializeRequest(Client *client, Request *req);
 	void reinitializeAppResponse(Client *client, Request *req);
 	void deinitializeAppResponse(Client *client, Request *req);
+	void releaseAppResponseHeaders(Client *client, Request *req);
 	virtual Channel::Result onRequestBody(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer, int errcode);
 	virtual void onNextRequestEarlyReadError(Client *client, Request *req, int errcode);
 	virtual bool shouldDisconnectClientOnShutdown(Client *client);
 	virtual bool shouldAutoDechunkBody(Client *client, Request *req);
 	virtual bool supportsUpgrade(Client *client, Request *req);
+	virtual void onHttp2StreamWritable(Client *client, Request *req);
 
 
 	/****** Marked virtual so that unit tests can mock these ******/
@@ -369,6 +407,16 @@ public:
 	ResourceLocator *resourceLocator;
 	WrapperRegistry::Registry *wrapperRegistry;
 	PoolPtr appPool;
+	/**
+	 * The NUMA node that this Controller's thread runs on, or -1 if
+	 * NUMA-aware placement is disabled.
+	 */
+	int numaNode;
+	/**
+	 * Caches the stat() calls of application type detection. A shared
+	 * cache may be attached, so that other processes refresh it.
+	 */
+	CachedFileStat cstat;
 
 
 	/****** Initialization and shutdown ******/
@@ -386,10 +434,13 @@ public:
 		  mainConfig(config),
 		  requestConfig(new ControllerRequestConfig(config)),
 		  poolOptionsCache(4),
+		  sessionHeaderPrefixCache(4),
 
 		  turboCaching(),
 		  singleAppModeConfig(NULL),
-		  resourceLocator(NULL)
+		  resourceLocator(NULL),
+		  numaNode(-1),
+		  cstat(1024)
 		  /**************************/
 	{
 		if (mainConfig.singleAppMode) {
@@ -424,6 +475,9 @@ public:
 	virtual Json::Value inspectStateAsJson() const;
 	virtual Json::Value inspectClientStateAsJson(const Client *client) const;
 	virtual Json::Value inspectRequestStateAsJson(const Request *req) const;
+	LatencyStats::Snapshot getLatencyStatsSnapshot();
+	void resetLatencyStats();
+	ControllerMetrics collectMetrics() const;
 
 
 	/****** Miscellaneous *******/
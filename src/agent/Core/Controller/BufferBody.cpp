@@ -68,6 +68,38 @@ Controller::_bodyBufferFlushed(FileBufferedChannel *channel) {
 	req->bodyChannel.start();
 }
 
+/**
+ * Whether the buffered request body may be handed to the app as a file
+ * descriptor instead of being streamed over the session. That is only
+ * possible when the app advertised support for it, and when the body
+ * ended up in a buffer file of its own (small bodies stay in memory, and
+ * data in the spool arena can't be handed over).
+ */
+bool
+Controller::mayPassBufferedBodyFdToApp(Request *req) {
+	return req->requestBodyBuffering
+		&& req->session->acceptsBodyFd()
+		&& req->bodyBuffer.getMode() == FileBufferedChannel::IN_FILE_MODE
+		&& !req->bodyBuffer.isSpoolingToArena();
+}
+
+/**
+ * Called when the bodyBuffer has finished writing the request body to its
+ * buffer file (or failed to), while initiateSession() was waiting for that
+ * before sending the header to the app.
+ */
+void
+Controller::_bodyBufferWriterTerminated(FileBufferedChannel *channel) {
+	Request *req = static_cast<Request *>(static_cast<
+		ServerKit::BaseHttpRequest *>(channel->getHooks()->userData));
+	Client *client = static_cast<Client *>(req->client);
+	Controller *self = static_cast<Controller *>(getServerFromClient(client));
+	SKC_LOG_EVENT_FROM_STATIC(self, Controller, client, "_bodyBufferWriterTerminated");
+
+	req->bodyBuffer.setWriterTerminatedCallback(NULL);
+	self->sendHeaderToApp(client, req);
+}
+
 /**
  * Receives data (buffer) originating from the bodyChannel, to be passed on to the bodyBuffer.
  * Backpressure is applied when the bodyBuffer in-memory part exceeds a threshold.
@@ -135,7 +167,7 @@ Controller::whenBufferingBody_onRequestBody(Client *client, Request *req,
 		int size = snprintf(message, BUFSIZE,
 			"error reading request body: %s (errno=%d)",
 			ServerKit::getErrorDesc(errcode), errcode);
-		disconnectWithError(&client, StaticString(message, size));
+		endRequestWithError(&client, &req, StaticString(message, size));
 		return Channel::Result(0, true);
 	}
 }
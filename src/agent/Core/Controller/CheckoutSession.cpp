@@ -50,7 +50,7 @@ using namespace boost;
 void
 Controller::checkoutSession(Client *client, Request *req) {
 	GetCallback callback;
-	Options &options = req->options;
+	const Options &options = *req->options;
 
 	CC_BENCHMARK_POINT(client, req, BM_BEFORE_CHECKOUT);
 	SKC_TRACE(client, 2, "Checking out session: appRoot=" << options.appRoot);
@@ -65,7 +65,19 @@ Controller::checkoutSession(Client *client, Request *req) {
 	callback.func = sessionCheckedOut;
 	callback.userData = req;
 
-	options.currentTime = SystemTime::getUsec();
+	// req->options is marked as `ownedByCaller`: it stays valid while the get
+	// action is queued, because cache entries are never removed and because
+	// deinitializeRequest() cancels the get action if the request ends before
+	// a session is checked out. The options may be shared with other requests,
+	// so the current time is passed to the pool separately, instead of in
+	// `options.currentTime`. This way the pool does not have to read the clock
+	// while holding its lock. The sticky session ID is passed separately too,
+	// so that sticky requests can keep using the shared options.
+	req->checkoutTime = SystemTime::getUsec();
+
+	if (req->checkoutStartedAt == 0) {
+		req->checkoutStartedAt = SystemTime::getMonotonicUsec();
+	}
 
 	refRequest(req, __FILE__, __LINE__);
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
@@ -84,7 +96,28 @@ Controller::checkoutSession(Client *client, Request *req) {
 
 void
 Controller::asyncGetFromApplicationPool(Request *req, ApplicationPool2::GetCallback callback) {
-	appPool->asyncGet(req->options, callback, true);
+	appPool->asyncGet(*req->options, callback, true, req->checkoutTime,
+		req->stickySessionId);
+}
+
+/**
+ * Called when a request ends while it's still waiting for a session, e.g.
+ * because the client disconnected. Removes the request from the application
+ * pool's wait list so that it doesn't occupy a process for nothing.
+ */
+void
+Controller::cancelCheckoutSession(Client *client, Request *req) {
+	GetCallback callback;
+	callback.func = sessionCheckedOut;
+	callback.userData = req;
+
+	if (appPool->cancelAsyncGet(*req->options, callback)) {
+		SKC_DEBUG(client, "Request ended while waiting for a session;"
+			" removed it from the application pool queue");
+		// sessionCheckedOut() will never be called, so drop the
+		// reference that it would have dropped.
+		unrefRequest(req, __FILE__, __LINE__);
+	}
 }
 
 void
@@ -138,6 +171,7 @@ Controller::sessionCheckedOutFromEventLoopThread(Client *client, Request *req,
 		SKC_DEBUG(client, "Session checked out: pid=" << session->getPid() <<
 			", gupid=" << session->getGupid());
 		req->session = session;
+		req->sessionCheckedOutAt = SystemTime::getMonotonicUsec();
 		UPDATE_TRACE_POINT();
 		maybeSend100Continue(client, req);
 		UPDATE_TRACE_POINT();
@@ -163,7 +197,7 @@ Controller::maybeSend100Continue(Client *client, Request *req) {
 			char *buf = (char *) psg_pnalloc(req->pool, BUFSIZE);
 			int size = snprintf(buf, BUFSIZE, "HTTP/%d.%d 100 Continue\r\n",
 				(int) req->httpMajor, (int) req->httpMinor);
-			writeResponse(client, buf, size);
+			writeResponse(client, req, buf, size);
 			if (!req->ended()) {
 				// Allow sending more response headers.
 				req->responseBegun = false;
@@ -188,7 +222,7 @@ Controller::initiateSession(Client *client, Request *req) {
 			string message = "could not initiate a session (";
 			message.append(e2.what());
 			message.append(")");
-			disconnectWithError(&client, message);
+			endRequestWithError(&client, &req, message);
 		}
 		return;
 	}
@@ -202,6 +236,16 @@ Controller::initiateSession(Client *client, Request *req) {
 	/***************/
 	/***************/
 	reinitializeAppResponse(client, req);
+
+	if (mayPassBufferedBodyFdToApp(req) && req->bodyBuffer.isWritingToFile()) {
+		// The app can take the buffered body as a file descriptor, but
+		// only once all of it has been written to the buffer file.
+		SKC_TRACE(client, 2, "Waiting until the request body buffer file"
+			" is complete before sending headers to application");
+		req->state = Request::SENDING_HEADER_TO_APP;
+		req->bodyBuffer.setWriterTerminatedCallback(_bodyBufferWriterTerminated);
+		return;
+	}
 	sendHeaderToApp(client, req);
 }
 
@@ -231,6 +275,14 @@ Controller::reportSessionCheckoutError(Client *client, Request *req,
 			return;
 		}
 	}
+	{
+		boost::shared_ptr<RequestQueueTimeoutException> e2 =
+			dynamic_pointer_cast<RequestQueueTimeoutException>(e);
+		if (e2 != NULL) {
+			writeRequestQueueTimeoutExceptionErrorResponse(client, req, e2);
+			return;
+		}
+	}
 	{
 		boost::shared_ptr<SpawningKit::SpawnException> e2 =
 			dynamic_pointer_cast<SpawningKit::SpawnException>(e);
@@ -242,11 +294,8 @@ Controller::reportSessionCheckoutError(Client *client, Request *req,
 	writeOtherExceptionErrorResponse(client, req, e);
 }
 
-void
-Controller::writeRequestQueueFullExceptionErrorResponse(Client *client, Request *req,
-	const boost::shared_ptr<RequestQueueFullException> &e)
-{
-	TRACE_POINT();
+int
+Controller::getRequestQueueOverflowStatusCode(Request *req) {
 	const LString *value = req->secureHeaders.lookup(
 		"!~PASSENGER_REQUEST_QUEUE_OVERFLOW_STATUS_CODE");
 	int requestQueueOverflowStatusCode = 503;
@@ -255,6 +304,15 @@ Controller::writeRequestQueueFullExceptionErrorResponse(Client *client, Request
 		requestQueueOverflowStatusCode = stringToInt(
 			StaticString(value->start->data, value->size));
 	}
+	return requestQueueOverflowStatusCode;
+}
+
+void
+Controller::writeRequestQueueFullExceptionErrorResponse(Client *client, Request *req,
+	const boost::shared_ptr<RequestQueueFullException> &e)
+{
+	TRACE_POINT();
+	int requestQueueOverflowStatusCode = getRequestQueueOverflowStatusCode(req);
 
 	SKC_WARN(client, "Returning HTTP " << requestQueueOverflowStatusCode <<
 		" due to: " << e->what());
@@ -266,6 +324,23 @@ Controller::writeRequestQueueFullExceptionErrorResponse(Client *client, Request
 		requestQueueOverflowStatusCode);
 }
 
+void
+Controller::writeRequestQueueTimeoutExceptionErrorResponse(Client *client, Request *req,
+	const boost::shared_ptr<RequestQueueTimeoutException> &e)
+{
+	TRACE_POINT();
+	int requestQueueOverflowStatusCode = getRequestQueueOverflowStatusCode(req);
+
+	SKC_WARN(client, "Returning HTTP " << requestQueueOverflowStatusCode <<
+		" due to: " << e->what());
+
+	endRequestWithSimpleResponse(&client, &req,
+		"<h2>This website is under heavy load (queue timeout)</h2>"
+		"<p>We're sorry, too many people are accessing this website at the same "
+		"time. We're working on this problem. Please try again later.</p>",
+		requestQueueOverflowStatusCode);
+}
+
 void
 Controller::writeSpawnExceptionErrorResponse(Client *client, Request *req,
 	const boost::shared_ptr<SpawningKit::SpawnException> &e)
@@ -367,7 +442,7 @@ Controller::friendlyErrorPagesEnabled(Request *req) {
 	bool defaultValue;
 	const StaticString &defaultStr = req->config->defaultFriendlyErrorPages;
 	if (defaultStr == "auto") {
-		defaultValue = (req->options.environment == "development");
+		defaultValue = (req->options->environment == "development");
 	} else {
 		defaultValue = defaultStr == "true";
 	}
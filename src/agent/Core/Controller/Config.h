@@ -33,6 +33,8 @@
 #include <unistd.h>
 #include <sys/param.h>
 #include <cerrno>
+#include <algorithm>
+#include <vector>
 
 #include <ConfigKit/ConfigKit.h>
 #include <ConfigKit/SchemaUtils.h>
@@ -40,6 +42,7 @@
 #include <ServerKit/HttpServer.h>
 #include <SystemTools/UserDatabase.h>
 #include <WrapperRegistry/Registry.h>
+#include <Core/ApplicationPool/Options.h>
 #include <Constants.h>
 #include <Exceptions.h>
 #include <StaticString.h>
@@ -88,6 +91,8 @@ parseControllerBenchmarkMode(const StaticString &mode) {
  *   default_abort_websockets_on_process_shutdown        boolean            -          default(true)
  *   default_app_file_descriptor_ulimit                  unsigned integer   -          -
  *   default_bind_address                                string             -          default("127.0.0.1")
+ *   default_capacity_reservation                        unsigned integer   -          default(0)
+ *   default_capacity_weight                             unsigned integer   -          default(1)
  *   default_environment                                 string             -          default("production")
  *   default_force_max_concurrent_requests_per_process   integer            -          default(-1)
  *   default_friendly_error_pages                        string             -          default("auto")
@@ -95,25 +100,31 @@ parseControllerBenchmarkMode(const StaticString &mode) {
  *   default_load_shell_envvars                          boolean            -          default(false)
  *   default_max_preloader_idle_time                     unsigned integer   -          default(300)
  *   default_max_request_queue_size                      unsigned integer   -          default(100)
+ *   default_max_request_queue_time                      unsigned integer   -          default(0)
  *   default_max_requests                                unsigned integer   -          default(0)
+ *   default_memory_limit                                unsigned integer   -          default(0)
  *   default_meteor_app_settings                         string             -          -
  *   default_min_instances                               unsigned integer   -          default(1)
  *   default_nodejs                                      string             -          default("node")
  *   default_python                                      string             -          default("python")
+ *   default_request_priority                            string             -          default("normal")
  *   default_ruby                                        string             -          default("ruby")
  *   default_server_name                                 string             required   -
  *   default_server_port                                 unsigned integer   required   -
  *   default_spawn_method                                string             -          default("smart")
  *   default_sticky_sessions                             boolean            -          default(false)
+ *   default_sticky_sessions_consistent_hashing          boolean            -          default(false)
  *   default_sticky_sessions_cookie_attributes           string             -          default("SameSite=Lax; Secure;")
  *   default_sticky_sessions_cookie_name                 string             -          default("_passenger_route")
  *   default_user                                        string             -          default("nobody")
  *   graceful_exit                                       boolean            -          default(true)
+ *   http2                                               boolean            -          default(false)
  *   integration_mode                                    string             -          default("standalone"),read_only
  *   max_instances_per_app                               unsigned integer   -          read_only
  *   min_spare_clients                                   unsigned integer   -          default(0)
  *   multi_app                                           boolean            -          default(true),read_only
  *   request_freelist_limit                              unsigned integer   -          default(1024)
+ *   request_priority_rules                              array of strings   -          default([])
  *   response_buffer_high_watermark                      unsigned integer   -          default(134217728)
  *   server_software                                     string             -          default("Phusion_Passenger/6.0.8")
  *   show_version_in_header                              boolean            -          default(true)
@@ -155,6 +166,7 @@ private:
 		add("default_server_name", STRING_TYPE, REQUIRED);
 		add("default_server_port", UINT_TYPE, REQUIRED);
 		add("default_sticky_sessions", BOOL_TYPE, OPTIONAL, false);
+		add("default_sticky_sessions_consistent_hashing", BOOL_TYPE, OPTIONAL, false);
 		add("default_sticky_sessions_cookie_name", STRING_TYPE, OPTIONAL, DEFAULT_STICKY_SESSIONS_COOKIE_NAME);
 		add("default_sticky_sessions_cookie_attributes", STRING_TYPE, OPTIONAL, DEFAULT_STICKY_SESSIONS_COOKIE_ATTRIBUTES);
 		add("server_software", STRING_TYPE, OPTIONAL, SERVER_TOKEN_NAME "/" PASSENGER_VERSION);
@@ -170,9 +182,15 @@ private:
 		add("default_min_instances", UINT_TYPE, OPTIONAL, 1);
 		add("default_max_preloader_idle_time", UINT_TYPE, OPTIONAL, DEFAULT_MAX_PRELOADER_IDLE_TIME);
 		add("default_max_request_queue_size", UINT_TYPE, OPTIONAL, DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+		add("default_max_request_queue_time", UINT_TYPE, OPTIONAL, 0);
 		add("default_force_max_concurrent_requests_per_process", INT_TYPE, OPTIONAL, -1);
 		add("default_abort_websockets_on_process_shutdown", BOOL_TYPE, OPTIONAL, true);
 		add("default_max_requests", UINT_TYPE, OPTIONAL, 0);
+		add("default_memory_limit", UINT_TYPE, OPTIONAL, 0);
+		add("default_capacity_weight", UINT_TYPE, OPTIONAL, 1);
+		add("default_capacity_reservation", UINT_TYPE, OPTIONAL, 0);
+		add("default_request_priority", STRING_TYPE, OPTIONAL, "normal");
+		add("request_priority_rules", STRING_ARRAY_TYPE, OPTIONAL, Json::arrayValue);
 
 
 		/*******************/
@@ -204,6 +222,27 @@ private:
 			errors.push_back(Error("'{{benchmark_mode}}' is not set to a valid value"));
 		}
 
+		string priority = config["default_request_priority"].asString();
+		if (priority != "high" && priority != "normal" && priority != "low") {
+			errors.push_back(Error("'{{default_request_priority}}' must be one of 'high', 'normal' or 'low'"));
+		}
+
+		Json::Value rules = config["request_priority_rules"];
+		Json::Value::const_iterator it, end = rules.end();
+		for (it = rules.begin(); it != end; it++) {
+			string rule = it->asString();
+			string::size_type pos = rule.rfind('=');
+			string ruleClass = (pos == string::npos) ? string() : rule.substr(pos + 1);
+			if (pos == 0 || rule[0] != '/'
+			 || (ruleClass != "high" && ruleClass != "normal" && ruleClass != "low"))
+			{
+				errors.push_back(Error("'{{request_priority_rules}}' entries must be "
+					"formatted as PATH_PREFIX=high|normal|low, with a path prefix "
+					"that begins with '/'"));
+				break;
+			}
+		}
+
 		/*******************/
 	}
 
@@ -399,6 +438,27 @@ public:
 	}
 };
 
+/**
+ * Requests whose path begins with `pathPrefix` are put in the
+ * `priority` class of the request queue, unless the web server
+ * specifies a priority class for them.
+ */
+struct RequestPriorityRule {
+	StaticString pathPrefix;
+	ApplicationPool2::RequestPriority priority;
+
+	RequestPriorityRule(const StaticString &_pathPrefix,
+		ApplicationPool2::RequestPriority _priority)
+		: pathPrefix(_pathPrefix),
+		  priority(_priority)
+		{ }
+
+	/** Orders longer prefixes first, so that the most specific rule matches. */
+	static bool longerPrefixFirst(const RequestPriorityRule &a, const RequestPriorityRule &b) {
+		return a.pathPrefix.size() > b.pathPrefix.size();
+	}
+};
+
 /**
  * A structure that caches controller configuration that must stay the
  * same for the entire duration of a request.
@@ -435,11 +495,18 @@ public:
 	unsigned int defaultMinInstances;
 	unsigned int defaultMaxPreloaderIdleTime;
 	unsigned int defaultMaxRequestQueueSize;
+	unsigned int defaultMaxRequestQueueTime;
 	unsigned int defaultMaxRequests;
+	unsigned int defaultMemoryLimit;
+	unsigned int defaultCapacityWeight;
+	unsigned int defaultCapacityReservation;
 	int defaultForceMaxConcurrentRequestsPerProcess;
+	ApplicationPool2::RequestPriority defaultRequestPriority;
+	vector<RequestPriorityRule> requestPriorityRules;
 	bool showVersionInHeader: 1;
 	bool defaultAbortWebsocketsOnProcessShutdown;
 	bool defaultLoadShellEnvvars;
+	bool defaultStickySessionsConsistentHashing;
 
 	/*******************/
 	/*******************/
@@ -469,14 +536,32 @@ public:
 		  defaultMinInstances(config["default_min_instances"].asUInt()),
 		  defaultMaxPreloaderIdleTime(config["default_max_preloader_idle_time"].asUInt()),
 		  defaultMaxRequestQueueSize(config["default_max_request_queue_size"].asUInt()),
+		  defaultMaxRequestQueueTime(config["default_max_request_queue_time"].asUInt()),
 		  defaultMaxRequests(config["default_max_requests"].asUInt()),
+		  defaultMemoryLimit(config["default_memory_limit"].asUInt()),
+		  defaultCapacityWeight(config["default_capacity_weight"].asUInt()),
+		  defaultCapacityReservation(config["default_capacity_reservation"].asUInt()),
 		  defaultForceMaxConcurrentRequestsPerProcess(config["default_force_max_concurrent_requests_per_process"].asInt()),
+		  defaultRequestPriority(ApplicationPool2::parseRequestPriority(config["default_request_priority"].asString())),
 		  showVersionInHeader(config["show_version_in_header"].asBool()),
 		  defaultAbortWebsocketsOnProcessShutdown(config["default_abort_websockets_on_process_shutdown"].asBool()),
-		  defaultLoadShellEnvvars(config["default_load_shell_envvars"].asBool())
+		  defaultLoadShellEnvvars(config["default_load_shell_envvars"].asBool()),
+		  defaultStickySessionsConsistentHashing(config["default_sticky_sessions_consistent_hashing"].asBool())
 
 		  /*******************/
-		{ }
+	{
+		Json::Value rules = config["request_priority_rules"];
+		Json::Value::const_iterator it, end = rules.end();
+		for (it = rules.begin(); it != end; it++) {
+			string rule = it->asString();
+			string::size_type pos = rule.rfind('=');
+			requestPriorityRules.push_back(RequestPriorityRule(
+				psg_pstrdup(pool, rule.substr(0, pos)),
+				ApplicationPool2::parseRequestPriority(rule.substr(pos + 1))));
+		}
+		std::stable_sort(requestPriorityRules.begin(), requestPriorityRules.end(),
+			RequestPriorityRule::longerPrefixFirst);
+	}
 
 	~ControllerRequestConfig() {
 		psg_destroy_pool(pool);
@@ -231,7 +231,7 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 					{
 						string message = "error parsing app response chunked encoding: ";
 						message.append(ServerKit::getErrorDesc(event.errcode));
-						disconnectWithError(&client, message);
+						endRequestWithError(&client, &req, message);
 					}
 					return Channel::Result(event.consumed, true);
 				}
@@ -241,7 +241,7 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 				case ServerKit::HttpChunkedEvent::NONE:
 				case ServerKit::HttpChunkedEvent::DATA:
 					assert(!event.end);
-					writeResponse(client, MemoryKit::mbuf(buffer, 0, event.consumed));
+					writeResponse(client, req, MemoryKit::mbuf(buffer, 0, event.consumed));
 					markResponsePartForTurboCaching(client, req, event.data);
 					maybeThrottleAppSource(client, req);
 					return Channel::Result(event.consumed, false);
@@ -250,7 +250,7 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 					SKC_TRACE(client, 2, "End of application response body reached");
 					resp->aux.bodyInfo.endReached = true;
 					handleAppResponseBodyEnd(client, req);
-					writeResponse(client, MemoryKit::mbuf(buffer, 0, event.consumed));
+					writeResponse(client, req, MemoryKit::mbuf(buffer, 0, event.consumed));
 					if (!req->ended()) {
 						endRequest(&client, &req);
 					}
@@ -260,7 +260,7 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 					{
 						string message = "error parsing app response chunked encoding: ";
 						message.append(ServerKit::getErrorDesc(event.errcode));
-						disconnectWithError(&client, message);
+						endRequestWithError(&client, &req, message);
 					}
 					return Channel::Result(event.consumed, true);
 				}
@@ -269,7 +269,7 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 			// Premature EOF. This cannot be an expected EOF because
 			// we end the request upon consuming the end of the chunked body.
 			UPDATE_TRACE_POINT();
-			disconnectWithError(&client, "error parsing app response chunked encoding: "
+			endRequestWithError(&client, &req, "error parsing app response chunked encoding: "
 				"unexpected end-of-stream");
 			return Channel::Result(0, false);
 		} else {
@@ -291,6 +291,9 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 			resp->bodyAlreadyRead += buffer.size();
 			writeResponseAndMarkForTurboCaching(client, req, buffer);
 			maybeThrottleAppSource(client, req);
+			if (resp->httpState == AppResponse::UPGRADED && !req->tunneled) {
+				maybeSwitchToTunnel(client, req);
+			}
 			return Channel::Result(buffer.size(), false);
 		} else if (errcode == 0 || errcode == ECONNRESET) {
 			// EOF
@@ -323,6 +326,7 @@ Controller::onAppResponseBegin(Client *client, Request *req) {
 	ssize_t bytesWritten;
 	bool oobw;
 
+	req->appResponseBegunAt = SystemTime::getMonotonicUsec();
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		req->timeOnRequestHeaderSent = ev_now(getLoop());
 		reportLargeTimeDiff(client,
@@ -397,6 +401,9 @@ Controller::onAppResponseBegin(Client *client, Request *req) {
 		UPDATE_TRACE_POINT();
 		handleAppResponseBodyEnd(client, req);
 		endRequest(&client, &req);
+	} else if (!req->ended() && resp->upgraded()) {
+		UPDATE_TRACE_POINT();
+		maybeSwitchToTunnel(client, req);
 	}
 }
 
@@ -442,7 +449,7 @@ Controller::onAppResponse100Continue(Client *client, Request *req) {
 		char *buf = (char *) psg_pnalloc(req->pool, BUFSIZE);
 		int size = snprintf(buf, BUFSIZE, "HTTP/%d.%d 100 Continue\r\n",
 			(int) req->httpMajor, (int) req->httpMinor);
-		writeResponse(client, buf, size);
+		writeResponse(client, req, buf, size);
 	}
 	if (!req->ended()) {
 		UPDATE_TRACE_POINT();
@@ -716,7 +723,7 @@ Controller::constructHeaderBuffersForResponse(Request *req, struct iovec *buffer
 	}
 
 	if (req->stickySession) {
-		StaticString baseURI = req->options.baseURI;
+		StaticString baseURI = req->options->baseURI;
 		if (baseURI.empty()) {
 			baseURI = P_STATIC_STRING("/");
 		}
@@ -769,7 +776,7 @@ Controller::constructHeaderBuffersForResponse(Request *req, struct iovec *buffer
 		INC_BUFFER_ITER(i);
 
 
-		StaticString stickyAttributes = req->options.stickySessionsCookieAttributes;
+		StaticString stickyAttributes = req->options->stickySessionsCookieAttributes;
 		if (stickyAttributes.size() > 0) {
 			PUSH_STATIC_BUFFER("; ");
 			if (buffers != NULL) {
@@ -829,6 +836,11 @@ Controller::sendResponseHeaderWithWritev(Client *client, Request *req,
 		writeBenchmarkResponse(&client, &req, false);
 		return true;
 	}
+	if (req->http2StreamId != 0) {
+		// The response goes through the HTTP/2 session.
+		bytesWritten = 0;
+		return false;
+	}
 
 	unsigned int maxbuffers = std::min<unsigned int>(
 		8 + req->appResponse.headers.size() * 4 + 11, IOV_MAX);
@@ -890,13 +902,13 @@ Controller::sendResponseHeaderWithBuffering(Client *client, Request *req,
 		MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
 		gatherBuffers(buffer.start, MBUF_MAX_SIZE, buffers, nbuffers);
 		buffer = MemoryKit::mbuf(buffer, offset, dataSize - offset);
-		writeResponse(client, buffer);
+		writeResponse(client, req, buffer);
 	} else {
 		UPDATE_TRACE_POINT();
 		SKC_TRACE(client, 2, "Sending response headers using a psg_pool buffer");
 		char *buffer = (char *) psg_pnalloc(req->pool, dataSize);
 		gatherBuffers(buffer, dataSize, buffers, nbuffers);
-		writeResponse(client, buffer + offset, dataSize - offset);
+		writeResponse(client, req, buffer + offset, dataSize - offset);
 	}
 }
 
@@ -974,7 +986,7 @@ Controller::writeResponseAndMarkForTurboCaching(Client *client, Request *req,
 	const MemoryKit::mbuf &buffer)
 {
 	if (OXT_LIKELY(mainConfig.benchmarkMode != BM_RESPONSE_BEGIN)) {
-		writeResponse(client, buffer);
+		writeResponse(client, req, buffer);
 	}
 	markResponsePartForTurboCaching(client, req, buffer);
 }
@@ -1002,7 +1014,23 @@ Controller::markResponsePartForTurboCaching(Client *client, Request *req,
 
 void
 Controller::maybeThrottleAppSource(Client *client, Request *req) {
-	if (!req->ended()) {
+	if (req->http2StreamId != 0) {
+		// The output channel is shared by all streams, so the session
+		// pauses and resumes each stream on its own; see onHttp2StreamWritable().
+		if (req->ended()) {
+			return;
+		}
+		if (mainConfig.responseBufferHighWatermark > 0
+		 && client->output.getTotalBytesBuffered() >= mainConfig.responseBufferHighWatermark)
+		{
+			throttleHttp2Output(client);
+		}
+		if (http2ResponseBufferFull(client, req)) {
+			SKC_TRACE(client, 2, "Application is sending response data quicker than the HTTP/2 "
+				"client can keep up with. Throttling application socket");
+			req->appSource.stop();
+		}
+	} else if (!req->ended()) {
 		assert(client->output.getBuffersFlushedCallback() == NULL);
 		assert(client->output.getDataFlushedCallback() == getClientOutputDataFlushedCallback());
 		if (mainConfig.responseBufferHighWatermark > 0
@@ -1027,9 +1055,12 @@ Controller::_outputBuffersFlushed(FileBufferedChannel *_channel) {
 	FileBufferedFdSinkChannel *channel = reinterpret_cast<FileBufferedFdSinkChannel *>(_channel);
 	Client *client = static_cast<Client *>(static_cast<
 		ServerKit::BaseClient *>(channel->getHooks()->userData));
+	// Only HTTP/1 responses install this callback (see maybeThrottleAppSource()),
+	// and those are always the client's current request.
 	Request *req = static_cast<Request *>(client->currentRequest);
 	Controller *self = static_cast<Controller *>(getServerFromClient(client));
 	if (client->connected() && req != NULL) {
+		assert(req->http2StreamId == 0);
 		self->outputBuffersFlushed(client, req);
 	}
 }
@@ -1049,11 +1080,13 @@ Controller::_outputDataFlushed(FileBufferedChannel *_channel) {
 	FileBufferedFdSinkChannel *channel = reinterpret_cast<FileBufferedFdSinkChannel *>(_channel);
 	Client *client = static_cast<Client *>(static_cast<
 		ServerKit::BaseClient *>(channel->getHooks()->userData));
+	// See the comment in _outputBuffersFlushed().
 	Request *req = static_cast<Request *>(client->currentRequest);
 	Controller *self = static_cast<Controller *>(getServerFromClient(client));
 
 	getClientOutputDataFlushedCallback()(_channel);
 	if (client->connected() && req != NULL) {
+		assert(req->http2StreamId == 0);
 		self->outputDataFlushed(client, req);
 	}
 }
@@ -93,6 +93,24 @@ Controller::onClientAccepted(Client *client) {
 	client->connectedAt = ev_now(getLoop());
 }
 
+ServerKit::Channel::Result
+Controller::onClientDataReceived(Client *client, const MemoryKit::mbuf &buffer,
+	int errcode)
+{
+	// Marks the start of the HEADERS_PARSED latency phase. On keep-alive
+	// connections this excludes the time spent waiting for the next request.
+	Request *req = client->currentRequest;
+	if (client->http2Session == NULL
+	 && req != NULL
+	 && req->headerReceiveStartedAt == 0
+	 && req->httpState == Request::PARSING_HEADERS
+	 && buffer.size() > 0)
+	{
+		req->headerReceiveStartedAt = SystemTime::getMonotonicUsec();
+	}
+	return ParentClass::onClientDataReceived(client, buffer, errcode);
+}
+
 void
 Controller::onRequestObjectCreated(Client *client, Request *req) {
 	ParentClass::onRequestObjectCreated(client, req);
@@ -107,6 +125,10 @@ Controller::onRequestObjectCreated(Client *client, Request *req) {
 	req->bodyBuffer.setContext(getContext());
 	req->bodyBuffer.setHooks(&req->hooks);
 	req->bodyBuffer.setDataCallback(onBodyBufferData);
+	// The buffer file may be passed to the app (see
+	// mayPassBufferedBodyFdToApp()), which isn't possible for data in the
+	// shared spool arena.
+	req->bodyBuffer.setSpoolToArena(false);
 }
 
 void
@@ -124,6 +146,12 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 	// appSink and appSource are initialized in Controller::checkoutSession().
 
 	req->startedAt = 0;
+	req->headerReceiveStartedAt = 0;
+	req->headersParsedAt = 0;
+	req->checkoutStartedAt = 0;
+	req->sessionCheckedOutAt = 0;
+	req->appRequestHeaderSentAt = 0;
+	req->appResponseBegunAt = 0;
 	req->state = Request::ANALYZING_REQUEST;
 	req->dechunkResponse = false;
 	req->requestBodyBuffering = false;
@@ -134,6 +162,8 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 	req->appResponseInitialized = false;
 	req->strip100ContinueHeader = false;
 	req->hasPragmaHeader = false;
+	req->tunneled = false;
+	req->bodyPassedAsFd = false;
 	req->host = NULL;
 	req->config = requestConfig;
 	req->bodyBytesBuffered = 0;
@@ -141,6 +171,10 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 	req->cacheControl = NULL;
 	req->varyCookie = NULL;
 	req->envvars = NULL;
+	req->options = NULL;
+	req->privateOptions = NULL;
+	req->checkoutTime = 0;
+	req->stickySessionId = 0;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		req->timedAppPoolGet = false;
@@ -154,13 +188,22 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 
 void
 Controller::deinitializeRequest(Client *client, Request *req) {
+	if (req->state == Request::CHECKING_OUT_SESSION) {
+		cancelCheckoutSession(client, req);
+	}
+	if (req->headersParsedAt != 0) {
+		recordLatencyStats(client, req);
+	}
+
 	req->session.reset();
 	req->config.reset();
+	destroyPrivatePoolOptions(req);
 
 	req->appSink.setConsumedCallback(NULL);
 	req->appSink.deinitialize();
 	req->appSource.deinitialize();
 	req->bodyBuffer.clearBuffersFlushedCallback();
+	req->bodyBuffer.setWriterTerminatedCallback(NULL);
 	req->bodyBuffer.deinitialize();
 
 	/***************/
@@ -214,6 +257,18 @@ Controller::deinitializeAppResponse(Client *client, Request *req) {
 		resp->parserState.headerParser = NULL;
 	}
 
+	releaseAppResponseHeaders(client, req);
+}
+
+/**
+ * Releases the app response headers, including the buffers that their data
+ * lives in. Also called by switchToTunnel() after the response headers have
+ * been forwarded.
+ */
+void
+Controller::releaseAppResponseHeaders(Client *client, Request *req) {
+	AppResponse *resp = &req->appResponse;
+
 	ServerKit::HeaderTable::Iterator it(resp->headers);
 	while (*it != NULL) {
 		psg_lstr_deinit(&it->header->key);
@@ -237,6 +292,14 @@ Controller::deinitializeAppResponse(Client *client, Request *req) {
 		psg_lstr_deinit(resp->setCookie);
 	}
 	psg_lstr_deinit(&resp->bodyCacheBuffer);
+
+	resp->date = NULL;
+	resp->setCookie = NULL;
+	resp->cacheControl = NULL;
+	resp->expiresHeader = NULL;
+	resp->lastModifiedHeader = NULL;
+	resp->headerCacheBuffers = NULL;
+	resp->nHeaderCacheBuffers = 0;
 }
 
 ServerKit::Channel::Result
@@ -289,6 +352,14 @@ Controller::supportsUpgrade(Client *client, Request *req) {
 	return true;
 }
 
+void
+Controller::onHttp2StreamWritable(Client *client, Request *req) {
+	if (!req->ended() && !req->appSource.isStarted()) {
+		SKC_TRACE(client, 2, "The HTTP/2 client is ready to receive more data. Resuming application socket");
+		req->appSource.start();
+	}
+}
+
 
 /****************************
  *
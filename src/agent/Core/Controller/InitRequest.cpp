@@ -139,7 +139,7 @@ Controller::initializePoolOptions(Client *client, Request *req, RequestAnalysis
 	if (mainConfig.singleAppMode) {
 		P_ASSERT_EQ(poolOptionsCache.size(), 1);
 		poolOptionsCache.lookupRandom(NULL, &options);
-		req->options = **options;
+		req->options = options->get();
 	} else {
 		ServerKit::HeaderTable::Cell *appGroupNameCell = analysis.appGroupNameCell;
 		if (appGroupNameCell != NULL && appGroupNameCell->header->val.size > 0) {
@@ -152,29 +152,59 @@ Controller::initializePoolOptions(Client *client, Request *req, RequestAnalysis
 			poolOptionsCache.lookup(hAppGroupName, &options);
 
 			if (options != NULL) {
-				req->options = **options;
-				fillPoolOption(req, req->options.baseURI, "!~SCRIPT_NAME");
+				req->options = options->get();
+				const LString *scriptName = req->secureHeaders.lookup("!~SCRIPT_NAME");
+				if (scriptName != NULL && scriptName->size > 0
+				 && !psg_lstr_cmp(scriptName, req->options->baseURI))
+				{
+					fillPoolOption(req, getWritablePoolOptions(req).baseURI,
+						"!~SCRIPT_NAME");
+				}
 			} else {
 				createNewPoolOptions(client, req, hAppGroupName);
 			}
 		} else {
-			disconnectWithError(&client, "the !~PASSENGER_APP_GROUP_NAME header must be set");
+			endRequestWithError(&client, &req, "the !~PASSENGER_APP_GROUP_NAME header must be set");
+			return;
 		}
 	}
 
 	if (!req->ended()) {
+		// The options that are shared with other requests are only copied
+		// when this request overrides one of them with a different value.
+
 		// See comment for req->envvars to learn how it is different
-		// from req->options.environmentVariables.
+		// from req->options->environmentVariables.
 		req->envvars = req->secureHeaders.lookup(PASSENGER_ENV_VARS);
 		if (req->envvars != NULL && req->envvars->size > 0) {
 			req->envvars = psg_lstr_make_contiguous(req->envvars, req->pool);
-			req->options.environmentVariables = StaticString(
-				req->envvars->start->data,
-				req->envvars->size);
+			StaticString envvars(req->envvars->start->data, req->envvars->size);
+			if (envvars != req->options->environmentVariables) {
+				getWritablePoolOptions(req).environmentVariables = envvars;
+			}
 		}
 
 		// Allow certain options to be overridden on a per-request basis
-		fillPoolOption(req, req->options.maxRequests, PASSENGER_MAX_REQUESTS);
+		unsigned long maxRequests = req->options->maxRequests;
+		fillPoolOption(req, maxRequests, PASSENGER_MAX_REQUESTS);
+		if (maxRequests != req->options->maxRequests) {
+			getWritablePoolOptions(req).maxRequests = maxRequests;
+		}
+
+		// A priority class set by the web server takes precedence over
+		// the path rules.
+		const LString *priority = req->secureHeaders.lookup(PASSENGER_REQUEST_PRIORITY);
+		RequestPriority requestPriority = req->options->requestPriority;
+		if (priority != NULL && priority->size > 0) {
+			priority = psg_lstr_make_contiguous(priority, req->pool);
+			requestPriority = parseRequestPriority(
+				StaticString(priority->start->data, priority->size));
+		} else {
+			requestPriority = lookupRequestPriorityRule(req, requestPriority);
+		}
+		if (requestPriority != req->options->requestPriority) {
+			getWritablePoolOptions(req).requestPriority = requestPriority;
+		}
 	}
 }
 
@@ -196,6 +226,7 @@ Controller::fillPoolOptionsFromConfigCaches(Options &options,
 	options.minProcesses = requestConfig->defaultMinInstances;
 	options.maxPreloaderIdleTime = requestConfig->defaultMaxPreloaderIdleTime;
 	options.maxRequestQueueSize = requestConfig->defaultMaxRequestQueueSize;
+	options.maxRequestQueueTime = requestConfig->defaultMaxRequestQueueTime;
 	options.abortWebsocketsOnProcessShutdown = requestConfig->defaultAbortWebsocketsOnProcessShutdown;
 	options.forceMaxConcurrentRequestsPerProcess = requestConfig->defaultForceMaxConcurrentRequestsPerProcess;
 	options.environment = requestConfig->defaultEnvironment;
@@ -204,11 +235,34 @@ Controller::fillPoolOptionsFromConfigCaches(Options &options,
 	options.loadShellEnvvars = requestConfig->defaultLoadShellEnvvars;
 	options.statThrottleRate = mainConfig.statThrottleRate;
 	options.maxRequests = requestConfig->defaultMaxRequests;
+	options.memoryLimit = requestConfig->defaultMemoryLimit;
+	options.capacityWeight = requestConfig->defaultCapacityWeight;
+	options.capacityReservation = requestConfig->defaultCapacityReservation;
+	options.requestPriority = requestConfig->defaultRequestPriority;
 	options.stickySessionsCookieAttributes = requestConfig->defaultStickySessionsCookieAttributes;
+	options.stickySessionsConsistentHashing = requestConfig->defaultStickySessionsConsistentHashing;
 
 	/******************************/
 }
 
+/**
+ * Returns the priority class of the most specific `request_priority_rules`
+ * entry whose path prefix matches this request, or `defaultPriority` if
+ * none matches.
+ */
+RequestPriority
+Controller::lookupRequestPriorityRule(Request *req, RequestPriority defaultPriority) {
+	const vector<RequestPriorityRule> &rules = req->config->requestPriorityRules;
+	vector<RequestPriorityRule>::const_iterator it, end = rules.end();
+
+	for (it = rules.begin(); it != end; it++) {
+		if (psg_lstr_cmp(&req->path, it->pathPrefix, it->pathPrefix.size())) {
+			return it->priority;
+		}
+	}
+	return defaultPriority;
+}
+
 void
 Controller::fillPoolOption(Request *req, StaticString &field,
 	const HashedStaticString &name)
@@ -290,11 +344,11 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	const HashedStaticString &appGroupName)
 {
 	ServerKit::HeaderTable &secureHeaders = req->secureHeaders;
-	Options &options = req->options;
+	Options &options = getWritablePoolOptions(req);
 
 	SKC_TRACE(client, 2, "Creating new pool options: app group name=" << appGroupName);
 
-	options = Options();
+	options.ownedByCaller = true;
 
 	const LString *scriptName = secureHeaders.lookup("!~SCRIPT_NAME");
 	const LString *appRoot = secureHeaders.lookup("!~PASSENGER_APP_ROOT");
@@ -302,7 +356,7 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 		if (appRoot == NULL || appRoot->size == 0) {
 			const LString *documentRoot = secureHeaders.lookup("!~DOCUMENT_ROOT");
 			if (OXT_UNLIKELY(documentRoot == NULL || documentRoot->size == 0)) {
-				disconnectWithError(&client, "client did not send a !~PASSENGER_APP_ROOT or a !~DOCUMENT_ROOT header");
+				endRequestWithError(&client, &req, "client did not send a !~PASSENGER_APP_ROOT or a !~DOCUMENT_ROOT header");
 				return;
 			}
 
@@ -318,7 +372,7 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 		if (appRoot == NULL || appRoot->size == 0) {
 			const LString *documentRoot = secureHeaders.lookup("!~DOCUMENT_ROOT");
 			if (OXT_UNLIKELY(documentRoot == NULL || documentRoot->size == 0)) {
-				disconnectWithError(&client, "client did not send a !~DOCUMENT_ROOT header");
+				endRequestWithError(&client, &req, "client did not send a !~DOCUMENT_ROOT header");
 				return;
 			}
 
@@ -342,10 +396,11 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	if (appType == NULL || appType->size == 0) {
 		const LString *appStartCommand = secureHeaders.lookup("!~PASSENGER_APP_START_COMMAND");
 		if (appStartCommand == NULL || appStartCommand->size == 0) {
-			AppTypeDetector::Detector detector(*wrapperRegistry);
+			AppTypeDetector::Detector detector(*wrapperRegistry, &cstat, NULL,
+				mainConfig.statThrottleRate);
 			AppTypeDetector::Detector::Result result = detector.checkAppRoot(options.appRoot);
 			if (result.isNull()) {
-				disconnectWithError(&client, "client did not send a recognized !~PASSENGER_APP_TYPE header");
+				endRequestWithError(&client, &req, "client did not send a recognized !~PASSENGER_APP_TYPE header");
 				return;
 			}
 			options.appType = result.wrapperRegistryEntry->language;
@@ -373,6 +428,7 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	fillPoolOptionSecToMsec(req, options.startTimeout, "!~PASSENGER_START_TIMEOUT");
 	fillPoolOption(req, options.maxPreloaderIdleTime, "!~PASSENGER_MAX_PRELOADER_IDLE_TIME");
 	fillPoolOption(req, options.maxRequestQueueSize, "!~PASSENGER_MAX_REQUEST_QUEUE_SIZE");
+	fillPoolOption(req, options.maxRequestQueueTime, "!~PASSENGER_MAX_REQUEST_QUEUE_TIME");
 	fillPoolOption(req, options.abortWebsocketsOnProcessShutdown, "!~PASSENGER_ABORT_WEBSOCKETS_ON_PROCESS_SHUTDOWN");
 	fillPoolOption(req, options.forceMaxConcurrentRequestsPerProcess, "!~PASSENGER_FORCE_MAX_CONCURRENT_REQUESTS_PER_PROCESS");
 	fillPoolOption(req, options.restartDir, "!~PASSENGER_RESTART_DIR");
@@ -382,6 +438,10 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	fillPoolOption(req, options.raiseInternalError, "!~PASSENGER_RAISE_INTERNAL_ERROR");
 	fillPoolOption(req, options.lveMinUid, "!~PASSENGER_LVE_MIN_UID");
 	fillPoolOption(req, options.stickySessionsCookieAttributes, "!~PASSENGER_STICKY_SESSIONS_COOKIE_ATTRIBUTES");
+	fillPoolOption(req, options.stickySessionsConsistentHashing, "!~PASSENGER_STICKY_SESSIONS_CONSISTENT_HASHING");
+	fillPoolOption(req, options.memoryLimit, "!~PASSENGER_MEMORY_LIMIT");
+	fillPoolOption(req, options.capacityWeight, "!~PASSENGER_CAPACITY_WEIGHT");
+	fillPoolOption(req, options.capacityReservation, "!~PASSENGER_CAPACITY_RESERVATION");
 
 	// maxProcesses is configured per-application by the (Enterprise) maxInstances option (and thus passed
 	// via request headers). In OSS the max processes can also be configured, but on a global level
@@ -390,12 +450,46 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	options.maxProcesses = mainConfig.maxInstancesPerApp;
 	/******************/
 
+	options.numaNode = numaNode;
+
 	boost::shared_ptr<Options> optionsCopy = boost::make_shared<Options>(options);
 	optionsCopy->persist(options);
 	optionsCopy->clearPerRequestFields();
+	// Cache entries are never removed, so they outlive any get action
+	// that refers to them. See Request::options.
+	optionsCopy->ownedByCaller = true;
 	poolOptionsCache.insert(options.getAppGroupName(), optionsCopy);
 }
 
+/**
+ * Returns a copy of the request's pool options that the request may modify,
+ * making that copy first if the request still shares its options with other
+ * requests. The copy is allocated from the request's palloc pool and is
+ * destroyed by destroyPrivatePoolOptions().
+ */
+Options &
+Controller::getWritablePoolOptions(Request *req) {
+	if (req->privateOptions == NULL) {
+		void *mem = psg_palloc(req->pool, sizeof(Options));
+		if (req->options != NULL) {
+			req->privateOptions = new (mem) Options(*req->options);
+		} else {
+			req->privateOptions = new (mem) Options();
+		}
+		req->options = req->privateOptions;
+	}
+	return *req->privateOptions;
+}
+
+void
+Controller::destroyPrivatePoolOptions(Request *req) {
+	if (req->privateOptions != NULL) {
+		req->privateOptions->~Options();
+		req->privateOptions = NULL;
+	}
+	req->options = NULL;
+}
+
 void
 Controller::setStickySessionId(Client *client, Request *req) {
 	if (req->stickySession) {
@@ -412,7 +506,7 @@ Controller::setStickySessionId(Client *client, Request *req) {
 			foreach (cookie, cookies) {
 				if (psg_lstr_cmp(cookieName, cookie.first)) {
 					// This cookie matches the one we're looking for.
-					req->options.stickySessionId = stringToUint(cookie.second);
+					req->stickySessionId = stringToUint(cookie.second);
 					return;
 				}
 			}
@@ -462,6 +556,7 @@ Controller::onRequestBegin(Client *client, Request *req) {
 
 		SKC_TRACE(client, 2, "Initiating request");
 		req->startedAt = ev_now(getLoop());
+		req->headersParsedAt = SystemTime::getMonotonicUsec();
 		req->bodyChannel.stop();
 
 		initializeFlags(client, req, analysis);
@@ -67,6 +67,7 @@ Controller::preinitialize() {
 	PASSENGER_APP_GROUP_NAME = "!~PASSENGER_APP_GROUP_NAME";
 	PASSENGER_ENV_VARS = "!~PASSENGER_ENV_VARS";
 	PASSENGER_MAX_REQUESTS = "!~PASSENGER_MAX_REQUESTS";
+	PASSENGER_REQUEST_PRIORITY = "!~PASSENGER_REQUEST_PRIORITY";
 	PASSENGER_SHOW_VERSION_IN_HEADER = "!~PASSENGER_SHOW_VERSION_IN_HEADER";
 	PASSENGER_STICKY_SESSIONS = "!~PASSENGER_STICKY_SESSIONS";
 	PASSENGER_STICKY_SESSIONS_COOKIE_NAME = "!~PASSENGER_STICKY_SESSIONS_COOKIE_NAME";
@@ -121,6 +122,7 @@ Controller::initialize() {
 		options->startupFile = startupFile;
 		options->appStartCommand = appStartCommand;
 		*options = options->copyAndPersist();
+		options->ownedByCaller = true;
 		poolOptionsCache.insert(options->getAppGroupName(), options);
 	}
 }
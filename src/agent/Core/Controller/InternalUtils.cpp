@@ -60,27 +60,33 @@ Controller::disconnectWithClientSocketWriteError(Client **client, int e) {
 	disconnectWithError(client, message.str(), logLevel);
 }
 
+/*
+ * The app socket errors below only concern one request. For an HTTP/2
+ * stream, endRequestWithError() resets that stream instead of
+ * disconnecting the client.
+ */
+
 void
-Controller::disconnectWithAppSocketIncompleteResponseError(Client **client) {
-	disconnectWithError(client, "application did not send a complete response");
+Controller::disconnectWithAppSocketIncompleteResponseError(Client **client, Request **req) {
+	endRequestWithError(client, req, "application did not send a complete response");
 }
 
 void
-Controller::disconnectWithAppSocketReadError(Client **client, int e) {
+Controller::disconnectWithAppSocketReadError(Client **client, Request **req, int e) {
 	stringstream message;
 	message << "app socket read error: ";
 	message << ServerKit::getErrorDesc(e);
 	message << " (errno=" << e << ")";
-	disconnectWithError(client, message.str());
+	endRequestWithError(client, req, message.str());
 }
 
 void
-Controller::disconnectWithAppSocketWriteError(Client **client, int e) {
+Controller::disconnectWithAppSocketWriteError(Client **client, Request **req, int e) {
 	stringstream message;
 	message << "app socket write error: ";
 	message << ServerKit::getErrorDesc(e);
 	message << " (errno=" << e << ")";
-	disconnectWithError(client, message.str());
+	endRequestWithError(client, req, message.str());
 }
 
 void
@@ -98,18 +104,19 @@ Controller::endRequestWithAppSocketIncompleteResponse(Client **client, Request *
 		endRequestWithSimpleResponse(client, req,
 			"<h2>Incomplete response received from application</h2>", 502);
 	} else {
-		disconnectWithAppSocketIncompleteResponseError(client);
+		disconnectWithAppSocketIncompleteResponseError(client, req);
 	}
 }
 
 void
 Controller::endRequestWithAppSocketReadError(Client **client, Request **req, int e) {
 	Client *c = *client;
+	Request *r = *req;
 	if (!(*req)->responseBegun) {
 		SKC_WARN(*client, "Sending 502 response: application socket read error");
 		endRequestWithSimpleResponse(client, req, "<h2>Application socket read error</h2>", 502);
 	} else {
-		disconnectWithAppSocketReadError(&c, e);
+		disconnectWithAppSocketReadError(&c, &r, e);
 	}
 }
 
@@ -125,18 +132,18 @@ Controller::endRequestWithSimpleResponse(Client **c, Request **r,
 	ServerKit::HeaderTable headers;
 
 	headers.insert(req->pool, "cache-control", "no-cache, no-store, must-revalidate");
-	writeSimpleResponse(client, code, &headers, body);
+	writeSimpleResponse(client, req, code, &headers, body);
 	endRequest(c, r);
 }
 
 void
 Controller::endRequestAsBadGateway(Client **client, Request **req) {
 	if ((*req)->responseBegun) {
-		disconnectWithError(client, "bad gateway");
+		endRequestWithError(client, req, "bad gateway");
 	} else {
 		ServerKit::HeaderTable headers;
 		headers.insert((*req)->pool, "cache-control", "no-cache, no-store, must-revalidate");
-		writeSimpleResponse(*client, 502, &headers, "<h1>Bad Gateway</h1>");
+		writeSimpleResponse(*client, *req, 502, &headers, "<h1>Bad Gateway</h1>");
 		endRequest(client, req);
 	}
 }
@@ -144,7 +151,7 @@ Controller::endRequestAsBadGateway(Client **client, Request **req) {
 void
 Controller::writeBenchmarkResponse(Client **client, Request **req, bool end) {
 	if (canKeepAlive(*req)) {
-		writeResponse(*client, P_STATIC_STRING(
+		writeResponse(*client, *req, P_STATIC_STRING(
 			"HTTP/1.1 200 OK\r\n"
 			"Status: 200 OK\r\n"
 			"Date: Wed, 15 Nov 1995 06:25:24 GMT\r\n"
@@ -154,7 +161,7 @@ Controller::writeBenchmarkResponse(Client **client, Request **req, bool end) {
 			"\r\n"
 			"ok\n"));
 	} else {
-		writeResponse(*client, P_STATIC_STRING(
+		writeResponse(*client, *req, P_STATIC_STRING(
 			"HTTP/1.1 200 OK\r\n"
 			"Status: 200 OK\r\n"
 			"Date: Wed, 15 Nov 1995 06:25:24 GMT\r\n"
@@ -296,6 +303,45 @@ Controller::parseCookieHeader(psg_pool_t *pool, const LString *headerValue,
 	}
 }
 
+/**
+ * Called when a request is deinitialized. Records the duration of every
+ * request phase that the request went through into `latencyStats`.
+ */
+void
+Controller::recordLatencyStats(Client *client, Request *req) {
+	struct Recorder {
+		static void record(LatencyStats &stats, LatencyStats::Phase phase,
+			const HashedStaticString &appGroupName, MonotonicTimeUsec from,
+			MonotonicTimeUsec to)
+		{
+			if (from != 0 && to != 0 && to >= from) {
+				stats.record(phase, appGroupName, to - from);
+			}
+		}
+	};
+
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+	// req->options is only filled in for requests that try to check out a
+	// session; e.g. not for requests that were served by the turbocache.
+	HashedStaticString appGroupName;
+	if (req->checkoutStartedAt != 0) {
+		appGroupName = req->options->getAppGroupName();
+	}
+
+	Recorder::record(latencyStats, LatencyStats::HEADERS_PARSED, appGroupName,
+		req->headerReceiveStartedAt, req->headersParsedAt);
+	Recorder::record(latencyStats, LatencyStats::QUEUE_WAIT, appGroupName,
+		req->checkoutStartedAt, req->sessionCheckedOutAt);
+	Recorder::record(latencyStats, LatencyStats::SESSION_CONNECT, appGroupName,
+		req->sessionCheckedOutAt, req->appRequestHeaderSentAt);
+	Recorder::record(latencyStats, LatencyStats::FIRST_APP_BYTE, appGroupName,
+		req->appRequestHeaderSentAt, req->appResponseBegunAt);
+	if (!req->upgraded()) {
+		Recorder::record(latencyStats, LatencyStats::TOTAL, appGroupName,
+			req->headersParsedAt, now);
+	}
+}
+
 #ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 	void
 	Controller::reportLargeTimeDiff(Client *client, const char *name,
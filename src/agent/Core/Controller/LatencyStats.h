@@ -0,0 +1,295 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_LATENCY_STATS_H_
+#define _PASSENGER_CORE_CONTROLLER_LATENCY_STATS_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <set>
+#include <map>
+#include <ostream>
+#include <jsoncpp/json.h>
+#include <Algorithms/LatencyHistogram.h>
+#include <DataStructures/StringKeyTable.h>
+#include <DataStructures/HashedStaticString.h>
+#include <StaticString.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * Per-phase request latency histograms, maintained by every Controller for
+ * all requests together and for each application group separately. Each
+ * Controller only touches its own LatencyStats from its own event loop
+ * thread, so recording requires no locking or atomic operations. Reports
+ * are created by taking a Snapshot on every Controller thread and merging
+ * those.
+ */
+class LatencyStats {
+public:
+	enum Phase {
+		/**
+		 * From receiving the first bytes of the request until its headers have
+		 * been parsed. Idle time on keep-alive connections is not included.
+		 * Not recorded for HTTP/2 streams.
+		 */
+		HEADERS_PARSED,
+		/** From the first attempt to check out a session until the pool hands one out. */
+		QUEUE_WAIT,
+		/** From obtaining a session until the request header has been sent to the app. */
+		SESSION_CONNECT,
+		/** From sending the request header until the app's response begins. */
+		FIRST_APP_BYTE,
+		/**
+		 * From parsing the request headers until the request ends. Not recorded
+		 * for upgraded (e.g. WebSocket) requests, which last as long as the
+		 * connection does.
+		 */
+		TOTAL,
+
+		PHASE_COUNT
+	};
+
+	struct HistogramSet {
+		LatencyHistogram histograms[PHASE_COUNT];
+
+		void merge(const HistogramSet &other) {
+			for (unsigned int i = 0; i < PHASE_COUNT; i++) {
+				histograms[i].merge(other.histograms[i]);
+			}
+		}
+	};
+
+	typedef boost::shared_ptr<HistogramSet> HistogramSetPtr;
+
+	/**
+	 * A copy of one or more LatencyStats that can be passed between
+	 * threads, merged and reported.
+	 */
+	struct Snapshot {
+		HistogramSet total;
+		map<string, HistogramSet> groups;
+
+		void merge(const Snapshot &other) {
+			map<string, HistogramSet>::const_iterator it, end = other.groups.end();
+
+			total.merge(other.total);
+			for (it = other.groups.begin(); it != end; it++) {
+				groups[it->first].merge(it->second);
+			}
+		}
+
+		Json::Value inspectAsJson() const {
+			Json::Value doc;
+			Json::Value groupsDoc(Json::objectValue);
+			map<string, HistogramSet>::const_iterator it, end = groups.end();
+
+			doc["total"] = inspectHistogramSetAsJson(total);
+			for (it = groups.begin(); it != end; it++) {
+				groupsDoc[it->first] = inspectHistogramSetAsJson(it->second);
+			}
+			doc["groups"] = groupsDoc;
+			return doc;
+		}
+
+		/**
+		 * Writes the histograms in the Prometheus text exposition format.
+		 * Prometheus histograms have cumulative buckets with fixed upper bounds,
+		 * so the log-linear buckets are folded into a short list of bounds.
+		 * Because a bound may fall inside a log-linear bucket, bucket counts
+		 * may include values that are up to 12.5% larger than the bound.
+		 */
+		void writePrometheusText(ostream &stream, const StaticString &metricName) const {
+			map<string, HistogramSet>::const_iterator it, end = groups.end();
+
+			stream << "# HELP " << metricName << " Request latency per phase, in seconds.\n";
+			stream << "# TYPE " << metricName << " histogram\n";
+			writePrometheusHistogramSet(stream, metricName, StaticString(), total);
+			for (it = groups.begin(); it != end; it++) {
+				writePrometheusHistogramSet(stream, metricName, it->first, it->second);
+			}
+		}
+	};
+
+	static const char *getPhaseName(Phase phase) {
+		switch (phase) {
+		case HEADERS_PARSED:
+			return "headers_parsed";
+		case QUEUE_WAIT:
+			return "queue_wait";
+		case SESSION_CONNECT:
+			return "session_connect";
+		case FIRST_APP_BYTE:
+			return "first_app_byte";
+		case TOTAL:
+			return "total";
+		default:
+			return "unknown";
+		}
+	}
+
+private:
+	HistogramSet total;
+	StringKeyTable<HistogramSetPtr> groups;
+
+	static Json::Value inspectHistogramAsJson(const LatencyHistogram &histogram) {
+		Json::Value doc;
+		doc["count"] = (Json::UInt64) histogram.getCount();
+		doc["sum_usec"] = (Json::UInt64) histogram.getSum();
+		doc["max_usec"] = (Json::UInt64) histogram.getMax();
+		doc["p50_usec"] = (Json::UInt64) histogram.valueAtPercentile(50);
+		doc["p90_usec"] = (Json::UInt64) histogram.valueAtPercentile(90);
+		doc["p99_usec"] = (Json::UInt64) histogram.valueAtPercentile(99);
+		doc["p999_usec"] = (Json::UInt64) histogram.valueAtPercentile(99.9);
+		return doc;
+	}
+
+	static Json::Value inspectHistogramSetAsJson(const HistogramSet &set) {
+		Json::Value doc;
+		for (unsigned int i = 0; i < PHASE_COUNT; i++) {
+			doc[getPhaseName((Phase) i)] = inspectHistogramAsJson(set.histograms[i]);
+		}
+		return doc;
+	}
+
+	static void writePrometheusHistogramSet(ostream &stream, const StaticString &metricName,
+		const StaticString &groupName, const HistogramSet &set)
+	{
+		// Upper bounds in microseconds.
+		static const boost::uint64_t bounds[] = {
+			1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000,
+			1000000, 2500000, 5000000, 10000000, 30000000, 60000000
+		};
+		static const unsigned int nbounds = sizeof(bounds) / sizeof(boost::uint64_t);
+
+		for (unsigned int i = 0; i < PHASE_COUNT; i++) {
+			const LatencyHistogram &histogram = set.histograms[i];
+			string labels = string("phase=\"") + getPhaseName((Phase) i) + "\"";
+			if (!groupName.empty()) {
+				labels.append(",app_group=\"");
+				labels.append(escapePrometheusLabelValue(groupName));
+				labels.append("\"");
+			}
+
+			for (unsigned int j = 0; j < nbounds; j++) {
+				stream << metricName << "_bucket{" << labels << ",le=\""
+					<< (bounds[j] / 1000000.0) << "\"} "
+					<< histogram.countAtOrBelow(bounds[j]) << "\n";
+			}
+			stream << metricName << "_bucket{" << labels << ",le=\"+Inf\"} "
+				<< histogram.getCount() << "\n";
+			stream << metricName << "_sum{" << labels << "} "
+				<< (histogram.getSum() / 1000000.0) << "\n";
+			stream << metricName << "_count{" << labels << "} "
+				<< histogram.getCount() << "\n";
+		}
+	}
+
+public:
+	/**
+	 * Records a latency (in microseconds) for the given phase, both in the
+	 * totals and in the histograms of the given application group.
+	 */
+	void record(Phase phase, const HashedStaticString &appGroupName,
+		boost::uint64_t usec)
+	{
+		total.histograms[phase].record(usec);
+		if (!appGroupName.empty()) {
+			lookupOrCreateGroup(appGroupName)->histograms[phase].record(usec);
+		}
+	}
+
+	HistogramSet *lookupOrCreateGroup(const HashedStaticString &appGroupName) {
+		HistogramSetPtr *result;
+		if (OXT_LIKELY(groups.lookup(appGroupName, &result))) {
+			return result->get();
+		} else {
+			HistogramSetPtr set = boost::make_shared<HistogramSet>();
+			groups.insert(appGroupName, set);
+			return set.get();
+		}
+	}
+
+	/**
+	 * Discards the histograms of the application groups that are not in
+	 * `existingGroups`, e.g. because they have been removed from the pool.
+	 */
+	void evictGroups(const set<string> &existingGroups) {
+		StringKeyTable<HistogramSetPtr>::ConstIterator it(groups);
+		StringKeyTable<HistogramSetPtr> retained;
+		bool evicted = false;
+
+		while (*it != NULL) {
+			if (existingGroups.find(it.getKey().toString()) != existingGroups.end()) {
+				retained.insert(it.getKey(), it.getValue());
+			} else {
+				evicted = true;
+			}
+			it.next();
+		}
+		if (evicted) {
+			// Rebuilding the table also frees the storage of the evicted keys,
+			// which erasing them would not.
+			groups = retained;
+		}
+	}
+
+	unsigned int getGroupCount() const {
+		return groups.size();
+	}
+
+	/** Discards everything recorded so far, e.g. after a warmup period. */
+	void reset() {
+		for (unsigned int i = 0; i < PHASE_COUNT; i++) {
+			total.histograms[i].reset();
+		}
+		groups.clear();
+	}
+
+	Snapshot snapshot() const {
+		Snapshot result;
+		StringKeyTable<HistogramSetPtr>::ConstIterator it(groups);
+
+		result.total = total;
+		while (*it != NULL) {
+			result.groups[it.getKey().toString()] = *it.getValue();
+			it.next();
+		}
+		return result;
+	}
+};
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_LATENCY_STATS_H_ */
@@ -0,0 +1,170 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_METRICS_H_
+#define _PASSENGER_CORE_CONTROLLER_METRICS_H_
+
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <ostream>
+#include <StaticString.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * A copy of the counters and gauges of a single Controller, taken on its
+ * event loop thread, so that the API server can report them in the
+ * Prometheus text exposition format without building a JSON document.
+ */
+struct ControllerMetrics {
+	unsigned int threadNumber;
+
+	unsigned int activeClientCount;
+	unsigned int disconnectedClientCount;
+	unsigned int freeClientCount;
+	boost::uint64_t totalClientsAccepted;
+	boost::uint64_t totalBytesConsumed;
+	boost::uint64_t totalRequestsBegun;
+
+	bool turboCachingEnabled;
+	unsigned int turboCacheFetches;
+	unsigned int turboCacheHits;
+	unsigned int turboCacheStores;
+	unsigned int turboCacheStoreSuccesses;
+
+	unsigned int mbufFreeBlocks;
+	unsigned int mbufActiveBlocks;
+	unsigned int mbufChunkSize;
+
+	ControllerMetrics()
+		: threadNumber(0),
+		  activeClientCount(0),
+		  disconnectedClientCount(0),
+		  freeClientCount(0),
+		  totalClientsAccepted(0),
+		  totalBytesConsumed(0),
+		  totalRequestsBegun(0),
+		  turboCachingEnabled(false),
+		  turboCacheFetches(0),
+		  turboCacheHits(0),
+		  turboCacheStores(0),
+		  turboCacheStoreSuccesses(0),
+		  mbufFreeBlocks(0),
+		  mbufActiveBlocks(0),
+		  mbufChunkSize(0)
+		{ }
+};
+
+/**
+ * Writes one metric family with one sample per Controller, labeled by
+ * thread number.
+ */
+template<typename T>
+inline void
+writeControllerMetricFamily(ostream &stream, const vector<ControllerMetrics> &metrics,
+	const StaticString &name, const StaticString &type, const StaticString &help,
+	T ControllerMetrics::*field)
+{
+	stream << "# HELP " << name << " " << help << "\n";
+	stream << "# TYPE " << name << " " << type << "\n";
+	for (unsigned int i = 0; i < metrics.size(); i++) {
+		stream << name << "{thread=\"" << metrics[i].threadNumber << "\"} "
+			<< metrics[i].*field << "\n";
+	}
+}
+
+inline void
+writeControllerMetrics(ostream &stream, const vector<ControllerMetrics> &metrics) {
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_server_active_clients"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of connected clients."),
+		&ControllerMetrics::activeClientCount);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_server_disconnected_clients"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of disconnected clients that are not yet released."),
+		&ControllerMetrics::disconnectedClientCount);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_server_free_clients"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of preallocated client objects."),
+		&ControllerMetrics::freeClientCount);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_server_clients_accepted_total"), P_STATIC_STRING("counter"),
+		P_STATIC_STRING("Number of client connections accepted."),
+		&ControllerMetrics::totalClientsAccepted);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_server_received_bytes_total"), P_STATIC_STRING("counter"),
+		P_STATIC_STRING("Number of bytes received from clients."),
+		&ControllerMetrics::totalBytesConsumed);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_server_requests_total"), P_STATIC_STRING("counter"),
+		P_STATIC_STRING("Number of requests begun."),
+		&ControllerMetrics::totalRequestsBegun);
+
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_turbocache_enabled"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Whether the turbocache is enabled (1) or not (0)."),
+		&ControllerMetrics::turboCachingEnabled);
+	// The response cache resets these counters at the start of every
+	// turbocaching interval, so they are gauges rather than counters.
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_turbocache_fetches"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of turbocache lookups in the current interval."),
+		&ControllerMetrics::turboCacheFetches);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_turbocache_hits"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of turbocache hits in the current interval."),
+		&ControllerMetrics::turboCacheHits);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_turbocache_stores"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of turbocache store attempts in the current interval."),
+		&ControllerMetrics::turboCacheStores);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_turbocache_store_successes"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of successful turbocache stores in the current interval."),
+		&ControllerMetrics::turboCacheStoreSuccesses);
+
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_mbuf_free_blocks"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of free blocks in the mbuf pool."),
+		&ControllerMetrics::mbufFreeBlocks);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_mbuf_active_blocks"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Number of blocks in use in the mbuf pool."),
+		&ControllerMetrics::mbufActiveBlocks);
+	writeControllerMetricFamily(stream, metrics,
+		P_STATIC_STRING("passenger_mbuf_block_size_bytes"), P_STATIC_STRING("gauge"),
+		P_STATIC_STRING("Size of an mbuf pool block."),
+		&ControllerMetrics::mbufChunkSize);
+}
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_METRICS_H_ */
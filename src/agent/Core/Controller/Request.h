@@ -65,6 +65,15 @@ public:
 	};
 
 	ev_tstamp startedAt;
+	// Timestamps for LatencyStats; 0 if the corresponding event hasn't happened.
+	// These read the monotonic clock instead of using ev_now(), because
+	// several phases usually complete within a single event loop iteration.
+	MonotonicTimeUsec headerReceiveStartedAt;
+	MonotonicTimeUsec headersParsedAt;
+	MonotonicTimeUsec checkoutStartedAt;
+	MonotonicTimeUsec sessionCheckedOutAt;
+	MonotonicTimeUsec appRequestHeaderSentAt;
+	MonotonicTimeUsec appResponseBegunAt;
 
 	State state: 3;
 	bool dechunkResponse: 1;
@@ -78,8 +87,30 @@ public:
 	bool appResponseInitialized: 1;
 	bool strip100ContinueHeader: 1;
 	bool hasPragmaHeader: 1;
-
-	Options options;
+	// Whether this upgraded request has been switched to a lightweight
+	// tunnel. See Controller/Tunnel.cpp.
+	bool tunneled: 1;
+	// Whether the buffered request body was passed to the app as a file
+	// descriptor instead of being forwarded over the session.
+	bool bodyPassedAsFd: 1;
+
+	// The pool options for this request. Normally points to an entry in
+	// Controller::poolOptionsCache, which is shared by all requests for the
+	// same app group and never modified. Only when a request overrides a
+	// per-request field, it gets a private copy (`privateOptions`) that is
+	// allocated from the request's palloc pool. See
+	// Controller::getWritablePoolOptions().
+	//
+	// NULL until initializePoolOptions() is called, e.g. for requests
+	// that are served by the turbocache.
+	const Options *options;
+	Options *privateOptions;
+	// The time (usec) at which the current session checkout started. Passed to
+	// the pool along with `options`, which may be shared with other requests.
+	unsigned long long checkoutTime;
+	// The sticky session ID from the request's cookie, or 0. Like
+	// `checkoutTime`, passed to the pool separately from `options`.
+	unsigned int stickySessionId;
 	AbstractSessionPtr session;
 	const LString *host;
 	ControllerRequestConfigPtr config;
@@ -95,9 +126,9 @@ public:
 	LString *cacheControl;
 	LString *varyCookie;
 	// Value of the `!~PASSENGER_ENV_VARS` header. This is different
-	// from `options.environmentVariables`. If `!~PASSENGER_ENV_VARS`
+	// from `options->environmentVariables`. If `!~PASSENGER_ENV_VARS`
 	// is not set or is empty, then `envvars` is NULL, while
-	// `options.environmentVariables` retains a previous value.
+	// `options->environmentVariables` retains a previous value.
 	//
 	// This value is guaranteed to be contiguous.
 	LString *envvars;
@@ -60,17 +60,33 @@ struct Controller::SessionProtocolWorkingState {
 	const LString *remoteUser;
 	const LString *contentType;
 	const LString *contentLength;
-	char *environmentVariablesData;
-	size_t environmentVariablesSize;
+	const SessionHeaderPrefix *prefix;
+	// The request body buffer file to pass to the app, or -1.
+	int bodyFd;
+	boost::uint64_t bodyFdSize;
 	bool hasBaseURI;
 
 	SessionProtocolWorkingState()
-		: environmentVariablesData(NULL)
+		: prefix(NULL),
+		  bodyFd(-1),
+		  bodyFdSize(0)
 		{ }
+};
 
-	~SessionProtocolWorkingState() {
-		free(environmentVariablesData);
-	}
+/**
+ * The fields of the session protocol header that only depend on the app group
+ * and the server configuration, serialized once instead of for every request.
+ * An entry is rebuilt when any of the values that it was serialized from
+ * differs from those of the current request.
+ */
+struct Controller::SessionHeaderPrefix {
+	string serverSoftware;
+	string apiKey;
+	// The base64-encoded PASSENGER_ENV_VARS secure header.
+	string envvars;
+	// SERVER_SOFTWARE, SERVER_PROTOCOL, PASSENGER_CONNECT_PASSWORD and
+	// the decoded environment variables.
+	string data;
 };
 
 struct Controller::HttpHeaderConstructionCache {
@@ -152,10 +168,17 @@ Controller::sendHeaderToApp(Client *client, Request *req) {
 }
 
 void
-Controller::sendHeaderToAppWithSessionProtocol(Client *client, Request *req) {
+Controller::sendHeaderToAppWithSessionProtocol(Client *client, Request *req,
+	bool passBodyFd)
+{
 	TRACE_POINT();
 	SessionProtocolWorkingState state;
 
+	if (passBodyFd && mayPassBufferedBodyFdToApp(req)) {
+		state.bodyFd = req->bodyBuffer.getCompleteBufferFileFd();
+		state.bodyFdSize = req->bodyBuffer.getBytesBufferedOnDisk();
+	}
+
 	// Workaround for Ruby < 2.1 support.
 	std::string deltaMonotonic;
 	unsigned long long now = SystemTime::getUsec();
@@ -171,6 +194,7 @@ Controller::sendHeaderToAppWithSessionProtocol(Client *client, Request *req) {
 		state, deltaMonotonic);
 	MemoryKit::mbuf_pool &mbuf_pool = getContext()->mbuf_pool;
 	const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
+	MemoryKit::mbuf header;
 	bool ok;
 
 	if (bufferSize <= MBUF_MAX_SIZE) {
@@ -180,23 +204,58 @@ Controller::sendHeaderToAppWithSessionProtocol(Client *client, Request *req) {
 		ok = constructHeaderForSessionProtocol(req, buffer.start,
 			bufferSize, state, deltaMonotonic);
 		assert(ok);
-		buffer = MemoryKit::mbuf(buffer, 0, bufferSize);
-		SKC_TRACE(client, 3, "Header data: \"" << cEscapeString(
-			StaticString(buffer.start, bufferSize)) << "\"");
-		req->appSink.feedWithoutRefGuard(boost::move(buffer));
+		header = MemoryKit::mbuf(buffer, 0, bufferSize);
 	} else {
 		char *buffer = (char *) psg_pnalloc(req->pool, bufferSize);
 
 		ok = constructHeaderForSessionProtocol(req, buffer,
 			bufferSize, state, deltaMonotonic);
 		assert(ok);
-		SKC_TRACE(client, 3, "Header data: \"" << cEscapeString(
-			StaticString(buffer, bufferSize)) << "\"");
-		req->appSink.feedWithoutRefGuard(MemoryKit::mbuf(
-			buffer, bufferSize));
+		header = MemoryKit::mbuf(buffer, bufferSize);
 	}
 
 	(void) ok; // Shut up compiler warning
+	SKC_TRACE(client, 3, "Header data: \"" << cEscapeString(
+		StaticString(header.start, header.size())) << "\"");
+
+	if (state.bodyFd != -1) {
+		if (!sendHeaderWithBodyFdToApp(client, req, header, state.bodyFd)) {
+			// Nothing was sent, so start over with a header
+			// that doesn't announce a file descriptor.
+			sendHeaderToAppWithSessionProtocol(client, req, false);
+		}
+	} else {
+		req->appSink.feedWithoutRefGuard(boost::move(header));
+	}
+}
+
+/**
+ * Writes the session protocol header directly to the app socket, passing the
+ * request body buffer file along with it. Whatever part of the header could not
+ * be written immediately is fed to the appSink. Returns false if nothing could
+ * be written, in which case the caller must fall back to forwarding the body.
+ */
+bool
+Controller::sendHeaderWithBodyFdToApp(Client *client, Request *req,
+	const MemoryKit::mbuf &header, int bodyFd)
+{
+	ssize_t ret = sendWithFileDescriptor(req->session->fd(), header.start,
+		header.size(), bodyFd);
+	if (ret == -1) {
+		int e = errno;
+		SKC_DEBUG(client, "Cannot pass request body file descriptor to application: "
+			<< strerror(e) << " (errno=" << e << "); forwarding body instead");
+		return false;
+	}
+
+	SKC_TRACE(client, 2, "Passed request body to application as file descriptor ("
+		<< req->bodyBuffer.getBytesBufferedOnDisk() << " bytes)");
+	req->bodyPassedAsFd = true;
+	if ((size_t) ret < header.size()) {
+		req->appSink.feedWithoutRefGuard(MemoryKit::mbuf(header, ret,
+			header.size() - ret));
+	}
+	return true;
 }
 
 void
@@ -229,6 +288,61 @@ Controller::sendBodyToAppWhenAppSinkIdle(Channel *_channel, unsigned int size) {
 	}
 }
 
+const Controller::SessionHeaderPrefix &
+Controller::getSessionHeaderPrefix(Request *req) {
+	HashedStaticString appGroupName(req->options->getAppGroupName());
+	StaticString serverSoftware = req->config->serverSoftware;
+	StaticString apiKey = req->session->getApiKey().toStaticString();
+	StaticString envvars;
+	boost::shared_ptr<SessionHeaderPrefix> *entry;
+
+	if (req->envvars != NULL && req->envvars->size > 0) {
+		// Made contiguous by initializePoolOptions().
+		envvars = StaticString(req->envvars->start->data, req->envvars->size);
+	}
+
+	if (sessionHeaderPrefixCache.lookup(appGroupName, &entry)
+	 && StaticString((*entry)->serverSoftware) == serverSoftware
+	 && StaticString((*entry)->apiKey) == apiKey
+	 && StaticString((*entry)->envvars) == envvars)
+	{
+		return **entry;
+	}
+
+	boost::shared_ptr<SessionHeaderPrefix> prefix =
+		boost::make_shared<SessionHeaderPrefix>();
+	prefix->serverSoftware = serverSoftware;
+	prefix->apiKey = apiKey;
+	prefix->envvars = envvars;
+
+	string &data = prefix->data;
+	data.reserve(sizeof("SERVER_SOFTWARE") + serverSoftware.size() + 1
+		+ sizeof("SERVER_PROTOCOL") + sizeof("HTTP/1.1")
+		+ sizeof("PASSENGER_CONNECT_PASSWORD") + apiKey.size() + 1
+		+ modp_b64_decode_len(envvars.size()));
+	data.append(P_STATIC_STRING_WITH_NULL("SERVER_SOFTWARE"));
+	data.append(serverSoftware.data(), serverSoftware.size());
+	data.append(1, '\0');
+	data.append(P_STATIC_STRING_WITH_NULL("SERVER_PROTOCOL"));
+	data.append(P_STATIC_STRING_WITH_NULL("HTTP/1.1"));
+	data.append(P_STATIC_STRING_WITH_NULL("PASSENGER_CONNECT_PASSWORD"));
+	data.append(apiKey.data(), apiKey.size());
+	data.append(1, '\0');
+
+	if (!envvars.empty()) {
+		size_t offset = data.size();
+		data.resize(offset + modp_b64_decode_len(envvars.size()));
+		size_t len = modp_b64_decode(&data[offset], envvars.data(), envvars.size());
+		if (len == (size_t) -1) {
+			throw RuntimeException("Unable to base64 decode environment variables");
+		}
+		data.resize(offset + len);
+	}
+
+	sessionHeaderPrefixCache.insert(appGroupName, prefix);
+	return *prefix;
+}
+
 static bool
 isAlphaNum(char ch) {
 	return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
@@ -323,10 +437,10 @@ Controller::determineMaxHeaderSizeForSessionProtocol(Request *req,
 	unsigned int dataSize = sizeof(boost::uint32_t);
 
 	state.path        = req->getPathWithoutQueryString();
-	state.hasBaseURI  = req->options.baseURI != P_STATIC_STRING("/")
-		&& startsWith(state.path, req->options.baseURI);
+	state.hasBaseURI  = req->options->baseURI != P_STATIC_STRING("/")
+		&& startsWith(state.path, req->options->baseURI);
 	if (state.hasBaseURI) {
-		state.path = state.path.substr(req->options.baseURI.size());
+		state.path = state.path.substr(req->options->baseURI.size());
 		if (state.path.empty()) {
 			state.path = P_STATIC_STRING("/");
 		}
@@ -342,21 +456,7 @@ Controller::determineMaxHeaderSizeForSessionProtocol(Request *req,
 	} else {
 		state.contentLength = NULL;
 	}
-	if (req->envvars != NULL) {
-		size_t len = modp_b64_decode_len(req->envvars->size);
-		state.environmentVariablesData = (char *) malloc(len);
-		if (state.environmentVariablesData == NULL) {
-			throw RuntimeException("Unable to allocate memory for base64 "
-				"decoding of environment variables");
-		}
-		len = modp_b64_decode(state.environmentVariablesData,
-			req->envvars->start->data,
-			req->envvars->size);
-		if (len == (size_t) -1) {
-			throw RuntimeException("Unable to base64 decode environment variables");
-		}
-		state.environmentVariablesSize = len;
-	}
+	state.prefix = &getSessionHeaderPrefix(req);
 
 	dataSize += sizeof("REQUEST_URI");
 	dataSize += req->path.size + 1;
@@ -366,7 +466,7 @@ Controller::determineMaxHeaderSizeForSessionProtocol(Request *req,
 
 	dataSize += sizeof("SCRIPT_NAME");
 	if (state.hasBaseURI) {
-		dataSize += req->options.baseURI.size();
+		dataSize += req->options->baseURI.size();
 	} else {
 		dataSize += sizeof("");
 	}
@@ -403,12 +503,6 @@ Controller::determineMaxHeaderSizeForSessionProtocol(Request *req,
 	dataSize += sizeof("SERVER_PORT");
 	dataSize += state.serverPort.size() + 1;
 
-	dataSize += sizeof("SERVER_SOFTWARE");
-	dataSize += req->config->serverSoftware.size() + 1;
-
-	dataSize += sizeof("SERVER_PROTOCOL");
-	dataSize += sizeof("HTTP/1.1");
-
 	dataSize += sizeof("REMOTE_ADDR");
 	if (state.remoteAddr != NULL) {
 		dataSize += state.remoteAddr->size + 1;
@@ -438,8 +532,10 @@ Controller::determineMaxHeaderSizeForSessionProtocol(Request *req,
 		dataSize += state.contentLength->size + 1;
 	}
 
-	dataSize += sizeof("PASSENGER_CONNECT_PASSWORD");
-	dataSize += ApplicationPool2::ApiKey::SIZE + 1;
+	if (state.bodyFd != -1) {
+		dataSize += sizeof("PASSENGER_BODY_FD_SIZE");
+		dataSize += sizeof("18446744073709551615");
+	}
 
 	if (req->https) {
 		dataSize += sizeof("HTTPS");
@@ -458,9 +554,7 @@ Controller::determineMaxHeaderSizeForSessionProtocol(Request *req,
 		it.next();
 	}
 
-	if (state.environmentVariablesData != NULL) {
-		dataSize += state.environmentVariablesSize;
-	}
+	dataSize += state.prefix->data.size();
 
 	return dataSize + 1;
 }
@@ -484,7 +578,7 @@ Controller::constructHeaderForSessionProtocol(Request *req, char * restrict buff
 
 	pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("SCRIPT_NAME"));
 	if (state.hasBaseURI) {
-		pos = appendData(pos, end, req->options.baseURI);
+		pos = appendData(pos, end, req->options->baseURI);
 		pos = appendData(pos, end, "", 1);
 	} else {
 		pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL(""));
@@ -506,13 +600,6 @@ Controller::constructHeaderForSessionProtocol(Request *req, char * restrict buff
 	pos = appendData(pos, end, state.serverPort);
 	pos = appendData(pos, end, "", 1);
 
-	pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("SERVER_SOFTWARE"));
-	pos = appendData(pos, end, req->config->serverSoftware);
-	pos = appendData(pos, end, "", 1);
-
-	pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("SERVER_PROTOCOL"));
-	pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("HTTP/1.1"));
-
 	pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("REMOTE_ADDR"));
 	if (state.remoteAddr != NULL) {
 		pos = appendData(pos, end, state.remoteAddr);
@@ -547,9 +634,16 @@ Controller::constructHeaderForSessionProtocol(Request *req, char * restrict buff
 		pos = appendData(pos, end, "", 1);
 	}
 
-	pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("PASSENGER_CONNECT_PASSWORD"));
-	pos = appendData(pos, end, req->session->getApiKey().toStaticString());
-	pos = appendData(pos, end, "", 1);
+	if (state.bodyFd != -1) {
+		// The request body is passed as a file descriptor along with
+		// the first byte of this header, and not sent over the socket.
+		char bodyFdSize[sizeof("18446744073709551615")];
+		unsigned int bodyFdSizeLen = integerToOtherBase<boost::uint64_t, 10>(
+			state.bodyFdSize, bodyFdSize, sizeof(bodyFdSize));
+		pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("PASSENGER_BODY_FD_SIZE"));
+		pos = appendData(pos, end, bodyFdSize, bodyFdSizeLen);
+		pos = appendData(pos, end, "", 1);
+	}
 
 	if (req->https) {
 		pos = appendData(pos, end, P_STATIC_STRING_WITH_NULL("HTTPS"));
@@ -600,9 +694,9 @@ Controller::constructHeaderForSessionProtocol(Request *req, char * restrict buff
 		it.next();
 	}
 
-	if (state.environmentVariablesData != NULL) {
-		pos = appendData(pos, end, state.environmentVariablesData, state.environmentVariablesSize);
-	}
+	// The environment variables in the prefix come last so that they
+	// take precedence over any of the fields above.
+	pos = appendData(pos, end, state.prefix->data);
 
 	Uint32Message::generate(buffer, pos - buffer - sizeof(boost::uint32_t));
 
@@ -645,7 +739,7 @@ Controller::sendHeaderToAppWithHttpProtocol(Client *client, Request *req) {
 		} else {
 			int e = errno;
 			P_ASSERT_EQ(bytesWritten, -1);
-			disconnectWithAppSocketWriteError(&client, e);
+			disconnectWithAppSocketWriteError(&client, &req, e);
 		}
 	}
 }
@@ -918,6 +1012,7 @@ void
 Controller::sendBodyToApp(Client *client, Request *req) {
 	TRACE_POINT();
 	assert(req->appSink.acceptingInput());
+	req->appRequestHeaderSentAt = SystemTime::getMonotonicUsec();
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		req->timeOnRequestHeaderSent = ev_now(getLoop());
 		reportLargeTimeDiff(client,
@@ -925,7 +1020,13 @@ Controller::sendBodyToApp(Client *client, Request *req) {
 			req->timeBeforeAccessingApplicationPool,
 			req->timeOnRequestHeaderSent);
 	#endif
-	if (req->hasBody() || req->upgraded()) {
+	if (req->bodyPassedAsFd) {
+		// The app reads the body from the file descriptor that
+		// we passed along with the header.
+		SKC_TRACE(client, 2, "Request body already passed to application");
+		req->state = Request::WAITING_FOR_APP_OUTPUT;
+		maybeHalfCloseAppSinkBecauseRequestBodyEndReached(client, req);
+	} else if (req->hasBody() || req->upgraded()) {
 		// onRequestBody() will take care of forwarding
 		// the request body to the app.
 		SKC_TRACE(client, 2, "Sending body to application");
@@ -974,6 +1075,9 @@ Controller::whenSendingRequest_onRequestBody(Client *client, Request *req,
 				"\"");
 		}
 		req->appSink.feed(buffer);
+		if (req->bodyType == Request::RBT_UPGRADE && !req->tunneled) {
+			maybeSwitchToTunnel(client, req);
+		}
 		if (!req->appSink.acceptingInput()) {
 			if (req->appSink.mayAcceptInputLater()) {
 				SKC_TRACE(client, 3, "Waiting for appSink channel to become "
@@ -1010,7 +1114,7 @@ Controller::whenSendingRequest_onRequestBody(Client *client, Request *req,
 		int size = snprintf(message, BUFSIZE,
 			"error reading request body: %s (errno=%d)",
 			ServerKit::getErrorDesc(errcode), errcode);
-		disconnectWithError(&client, StaticString(message, size));
+		endRequestWithError(&client, &req, StaticString(message, size));
 		return Channel::Result(0, true);
 	}
 }
@@ -64,9 +64,79 @@ Controller::inspectStateAsJson() const {
 		subdoc["store_success_ratio"] = turboCaching.responseCache.getStoreSuccessRatio();
 		doc["turbocaching"] = subdoc;
 	}
+	if (cstat.getSharedCache() != NULL) {
+		SharedFileStatCache::Stats stats = cstat.getSharedCache()->getStats();
+		Json::Value subdoc;
+		subdoc["hits"] = (Json::UInt64) stats.hits;
+		subdoc["misses"] = (Json::UInt64) stats.misses;
+		subdoc["refreshes"] = (Json::UInt64) stats.refreshes;
+		subdoc["background_refreshes"] = (Json::UInt64) stats.backgroundRefreshes;
+		subdoc["contended"] = (Json::UInt64) stats.contended;
+		subdoc["takeovers"] = (Json::UInt64) stats.takeovers;
+		subdoc["torn"] = (Json::UInt64) stats.torn;
+		subdoc["refresher_pid"] = (Json::Int) stats.refresherPid;
+		doc["shared_stat_cache"] = subdoc;
+	}
 	return doc;
 }
 
+/**
+ * Returns a copy of this Controller's latency histograms. The histograms
+ * of application groups that no longer exist in the pool are discarded
+ * first. Must be called from the event loop thread.
+ */
+LatencyStats::Snapshot
+Controller::getLatencyStatsSnapshot() {
+	ApplicationPool2::Pool::StateSnapshotPtr poolState = appPool->getStateSnapshot();
+	set<string> groupNames;
+
+	foreach (const ApplicationPool2::Group::Snapshot &group, poolState->groups) {
+		groupNames.insert(group.name);
+	}
+	latencyStats.evictGroups(groupNames);
+	return latencyStats.snapshot();
+}
+
+/**
+ * Discards this Controller's latency histograms. Must be called from the
+ * event loop thread.
+ */
+void
+Controller::resetLatencyStats() {
+	latencyStats.reset();
+}
+
+/**
+ * Returns a copy of this Controller's counters and gauges. Must be called
+ * from the event loop thread.
+ */
+ControllerMetrics
+Controller::collectMetrics() const {
+	ControllerMetrics metrics;
+	const struct MemoryKit::mbuf_pool &mbufPool = getContext()->mbuf_pool;
+
+	metrics.threadNumber = getThreadNumber();
+	metrics.activeClientCount = activeClientCount;
+	metrics.disconnectedClientCount = disconnectedClientCount;
+	metrics.freeClientCount = freeClientCount;
+	metrics.totalClientsAccepted = totalClientsAccepted;
+	metrics.totalBytesConsumed = totalBytesConsumed;
+	metrics.totalRequestsBegun = totalRequestsBegun;
+
+	metrics.turboCachingEnabled = turboCaching.isEnabled();
+	if (metrics.turboCachingEnabled) {
+		metrics.turboCacheFetches = turboCaching.responseCache.getFetches();
+		metrics.turboCacheHits = turboCaching.responseCache.getHits();
+		metrics.turboCacheStores = turboCaching.responseCache.getStores();
+		metrics.turboCacheStoreSuccesses = turboCaching.responseCache.getStoreSuccesses();
+	}
+
+	metrics.mbufFreeBlocks = mbufPool.nfree_mbuf_blockq;
+	metrics.mbufActiveBlocks = mbufPool.nactive_mbuf_blockq;
+	metrics.mbufChunkSize = mbufPool.mbuf_block_chunk_size;
+	return metrics;
+}
+
 Json::Value
 Controller::inspectClientStateAsJson(const Client *client) const {
 	Json::Value doc = ParentClass::inspectClientStateAsJson(client);
@@ -85,7 +155,7 @@ Controller::inspectRequestStateAsJson(const Request *req) const {
 	}
 	doc["state"] = req->getStateString();
 	if (req->stickySession) {
-		doc["sticky_session_id"] = req->options.stickySessionId;
+		doc["sticky_session_id"] = req->stickySessionId;
 	}
 	doc["sticky_session"] = req->stickySession;
 	doc["session_checkout_try"] = req->sessionCheckoutTry;
@@ -93,8 +163,15 @@ Controller::inspectRequestStateAsJson(const Request *req) const {
 	flags["dechunk_response"] = req->dechunkResponse;
 	flags["request_body_buffering"] = req->requestBodyBuffering;
 	flags["https"] = req->https;
+	flags["tunneled"] = req->tunneled;
+	flags["body_passed_as_fd"] = req->bodyPassedAsFd;
 	doc["flags"] = flags;
 
+	if (req->tunneled && req->host != NULL) {
+		// The header table has been released; see Controller/Tunnel.cpp.
+		doc["host"] = string(req->host->start->data, req->host->size);
+	}
+
 	if (req->requestBodyBuffering) {
 		doc["body_bytes_buffered"] = byteSizeToJson(req->bodyBytesBuffered);
 	}
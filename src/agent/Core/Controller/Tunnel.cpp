@@ -0,0 +1,177 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/Controller.h>
+
+/*************************************************************************
+ *
+ * Implements Core::Controller methods pertaining switching upgraded
+ * (e.g. WebSocket) connections to a lightweight tunnel.
+ *
+ * After the application's upgrade response has been forwarded, the
+ * connection is nothing more than a pair of byte streams. But a Request
+ * holds on to a lot of state that was only needed to parse and forward the
+ * HTTP exchange: the request and response header tables (including their
+ * cell arrays) and the mbuf blocks that their data lives in, a palloc pool
+ * of PSG_DEFAULT_POOL_SIZE bytes, and the partially filled read buffers of
+ * the client and application sockets. Upgraded connections are typically
+ * long-lived and mostly idle, so switching to a tunnel releases all of that
+ * and only keeps what is needed to forward data and to inspect the
+ * connection, in a pool that is sized to fit exactly that. Upgraded
+ * requests never buffer their body, so `bodyBuffer` holds no memory.
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+using namespace boost;
+
+
+/****************************
+ *
+ * Private methods
+ *
+ ****************************/
+
+
+/**
+ * Switches the request to a tunnel if it has been upgraded and if
+ * none of the data that is still being written refers to the request's
+ * palloc pool. Called whenever upgraded connection data is forwarded,
+ * so that a request that couldn't be switched immediately after the
+ * upgrade response was sent will be switched later.
+ */
+void
+Controller::maybeSwitchToTunnel(Client *client, Request *req) {
+	if (req->tunneled || req->ended() || !req->appResponseInitialized
+	 || !req->appResponse.upgraded())
+	{
+		return;
+	}
+	if (client->output.getTotalBytesBuffered() > 0) {
+		// Parts of the response header may live in req->pool.
+		return;
+	}
+	if (!req->appSink.acceptingInput() && req->appSink.mayAcceptInputLater()) {
+		// Parts of the request header may live in req->pool.
+		return;
+	}
+	switchToTunnel(client, req);
+}
+
+void
+Controller::switchToTunnel(Client *client, Request *req) {
+	TRACE_POINT();
+	psg_pool_t *pool = psg_create_pool(getTunnelPoolSize(req));
+	LString path, *host = NULL;
+
+	if (OXT_UNLIKELY(pool == NULL)) {
+		return;
+	}
+
+	// Preserve what is needed for logging and state inspection.
+	copyLStringIntoPool(&path, &req->path, pool);
+	if (req->host != NULL && req->host->size > 0) {
+		host = (LString *) psg_palloc(pool, sizeof(LString));
+		copyLStringIntoPool(host, req->host, pool);
+	}
+	if (req->privateOptions != NULL) {
+		// The private options live in req->pool and may refer to header data.
+		UPDATE_TRACE_POINT();
+		void *mem = psg_palloc(pool, sizeof(Options));
+		Options *options = new (mem) Options(req->privateOptions->copyAndPersist());
+		destroyPrivatePoolOptions(req);
+		req->privateOptions = options;
+		req->options = options;
+	}
+
+	UPDATE_TRACE_POINT();
+	releaseAppResponseHeaders(client, req);
+	req->appResponse.headers.freeMemory();
+	req->appResponse.secureHeaders.freeMemory();
+	psg_lstr_deinit(&req->path);
+	releaseRequestHeaders(req);
+	req->headers.freeMemory();
+	req->secureHeaders.freeMemory();
+	psg_destroy_pool(req->pool);
+
+	req->pool = pool;
+	req->path = path;
+	req->host = host;
+	req->cacheKey = HashedStaticString();
+	req->cacheControl = NULL;
+	req->varyCookie = NULL;
+	req->envvars = NULL;
+
+	client->input.setKeepPartialBuffer(false);
+	req->appSource.setKeepPartialBuffer(false);
+	req->tunneled = true;
+	SKC_TRACE(client, 2, "Switched upgraded connection to tunnel mode");
+}
+
+/**
+ * Returns the size of a palloc pool that can hold everything that
+ * switchToTunnel() copies into it, so that the Options object doesn't
+ * end up in a separate large allocation.
+ */
+size_t
+Controller::getTunnelPoolSize(const Request *req) {
+	// Every allocation may be preceded by alignment padding.
+	size_t size = sizeof(psg_pool_t)
+		+ req->path.size + sizeof(LString::Part) + 2 * PSG_ALIGNMENT;
+	if (req->host != NULL && req->host->size > 0) {
+		size += sizeof(LString) + req->host->size + sizeof(LString::Part)
+			+ 3 * PSG_ALIGNMENT;
+	}
+	if (req->privateOptions != NULL) {
+		size += sizeof(Options) + PSG_ALIGNMENT;
+	}
+	return psg_align(size, PSG_ALIGNMENT);
+}
+
+void
+Controller::copyLStringIntoPool(LString *dest, const LString *src, psg_pool_t *pool) {
+	const LString::Part *part = src->start;
+	char *data, *pos;
+
+	psg_lstr_init(dest);
+	if (src->size == 0) {
+		return;
+	}
+
+	data = pos = (char *) psg_pnalloc(pool, src->size);
+	while (part != NULL) {
+		memcpy(pos, part->data, part->size);
+		pos += part->size;
+		part = part->next;
+	}
+	psg_lstr_append(dest, pool, data, src->size);
+}
+
+
+} // namespace Core
+} // namespace Passenger
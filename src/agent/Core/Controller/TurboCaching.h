@@ -280,14 +280,14 @@ public:
 			buildResponseHeader(prep, server, buffer.start, buffer.size());
 			memcpy(buffer.start + headerSize, entry.body->httpBodyData, entry.body->httpBodySize);
 
-			server->writeResponse(client, buffer);
+			server->writeResponse(client, req, buffer);
 		} else {
 			char *buffer = (char *) psg_pnalloc(req->pool, headerSize + entry.body->httpBodySize);
 			buildResponseHeader(prep, server, buffer,
 				headerSize + entry.body->httpBodySize);
 			memcpy(buffer + headerSize, entry.body->httpBodyData, entry.body->httpBodySize);
 
-			server->writeResponse(client, buffer, headerSize + entry.body->httpBodySize);
+			server->writeResponse(client, req, buffer, headerSize + entry.body->httpBodySize);
 		}
 	}
 };
@@ -86,6 +86,7 @@
 #include <FileDescriptor.h>
 #include <ResourceLocator.h>
 #include <BackgroundEventLoop.cpp>
+#include <EventLoopStallDetector.h>
 #include <FileTools/FileManip.h>
 #include <FileTools/PathSecurityCheck.h>
 #include <Exceptions.h>
@@ -117,11 +118,14 @@ namespace Core {
 		BackgroundEventLoop *bgloop;
 		ServerKit::Context *serverKitContext;
 		Controller *controller;
+		/** The CPU to pin this thread to, or -1. Set in NUMA-aware mode. */
+		int cpu;
 
 		ThreadWorkingObjects()
 			: bgloop(NULL),
 			  serverKitContext(NULL),
-			  controller(NULL)
+			  controller(NULL),
+			  cpu(-1)
 			{ }
 	};
 
@@ -165,11 +169,14 @@ namespace Core {
 		unsigned int terminationCount;
 		boost::atomic<unsigned int> shutdownCounter;
 		oxt::thread *prestarterThread;
+		boost::shared_ptr<SharedFileStatCache> statCache;
+		oxt::thread *statCacheRefresherThread;
 
 		SecurityUpdateChecker *securityUpdateChecker;
 		TelemetryCollector *telemetryCollector;
 		AdminPanelConnector *adminPanelConnector;
 		oxt::thread *adminPanelConnectorThread;
+		EventLoopStallDetector *eventLoopStallDetector;
 
 		WorkingObjects()
 			: exitEvent(__FILE__, __LINE__, "WorkingObjects: exitEvent"),
@@ -177,10 +184,12 @@ namespace Core {
 			  terminationCount(0),
 			  shutdownCounter(0),
 			  prestarterThread(NULL),
+			  statCacheRefresherThread(NULL),
 			  securityUpdateChecker(NULL),
 			  telemetryCollector(NULL),
 			  adminPanelConnector(NULL),
-			  adminPanelConnectorThread(NULL)
+			  adminPanelConnectorThread(NULL),
+			  eventLoopStallDetector(NULL)
 			  /*******************/
 		{
 			for (unsigned int i = 0; i < SERVER_KIT_MAX_SERVER_ENDPOINTS; i++) {
@@ -190,7 +199,9 @@ namespace Core {
 		}
 
 		~WorkingObjects() {
+			delete eventLoopStallDetector;
 			delete prestarterThread;
+			delete statCacheRefresherThread;
 			delete adminPanelConnectorThread;
 			delete adminPanelConnector;
 			delete securityUpdateChecker;
@@ -582,6 +593,13 @@ printInfoInThread() {
 	cerr << "nfree_mbuf_blockq    : " << stats.nfree_mbuf_blockq << "\n";
 	cerr << "nactive_mbuf_blockq  : " << stats.nactive_mbuf_blockq << "\n";
 	cerr << "mbuf_block_chunk_size: " << stats.mbuf_block_chunk_size << "\n";
+	for (i = 0; i < stats.nsize_classes; i++) {
+		cerr << "size class " << i << "         : chunk_size="
+			<< stats.size_classes[i].mbuf_block_chunk_size
+			<< ", nfree=" << stats.size_classes[i].nfree_mbuf_blockq
+			<< ", nactive=" << stats.size_classes[i].nactive_mbuf_blockq
+			<< ", nslabs=" << stats.size_classes[i].nslabs << "\n";
+	}
 	cerr << "\n";
 	cerr.flush();
 
@@ -686,6 +704,49 @@ initializeCurl() {
 	}
 }
 
+static void
+refreshStatCache(boost::shared_ptr<SharedFileStatCache> statCache) {
+	TRACE_POINT();
+	while (true) {
+		syscalls::sleep(1);
+		statCache->refresh(SharedFileStatCache::DEFAULT_REFRESH_MAX_IDLE_TIME);
+	}
+}
+
+/**
+ * Creates the stat cache that is shared with the web server, and becomes
+ * its refresher. Stat caching is an optimization, so failures are only
+ * logged.
+ */
+static void
+initializeStatCache(const string &instanceDir) {
+	TRACE_POINT();
+	WorkingObjects *wo = workingObjects;
+
+	if (instanceDir.empty()) {
+		return;
+	}
+
+	string path = SharedFileStatCache::getPathInInstanceDir(instanceDir);
+	try {
+		wo->statCache = boost::make_shared<SharedFileStatCache>(path,
+			(unsigned int) SharedFileStatCache::DEFAULT_SIZE);
+	} catch (const SystemException &e) {
+		P_WARN("Cannot create the shared stat cache " << path << ": " << e.what());
+		return;
+	} catch (const RuntimeException &e) {
+		P_WARN("Cannot use the shared stat cache " << path << ": " << e.what());
+		return;
+	}
+
+	if (wo->statCache->becomeRefresher()) {
+		boost::function<void ()> func = boost::bind(refreshStatCache, wo->statCache);
+		wo->statCacheRefresherThread = new oxt::thread(
+			boost::bind(runAndPrintExceptions, func, false),
+			"Stat cache refresher", 64 * 1024);
+	}
+}
+
 static void
 initializeNonPrivilegedWorkingObjects() {
 	TRACE_POINT();
@@ -721,17 +782,29 @@ initializeNonPrivilegedWorkingObjects() {
 	}
 	wo->spawningKitContext->finalize();
 
+	UPDATE_TRACE_POINT();
+	initializeStatCache(wo->spawningKitContext->instanceDir);
+
 	UPDATE_TRACE_POINT();
 	wo->appPoolContext = boost::make_shared<ApplicationPool2::Context>();
 	wo->appPoolContext->spawningKitFactory = boost::make_shared<SpawningKit::Factory>(
 		wo->spawningKitContext.get());
 	wo->appPoolContext->agentConfig = coreConfig->inspectEffectiveValues();
+	if (coreConfig->get("numa_aware_placement").asBool()) {
+		wo->appPoolContext->cpuTopology = boost::make_shared<CpuTopology>(
+			CpuTopology::detect());
+		P_INFO("NUMA-aware placement enabled. CPU topology: "
+			<< wo->appPoolContext->cpuTopology->inspect());
+	}
 	wo->appPoolContext->finalize();
 	wo->appPool = boost::make_shared<Pool>(wo->appPoolContext.get());
 	wo->appPool->initialize();
 	wo->appPool->setMax(coreConfig->get("max_pool_size").asInt());
 	wo->appPool->setMaxIdleTime(coreConfig->get("pool_idle_time").asInt() * 1000000ULL);
 	wo->appPool->enableSelfChecking(coreConfig->get("pool_selfchecks").asBool());
+	wo->appPool->setAutoscalerConfig(createAutoscalerConfig(*coreConfig));
+	wo->appPool->setMemoryRecyclingConfig(createMemoryRecyclingConfig(*coreConfig));
+	wo->appPool->setCapacitySchedulerConfig(createCapacitySchedulerConfig(*coreConfig));
 	wo->appPool->abortLongRunningConnectionsCallback = abortLongRunningConnections;
 
 	UPDATE_TRACE_POINT();
@@ -774,6 +847,13 @@ initializeNonPrivilegedWorkingObjects() {
 		two.controller->resourceLocator = &wo->resourceLocator;
 		two.controller->wrapperRegistry = coreWrapperRegistry;
 		two.controller->appPool = wo->appPool;
+		two.controller->cstat.setSharedCache(wo->statCache);
+		if (wo->appPoolContext->cpuTopology != NULL) {
+			unsigned int node, cpu;
+			wo->appPoolContext->cpuTopology->getThreadPlacement(i, node, cpu);
+			two.controller->numaNode = node;
+			two.cpu = cpu;
+		}
 		two.controller->shutdownFinishCallback = controllerShutdownFinished;
 		two.controller->initialize();
 		wo->shutdownCounter.fetch_add(1, boost::memory_order_relaxed);
@@ -822,6 +902,23 @@ initializeNonPrivilegedWorkingObjects() {
 		wo->shutdownCounter.fetch_add(1, boost::memory_order_relaxed);
 	}
 
+	UPDATE_TRACE_POINT();
+	unsigned int stallThreshold = coreConfig->get("event_loop_stall_threshold").asUInt();
+	if (stallThreshold > 0) {
+		wo->eventLoopStallDetector = new EventLoopStallDetector(stallThreshold);
+		for (unsigned int i = 0; i < wo->threadWorkingObjects.size(); i++) {
+			wo->eventLoopStallDetector->addEventLoop(
+				"Main event loop: thread " + toString(i + 1),
+				wo->threadWorkingObjects[i].bgloop);
+		}
+		if (wo->apiWorkingObjects.apiServer != NULL) {
+			wo->eventLoopStallDetector->addEventLoop("API event loop",
+				wo->apiWorkingObjects.bgloop);
+			wo->apiWorkingObjects.apiServer->eventLoopStallDetector =
+				wo->eventLoopStallDetector;
+		}
+	}
+
 	UPDATE_TRACE_POINT();
 	/* We do not delete Unix domain socket files at shutdown because
 	 * that can cause a race condition if the user tries to start another
@@ -1102,11 +1199,46 @@ mainLoop() {
 			&& maxCpus <= CPU_SETSIZE;
 	#endif
 
+	#ifdef SUPPORTS_PER_THREAD_CPU_AFFINITY
+		// In NUMA-aware mode, the main thread temporarily binds itself to
+		// the target CPU of each event loop thread that it starts. The
+		// new thread inherits that affinity from birth, so the memory that
+		// it touches first (its stack, its malloc arena, mbuf blocks) is
+		// allocated on its own node.
+		bool numaAware = wo->appPoolContext->cpuTopology != NULL;
+		cpu_set_t originalCpus;
+		if (numaAware && pthread_getaffinity_np(pthread_self(),
+			sizeof(originalCpus), &originalCpus) != 0)
+		{
+			numaAware = false;
+		}
+	#endif
+
 	for (unsigned int i = 0; i < wo->threadWorkingObjects.size(); i++) {
 		ThreadWorkingObjects *two = &wo->threadWorkingObjects[i];
+		#ifdef SUPPORTS_PER_THREAD_CPU_AFFINITY
+			if (numaAware && two->cpu >= 0 && two->cpu < CPU_SETSIZE) {
+				cpu_set_t cpus;
+				int result;
+
+				CPU_ZERO(&cpus);
+				CPU_SET(two->cpu, &cpus);
+				P_DEBUG("Setting CPU affinity of core thread " << (i + 1)
+					<< " to CPU " << (two->cpu + 1) << " (NUMA node "
+					<< two->controller->numaNode << ")");
+				result = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+				if (result != 0) {
+					P_WARN("Cannot set CPU affinity on core thread " << (i + 1)
+						<< ": " << strerror(result) << " (errno=" << result << ")");
+				}
+			}
+		#endif
 		two->bgloop->start("Main event loop: thread " + toString(i + 1), 0);
 		#ifdef SUPPORTS_PER_THREAD_CPU_AFFINITY
-			if (cpuAffine) {
+			if (numaAware) {
+				pthread_setaffinity_np(pthread_self(), sizeof(originalCpus),
+					&originalCpus);
+			} else if (cpuAffine) {
 				cpu_set_t cpus;
 				int result;
 
@@ -1126,6 +1258,9 @@ mainLoop() {
 	if (wo->apiWorkingObjects.apiServer != NULL) {
 		wo->apiWorkingObjects.bgloop->start("API event loop", 0);
 	}
+	if (wo->eventLoopStallDetector != NULL) {
+		wo->eventLoopStallDetector->start();
+	}
 	if (wo->threadWorkingObjects.size() > 1) {
 		wo->loadBalancer.start();
 	}
@@ -1288,6 +1423,9 @@ cleanup() {
 
 	uninstallAbortHandlerCustomDiagnostics();
 
+	if (wo->eventLoopStallDetector != NULL) {
+		wo->eventLoopStallDetector->stop();
+	}
 	for (unsigned i = 0; i < wo->threadWorkingObjects.size(); i++) {
 		ThreadWorkingObjects *two = &wo->threadWorkingObjects[i];
 		two->bgloop->stop();
@@ -1311,6 +1449,12 @@ cleanup() {
 		delete wo->prestarterThread;
 		wo->prestarterThread = NULL;
 	}
+	if (wo->statCacheRefresherThread != NULL) {
+		wo->statCacheRefresherThread->interrupt_and_join();
+		delete wo->statCacheRefresherThread;
+		wo->statCacheRefresherThread = NULL;
+		wo->statCache->resignRefresher();
+	}
 	for (unsigned int i = 0; i < SERVER_KIT_MAX_SERVER_ENDPOINTS; i++) {
 		if (wo->serverFds[i] != -1) {
 			close(wo->serverFds[i]);
@@ -70,6 +70,8 @@ coreUsage() {
 	printf("                            are applicable\n");
 	printf("      --socket-backlog      Override size of the socket backlog.\n");
 	printf("                            Default: %d\n", DEFAULT_SOCKET_BACKLOG);
+	printf("      --http2               Accept HTTP/2 connections from clients with prior\n");
+	printf("                            knowledge (cleartext only)\n");
 	printf("\n");
 	printf("Daemon options (optional):\n");
 	printf("      --pid-file PATH       Store the core's PID in the given file. The file\n");
@@ -149,6 +151,32 @@ coreUsage() {
 	printf("      --pool-idle-time SECS\n");
 	printf("                            Maximum number of seconds an application process\n");
 	printf("                            may be idle. Default: %d\n", DEFAULT_POOL_IDLE_TIME);
+	printf("      --pool-autoscale      Spawn application processes ahead of predicted\n");
+	printf("                            demand, and shut them down gradually when demand\n");
+	printf("                            goes down\n");
+	printf("      --pool-autoscale-min-processes N\n");
+	printf("                            Minimum number of processes per application that\n");
+	printf("                            the autoscaler keeps, in addition to the\n");
+	printf("                            application's own minimum. Default: 0\n");
+	printf("      --pool-autoscale-max-processes N\n");
+	printf("                            Maximum number of processes per application that\n");
+	printf("                            the autoscaler spawns. Default: 0 (unlimited)\n");
+	printf("      --pool-memory-limit-metric NAME\n");
+	printf("                            What --memory-limit is compared against:\n");
+	printf("                            'private_dirty' or 'pss'. Default: private_dirty\n");
+	printf("      --pool-memory-limit-min-samples N\n");
+	printf("                            Number of consecutive memory samples (taken every\n");
+	printf("                            5 seconds) in which a process must exceed\n");
+	printf("                            --memory-limit before it is replaced. Default: 3\n");
+	printf("      --pool-max-concurrent-memory-recycles N\n");
+	printf("                            Maximum number of processes that may be replaced\n");
+	printf("                            because of --memory-limit at the same time.\n");
+	printf("                            Default: 1 (0 = unlimited)\n");
+	printf("      --pool-capacity-rebalance-hysteresis SECS\n");
+	printf("                            Minimum age of a process before it may be shut\n");
+	printf("                            down to give its capacity to an application that\n");
+	printf("                            is below its share of the pool. Default: 30\n");
+	printf("                            (0 = never take capacity from busy applications)\n");
 	printf("      --max-preloader-idle-time SECS\n");
 	printf("                            Maximum time that preloader processes may be\n");
 	printf("                            be idle. A value of 0 means that preloader\n");
@@ -159,7 +187,12 @@ coreUsage() {
 	printf("                            requests per process\n");
 	printf("      --min-instances N     Minimum number of application processes. Default: 1\n");
 	printf("      --memory-limit MB     Restart application processes that go over the\n");
-	printf("                            given memory limit (Enterprise only)\n");
+	printf("                            given memory limit. Default: 0 (unlimited)\n");
+	printf("      --capacity-weight N   Share of the pool that applications get relative\n");
+	printf("                            to each other when the pool is full. Default: 1\n");
+	printf("      --capacity-reservation N\n");
+	printf("                            Number of processes that applications keep when\n");
+	printf("                            the pool is full. Default: 0\n");
 	printf("\n");
 	printf("Request handling options (optional):\n");
 	printf("      --max-requests        Restart application processes that have handled\n");
@@ -169,7 +202,21 @@ coreUsage() {
 	printf("      --max-request-queue-size NUMBER\n");
 	printf("                            Specify request queue size. Default: %d\n",
 		DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+	printf("      --max-request-queue-time SECONDS\n");
+	printf("                            Abort requests that wait in the request queue for\n");
+	printf("                            longer than this. Default: 0 (unlimited)\n");
+	printf("      --request-priority high|normal|low\n");
+	printf("                            Priority class of requests in the request queue.\n");
+	printf("                            Default: normal\n");
+	printf("      --request-priority-rule PATH_PREFIX=high|normal|low\n");
+	printf("                            Put requests whose path begins with PATH_PREFIX\n");
+	printf("                            in the given priority class, unless the web\n");
+	printf("                            server sets one. May be specified multiple times\n");
 	printf("      --sticky-sessions     Enable sticky sessions\n");
+	printf("      --sticky-sessions-consistent-hashing\n");
+	printf("                            Route sticky sessions of processes that are gone\n");
+	printf("                            by consistent hashing, and let replacement\n");
+	printf("                            processes take over their sessions\n");
 	printf("      --sticky-sessions-cookie-name NAME\n");
 	printf("                            Cookie name to use for sticky sessions.\n");
 	printf("                            Default: " DEFAULT_STICKY_SESSIONS_COOKIE_NAME "\n");
@@ -209,8 +256,15 @@ coreUsage() {
 	printf("                            Default: number of CPU cores (%d)\n",
 		boost::thread::hardware_concurrency());
 	printf("      --cpu-affine          Enable per-thread CPU affinity (Linux only)\n");
+	printf("      --numa-aware          Spread core threads and application processes\n");
+	printf("                            over NUMA nodes, and route requests to processes\n");
+	printf("                            on the same node (Linux only)\n");
 	printf("      --core-file-descriptor-ulimit NUMBER\n");
 	printf("                            Set custom file descriptor ulimit for the core\n");
+	printf("      --event-loop-stall-threshold MSEC\n");
+	printf("                            Log a backtrace when an event loop thread is\n");
+	printf("                            blocked for at least this long. 0 disables.\n");
+	printf("                            Default: 100\n");
 	printf("      --admin-panel-url URL\n");
 	printf("                            Connect to an admin panel through this service\n");
 	printf("                            connector URL\n");
@@ -278,6 +332,9 @@ parseCoreOption(int argc, const char *argv[], int &i, Json::Value &updates) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--socket-backlog")) {
 		updates["controller_socket_backlog"] = argv[i + 1];
 		i += 2;
+	} else if (p.isFlag(argv[i], '\0', "--http2")) {
+		updates["controller_http2"] = true;
+		i++;
 	} else if (p.isFlag(argv[i], '\0', "--no-user-switching")) {
 		updates["user_switching"] = false;
 		i++;
@@ -305,6 +362,27 @@ parseCoreOption(int argc, const char *argv[], int &i, Json::Value &updates) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-idle-time")) {
 		updates["pool_idle_time"] = atoi(argv[i + 1]);
 		i += 2;
+	} else if (p.isFlag(argv[i], '\0', "--pool-autoscale")) {
+		updates["pool_autoscale"] = true;
+		i++;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-autoscale-min-processes")) {
+		updates["pool_autoscale_min_processes"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-autoscale-max-processes")) {
+		updates["pool_autoscale_max_processes"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-memory-limit-metric")) {
+		updates["pool_memory_limit_metric"] = argv[i + 1];
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-memory-limit-min-samples")) {
+		updates["pool_memory_limit_min_samples"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-max-concurrent-memory-recycles")) {
+		updates["pool_max_concurrent_memory_recycles"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--pool-capacity-rebalance-hysteresis")) {
+		updates["pool_capacity_rebalance_hysteresis"] = atoi(argv[i + 1]);
+		i += 2;
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--max-preloader-idle-time")) {
 		updates["default_max_preloader_idle_time"] = atoi(argv[i + 1]);
 		i += 2;
@@ -344,12 +422,33 @@ parseCoreOption(int argc, const char *argv[], int &i, Json::Value &updates) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--max-requests")) {
 		updates["default_max_requests"] = atoi(argv[i + 1]);
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--memory-limit")) {
+		updates["default_memory_limit"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--capacity-weight")) {
+		updates["default_capacity_weight"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--capacity-reservation")) {
+		updates["default_capacity_reservation"] = atoi(argv[i + 1]);
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--request-priority")) {
+		updates["default_request_priority"] = argv[i + 1];
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--request-priority-rule")) {
+		updates["request_priority_rules"].append(argv[i + 1]);
+		i += 2;
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--max-request-queue-size")) {
 		updates["default_max_request_queue_size"] = atoi(argv[i + 1]);
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--max-request-queue-time")) {
+		updates["default_max_request_queue_time"] = atoi(argv[i + 1]);
+		i += 2;
 	} else if (p.isFlag(argv[i], '\0', "--sticky-sessions")) {
 		updates["default_sticky_sessions"] = true;
 		i++;
+	} else if (p.isFlag(argv[i], '\0', "--sticky-sessions-consistent-hashing")) {
+		updates["default_sticky_sessions_consistent_hashing"] = true;
+		i++;
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--sticky-sessions-cookie-name")) {
 		updates["default_sticky_sessions_cookie_name"] = argv[i + 1];
 		i += 2;
@@ -410,9 +509,15 @@ parseCoreOption(int argc, const char *argv[], int &i, Json::Value &updates) {
 	} else if (p.isFlag(argv[i], '\0', "--cpu-affine")) {
 		updates["controller_cpu_affine"] = true;
 		i++;
+	} else if (p.isFlag(argv[i], '\0', "--numa-aware")) {
+		updates["numa_aware_placement"] = true;
+		i++;
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--core-file-descriptor-ulimit")) {
 		updates["file_descriptor_ulimit"] = atoi(argv[i + 1]);
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--event-loop-stall-threshold")) {
+		updates["event_loop_stall_threshold"] = atoi(argv[i + 1]);
+		i += 2;
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--admin-panel-url")) {
 		updates["admin_panel_url"] = argv[i + 1];
 		i += 2;
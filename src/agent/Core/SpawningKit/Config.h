@@ -353,6 +353,18 @@ public:
 	 */
 	unsigned int fileDescriptorUlimit;
 
+	/**
+	 * The CPUs that the app should be bound to, in the Linux cpulist
+	 * format (e.g. "0-3,8-11"). An empty value means that the CPU
+	 * affinity should not be changed.
+	 *
+	 * @hinted_parseable
+	 * @pass_during_handshake
+	 * @non_confidential
+	 * @only_pass_during_handshake_if !config.cpuAffinity.empty()
+	 */
+	StaticString cpuAffinity;
+
 	/**
 	 * The maximum amount of time, in milliseconds, that may be spent
 	 * on spawning the process or the preloader.
@@ -65,6 +65,7 @@ Passenger::SpawningKit::Config::internStrings() {
 	totalSize += logFile.size() + 1;
 	totalSize += apiKey.size() + 1;
 	totalSize += groupUuid.size() + 1;
+	totalSize += cpuAffinity.size() + 1;
 
 	/*
 	 * Allocate new storage
@@ -113,6 +114,8 @@ Passenger::SpawningKit::Config::internStrings() {
 	pos = appendData(pos, end, "\0", 1);
 	pos = appendData(pos, end, groupUuid);
 	pos = appendData(pos, end, "\0", 1);
+	pos = appendData(pos, end, cpuAffinity);
+	pos = appendData(pos, end, "\0", 1);
 
 	/*
 	 * Move over pointers to new storage
@@ -188,6 +191,10 @@ Passenger::SpawningKit::Config::internStrings() {
 	groupUuid = StaticString(pos, tmpSize);
 	pos += tmpSize + 1;
 
+	tmpSize = cpuAffinity.size();
+	cpuAffinity = StaticString(pos, tmpSize);
+	pos += tmpSize + 1;
+
 
 	/*
 	 * Commit current storage
@@ -267,6 +274,7 @@ Passenger::SpawningKit::Config::validate(vector<StaticString> &errors) const {
 	 * groupUuid
 	 * lveMinUid
 	 * fileDescriptorUlimit
+	 * cpuAffinity
 	 */
 
 	return ok;
@@ -313,6 +321,9 @@ Passenger::SpawningKit::Config::getConfidentialFieldsToPassToApp() const {
 	if (config.fileDescriptorUlimit > 0) {
 		doc["file_descriptor_ulimit"] = fileDescriptorUlimit;
 	}
+	if (!config.cpuAffinity.empty()) {
+		doc["cpu_affinity"] = cpuAffinity.toString();
+	}
 
 	/*
 	 * Excluded:
@@ -367,6 +378,9 @@ Passenger::SpawningKit::Config::getNonConfidentialFieldsToPassToApp() const {
 	if (config.fileDescriptorUlimit > 0) {
 		doc["file_descriptor_ulimit"] = fileDescriptorUlimit;
 	}
+	if (!config.cpuAffinity.empty()) {
+		doc["cpu_affinity"] = cpuAffinity.toString();
+	}
 
 	/*
 	 * Excluded:
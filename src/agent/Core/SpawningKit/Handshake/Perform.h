@@ -431,6 +431,9 @@ private:
 			if (socketDoc.isMember("accept_http_requests")) {
 				socket.acceptHttpRequests = socketDoc["accept_http_requests"].asBool();
 			}
+			if (socketDoc.isMember("accept_body_fd")) {
+				socket.acceptBodyFd = socketDoc["accept_body_fd"].asBool();
+			}
 			if (socketDoc.isMember("description")) {
 				socket.description = socketDoc["description"].asString();
 			}
@@ -482,6 +485,9 @@ private:
 			validateResultPropertiesFileSocketField(socketDoc,
 				"accept_http_requests", Json::booleanValue, it.index(),
 				false, false, errors);
+			validateResultPropertiesFileSocketField(socketDoc,
+				"accept_body_fd", Json::booleanValue, it.index(),
+				false, false, errors);
 			validateResultPropertiesFileSocketAddress(socketDoc,
 				it.index(), errors);
 		}
@@ -61,6 +61,7 @@ public:
 				add("description", STRING_TYPE, OPTIONAL);
 				add("concurrency", INT_TYPE, OPTIONAL, -1);
 				add("accept_http_requests", BOOL_TYPE, OPTIONAL, false);
+				add("accept_body_fd", BOOL_TYPE, OPTIONAL, false);
 
 				finalize();
 			}
@@ -76,10 +77,16 @@ public:
 		 */
 		int concurrency;
 		bool acceptHttpRequests;
+		/**
+		 * Whether the app accepts a buffered request body as a file
+		 * descriptor instead of as data on this socket.
+		 */
+		bool acceptBodyFd;
 
 		Socket()
 			: concurrency(-1),
-			  acceptHttpRequests(false)
+			  acceptHttpRequests(false),
+			  acceptBodyFd(false)
 			{ }
 
 		Socket(const Schema &schema, const Json::Value &values) {
@@ -98,6 +105,7 @@ public:
 			}
 			concurrency = store["concurrency"].asInt();
 			acceptHttpRequests = store["accept_http_requests"].asBool();
+			acceptBodyFd = store["accept_body_fd"].asBool();
 		}
 
 		Json::Value inspectAsJson() const {
@@ -109,6 +117,9 @@ public:
 			}
 			doc["concurrency"] = concurrency;
 			doc["accept_http_requests"] = acceptHttpRequests;
+			if (acceptBodyFd) {
+				doc["accept_body_fd"] = true;
+			}
 			return doc;
 		}
 	};
@@ -52,6 +52,7 @@
 #include <ProcessManagement/Utils.h>
 #include <SystemTools/ProcessMetricsCollector.h>
 #include <SystemTools/SystemTime.h>
+#include <SystemTools/CpuTopology.h>
 #include <FileTools/FileManip.h>
 #include <IOTools/BufferedIO.h>
 #include <JsonTools/JsonUtils.h>
@@ -318,6 +319,9 @@ private:
 		try {
 			setConfigFromAppPoolOptions(&config, extraArgs, options);
 			config.startCommand = preloaderCommandString;
+			// The preloader forks processes for all NUMA nodes, so
+			// it is not bound to any of them.
+			config.cpuAffinity = StaticString();
 		} catch (const std::exception &originalException) {
 			Journey journey(SPAWN_THROUGH_PRELOADER, true);
 			journey.setStepErrored(SPAWNING_KIT_PREPARATION, true);
@@ -1195,6 +1199,32 @@ private:
 		return string();
 	}
 
+	/**
+	 * Processes forked by the preloader do not pass through the
+	 * SpawnEnvSetupper, so their CPU affinity is set from here.
+	 * The forked process starts with a single thread, but it is already
+	 * running by now and may have started more (e.g. a language runtime's
+	 * timer thread), so all of its threads are bound.
+	 * Failure is not fatal: the process then simply runs unbound.
+	 */
+	static void setForkedProcessCpuAffinity(const Config &config, pid_t pid) {
+		if (config.cpuAffinity.empty()) {
+			return;
+		}
+
+		vector<unsigned int> cpus;
+		int e;
+		if (!CpuTopology::parseCpuList(config.cpuAffinity, cpus)) {
+			e = EINVAL;
+		} else {
+			e = CpuTopology::setProcessAffinity(pid, cpus, true);
+		}
+		if (e != 0) {
+			P_WARN("Cannot set CPU affinity of process " << pid << " to "
+				<< config.cpuAffinity << ": " << strerror(e) << " (errno=" << e << ")");
+		}
+	}
+
 	static StringKeyTable<string> loadAnnotationsFromEnvDumpDir(const string &envDumpDir,
 		int envDumpAnnotationsDirFd)
 	{
@@ -1314,6 +1344,7 @@ public:
 			UPDATE_TRACE_POINT();
 			ScopeGuard guard(boost::bind(nonInterruptableKillAndWaitpid, forkResult.pid));
 			P_DEBUG("Process forked for appRoot=" << options.appRoot << ": PID " << forkResult.pid);
+			setForkedProcessCpuAffinity(config, forkResult.pid);
 
 			UPDATE_TRACE_POINT();
 			session.journey.setStepPerformed(SPAWNING_KIT_PROCESS_RESPONSE_FROM_PRELOADER);
@@ -126,6 +126,7 @@ protected:
 		config->groupUuid = options.groupUuid;
 		config->lveMinUid = options.lveMinUid;
 		config->fileDescriptorUlimit = options.fileDescriptorUlimit;
+		config->cpuAffinity = options.cpuAffinity;
 		config->startTimeoutMsec = options.startTimeout;
 
 		UserSwitchingInfo info = prepareUserSwitching(options,
@@ -63,6 +63,7 @@
 #include <FileTools/FileManip.h>
 #include <FileTools/PathManip.h>
 #include <SystemTools/UserDatabase.h>
+#include <SystemTools/CpuTopology.h>
 #include <Utils.h>
 #include <StrIntTools/StrIntUtils.h>
 #include <Core/SpawningKit/Handshake/WorkDir.h>
@@ -297,6 +298,27 @@ setUlimits(const Json::Value &args) {
 	return ret != -1;
 }
 
+static void
+setCpuAffinity(const Json::Value &args) {
+	if (!args.isMember("cpu_affinity")) {
+		return;
+	}
+
+	string cpuList = args["cpu_affinity"].asString();
+	vector<unsigned int> cpus;
+	if (!CpuTopology::parseCpuList(cpuList, cpus)) {
+		fprintf(stderr, "Warning: invalid CPU list '%s'; not changing CPU affinity\n",
+			cpuList.c_str());
+		return;
+	}
+
+	int e = CpuTopology::setProcessAffinity(0, cpus);
+	if (e != 0) {
+		fprintf(stderr, "Warning: unable to set CPU affinity to %s: %s (errno=%d)\n",
+			cpuList.c_str(), strerror(e), e);
+	}
+}
+
 static bool
 canSwitchUser(const Json::Value &args) {
 	return args.isMember("user") && geteuid() == 0;
@@ -900,6 +922,7 @@ spawnEnvSetupperMain(int argc, char *argv[]) {
 			if (setUlimits(context.args)) {
 				dumpUlimits(context.workDir);
 			}
+			setCpuAffinity(context.args);
 			if (shouldTrySwitchUser) {
 				chownNewWorkDirFiles(context, uid, gid);
 				finalizeWorkDir(context, uid, gid);
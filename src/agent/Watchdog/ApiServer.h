@@ -59,6 +59,7 @@ using namespace std;
  *   authorizations               array              -          default("[FILTERED]"),secret
  *   client_freelist_limit        unsigned integer   -          default(0)
  *   fd_passing_password          string             required   secret
+ *   http2                        boolean            -          default(false)
  *   min_spare_clients            unsigned integer   -          default(0)
  *   request_freelist_limit       unsigned integer   -          default(1024)
  *   start_reading_after_accept   boolean            -          default(true)
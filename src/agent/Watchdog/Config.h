@@ -74,9 +74,16 @@ using namespace std;
  *   controller_file_buffered_channel_auto_truncate_file                      boolean            -          default(true)
  *   controller_file_buffered_channel_buffer_dir                              string             -          default
  *   controller_file_buffered_channel_delay_in_file_mode_switching            unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_max_disk_buffering                      unsigned integer   -          default(0)
  *   controller_file_buffered_channel_max_disk_chunk_read_size                unsigned integer   -          default(0)
+ *   controller_file_buffered_channel_spool_arena                             boolean            -          default(true)
+ *   controller_file_buffered_channel_spool_extent_size                       unsigned integer   -          default(1048576)
  *   controller_file_buffered_channel_threshold                               unsigned integer   -          default(131072)
+ *   controller_http2                                                         boolean            -          default(false)
  *   controller_mbuf_block_chunk_size                                         unsigned integer   -          default(4096),read_only
+ *   controller_mbuf_block_size_classes                                       unsigned integer   -          default(3),read_only
+ *   controller_mbuf_pool_huge_pages                                          boolean            -          default(false),read_only
+ *   controller_mbuf_pool_max_spare_memory                                    unsigned integer   -          default(8388608)
  *   controller_min_spare_clients                                             unsigned integer   -          default(0)
  *   controller_pid_file                                                      string             -          default,read_only
  *   controller_request_freelist_limit                                        unsigned integer   -          default(1024)
@@ -92,9 +99,16 @@ using namespace std;
  *   core_api_server_file_buffered_channel_auto_truncate_file                 boolean            -          default(true)
  *   core_api_server_file_buffered_channel_buffer_dir                         string             -          default
  *   core_api_server_file_buffered_channel_delay_in_file_mode_switching       unsigned integer   -          default(0)
+ *   core_api_server_file_buffered_channel_max_disk_buffering                 unsigned integer   -          default(0)
  *   core_api_server_file_buffered_channel_max_disk_chunk_read_size           unsigned integer   -          default(0)
+ *   core_api_server_file_buffered_channel_spool_arena                        boolean            -          default(false)
+ *   core_api_server_file_buffered_channel_spool_extent_size                  unsigned integer   -          default(1048576)
  *   core_api_server_file_buffered_channel_threshold                          unsigned integer   -          default(131072)
+ *   core_api_server_http2                                                    boolean            -          default(false)
  *   core_api_server_mbuf_block_chunk_size                                    unsigned integer   -          default(4096),read_only
+ *   core_api_server_mbuf_block_size_classes                                  unsigned integer   -          default(3),read_only
+ *   core_api_server_mbuf_pool_huge_pages                                     boolean            -          default(false),read_only
+ *   core_api_server_mbuf_pool_max_spare_memory                               unsigned integer   -          default(8388608)
  *   core_api_server_min_spare_clients                                        unsigned integer   -          default(0)
  *   core_api_server_request_freelist_limit                                   unsigned integer   -          default(1024)
  *   core_api_server_start_reading_after_accept                               boolean            -          default(true)
@@ -104,6 +118,8 @@ using namespace std;
  *   default_abort_websockets_on_process_shutdown                             boolean            -          default(true)
  *   default_app_file_descriptor_ulimit                                       unsigned integer   -          -
  *   default_bind_address                                                     string             -          default("127.0.0.1")
+ *   default_capacity_reservation                                             unsigned integer   -          default(0)
+ *   default_capacity_weight                                                  unsigned integer   -          default(1)
  *   default_environment                                                      string             -          default("production")
  *   default_force_max_concurrent_requests_per_process                        integer            -          default(-1)
  *   default_friendly_error_pages                                             string             -          default("auto")
@@ -111,16 +127,20 @@ using namespace std;
  *   default_load_shell_envvars                                               boolean            -          default(false)
  *   default_max_preloader_idle_time                                          unsigned integer   -          default(300)
  *   default_max_request_queue_size                                           unsigned integer   -          default(100)
+ *   default_max_request_queue_time                                           unsigned integer   -          default(0)
  *   default_max_requests                                                     unsigned integer   -          default(0)
+ *   default_memory_limit                                                     unsigned integer   -          default(0)
  *   default_meteor_app_settings                                              string             -          -
  *   default_min_instances                                                    unsigned integer   -          default(1)
  *   default_nodejs                                                           string             -          default("node")
  *   default_python                                                           string             -          default("python")
+ *   default_request_priority                                                 string             -          default("normal")
  *   default_ruby                                                             string             -          default("ruby")
  *   default_server_name                                                      string             -          default
  *   default_server_port                                                      unsigned integer   -          default
  *   default_spawn_method                                                     string             -          default("smart")
  *   default_sticky_sessions                                                  boolean            -          default(false)
+ *   default_sticky_sessions_consistent_hashing                               boolean            -          default(false)
  *   default_sticky_sessions_cookie_attributes                                string             -          default("SameSite=Lax; Secure;")
  *   default_sticky_sessions_cookie_name                                      string             -          default("_passenger_route")
  *   default_user                                                             string             -          default("nobody")
@@ -142,11 +162,13 @@ using namespace std;
  *   max_instances_per_app                                                    unsigned integer   -          read_only
  *   max_pool_size                                                            unsigned integer   -          default(6)
  *   multi_app                                                                boolean            -          default(false),read_only
+ *   numa_aware_placement                                                     boolean            -          default(false),read_only
  *   passenger_root                                                           string             required   read_only
  *   pidfiles_to_delete_on_exit                                               array of strings   -          default([])
  *   pool_idle_time                                                           unsigned integer   -          default(300)
  *   pool_selfchecks                                                          boolean            -          default(false)
  *   prestart_urls                                                            array of strings   -          default([]),read_only
+ *   request_priority_rules                                                   array of strings   -          default([])
  *   response_buffer_high_watermark                                           unsigned integer   -          default(134217728)
  *   security_update_checker_certificate_path                                 string             -          -
  *   security_update_checker_disabled                                         boolean            -          default(false)
@@ -187,9 +209,16 @@ using namespace std;
  *   watchdog_api_server_file_buffered_channel_auto_truncate_file             boolean            -          default(true)
  *   watchdog_api_server_file_buffered_channel_buffer_dir                     string             -          default
  *   watchdog_api_server_file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -          default(0)
+ *   watchdog_api_server_file_buffered_channel_max_disk_buffering             unsigned integer   -          default(0)
  *   watchdog_api_server_file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -          default(0)
+ *   watchdog_api_server_file_buffered_channel_spool_arena                    boolean            -          default(false)
+ *   watchdog_api_server_file_buffered_channel_spool_extent_size              unsigned integer   -          default(1048576)
  *   watchdog_api_server_file_buffered_channel_threshold                      unsigned integer   -          default(131072)
+ *   watchdog_api_server_http2                                                boolean            -          default(false)
  *   watchdog_api_server_mbuf_block_chunk_size                                unsigned integer   -          default(4096),read_only
+ *   watchdog_api_server_mbuf_block_size_classes                              unsigned integer   -          default(3),read_only
+ *   watchdog_api_server_mbuf_pool_huge_pages                                 boolean            -          default(false),read_only
+ *   watchdog_api_server_mbuf_pool_max_spare_memory                           unsigned integer   -          default(8388608)
  *   watchdog_api_server_min_spare_clients                                    unsigned integer   -          default(0)
  *   watchdog_api_server_request_freelist_limit                               unsigned integer   -          default(1024)
  *   watchdog_api_server_start_reading_after_accept                           boolean            -          default(true)
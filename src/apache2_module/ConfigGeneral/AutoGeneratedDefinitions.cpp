@@ -132,6 +132,16 @@ extern "C" const command_rec passenger_commands[] = {
 		NULL,
 		RSRC_CONF | ACCESS_CONF | OR_ALL,
 		"Whether to buffer file uploads."),
+	AP_INIT_TAKE1("PassengerCapacityReservation",
+		(Take1Func) cmd_passenger_capacity_reservation,
+		NULL,
+		RSRC_CONF | ACCESS_CONF,
+		"The number of processes that this application keeps when the pool is full."),
+	AP_INIT_TAKE1("PassengerCapacityWeight",
+		(Take1Func) cmd_passenger_capacity_weight,
+		NULL,
+		RSRC_CONF | ACCESS_CONF,
+		"The share of the pool that this application gets relative to other applications when the pool is full."),
 	AP_INIT_TAKE1("PassengerConcurrencyModel",
 		(Take1Func) cmd_passenger_enterprise_only,
 		NULL,
@@ -288,7 +298,7 @@ extern "C" const command_rec passenger_commands[] = {
 		RSRC_CONF | ACCESS_CONF,
 		"The maximum number of queued requests."),
 	AP_INIT_TAKE1("PassengerMaxRequestQueueTime",
-		(Take1Func) cmd_passenger_enterprise_only,
+		(Take1Func) cmd_passenger_max_request_queue_time,
 		NULL,
 		RSRC_CONF | ACCESS_CONF | OR_ALL,
 		"The maximum number of seconds that a request may remain in the queue before it is dropped."),
@@ -303,7 +313,7 @@ extern "C" const command_rec passenger_commands[] = {
 		RSRC_CONF | ACCESS_CONF,
 		"The maximum number of requests that an application instance may process."),
 	AP_INIT_TAKE1("PassengerMemoryLimit",
-		(Take1Func) cmd_passenger_enterprise_only,
+		(Take1Func) cmd_passenger_memory_limit,
 		NULL,
 		RSRC_CONF | ACCESS_CONF,
 		"The maximum amount of memory in MB that an application instance may use."),
@@ -342,6 +352,11 @@ extern "C" const command_rec passenger_commands[] = {
 		NULL,
 		RSRC_CONF | ACCESS_CONF,
 		"The Python interpreter to use."),
+	AP_INIT_TAKE1("PassengerRequestPriority",
+		(Take1Func) cmd_passenger_request_priority,
+		NULL,
+		RSRC_CONF | ACCESS_CONF | OR_ALL,
+		"The priority class (high, normal or low) of requests in the application's request queue."),
 	AP_INIT_FLAG("PassengerResistDeploymentErrors",
 		(FlagFunc) cmd_passenger_enterprise_only,
 		NULL,
@@ -417,6 +432,11 @@ extern "C" const command_rec passenger_commands[] = {
 		NULL,
 		RSRC_CONF | ACCESS_CONF | OR_ALL,
 		"Whether to enable sticky sessions."),
+	AP_INIT_FLAG("PassengerStickySessionsConsistentHashing",
+		(FlagFunc) cmd_passenger_sticky_sessions_consistent_hashing,
+		NULL,
+		RSRC_CONF | ACCESS_CONF | OR_ALL,
+		"Whether to route sticky sessions of processes that are gone by consistent hashing."),
 	AP_INIT_TAKE1("PassengerStickySessionsCookieAttributes",
 		(Take1Func) cmd_passenger_sticky_sessions_cookie_attributes,
 		NULL,
@@ -179,6 +179,16 @@ ConfigManifestGenerator::autoGenerated_setAppConfigDefaults() {
 		"PassengerAppType",
 		P_STATIC_STRING("Autodetected"));
 
+	addOptionsContainerStaticDefaultInt(
+		defaultAppConfigContainer,
+		"PassengerCapacityReservation",
+		0);
+
+	addOptionsContainerStaticDefaultInt(
+		defaultAppConfigContainer,
+		"PassengerCapacityWeight",
+		1);
+
 	addOptionsContainerStaticDefaultStr(
 		defaultAppConfigContainer,
 		"PassengerDirectInstanceRequestAddress",
@@ -224,6 +234,11 @@ ConfigManifestGenerator::autoGenerated_setAppConfigDefaults() {
 		"PassengerMaxRequests",
 		0);
 
+	addOptionsContainerStaticDefaultInt(
+		defaultAppConfigContainer,
+		"PassengerMemoryLimit",
+		0);
+
 	addOptionsContainerStaticDefaultInt(
 		defaultAppConfigContainer,
 		"PassengerMinInstances",
@@ -305,11 +320,26 @@ ConfigManifestGenerator::autoGenerated_setLocationConfigDefaults() {
 		"PassengerHighPerformance",
 		false);
 
+	addOptionsContainerStaticDefaultInt(
+		defaultLocConfigContainer,
+		"PassengerMaxRequestQueueTime",
+		0);
+
+	addOptionsContainerStaticDefaultStr(
+		defaultLocConfigContainer,
+		"PassengerRequestPriority",
+		P_STATIC_STRING("normal"));
+
 	addOptionsContainerStaticDefaultBool(
 		defaultLocConfigContainer,
 		"PassengerStickySessions",
 		false);
 
+	addOptionsContainerStaticDefaultBool(
+		defaultLocConfigContainer,
+		"PassengerStickySessionsConsistentHashing",
+		false);
+
 	addOptionsContainerStaticDefaultStr(
 		defaultLocConfigContainer,
 		"PassengerStickySessionsCookieAttributes",
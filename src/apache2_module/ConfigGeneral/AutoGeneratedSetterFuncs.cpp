@@ -259,6 +259,34 @@ cmd_passenger_buffer_upload(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return NULL;
 }
 
+static const char *
+cmd_passenger_capacity_reservation(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mCapacityReservationSourceFile = cmd->directive->filename;
+	config->mCapacityReservationSourceLine = cmd->directive->line_num;
+	config->mCapacityReservationExplicitlySet = true;
+	return setIntConfig(cmd, arg, config->mCapacityReservation, 0);
+}
+
+static const char *
+cmd_passenger_capacity_weight(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mCapacityWeightSourceFile = cmd->directive->filename;
+	config->mCapacityWeightSourceLine = cmd->directive->line_num;
+	config->mCapacityWeightExplicitlySet = true;
+	return setIntConfig(cmd, arg, config->mCapacityWeight, 0);
+}
+
 static const char *
 cmd_passenger_data_buffer_dir(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
@@ -627,6 +655,15 @@ cmd_passenger_max_request_queue_size(cmd_parms *cmd, void *pcfg, const char *arg
 	return setIntConfig(cmd, arg, config->mMaxRequestQueueSize, 0);
 }
 
+static const char *
+cmd_passenger_max_request_queue_time(cmd_parms *cmd, void *pcfg, const char *arg) {
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mMaxRequestQueueTimeSourceFile = cmd->directive->filename;
+	config->mMaxRequestQueueTimeSourceLine = cmd->directive->line_num;
+	config->mMaxRequestQueueTimeExplicitlySet = true;
+	return setIntConfig(cmd, arg, config->mMaxRequestQueueTime, 0);
+}
+
 static const char *
 cmd_passenger_max_requests(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
@@ -641,6 +678,20 @@ cmd_passenger_max_requests(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return setIntConfig(cmd, arg, config->mMaxRequests, 0);
 }
 
+static const char *
+cmd_passenger_memory_limit(cmd_parms *cmd, void *pcfg, const char *arg) {
+	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
+	if (err != NULL) {
+		return err;
+	}
+
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mMemoryLimitSourceFile = cmd->directive->filename;
+	config->mMemoryLimitSourceLine = cmd->directive->line_num;
+	config->mMemoryLimitExplicitlySet = true;
+	return setIntConfig(cmd, arg, config->mMemoryLimit, 0);
+}
+
 static const char *
 cmd_passenger_meteor_app_settings(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, NOT_IN_FILES);
@@ -744,6 +795,16 @@ cmd_passenger_python(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return NULL;
 }
 
+static const char *
+cmd_passenger_request_priority(cmd_parms *cmd, void *pcfg, const char *arg) {
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mRequestPrioritySourceFile = cmd->directive->filename;
+	config->mRequestPrioritySourceLine = cmd->directive->line_num;
+	config->mRequestPriorityExplicitlySet = true;
+	config->mRequestPriority = arg;
+	return NULL;
+}
+
 static const char *
 cmd_passenger_response_buffer_high_watermark(cmd_parms *cmd, void *pcfg, const char *arg) {
 	const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
@@ -918,6 +979,19 @@ cmd_passenger_sticky_sessions(cmd_parms *cmd, void *pcfg, const char *arg) {
 	return NULL;
 }
 
+static const char *
+cmd_passenger_sticky_sessions_consistent_hashing(cmd_parms *cmd, void *pcfg, const char *arg) {
+	DirConfig *config = (DirConfig *) pcfg;
+	config->mStickySessionsConsistentHashingSourceFile = cmd->directive->filename;
+	config->mStickySessionsConsistentHashingSourceLine = cmd->directive->line_num;
+	config->mStickySessionsConsistentHashingExplicitlySet = true;
+	config->mStickySessionsConsistentHashing =
+		(arg != NULL) ?
+		ENABLED :
+		DISABLED;
+	return NULL;
+}
+
 static const char *
 cmd_passenger_sticky_sessions_cookie_attributes(cmd_parms *cmd, void *pcfg, const char *arg) {
 	DirConfig *config = (DirConfig *) pcfg;
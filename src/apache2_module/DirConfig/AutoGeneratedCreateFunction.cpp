@@ -75,6 +75,8 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	 */
 	config->mBufferResponse = Apache2Module::UNSET;
 	config->mBufferUpload = Apache2Module::UNSET;
+	config->mCapacityReservation = UNSET_INT_VALUE;
+	config->mCapacityWeight = UNSET_INT_VALUE;
 	/*
 	 * config->mDirectInstanceRequestAddress: default initialized
 	 */
@@ -90,7 +92,9 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mLveMinUid = UNSET_INT_VALUE;
 	config->mMaxPreloaderIdleTime = UNSET_INT_VALUE;
 	config->mMaxRequestQueueSize = UNSET_INT_VALUE;
+	config->mMaxRequestQueueTime = UNSET_INT_VALUE;
 	config->mMaxRequests = UNSET_INT_VALUE;
+	config->mMemoryLimit = UNSET_INT_VALUE;
 	/*
 	 * config->mMeteorAppSettings: default initialized
 	 */
@@ -104,6 +108,9 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	/*
 	 * config->mPython: default initialized
 	 */
+	/*
+	 * config->mRequestPriority: default initialized
+	 */
 	/*
 	 * config->mRestartDir: default initialized
 	 */
@@ -118,6 +125,7 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	 * config->mStartupFile: default initialized
 	 */
 	config->mStickySessions = Apache2Module::UNSET;
+	config->mStickySessionsConsistentHashing = Apache2Module::UNSET;
 	/*
 	 * config->mStickySessionsCookieAttributes: default initialized
 	 */
@@ -138,6 +146,8 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mBaseURIsSourceLine = 0;
 	config->mBufferResponseSourceLine = 0;
 	config->mBufferUploadSourceLine = 0;
+	config->mCapacityReservationSourceLine = 0;
+	config->mCapacityWeightSourceLine = 0;
 	config->mDirectInstanceRequestAddressSourceLine = 0;
 	config->mEnabledSourceLine = 0;
 	config->mErrorOverrideSourceLine = 0;
@@ -149,18 +159,22 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mLveMinUidSourceLine = 0;
 	config->mMaxPreloaderIdleTimeSourceLine = 0;
 	config->mMaxRequestQueueSizeSourceLine = 0;
+	config->mMaxRequestQueueTimeSourceLine = 0;
 	config->mMaxRequestsSourceLine = 0;
+	config->mMemoryLimitSourceLine = 0;
 	config->mMeteorAppSettingsSourceLine = 0;
 	config->mMinInstancesSourceLine = 0;
 	config->mMonitorLogFileSourceLine = 0;
 	config->mNodejsSourceLine = 0;
 	config->mPythonSourceLine = 0;
+	config->mRequestPrioritySourceLine = 0;
 	config->mRestartDirSourceLine = 0;
 	config->mRubySourceLine = 0;
 	config->mSpawnMethodSourceLine = 0;
 	config->mStartTimeoutSourceLine = 0;
 	config->mStartupFileSourceLine = 0;
 	config->mStickySessionsSourceLine = 0;
+	config->mStickySessionsConsistentHashingSourceLine = 0;
 	config->mStickySessionsCookieAttributesSourceLine = 0;
 	config->mStickySessionsCookieNameSourceLine = 0;
 	config->mUserSourceLine = 0;
@@ -175,6 +189,8 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mBaseURIsExplicitlySet = false;
 	config->mBufferResponseExplicitlySet = false;
 	config->mBufferUploadExplicitlySet = false;
+	config->mCapacityReservationExplicitlySet = false;
+	config->mCapacityWeightExplicitlySet = false;
 	config->mDirectInstanceRequestAddressExplicitlySet = false;
 	config->mEnabledExplicitlySet = false;
 	config->mErrorOverrideExplicitlySet = false;
@@ -186,18 +202,22 @@ createDirConfig_autoGenerated(DirConfig *config) {
 	config->mLveMinUidExplicitlySet = false;
 	config->mMaxPreloaderIdleTimeExplicitlySet = false;
 	config->mMaxRequestQueueSizeExplicitlySet = false;
+	config->mMaxRequestQueueTimeExplicitlySet = false;
 	config->mMaxRequestsExplicitlySet = false;
+	config->mMemoryLimitExplicitlySet = false;
 	config->mMeteorAppSettingsExplicitlySet = false;
 	config->mMinInstancesExplicitlySet = false;
 	config->mMonitorLogFileExplicitlySet = false;
 	config->mNodejsExplicitlySet = false;
 	config->mPythonExplicitlySet = false;
+	config->mRequestPriorityExplicitlySet = false;
 	config->mRestartDirExplicitlySet = false;
 	config->mRubyExplicitlySet = false;
 	config->mSpawnMethodExplicitlySet = false;
 	config->mStartTimeoutExplicitlySet = false;
 	config->mStartupFileExplicitlySet = false;
 	config->mStickySessionsExplicitlySet = false;
+	config->mStickySessionsConsistentHashingExplicitlySet = false;
 	config->mStickySessionsCookieAttributesExplicitlySet = false;
 	config->mStickySessionsCookieNameExplicitlySet = false;
 	config->mUserExplicitlySet = false;
@@ -61,6 +61,12 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(result, StaticString("!~PASSENGER_APP_LOG_FILE",
 			sizeof("!~PASSENGER_APP_LOG_FILE") - 1),
 		config->mAppLogFile);
+	addHeader(r, result, StaticString("!~PASSENGER_CAPACITY_RESERVATION",
+			sizeof("!~PASSENGER_CAPACITY_RESERVATION") - 1),
+		config->mCapacityReservation);
+	addHeader(r, result, StaticString("!~PASSENGER_CAPACITY_WEIGHT",
+			sizeof("!~PASSENGER_CAPACITY_WEIGHT") - 1),
+		config->mCapacityWeight);
 	addHeader(result, StaticString("!~PASSENGER_DIRECT_INSTANCE_REQUEST_ADDRESS",
 			sizeof("!~PASSENGER_DIRECT_INSTANCE_REQUEST_ADDRESS") - 1),
 		config->mDirectInstanceRequestAddress);
@@ -85,9 +91,15 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(r, result, StaticString("!~PASSENGER_MAX_REQUEST_QUEUE_SIZE",
 			sizeof("!~PASSENGER_MAX_REQUEST_QUEUE_SIZE") - 1),
 		config->mMaxRequestQueueSize);
+	addHeader(r, result, StaticString("!~PASSENGER_MAX_REQUEST_QUEUE_TIME",
+			sizeof("!~PASSENGER_MAX_REQUEST_QUEUE_TIME") - 1),
+		config->mMaxRequestQueueTime);
 	addHeader(r, result, StaticString("!~PASSENGER_MAX_REQUESTS",
 			sizeof("!~PASSENGER_MAX_REQUESTS") - 1),
 		config->mMaxRequests);
+	addHeader(r, result, StaticString("!~PASSENGER_MEMORY_LIMIT",
+			sizeof("!~PASSENGER_MEMORY_LIMIT") - 1),
+		config->mMemoryLimit);
 	addHeader(result, StaticString("!~PASSENGER_METEOR_APP_SETTINGS",
 			sizeof("!~PASSENGER_METEOR_APP_SETTINGS") - 1),
 		config->mMeteorAppSettings);
@@ -100,6 +112,9 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(result, StaticString("!~PASSENGER_PYTHON",
 			sizeof("!~PASSENGER_PYTHON") - 1),
 		config->mPython);
+	addHeader(result, StaticString("!~PASSENGER_REQUEST_PRIORITY",
+			sizeof("!~PASSENGER_REQUEST_PRIORITY") - 1),
+		config->mRequestPriority);
 	addHeader(result, StaticString("!~PASSENGER_RESTART_DIR",
 			sizeof("!~PASSENGER_RESTART_DIR") - 1),
 		config->mRestartDir);
@@ -118,6 +133,9 @@ constructRequestHeaders_autoGenerated(request_rec *r, DirConfig *config, std::st
 	addHeader(result, StaticString("!~PASSENGER_STICKY_SESSIONS",
 			sizeof("!~PASSENGER_STICKY_SESSIONS") - 1),
 		config->mStickySessions);
+	addHeader(result, StaticString("!~PASSENGER_STICKY_SESSIONS_CONSISTENT_HASHING",
+			sizeof("!~PASSENGER_STICKY_SESSIONS_CONSISTENT_HASHING") - 1),
+		config->mStickySessionsConsistentHashing);
 	addHeader(result, StaticString("!~PASSENGER_STICKY_SESSIONS_COOKIE_ATTRIBUTES",
 			sizeof("!~PASSENGER_STICKY_SESSIONS_COOKIE_ATTRIBUTES") - 1),
 		config->mStickySessionsCookieAttributes);
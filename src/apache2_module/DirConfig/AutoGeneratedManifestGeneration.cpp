@@ -176,6 +176,28 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mBufferUploadSourceLine);
 		hierarchyMember["value"] = pdconf->mBufferUpload == Apache2Module::ENABLED;
 	}
+	if (pdconf->mCapacityReservationExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerCapacityReservation",
+			sizeof("PassengerCapacityReservation") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mCapacityReservationSourceFile,
+			pdconf->mCapacityReservationSourceLine);
+		hierarchyMember["value"] = pdconf->mCapacityReservation;
+	}
+	if (pdconf->mCapacityWeightExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerCapacityWeight",
+			sizeof("PassengerCapacityWeight") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mCapacityWeightSourceFile,
+			pdconf->mCapacityWeightSourceLine);
+		hierarchyMember["value"] = pdconf->mCapacityWeight;
+	}
 	if (pdconf->mDirectInstanceRequestAddressExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -301,6 +323,17 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mMaxRequestQueueSizeSourceLine);
 		hierarchyMember["value"] = pdconf->mMaxRequestQueueSize;
 	}
+	if (pdconf->mMaxRequestQueueTimeExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*locOptionsContainer,
+			"PassengerMaxRequestQueueTime",
+			sizeof("PassengerMaxRequestQueueTime") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mMaxRequestQueueTimeSourceFile,
+			pdconf->mMaxRequestQueueTimeSourceLine);
+		hierarchyMember["value"] = pdconf->mMaxRequestQueueTime;
+	}
 	if (pdconf->mMaxRequestsExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -312,6 +345,17 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mMaxRequestsSourceLine);
 		hierarchyMember["value"] = pdconf->mMaxRequests;
 	}
+	if (pdconf->mMemoryLimitExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*appOptionsContainer,
+			"PassengerMemoryLimit",
+			sizeof("PassengerMemoryLimit") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mMemoryLimitSourceFile,
+			pdconf->mMemoryLimitSourceLine);
+		hierarchyMember["value"] = pdconf->mMemoryLimit;
+	}
 	if (pdconf->mMeteorAppSettingsExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -374,6 +418,19 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mPython.data(),
 			pdconf->mPython.data() + pdconf->mPython.size());
 	}
+	if (pdconf->mRequestPriorityExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*locOptionsContainer,
+			"PassengerRequestPriority",
+			sizeof("PassengerRequestPriority") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mRequestPrioritySourceFile,
+			pdconf->mRequestPrioritySourceLine);
+		hierarchyMember["value"] = Json::Value(
+			pdconf->mRequestPriority.data(),
+			pdconf->mRequestPriority.data() + pdconf->mRequestPriority.size());
+	}
 	if (pdconf->mRestartDirExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
@@ -448,6 +505,17 @@ ConfigManifestGenerator::autoGenerated_generateConfigManifestForDirConfig(server
 			pdconf->mStickySessionsSourceLine);
 		hierarchyMember["value"] = pdconf->mStickySessions == Apache2Module::ENABLED;
 	}
+	if (pdconf->mStickySessionsConsistentHashingExplicitlySet) {
+		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
+			pdconf, context, &appOptionsContainer, &locOptionsContainer);
+		Json::Value &optionContainer = findOrCreateOptionContainer(*locOptionsContainer,
+			"PassengerStickySessionsConsistentHashing",
+			sizeof("PassengerStickySessionsConsistentHashing") - 1);
+		Json::Value &hierarchyMember = addOptionContainerHierarchyMember(optionContainer,
+			pdconf->mStickySessionsConsistentHashingSourceFile,
+			pdconf->mStickySessionsConsistentHashingSourceLine);
+		hierarchyMember["value"] = pdconf->mStickySessionsConsistentHashing == Apache2Module::ENABLED;
+	}
 	if (pdconf->mStickySessionsCookieAttributesExplicitlySet) {
 		findOrCreateAppAndLocOptionsContainers(serverRec, csconf, cdconf,
 			pdconf, context, &appOptionsContainer, &locOptionsContainer);
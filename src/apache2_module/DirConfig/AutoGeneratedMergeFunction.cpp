@@ -88,6 +88,14 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(add->mBufferUpload != Apache2Module::UNSET)
 		? add->mBufferUpload
 		: base->mBufferUpload;
+	config->mCapacityReservation =
+		(add->mCapacityReservation != UNSET_INT_VALUE)
+		? add->mCapacityReservation
+		: base->mCapacityReservation;
+	config->mCapacityWeight =
+		(add->mCapacityWeight != UNSET_INT_VALUE)
+		? add->mCapacityWeight
+		: base->mCapacityWeight;
 	config->mDirectInstanceRequestAddress =
 		(!add->mDirectInstanceRequestAddress.empty())
 		? add->mDirectInstanceRequestAddress
@@ -132,10 +140,18 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(add->mMaxRequestQueueSize != UNSET_INT_VALUE)
 		? add->mMaxRequestQueueSize
 		: base->mMaxRequestQueueSize;
+	config->mMaxRequestQueueTime =
+		(add->mMaxRequestQueueTime != UNSET_INT_VALUE)
+		? add->mMaxRequestQueueTime
+		: base->mMaxRequestQueueTime;
 	config->mMaxRequests =
 		(add->mMaxRequests != UNSET_INT_VALUE)
 		? add->mMaxRequests
 		: base->mMaxRequests;
+	config->mMemoryLimit =
+		(add->mMemoryLimit != UNSET_INT_VALUE)
+		? add->mMemoryLimit
+		: base->mMemoryLimit;
 	config->mMeteorAppSettings =
 		(!add->mMeteorAppSettings.empty())
 		? add->mMeteorAppSettings
@@ -156,6 +172,10 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(!add->mPython.empty())
 		? add->mPython
 		: base->mPython;
+	config->mRequestPriority =
+		(!add->mRequestPriority.empty())
+		? add->mRequestPriority
+		: base->mRequestPriority;
 	config->mRestartDir =
 		(!add->mRestartDir.empty())
 		? add->mRestartDir
@@ -180,6 +200,10 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 		(add->mStickySessions != Apache2Module::UNSET)
 		? add->mStickySessions
 		: base->mStickySessions;
+	config->mStickySessionsConsistentHashing =
+		(add->mStickySessionsConsistentHashing != Apache2Module::UNSET)
+		? add->mStickySessionsConsistentHashing
+		: base->mStickySessionsConsistentHashing;
 	config->mStickySessionsCookieAttributes =
 		(!add->mStickySessionsCookieAttributes.empty())
 		? add->mStickySessionsCookieAttributes
@@ -203,6 +227,8 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mBaseURIsSourceFile = add->mBaseURIsSourceFile;
 	config->mBufferResponseSourceFile = add->mBufferResponseSourceFile;
 	config->mBufferUploadSourceFile = add->mBufferUploadSourceFile;
+	config->mCapacityReservationSourceFile = add->mCapacityReservationSourceFile;
+	config->mCapacityWeightSourceFile = add->mCapacityWeightSourceFile;
 	config->mDirectInstanceRequestAddressSourceFile = add->mDirectInstanceRequestAddressSourceFile;
 	config->mEnabledSourceFile = add->mEnabledSourceFile;
 	config->mErrorOverrideSourceFile = add->mErrorOverrideSourceFile;
@@ -214,18 +240,22 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mLveMinUidSourceFile = add->mLveMinUidSourceFile;
 	config->mMaxPreloaderIdleTimeSourceFile = add->mMaxPreloaderIdleTimeSourceFile;
 	config->mMaxRequestQueueSizeSourceFile = add->mMaxRequestQueueSizeSourceFile;
+	config->mMaxRequestQueueTimeSourceFile = add->mMaxRequestQueueTimeSourceFile;
 	config->mMaxRequestsSourceFile = add->mMaxRequestsSourceFile;
+	config->mMemoryLimitSourceFile = add->mMemoryLimitSourceFile;
 	config->mMeteorAppSettingsSourceFile = add->mMeteorAppSettingsSourceFile;
 	config->mMinInstancesSourceFile = add->mMinInstancesSourceFile;
 	config->mMonitorLogFileSourceFile = add->mMonitorLogFileSourceFile;
 	config->mNodejsSourceFile = add->mNodejsSourceFile;
 	config->mPythonSourceFile = add->mPythonSourceFile;
+	config->mRequestPrioritySourceFile = add->mRequestPrioritySourceFile;
 	config->mRestartDirSourceFile = add->mRestartDirSourceFile;
 	config->mRubySourceFile = add->mRubySourceFile;
 	config->mSpawnMethodSourceFile = add->mSpawnMethodSourceFile;
 	config->mStartTimeoutSourceFile = add->mStartTimeoutSourceFile;
 	config->mStartupFileSourceFile = add->mStartupFileSourceFile;
 	config->mStickySessionsSourceFile = add->mStickySessionsSourceFile;
+	config->mStickySessionsConsistentHashingSourceFile = add->mStickySessionsConsistentHashingSourceFile;
 	config->mStickySessionsCookieAttributesSourceFile = add->mStickySessionsCookieAttributesSourceFile;
 	config->mStickySessionsCookieNameSourceFile = add->mStickySessionsCookieNameSourceFile;
 	config->mUserSourceFile = add->mUserSourceFile;
@@ -240,6 +270,8 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mBaseURIsSourceLine = add->mBaseURIsSourceLine;
 	config->mBufferResponseSourceLine = add->mBufferResponseSourceLine;
 	config->mBufferUploadSourceLine = add->mBufferUploadSourceLine;
+	config->mCapacityReservationSourceLine = add->mCapacityReservationSourceLine;
+	config->mCapacityWeightSourceLine = add->mCapacityWeightSourceLine;
 	config->mDirectInstanceRequestAddressSourceLine = add->mDirectInstanceRequestAddressSourceLine;
 	config->mEnabledSourceLine = add->mEnabledSourceLine;
 	config->mErrorOverrideSourceLine = add->mErrorOverrideSourceLine;
@@ -251,18 +283,22 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mLveMinUidSourceLine = add->mLveMinUidSourceLine;
 	config->mMaxPreloaderIdleTimeSourceLine = add->mMaxPreloaderIdleTimeSourceLine;
 	config->mMaxRequestQueueSizeSourceLine = add->mMaxRequestQueueSizeSourceLine;
+	config->mMaxRequestQueueTimeSourceLine = add->mMaxRequestQueueTimeSourceLine;
 	config->mMaxRequestsSourceLine = add->mMaxRequestsSourceLine;
+	config->mMemoryLimitSourceLine = add->mMemoryLimitSourceLine;
 	config->mMeteorAppSettingsSourceLine = add->mMeteorAppSettingsSourceLine;
 	config->mMinInstancesSourceLine = add->mMinInstancesSourceLine;
 	config->mMonitorLogFileSourceLine = add->mMonitorLogFileSourceLine;
 	config->mNodejsSourceLine = add->mNodejsSourceLine;
 	config->mPythonSourceLine = add->mPythonSourceLine;
+	config->mRequestPrioritySourceLine = add->mRequestPrioritySourceLine;
 	config->mRestartDirSourceLine = add->mRestartDirSourceLine;
 	config->mRubySourceLine = add->mRubySourceLine;
 	config->mSpawnMethodSourceLine = add->mSpawnMethodSourceLine;
 	config->mStartTimeoutSourceLine = add->mStartTimeoutSourceLine;
 	config->mStartupFileSourceLine = add->mStartupFileSourceLine;
 	config->mStickySessionsSourceLine = add->mStickySessionsSourceLine;
+	config->mStickySessionsConsistentHashingSourceLine = add->mStickySessionsConsistentHashingSourceLine;
 	config->mStickySessionsCookieAttributesSourceLine = add->mStickySessionsCookieAttributesSourceLine;
 	config->mStickySessionsCookieNameSourceLine = add->mStickySessionsCookieNameSourceLine;
 	config->mUserSourceLine = add->mUserSourceLine;
@@ -277,6 +313,8 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mBaseURIsExplicitlySet = add->mBaseURIsExplicitlySet;
 	config->mBufferResponseExplicitlySet = add->mBufferResponseExplicitlySet;
 	config->mBufferUploadExplicitlySet = add->mBufferUploadExplicitlySet;
+	config->mCapacityReservationExplicitlySet = add->mCapacityReservationExplicitlySet;
+	config->mCapacityWeightExplicitlySet = add->mCapacityWeightExplicitlySet;
 	config->mDirectInstanceRequestAddressExplicitlySet = add->mDirectInstanceRequestAddressExplicitlySet;
 	config->mEnabledExplicitlySet = add->mEnabledExplicitlySet;
 	config->mErrorOverrideExplicitlySet = add->mErrorOverrideExplicitlySet;
@@ -288,18 +326,22 @@ mergeDirConfig_autoGenerated(DirConfig *config, DirConfig *base, DirConfig *add)
 	config->mLveMinUidExplicitlySet = add->mLveMinUidExplicitlySet;
 	config->mMaxPreloaderIdleTimeExplicitlySet = add->mMaxPreloaderIdleTimeExplicitlySet;
 	config->mMaxRequestQueueSizeExplicitlySet = add->mMaxRequestQueueSizeExplicitlySet;
+	config->mMaxRequestQueueTimeExplicitlySet = add->mMaxRequestQueueTimeExplicitlySet;
 	config->mMaxRequestsExplicitlySet = add->mMaxRequestsExplicitlySet;
+	config->mMemoryLimitExplicitlySet = add->mMemoryLimitExplicitlySet;
 	config->mMeteorAppSettingsExplicitlySet = add->mMeteorAppSettingsExplicitlySet;
 	config->mMinInstancesExplicitlySet = add->mMinInstancesExplicitlySet;
 	config->mMonitorLogFileExplicitlySet = add->mMonitorLogFileExplicitlySet;
 	config->mNodejsExplicitlySet = add->mNodejsExplicitlySet;
 	config->mPythonExplicitlySet = add->mPythonExplicitlySet;
+	config->mRequestPriorityExplicitlySet = add->mRequestPriorityExplicitlySet;
 	config->mRestartDirExplicitlySet = add->mRestartDirExplicitlySet;
 	config->mRubyExplicitlySet = add->mRubyExplicitlySet;
 	config->mSpawnMethodExplicitlySet = add->mSpawnMethodExplicitlySet;
 	config->mStartTimeoutExplicitlySet = add->mStartTimeoutExplicitlySet;
 	config->mStartupFileExplicitlySet = add->mStartupFileExplicitlySet;
 	config->mStickySessionsExplicitlySet = add->mStickySessionsExplicitlySet;
+	config->mStickySessionsConsistentHashingExplicitlySet = add->mStickySessionsConsistentHashingExplicitlySet;
 	config->mStickySessionsCookieAttributesExplicitlySet = add->mStickySessionsCookieAttributesExplicitlySet;
 	config->mStickySessionsCookieNameExplicitlySet = add->mStickySessionsCookieNameExplicitlySet;
 	config->mUserExplicitlySet = add->mUserExplicitlySet;
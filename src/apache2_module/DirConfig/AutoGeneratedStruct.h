@@ -101,6 +101,21 @@ struct AutoGeneratedDirConfig {
 	 */
 	Threeway mStickySessions;
 
+	/*
+	 * Whether to route sticky sessions of processes that are gone by consistent hashing.
+	 */
+	Threeway mStickySessionsConsistentHashing;
+
+	/*
+	 * The number of processes that this application keeps when the pool is full.
+	 */
+	int mCapacityReservation;
+
+	/*
+	 * The share of the pool that this application gets relative to other applications when the pool is full.
+	 */
+	int mCapacityWeight;
+
 	/*
 	 * Force Passenger to believe that an application process can handle the given number of concurrent requests per process
 	 */
@@ -121,11 +136,21 @@ struct AutoGeneratedDirConfig {
 	 */
 	int mMaxRequestQueueSize;
 
+	/*
+	 * The maximum number of seconds that a request may remain in the queue before it is dropped.
+	 */
+	int mMaxRequestQueueTime;
+
 	/*
 	 * The maximum number of requests that an application instance may process.
 	 */
 	int mMaxRequests;
 
+	/*
+	 * The maximum amount of memory in MB that an application instance may use.
+	 */
+	int mMemoryLimit;
+
 	/*
 	 * The minimum number of application instances to keep when cleaning idle instances.
 	 */
@@ -191,6 +216,11 @@ struct AutoGeneratedDirConfig {
 	 */
 	StaticString mPython;
 
+	/*
+	 * The priority class (high, normal or low) of requests in the application's request queue.
+	 */
+	StaticString mRequestPriority;
+
 	/*
 	 * The directory in which Phusion Passenger should look for restart.txt.
 	 */
@@ -246,11 +276,16 @@ struct AutoGeneratedDirConfig {
 	StaticString mHighPerformanceSourceFile;
 	StaticString mLoadShellEnvvarsSourceFile;
 	StaticString mStickySessionsSourceFile;
+	StaticString mStickySessionsConsistentHashingSourceFile;
+	StaticString mCapacityReservationSourceFile;
+	StaticString mCapacityWeightSourceFile;
 	StaticString mForceMaxConcurrentRequestsPerProcessSourceFile;
 	StaticString mLveMinUidSourceFile;
 	StaticString mMaxPreloaderIdleTimeSourceFile;
 	StaticString mMaxRequestQueueSizeSourceFile;
+	StaticString mMaxRequestQueueTimeSourceFile;
 	StaticString mMaxRequestsSourceFile;
+	StaticString mMemoryLimitSourceFile;
 	StaticString mMinInstancesSourceFile;
 	StaticString mStartTimeoutSourceFile;
 	StaticString mAppEnvSourceFile;
@@ -264,6 +299,7 @@ struct AutoGeneratedDirConfig {
 	StaticString mMeteorAppSettingsSourceFile;
 	StaticString mNodejsSourceFile;
 	StaticString mPythonSourceFile;
+	StaticString mRequestPrioritySourceFile;
 	StaticString mRestartDirSourceFile;
 	StaticString mRubySourceFile;
 	StaticString mSpawnMethodSourceFile;
@@ -283,11 +319,16 @@ struct AutoGeneratedDirConfig {
 	unsigned int mHighPerformanceSourceLine;
 	unsigned int mLoadShellEnvvarsSourceLine;
 	unsigned int mStickySessionsSourceLine;
+	unsigned int mStickySessionsConsistentHashingSourceLine;
+	unsigned int mCapacityReservationSourceLine;
+	unsigned int mCapacityWeightSourceLine;
 	unsigned int mForceMaxConcurrentRequestsPerProcessSourceLine;
 	unsigned int mLveMinUidSourceLine;
 	unsigned int mMaxPreloaderIdleTimeSourceLine;
 	unsigned int mMaxRequestQueueSizeSourceLine;
+	unsigned int mMaxRequestQueueTimeSourceLine;
 	unsigned int mMaxRequestsSourceLine;
+	unsigned int mMemoryLimitSourceLine;
 	unsigned int mMinInstancesSourceLine;
 	unsigned int mStartTimeoutSourceLine;
 	unsigned int mAppEnvSourceLine;
@@ -301,6 +342,7 @@ struct AutoGeneratedDirConfig {
 	unsigned int mMeteorAppSettingsSourceLine;
 	unsigned int mNodejsSourceLine;
 	unsigned int mPythonSourceLine;
+	unsigned int mRequestPrioritySourceLine;
 	unsigned int mRestartDirSourceLine;
 	unsigned int mRubySourceLine;
 	unsigned int mSpawnMethodSourceLine;
@@ -320,11 +362,16 @@ struct AutoGeneratedDirConfig {
 	bool mHighPerformanceExplicitlySet: 1;
 	bool mLoadShellEnvvarsExplicitlySet: 1;
 	bool mStickySessionsExplicitlySet: 1;
+	bool mStickySessionsConsistentHashingExplicitlySet: 1;
+	bool mCapacityReservationExplicitlySet: 1;
+	bool mCapacityWeightExplicitlySet: 1;
 	bool mForceMaxConcurrentRequestsPerProcessExplicitlySet: 1;
 	bool mLveMinUidExplicitlySet: 1;
 	bool mMaxPreloaderIdleTimeExplicitlySet: 1;
 	bool mMaxRequestQueueSizeExplicitlySet: 1;
+	bool mMaxRequestQueueTimeExplicitlySet: 1;
 	bool mMaxRequestsExplicitlySet: 1;
+	bool mMemoryLimitExplicitlySet: 1;
 	bool mMinInstancesExplicitlySet: 1;
 	bool mStartTimeoutExplicitlySet: 1;
 	bool mAppEnvExplicitlySet: 1;
@@ -338,6 +385,7 @@ struct AutoGeneratedDirConfig {
 	bool mMeteorAppSettingsExplicitlySet: 1;
 	bool mNodejsExplicitlySet: 1;
 	bool mPythonExplicitlySet: 1;
+	bool mRequestPriorityExplicitlySet: 1;
 	bool mRestartDirExplicitlySet: 1;
 	bool mRubyExplicitlySet: 1;
 	bool mSpawnMethodExplicitlySet: 1;
@@ -426,6 +474,33 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	bool
+	getStickySessionsConsistentHashing() const {
+		if (mStickySessionsConsistentHashing == Apache2Module::UNSET) {
+			return false;
+		} else {
+			return mStickySessionsConsistentHashing == Apache2Module::ENABLED;
+		}
+	}
+
+	int
+	getCapacityReservation() const {
+		if (mCapacityReservation == UNSET_INT_VALUE) {
+			return 0;
+		} else {
+			return mCapacityReservation;
+		}
+	}
+
+	int
+	getCapacityWeight() const {
+		if (mCapacityWeight == UNSET_INT_VALUE) {
+			return 1;
+		} else {
+			return mCapacityWeight;
+		}
+	}
+
 	int
 	getForceMaxConcurrentRequestsPerProcess() const {
 		if (mForceMaxConcurrentRequestsPerProcess == UNSET_INT_VALUE) {
@@ -462,6 +537,15 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	int
+	getMaxRequestQueueTime() const {
+		if (mMaxRequestQueueTime == UNSET_INT_VALUE) {
+			return 0;
+		} else {
+			return mMaxRequestQueueTime;
+		}
+	}
+
 	int
 	getMaxRequests() const {
 		if (mMaxRequests == UNSET_INT_VALUE) {
@@ -471,6 +555,15 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	int
+	getMemoryLimit() const {
+		if (mMemoryLimit == UNSET_INT_VALUE) {
+			return 0;
+		} else {
+			return mMemoryLimit;
+		}
+	}
+
 	int
 	getMinInstances() const {
 		if (mMinInstances == UNSET_INT_VALUE) {
@@ -560,6 +653,15 @@ struct AutoGeneratedDirConfig {
 		}
 	}
 
+	StaticString
+	getRequestPriority() const {
+		if (mRequestPriority.empty()) {
+			return P_STATIC_STRING("normal");
+		} else {
+			return mRequestPriority;
+		}
+	}
+
 	StaticString
 	getRestartDir() const {
 		if (mRestartDir.empty()) {
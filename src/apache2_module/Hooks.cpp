@@ -1392,6 +1392,30 @@ public:
 		}
 
 		watchdogLauncher.start(serverConfig.root, config);
+
+		// Apache forks its children after this point, so they all share
+		// the stat information that the Core refreshes.
+		string statCachePath = SharedFileStatCache::getPathInInstanceDir(
+			watchdogLauncher.getInstanceDir());
+		try {
+			cstat.setSharedCache(boost::make_shared<SharedFileStatCache>(
+				statCachePath, (unsigned int) SharedFileStatCache::DEFAULT_SIZE));
+		} catch (const SystemException &e) {
+			P_WARN("Cannot attach the shared stat cache " << statCachePath
+				<< "; using a per-process stat cache instead: " << e.what());
+		} catch (const RuntimeException &e) {
+			P_WARN("Cannot attach the shared stat cache " << statCachePath
+				<< "; using a per-process stat cache instead: " << e.what());
+		}
+	}
+
+	void logStatCacheStats() {
+		if (cstat.getSharedCache() != NULL) {
+			SharedFileStatCache::Stats stats = cstat.getSharedCache()->getStats();
+			P_NOTICE("Shared stat cache: " << stats.hits << " hits, "
+				<< stats.misses << " misses, "
+				<< stats.backgroundRefreshes << " background refreshes");
+		}
 	}
 
 	void childInit(apr_pool_t *pchild, server_rec *s) {
@@ -1614,6 +1638,9 @@ destroy_hooks(void *arg) {
 		boost::this_thread::disable_interruption di;
 		boost::this_thread::disable_syscall_interruption dsi;
 		P_DEBUG("Shutting down Phusion Passenger...");
+		if (hooks != NULL) {
+			hooks->logStatCacheStats();
+		}
 		LoggingKit::shutdown();
 		oxt::shutdown();
 		delete hooks;
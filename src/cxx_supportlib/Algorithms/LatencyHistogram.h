@@ -0,0 +1,188 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_ALGORITHMS_LATENCY_HISTOGRAM_H_
+#define _PASSENGER_ALGORITHMS_LATENCY_HISTOGRAM_H_
+
+#include <oxt/macros.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * A fixed-size histogram of latencies in microseconds, in the spirit of
+ * HdrHistogram. Values are put into log-linear buckets: every power of two
+ * is split into 8 equally sized sub-buckets, so the value reported for a
+ * percentile is at most 12.5% higher than the real value, while recording
+ * a value is just a few shifts and an increment. Values of about 2^40 usec
+ * (12 days) and higher all end up in the last bucket.
+ *
+ * Not thread-safe. The intended usage is that every thread records into
+ * its own histograms, and that histograms are copied and merged with
+ * `merge()` when a report is requested.
+ */
+class LatencyHistogram {
+public:
+	static const unsigned int SUB_BUCKET_BITS = 3;
+	static const unsigned int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static const unsigned int MAX_EXPONENT = 39;
+	static const unsigned int BUCKET_COUNT =
+		(MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT;
+
+private:
+	boost::uint64_t counts[BUCKET_COUNT];
+	boost::uint64_t totalCount;
+	boost::uint64_t sum;
+	boost::uint64_t maxValue;
+
+	static unsigned int log2(boost::uint64_t value) {
+		#if defined(__GNUC__) || defined(__clang__)
+			return 63 - __builtin_clzll(value);
+		#else
+			unsigned int result = 0;
+			while (value >>= 1) {
+				result++;
+			}
+			return result;
+		#endif
+	}
+
+public:
+	LatencyHistogram() {
+		reset();
+	}
+
+	void reset() {
+		memset(counts, 0, sizeof(counts));
+		totalCount = 0;
+		sum = 0;
+		maxValue = 0;
+	}
+
+	static unsigned int bucketIndex(boost::uint64_t value) {
+		if (value < SUB_BUCKET_COUNT) {
+			return (unsigned int) value;
+		}
+
+		unsigned int exponent = log2(value);
+		if (OXT_UNLIKELY(exponent > MAX_EXPONENT)) {
+			return BUCKET_COUNT - 1;
+		}
+		unsigned int shift = exponent - SUB_BUCKET_BITS;
+		unsigned int subBucket = (unsigned int) (value >> shift) & (SUB_BUCKET_COUNT - 1);
+		return (shift + 1) * SUB_BUCKET_COUNT + subBucket;
+	}
+
+	/**
+	 * Returns the largest value that ends up in the bucket with the given index.
+	 */
+	static boost::uint64_t bucketUpperBound(unsigned int index) {
+		if (index < SUB_BUCKET_COUNT) {
+			return index;
+		}
+
+		unsigned int shift = index / SUB_BUCKET_COUNT - 1;
+		boost::uint64_t subBucket = index % SUB_BUCKET_COUNT;
+		boost::uint64_t lowerBound = (SUB_BUCKET_COUNT + subBucket) << shift;
+		return lowerBound + (((boost::uint64_t) 1) << shift) - 1;
+	}
+
+	void record(boost::uint64_t value) {
+		counts[bucketIndex(value)]++;
+		totalCount++;
+		sum += value;
+		maxValue = std::max(maxValue, value);
+	}
+
+	void merge(const LatencyHistogram &other) {
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			counts[i] += other.counts[i];
+		}
+		totalCount += other.totalCount;
+		sum += other.sum;
+		maxValue = std::max(maxValue, other.maxValue);
+	}
+
+	boost::uint64_t getCount() const {
+		return totalCount;
+	}
+
+	boost::uint64_t getSum() const {
+		return sum;
+	}
+
+	boost::uint64_t getMax() const {
+		return maxValue;
+	}
+
+	boost::uint64_t getBucketCount(unsigned int index) const {
+		return counts[index];
+	}
+
+	/**
+	 * Returns the number of recorded values that are less than or equal to
+	 * `value`. Only exact if `value` is the upper bound of a bucket.
+	 */
+	boost::uint64_t countAtOrBelow(boost::uint64_t value) const {
+		boost::uint64_t result = 0;
+		unsigned int last = bucketIndex(value);
+		for (unsigned int i = 0; i <= last; i++) {
+			result += counts[i];
+		}
+		return result;
+	}
+
+	/**
+	 * Returns the value below which `percentile` percent (0..100) of the
+	 * recorded values fall, rounded up to the upper bound of its bucket.
+	 * Returns 0 if nothing has been recorded.
+	 */
+	boost::uint64_t valueAtPercentile(double percentile) const {
+		if (totalCount == 0) {
+			return 0;
+		}
+
+		boost::uint64_t threshold = (boost::uint64_t) (percentile / 100.0 * totalCount + 0.5);
+		threshold = std::max<boost::uint64_t>(threshold, 1);
+		boost::uint64_t seen = 0;
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			seen += counts[i];
+			if (seen >= threshold) {
+				return std::min(bucketUpperBound(i), maxValue);
+			}
+		}
+		return maxValue;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_ALGORITHMS_LATENCY_HISTOGRAM_H_ */
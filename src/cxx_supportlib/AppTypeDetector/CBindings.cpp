@@ -88,11 +88,12 @@ psg_app_type_detector_result_get_app_start_command(const PsgAppTypeDetectorResul
 
 PsgAppTypeDetector *
 psg_app_type_detector_new(const PsgWrapperRegistry *registry,
-	unsigned int throttleRate)
+	PP_CachedFileStat *cstat, unsigned int throttleRate)
 {
 	const Registry *cxxRegistry = static_cast<const Registry *>(registry);
+	CachedFileStat *cxxCstat = static_cast<CachedFileStat *>(cstat);
 	try {
-		Detector *detector = new Detector(*cxxRegistry, NULL, NULL, throttleRate, NULL);
+		Detector *detector = new Detector(*cxxRegistry, cxxCstat, NULL, throttleRate, NULL);
 		return static_cast<PsgAppTypeDetector *>(detector);
 	} catch (const std::bad_alloc &) {
 		return NULL;
@@ -113,6 +114,14 @@ psg_app_type_detector_set_throttle_rate(PsgAppTypeDetector *detector,
 	cxxDetector->setThrottleRate(throttleRate);
 }
 
+void
+psg_app_type_detector_set_result_cache_size(PsgAppTypeDetector *detector,
+	unsigned int maxEntries)
+{
+	Detector *cxxDetector = static_cast<Detector *>(detector);
+	cxxDetector->setResultCacheSize(maxEntries);
+}
+
 void
 psg_app_type_detector_check_document_root(
 	PsgAppTypeDetector *detector, PsgAppTypeDetectorResult *result,
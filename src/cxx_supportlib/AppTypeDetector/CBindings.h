@@ -28,6 +28,7 @@
 
 #include <stddef.h>
 #include "../WrapperRegistry/CBindings.h"
+#include "../Utils/CachedFileStat.h"
 #include "../Exceptions.h"
 
 #ifdef __cplusplus
@@ -53,10 +54,12 @@ const char *psg_app_type_detector_result_get_app_start_command(const PsgAppTypeD
 typedef void PsgAppTypeDetector;
 
 PsgAppTypeDetector *psg_app_type_detector_new(const PsgWrapperRegistry *registry,
-	unsigned int throttleRate);
+	PP_CachedFileStat *cstat, unsigned int throttleRate);
 void psg_app_type_detector_free(PsgAppTypeDetector *detector);
 void psg_app_type_detector_set_throttle_rate(PsgAppTypeDetector *detector,
 	unsigned int throttleRate);
+void psg_app_type_detector_set_result_cache_size(PsgAppTypeDetector *detector,
+	unsigned int maxEntries);
 void psg_app_type_detector_check_document_root(
 	PsgAppTypeDetector *detector,
 	PsgAppTypeDetectorResult *result,
@@ -33,6 +33,7 @@
 #include <oxt/macros.hpp>
 #include <oxt/backtrace.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <string>
@@ -71,6 +72,15 @@ public:
 	};
 
 private:
+	struct CachedResult {
+		Result result;
+		time_t checkTime;
+
+		CachedResult()
+			: checkTime(0)
+			{ }
+	};
+
 	const WrapperRegistry::Registry &registry;
 	CachedFileStat *cstat;
 	boost::mutex *cstatMutex;
@@ -79,6 +89,8 @@ private:
 	AppLocalConfigMap appLocalConfigCache;
 	boost::mutex *configMutex;
 	StringKeyTable<time_t> appRootCheckTimes;
+	StringKeyTable<CachedResult> resultCache;
+	unsigned int resultCacheSize;
 
 	bool check(char *buf, const char *end, const StaticString &appRoot,
 		const StaticString &name)
@@ -113,6 +125,119 @@ private:
 		return appLocalConfig;
 	}
 
+	/**
+	 * Builds the result cache key for the given path. The key is prefixed
+	 * by `kind` so that document root lookups and app root lookups for the
+	 * same path do not collide. Returns false if the key does not fit in
+	 * the cache, in which case the caller should bypass the cache.
+	 */
+	bool makeResultCacheKey(char *buf, char kind, const StaticString &path,
+		HashedStaticString &key) const
+	{
+		if (resultCacheSize == 0
+		 || path.size() + 1 > StringKeyTable<CachedResult>::MAX_KEY_LENGTH)
+		{
+			return false;
+		}
+		buf[0] = kind;
+		memcpy(buf + 1, path.data(), path.size());
+		key = HashedStaticString(buf, path.size() + 1);
+		return true;
+	}
+
+	bool lookupCachedResult(const HashedStaticString &key, Result &result) {
+		boost::unique_lock<boost::mutex> l;
+		const CachedResult *cachedResult;
+
+		if (configMutex != NULL) {
+			l = boost::unique_lock<boost::mutex>(*configMutex);
+		}
+		if (resultCache.lookup(key, &cachedResult)
+		 && SystemTime::get() < cachedResult->checkTime + throttleRate)
+		{
+			result = cachedResult->result;
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	void storeCachedResult(const HashedStaticString &key, const Result &result) {
+		boost::unique_lock<boost::mutex> l;
+		CachedResult cachedResult;
+
+		if (configMutex != NULL) {
+			l = boost::unique_lock<boost::mutex>(*configMutex);
+		}
+		if (resultCache.size() >= resultCacheSize && !resultCache.contains(key)) {
+			// Keys are derived from the web server config, but may
+			// contain variables. Start over instead of growing without bound.
+			resultCache.clear();
+		}
+		cachedResult.result = result;
+		cachedResult.checkTime = SystemTime::get();
+		resultCache.insert(key, cachedResult);
+	}
+
+	const Result detectDocumentRoot(const StaticString &documentRoot,
+		bool resolveFirstSymlink, string *appRoot)
+	{
+		if (!resolveFirstSymlink) {
+			if (appRoot != NULL) {
+				*appRoot = extractDirNameStatic(documentRoot);
+				return detectAppRoot(*appRoot);
+			} else {
+				return detectAppRoot(extractDirNameStatic(documentRoot));
+			}
+		} else {
+			if (OXT_UNLIKELY(documentRoot.size() > PATH_MAX)) {
+				TRACE_POINT();
+				throw RuntimeException("Not enough buffer space");
+			}
+
+			char ntDocRoot[PATH_MAX + 1];
+			memcpy(ntDocRoot, documentRoot.data(), documentRoot.size());
+			ntDocRoot[documentRoot.size()] = '\0';
+			string resolvedDocumentRoot = resolveSymlink(ntDocRoot);
+			if (appRoot != NULL) {
+				*appRoot = extractDirNameStatic(resolvedDocumentRoot);
+				return detectAppRoot(*appRoot);
+			} else {
+				return detectAppRoot(extractDirNameStatic(resolvedDocumentRoot));
+			}
+		}
+	}
+
+	const Result detectAppRoot(const StaticString &appRoot) {
+		char buf[PATH_MAX + 32];
+		const char *end = buf + sizeof(buf) - 1;
+
+		AppLocalConfigPtr appLocalConfig = getAppLocalConfigFromCache(appRoot);
+
+		if (!appLocalConfig->appStartCommand.empty()) {
+			Result result;
+			result.appStartCommand = appLocalConfig->appStartCommand;
+			return result;
+		}
+
+		WrapperRegistry::Registry::ConstIterator it(registry.getIterator());
+		while (*it != NULL) {
+			const WrapperRegistry::Entry &entry = it.getValue();
+			foreach (const StaticString &defaultStartupFile,
+				entry.defaultStartupFiles)
+			{
+				if (check(buf, end, appRoot, defaultStartupFile)) {
+					Result result;
+					result.wrapperRegistryEntry = &entry;
+					return result;
+				}
+			}
+			it.next();
+		}
+
+		return Result();
+	}
+
 public:
 	Detector(const WrapperRegistry::Registry &_registry,
 		CachedFileStat *_cstat = NULL, boost::mutex *_cstatMutex = NULL,
@@ -122,7 +247,8 @@ public:
 		  cstatMutex(_cstatMutex),
 		  throttleRate(_throttleRate),
 		  ownsCstat(false),
-		  configMutex(_configMutex)
+		  configMutex(_configMutex),
+		  resultCacheSize(0)
 	{
 		assert(_registry.isFinalized());
 		if (_cstat == NULL) {
@@ -141,6 +267,31 @@ public:
 		throttleRate = val;
 	}
 
+	/**
+	 * Enables caching of detection results, keyed by document root or app
+	 * root, for up to `maxEntries` distinct paths. A cached result is reused
+	 * until the throttle rate has passed, so that repeated checks of the same
+	 * directory cost a single hash table lookup instead of a series of stat
+	 * calls. Failed checks and null results are never cached, so they can't
+	 * evict the results of detected apps. Pass 0 to disable the cache.
+	 *
+	 * Results are only cached when the caller does not ask for the inferred
+	 * application root.
+	 */
+	void setResultCacheSize(unsigned int maxEntries) {
+		boost::unique_lock<boost::mutex> l;
+		if (configMutex != NULL) {
+			l = boost::unique_lock<boost::mutex>(*configMutex);
+		}
+		resultCacheSize = std::min<unsigned int>(maxEntries,
+			StringKeyTable<CachedResult>::MAX_ITEMS - 1);
+		resultCache.clear();
+	}
+
+	unsigned int getResultCacheCount() const {
+		return resultCache.size();
+	}
+
 	/**
 	 * Given a web server document root (that is, some subdirectory under the
 	 * application root, e.g. "/webapps/foobar/public"), returns the type of
@@ -163,30 +314,22 @@ public:
 		bool resolveFirstSymlink = false,
 		string *appRoot = NULL)
 	{
-		if (!resolveFirstSymlink) {
-			if (appRoot != NULL) {
-				*appRoot = extractDirNameStatic(documentRoot);
-				return checkAppRoot(*appRoot);
-			} else {
-				return checkAppRoot(extractDirNameStatic(documentRoot));
-			}
-		} else {
-			if (OXT_UNLIKELY(documentRoot.size() > PATH_MAX)) {
-				TRACE_POINT();
-				throw RuntimeException("Not enough buffer space");
-			}
+		char keyBuf[StringKeyTable<CachedResult>::MAX_KEY_LENGTH];
+		HashedStaticString key;
+		Result result;
 
-			char ntDocRoot[PATH_MAX + 1];
-			memcpy(ntDocRoot, documentRoot.data(), documentRoot.size());
-			ntDocRoot[documentRoot.size()] = '\0';
-			string resolvedDocumentRoot = resolveSymlink(ntDocRoot);
-			if (appRoot != NULL) {
-				*appRoot = extractDirNameStatic(resolvedDocumentRoot);
-				return checkAppRoot(*appRoot);
-			} else {
-				return checkAppRoot(extractDirNameStatic(resolvedDocumentRoot));
+		if (appRoot != NULL || !makeResultCacheKey(keyBuf,
+			resolveFirstSymlink ? 'S' : 'D', documentRoot, key))
+		{
+			return detectDocumentRoot(documentRoot, resolveFirstSymlink, appRoot);
+		}
+		if (!lookupCachedResult(key, result)) {
+			result = detectDocumentRoot(documentRoot, resolveFirstSymlink, NULL);
+			if (!result.isNull()) {
+				storeCachedResult(key, result);
 			}
 		}
+		return result;
 	}
 
 	/**
@@ -199,33 +342,20 @@ public:
 	 * @throws boost::thread_interrupted
 	 */
 	const Result checkAppRoot(const StaticString &appRoot) {
-		char buf[PATH_MAX + 32];
-		const char *end = buf + sizeof(buf) - 1;
-
-		AppLocalConfigPtr appLocalConfig = getAppLocalConfigFromCache(appRoot);
+		char keyBuf[StringKeyTable<CachedResult>::MAX_KEY_LENGTH];
+		HashedStaticString key;
+		Result result;
 
-		if (!appLocalConfig->appStartCommand.empty()) {
-			Result result;
-			result.appStartCommand = appLocalConfig->appStartCommand;
-			return result;
+		if (!makeResultCacheKey(keyBuf, 'A', appRoot, key)) {
+			return detectAppRoot(appRoot);
 		}
-
-		WrapperRegistry::Registry::ConstIterator it(registry.getIterator());
-		while (*it != NULL) {
-			const WrapperRegistry::Entry &entry = it.getValue();
-			foreach (const StaticString &defaultStartupFile,
-				entry.defaultStartupFiles)
-			{
-				if (check(buf, end, appRoot, defaultStartupFile)) {
-					Result result;
-					result.wrapperRegistryEntry = &entry;
-					return result;
-				}
+		if (!lookupCachedResult(key, result)) {
+			result = detectAppRoot(appRoot);
+			if (!result.isNull()) {
+				storeCachedResult(key, result);
 			}
-			it.next();
 		}
-
-		return Result();
+		return result;
 	}
 };
 
@@ -23,12 +23,14 @@
  *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  *  THE SOFTWARE.
  */
+#include <algorithm>
 #include <cstdlib>
 #include <cerrno>
 #include <cassert>
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/atomic.hpp>
 #include <oxt/thread.hpp>
 #include <oxt/backtrace.hpp>
 #include <oxt/system_calls.hpp>
@@ -39,6 +41,7 @@
 #include <LoggingKit/LoggingKit.h>
 #include <Exceptions.h>
 #include <SafeLibev.h>
+#include <SystemTools/SystemTime.h>
 
 #ifndef HAVE_KQUEUE
 	#if defined(__APPLE__) || \
@@ -94,6 +97,14 @@ using namespace oxt;
 struct BackgroundEventLoopPrivate {
 	struct ev_async exitSignaller;
 	struct ev_async libuvActivitySignaller;
+	/**
+	 * Maintain `iterationStartTime`: the check watcher runs right after
+	 * the loop wakes up, the prepare watcher right before it goes back
+	 * to sleep.
+	 */
+	struct ev_check iterationStartWatcher;
+	struct ev_prepare iterationEndWatcher;
+	boost::atomic<MonotonicTimeUsec> iterationStartTime;
 	uv_loop_t libuv_loop;
 	/**
 	 * Coordinates communication between the libuv poller thread and the
@@ -123,6 +134,9 @@ signalLibevExit(struct ev_loop *loop, ev_async *async, int revents) {
 		ev_async_stop(bg->libev_loop, &bg->priv->libuvActivitySignaller);
 	}
 	ev_async_stop(bg->libev_loop, &bg->priv->exitSignaller);
+	ev_check_stop(bg->libev_loop, &bg->priv->iterationStartWatcher);
+	ev_prepare_stop(bg->libev_loop, &bg->priv->iterationEndWatcher);
+	bg->priv->iterationStartTime.store(0, boost::memory_order_relaxed);
 	ev_break(bg->libev_loop, EVBREAK_ALL);
 	if (bg->priv->usesLibuv) {
 		uv_timer_stop(&bg->priv->libuv_timer);
@@ -137,6 +151,22 @@ onLibuvActivity(struct ev_loop *loop, ev_async *async, int revents) {
 	uv_sem_post(&bg->priv->libuv_sem);
 }
 
+static void
+onIterationStart(struct ev_loop *loop, ev_check *check, int revents) {
+	BackgroundEventLoop *bg = (BackgroundEventLoop *) check->data;
+	MonotonicTimeUsec now = SystemTime::getMonotonicUsecWithGranularity
+		<SystemTime::GRAN_1MSEC>();
+	// 0 means idle, so never publish it.
+	bg->priv->iterationStartTime.store(std::max<MonotonicTimeUsec>(now, 1),
+		boost::memory_order_relaxed);
+}
+
+static void
+onIterationEnd(struct ev_loop *loop, ev_prepare *prepare, int revents) {
+	BackgroundEventLoop *bg = (BackgroundEventLoop *) prepare->data;
+	bg->priv->iterationStartTime.store(0, boost::memory_order_relaxed);
+}
+
 static void
 doNothing(uv_timer_t *timer) {
 	// Do nothing
@@ -277,6 +307,17 @@ BackgroundEventLoop::BackgroundEventLoop(bool scalable, bool usesLibuv)
 	priv->exitSignaller.data = this;
 	safe = boost::make_shared<SafeLibev>(libev_loop);
 
+	// Libev queues check watchers before all other watchers that became
+	// pending during the poll, and invokes pending watchers of the same
+	// priority in reverse order, so this one runs first.
+	ev_check_init(&priv->iterationStartWatcher, onIterationStart);
+	ev_set_priority(&priv->iterationStartWatcher, EV_MAXPRI);
+	priv->iterationStartWatcher.data = this;
+	ev_prepare_init(&priv->iterationEndWatcher, onIterationEnd);
+	ev_set_priority(&priv->iterationEndWatcher, EV_MINPRI);
+	priv->iterationEndWatcher.data = this;
+	priv->iterationStartTime.store(0, boost::memory_order_relaxed);
+
 	uv_barrier_init(&priv->startBarrier, usesLibuv ? 3 : 2);
 
 	if (usesLibuv) {
@@ -319,6 +360,12 @@ BackgroundEventLoop::~BackgroundEventLoop() {
 	if (ev_is_active(&priv->exitSignaller)) {
 		ev_async_stop(libev_loop, &priv->exitSignaller);
 	}
+	if (ev_is_active(&priv->iterationStartWatcher)) {
+		ev_check_stop(libev_loop, &priv->iterationStartWatcher);
+	}
+	if (ev_is_active(&priv->iterationEndWatcher)) {
+		ev_prepare_stop(libev_loop, &priv->iterationEndWatcher);
+	}
 	uv_barrier_destroy(&priv->startBarrier);
 	delete priv;
 }
@@ -327,6 +374,8 @@ void
 BackgroundEventLoop::start(const string &threadName, unsigned int stackSize) {
 	assert(priv->thr == NULL);
 	ev_async_start(libev_loop, &priv->exitSignaller);
+	ev_check_start(libev_loop, &priv->iterationStartWatcher);
+	ev_prepare_start(libev_loop, &priv->iterationEndWatcher);
 	if (priv->usesLibuv) {
 		ev_async_start(libev_loop, &priv->libuvActivitySignaller);
 	}
@@ -370,5 +419,19 @@ BackgroundEventLoop::getNativeHandle() const {
 	return priv->thr->native_handle();
 }
 
+unsigned long long
+BackgroundEventLoop::getIterationStartTime() const {
+	return priv->iterationStartTime.load(boost::memory_order_relaxed);
+}
+
+string
+BackgroundEventLoop::getBacktrace() const {
+	if (priv->thr != NULL) {
+		return priv->thr->backtrace();
+	} else {
+		return string();
+	}
+}
+
 
 } // namespace Passenger
@@ -58,6 +58,22 @@ namespace Passenger {
 		void stop();
 		bool isStarted() const;
 		pthread_t getNativeHandle() const;
+
+		/**
+		 * Returns the monotonic time (in microseconds) at which the event loop
+		 * thread woke up to process the events that it is currently processing,
+		 * or 0 if it is waiting for events. May be called from any thread.
+		 * A large difference between this value and the current time means
+		 * that the event loop thread is blocked.
+		 */
+		unsigned long long getIterationStartTime() const;
+
+		/**
+		 * Returns the current backtrace (as recorded by oxt trace points) of
+		 * the event loop thread. May be called from any thread, but not
+		 * concurrently with `stop()`.
+		 */
+		string getBacktrace() const;
 	};
 
 }
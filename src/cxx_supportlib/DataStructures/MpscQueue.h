@@ -0,0 +1,130 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_DATA_STRUCTURES_MPSC_QUEUE_H_
+#define _PASSENGER_DATA_STRUCTURES_MPSC_QUEUE_H_
+
+#include <boost/atomic.hpp>
+#include <sched.h>
+#include <cstddef>
+
+namespace Passenger {
+
+
+/**
+ * An intrusive, unbounded, lock-free multi-producer single-consumer queue,
+ * after Dmitry Vyukov's design. Any number of threads may push() concurrently,
+ * but only one thread at a time may pop().
+ *
+ * `Node` must be default constructible and must have a public member
+ * `boost::atomic<Node *> mpscNext`. The queue does not own the nodes: a node
+ * may be reused or freed as soon as pop() has returned it.
+ *
+ * push() is wait-free. pop() is lock-free, except that it briefly spins when
+ * it runs into a producer that has been interrupted between its two steps;
+ * those steps are only a few instructions apart.
+ */
+template<typename Node>
+class MpscQueue {
+private:
+	boost::atomic<Node *> head;
+	Node *tail;
+	Node stub;
+
+	static Node *waitForNext(Node *node) {
+		Node *next;
+		while ((next = node->mpscNext.load(boost::memory_order_acquire)) == NULL) {
+			sched_yield();
+		}
+		return next;
+	}
+
+	// Disable copying.
+	MpscQueue(const MpscQueue &);
+	MpscQueue &operator=(const MpscQueue &);
+
+public:
+	MpscQueue()
+		: head(&stub),
+		  tail(&stub)
+	{
+		stub.mpscNext.store(NULL, boost::memory_order_relaxed);
+	}
+
+	void push(Node *node) {
+		node->mpscNext.store(NULL, boost::memory_order_relaxed);
+		Node *prev = head.exchange(node, boost::memory_order_seq_cst);
+		prev->mpscNext.store(node, boost::memory_order_release);
+	}
+
+	/**
+	 * Returns the oldest node, or NULL if the queue is empty. Nodes that
+	 * have been pushed before this call started are guaranteed to be seen.
+	 * May only be called by the consumer thread.
+	 */
+	Node *pop() {
+		Node *tail = this->tail;
+		Node *next = tail->mpscNext.load(boost::memory_order_acquire);
+
+		if (tail == &stub) {
+			if (next == NULL) {
+				if (head.load(boost::memory_order_seq_cst) == &stub) {
+					return NULL;
+				}
+				next = waitForNext(tail);
+			}
+			this->tail = next;
+			tail = next;
+			next = tail->mpscNext.load(boost::memory_order_acquire);
+		}
+
+		if (next == NULL) {
+			// `tail` is the last node, unless a producer is busy
+			// appending to it. Append the stub so that `tail` can
+			// be handed out while the queue stays well-formed.
+			if (head.load(boost::memory_order_seq_cst) == tail) {
+				push(&stub);
+			}
+			next = waitForNext(tail);
+		}
+
+		this->tail = next;
+		return tail;
+	}
+
+	/**
+	 * Returns whether the queue is empty. Only meaningful when called
+	 * by the consumer thread.
+	 */
+	bool empty() const {
+		return tail == &stub
+			&& head.load(boost::memory_order_seq_cst) == &stub;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_DATA_STRUCTURES_MPSC_QUEUE_H_ */
@@ -0,0 +1,296 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_EVENT_LOOP_STALL_DETECTOR_H_
+#define _PASSENGER_EVENT_LOOP_STALL_DETECTOR_H_
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/backtrace.hpp>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <cassert>
+#include <jsoncpp/json.h>
+#include <BackgroundEventLoop.h>
+#include <Algorithms/LatencyHistogram.h>
+#include <LoggingKit/LoggingKit.h>
+#include <SystemTools/SystemTime.h>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * Watches a number of BackgroundEventLoops from a separate thread, and
+ * detects when one of them is blocked, i.e. when it has been busy with
+ * a single loop iteration for longer than a threshold. This happens when
+ * an event loop thread makes a blocking call, e.g. a blocking connect(),
+ * a slow write to a log file or a wait for a contended lock.
+ *
+ * When a stall is detected, the detector logs a warning with the oxt
+ * backtrace of the blocked thread. When the stall is over, its duration
+ * is recorded in a histogram. The most recent stalls, including their
+ * backtraces, can be inspected with `inspectStateAsJson()`.
+ *
+ * The event loops themselves only publish the time at which their current
+ * iteration started (see BackgroundEventLoop::getIterationStartTime()),
+ * so there is no overhead on the event loop threads beyond that. Stall
+ * durations are measured with the precision of the sampling interval,
+ * which is a quarter of the threshold.
+ */
+class EventLoopStallDetector {
+public:
+	static const unsigned int MAX_RECENT_STALLS = 16;
+
+private:
+	struct Stall {
+		string loopName;
+		unsigned long long startTime; // Wall clock time, usec
+		MonotonicTimeUsec duration;
+		string backtrace;
+		bool inProgress;
+	};
+
+	struct Loop {
+		string name;
+		BackgroundEventLoop *bgloop;
+		/** Iteration start time of the current stall, or 0 if not stalled. */
+		MonotonicTimeUsec stallIterationStartTime;
+		/** The largest lag observed during the current stall. */
+		MonotonicTimeUsec stallLag;
+		/** Index into `recentStalls`, counted from the first stall ever. */
+		unsigned long long stallNumber;
+		unsigned long long stallCount;
+		LatencyHistogram durations;
+	};
+
+	const MonotonicTimeUsec threshold;
+	oxt::thread *thr;
+
+	mutable boost::mutex syncher;
+	vector<Loop> loops;
+	deque<Stall> recentStalls;
+	unsigned long long totalStalls;
+
+	void threadMain() {
+		TRACE_POINT();
+		boost::chrono::microseconds interval(std::max<MonotonicTimeUsec>(
+			threshold / 4, 1000));
+		while (!boost::this_thread::interruption_requested()) {
+			UPDATE_TRACE_POINT();
+			check(SystemTime::getMonotonicUsecWithGranularity<SystemTime::GRAN_1MSEC>());
+			boost::this_thread::sleep_for(interval);
+		}
+	}
+
+	Stall *lookupRecentStall(unsigned long long stallNumber) {
+		unsigned long long oldest = totalStalls - recentStalls.size();
+		if (stallNumber >= oldest) {
+			return &recentStalls[stallNumber - oldest];
+		} else {
+			return NULL;
+		}
+	}
+
+	void beginStall(Loop &loop, MonotonicTimeUsec iterationStartTime, MonotonicTimeUsec lag) {
+		// Capture the backtrace as soon as possible, while the
+		// thread is still blocked at the same place.
+		string backtrace = loop.bgloop->getBacktrace();
+
+		loop.stallIterationStartTime = iterationStartTime;
+		loop.stallLag = lag;
+		loop.stallNumber = totalStalls;
+		loop.stallCount++;
+		totalStalls++;
+
+		Stall stall;
+		stall.loopName = loop.name;
+		stall.startTime = SystemTime::getUsec() - lag;
+		stall.duration = lag;
+		stall.backtrace = backtrace;
+		stall.inProgress = true;
+		recentStalls.push_back(stall);
+		if (recentStalls.size() > MAX_RECENT_STALLS) {
+			recentStalls.pop_front();
+		}
+
+		P_WARN("Event loop '" << loop.name << "' has been blocked for "
+			<< (lag / 1000) << " msec. Backtrace of its thread:\n" << backtrace);
+	}
+
+	void endStall(Loop &loop) {
+		Stall *stall = lookupRecentStall(loop.stallNumber);
+
+		loop.durations.record(loop.stallLag);
+		if (stall != NULL) {
+			stall->duration = loop.stallLag;
+			stall->inProgress = false;
+		}
+		P_INFO("Event loop '" << loop.name << "' is no longer blocked. It was blocked for at least "
+			<< (loop.stallLag / 1000) << " msec");
+		loop.stallIterationStartTime = 0;
+		loop.stallLag = 0;
+	}
+
+	static Json::Value inspectHistogramAsJson(const LatencyHistogram &histogram) {
+		Json::Value doc;
+		doc["count"] = (Json::UInt64) histogram.getCount();
+		doc["sum_usec"] = (Json::UInt64) histogram.getSum();
+		doc["max_usec"] = (Json::UInt64) histogram.getMax();
+		doc["p50_usec"] = (Json::UInt64) histogram.valueAtPercentile(50);
+		doc["p90_usec"] = (Json::UInt64) histogram.valueAtPercentile(90);
+		doc["p99_usec"] = (Json::UInt64) histogram.valueAtPercentile(99);
+		return doc;
+	}
+
+	// Disable copying.
+	EventLoopStallDetector(const EventLoopStallDetector &);
+	EventLoopStallDetector &operator=(const EventLoopStallDetector &);
+
+public:
+	/**
+	 * @param thresholdMsec An event loop is considered blocked when a
+	 *                      single loop iteration takes at least this long.
+	 */
+	EventLoopStallDetector(unsigned int thresholdMsec)
+		: threshold(thresholdMsec * 1000ull),
+		  thr(NULL),
+		  totalStalls(0)
+		{ }
+
+	~EventLoopStallDetector() {
+		stop();
+	}
+
+	/**
+	 * Adds an event loop to watch. May only be called before `start()`.
+	 * The event loop must stay alive until the detector has been stopped.
+	 */
+	void addEventLoop(const string &name, BackgroundEventLoop *bgloop) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		Loop loop;
+		loop.name = name;
+		loop.bgloop = bgloop;
+		loop.stallIterationStartTime = 0;
+		loop.stallLag = 0;
+		loop.stallNumber = 0;
+		loop.stallCount = 0;
+		loops.push_back(loop);
+	}
+
+	void start() {
+		assert(thr == NULL);
+		thr = new oxt::thread(
+			boost::bind(&EventLoopStallDetector::threadMain, this),
+			"Event loop stall detector",
+			1024 * 128
+		);
+	}
+
+	/**
+	 * Stops the detector thread. Must be called before any of the
+	 * watched event loops are stopped.
+	 */
+	void stop() {
+		if (thr != NULL) {
+			thr->interrupt_and_join();
+			delete thr;
+			thr = NULL;
+		}
+	}
+
+	/**
+	 * Samples all watched event loops once. Called periodically by the
+	 * detector thread; only public for the purpose of unit tests.
+	 */
+	void check(MonotonicTimeUsec now) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		vector<Loop>::iterator it, end = loops.end();
+
+		for (it = loops.begin(); it != end; it++) {
+			Loop &loop = *it;
+			MonotonicTimeUsec iterationStartTime = loop.bgloop->getIterationStartTime();
+			MonotonicTimeUsec lag = (iterationStartTime != 0 && now > iterationStartTime)
+				? now - iterationStartTime
+				: 0;
+
+			if (loop.stallIterationStartTime != 0
+			 && loop.stallIterationStartTime != iterationStartTime)
+			{
+				endStall(loop);
+			}
+			if (lag >= threshold && threshold > 0) {
+				if (loop.stallIterationStartTime == 0) {
+					beginStall(loop, iterationStartTime, lag);
+				} else {
+					loop.stallLag = lag;
+				}
+			}
+		}
+	}
+
+	Json::Value inspectStateAsJson() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		Json::Value doc;
+		Json::Value loopsDoc(Json::objectValue);
+		Json::Value recentDoc(Json::arrayValue);
+		vector<Loop>::const_iterator it, end = loops.end();
+		deque<Stall>::const_reverse_iterator sit, send = recentStalls.rend();
+
+		doc["threshold_msec"] = (Json::UInt64) (threshold / 1000);
+		doc["total_stalls"] = (Json::UInt64) totalStalls;
+
+		for (it = loops.begin(); it != end; it++) {
+			Json::Value loopDoc;
+			loopDoc["stalls"] = (Json::UInt64) it->stallCount;
+			loopDoc["stalled"] = it->stallIterationStartTime != 0;
+			loopDoc["durations"] = inspectHistogramAsJson(it->durations);
+			loopsDoc[it->name] = loopDoc;
+		}
+		doc["event_loops"] = loopsDoc;
+
+		for (sit = recentStalls.rbegin(); sit != send; sit++) {
+			Json::Value stallDoc;
+			stallDoc["event_loop"] = sit->loopName;
+			stallDoc["started_at"] = (Json::UInt64) (sit->startTime / 1000000);
+			stallDoc["duration_usec"] = (Json::UInt64) sit->duration;
+			stallDoc["in_progress"] = sit->inProgress;
+			stallDoc["backtrace"] = sit->backtrace;
+			recentDoc.append(stallDoc);
+		}
+		doc["recent_stalls"] = recentDoc;
+
+		return doc;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_EVENT_LOOP_STALL_DETECTOR_H_ */
@@ -294,6 +294,32 @@ public:
 	}
 };
 
+/**
+ * Indicates that a Pool::get() or Pool::asyncGet() request was denied because
+ * it sat in the getWaitlist queue for longer than the configured maximum
+ * queue time.
+ */
+class RequestQueueTimeoutException: public GetAbortedException {
+private:
+	string msg;
+
+public:
+	RequestQueueTimeoutException(unsigned int maxQueueTime)
+		: GetAbortedException(oxt::tracable_exception::no_backtrace())
+		{
+			stringstream str;
+			str << "Request queue time exceeded (configured max. time: " <<
+				maxQueueTime << " sec)";
+			msg = str.str();
+		}
+
+	virtual ~RequestQueueTimeoutException() throw() {}
+
+	virtual const char *what() const throw() {
+		return msg.c_str();
+	}
+};
+
 /**
  * Indicates that a specified argument is incorrect or violates a requirement.
  *
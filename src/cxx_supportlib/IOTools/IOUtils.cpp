@@ -1287,6 +1287,50 @@ writeFileDescriptor(int fd, int fdToSend, unsigned long long *timeout) {
 	}
 }
 
+ssize_t
+sendWithFileDescriptor(int fd, const char *data, size_t size, int fdToSend) {
+	struct msghdr msg;
+	struct iovec vec;
+	#if defined(__APPLE__) || defined(__SOLARIS__) || defined(__arm__)
+		struct {
+			struct cmsghdr header;
+			int fd;
+		} control_data;
+	#else
+		char control_data[CMSG_SPACE(sizeof(int))];
+	#endif
+	struct cmsghdr *control_header;
+	ssize_t ret;
+
+	memset(&msg, 0, sizeof(msg));
+	memset(&control_data, 0, sizeof(control_data));
+
+	vec.iov_base   = (void *) data;
+	vec.iov_len    = size;
+	msg.msg_iov    = &vec;
+	msg.msg_iovlen = 1;
+
+	msg.msg_control    = (caddr_t) &control_data;
+	msg.msg_controllen = sizeof(control_data);
+	msg.msg_flags      = 0;
+
+	control_header = CMSG_FIRSTHDR(&msg);
+	control_header->cmsg_level = SOL_SOCKET;
+	control_header->cmsg_type  = SCM_RIGHTS;
+	#if defined(__APPLE__) || defined(__SOLARIS__) || defined(__arm__)
+		control_header->cmsg_len = sizeof(control_data);
+		control_data.fd = fdToSend;
+	#else
+		control_header->cmsg_len = CMSG_LEN(sizeof(int));
+		memcpy(CMSG_DATA(control_header), &fdToSend, sizeof(int));
+	#endif
+
+	do {
+		ret = ::sendmsg(fd, &msg, 0);
+	} while (ret == -1 && errno == EINTR);
+	return ret;
+}
+
 void
 readPeerCredentials(int sock, uid_t *uid, gid_t *gid) {
 	union {
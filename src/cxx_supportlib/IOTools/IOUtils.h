@@ -616,6 +616,19 @@ int readFileDescriptor(int fd, unsigned long long *timeout = NULL);
  */
 void writeFileDescriptor(int fd, int fdToSend, unsigned long long *timeout = NULL);
 
+/**
+ * Writes up to `size` bytes of `data` to the Unix socket `fd` with a single
+ * sendmsg() call, and passes `fdToSend` along with the first written byte.
+ * This does not block if `fd` is non-blocking, and the file descriptor is only
+ * passed if at least one byte could be written. Unlike writeFileDescriptor(),
+ * this is meant for protocols in which the receiver expects a file descriptor
+ * at a known position in the stream, so no dummy byte is sent.
+ *
+ * @return The number of bytes written, or -1 if an error occurred, in which
+ *         case errno is set.
+ */
+ssize_t sendWithFileDescriptor(int fd, const char *data, size_t size, int fdToSend);
+
 /**
  * Return the effective UID and GID of the peer connected to a Unix domain socket.
  *
@@ -23,6 +23,9 @@
 #include <oxt/backtrace.hpp>
 #include <algorithm>
 #include <ostream>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <stdint.h>
 #include <MemoryKit/mbuf.h>
 #include <LoggingKit/LoggingKit.h>
 #include <StaticString.h>
@@ -61,7 +64,8 @@ _mbuf_block_mark_as_active(struct mbuf_pool *pool, struct mbuf_block *mbuf_block
 }
 
 static struct mbuf_block *
-_mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset)
+_mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset,
+	unsigned int size_class, boost::uint8_t flags)
 {
 	struct mbuf_block *mbuf_block;
 
@@ -73,14 +77,14 @@ _mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset)
 	 * mbuf_block header is at the tail end of the mbuf_block. The data
 	 * precedes the header. This enables us to catch buffer overrun early
 	 * by asserting on the magic value during get or put operations.
-	 * All normal mbuf_blocks in a pool have the same mbuf_block_offset,
-	 * allowing them to be reused through a freelist.
+	 * All normal mbuf_blocks in a size class have the same mbuf_block_offset,
+	 * allowing them to be reused through the size class's freelist.
 	 *
-	 *   <------------ pool->mbuf_block_chunk_size -------------->
+	 *   <------------ class->mbuf_block_chunk_size ------------->
 	 *   +-------------------------------------------------------+
 	 *   |       mbuf_block data          |  mbuf_block header   |
 	 *   |                                |                      |
-	 *   |  (pool->mbuf_block_offset)     | (struct mbuf_block)  |
+	 *   |  (class->mbuf_block_offset)    | (struct mbuf_block)  |
 	 *   +-------------------------------------------------------+
 	 *   ^                                ^
 	 *   |                                |
@@ -112,6 +116,8 @@ _mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset)
 	 */
 	mbuf_block = (struct mbuf_block *)(buf + block_offset);
 	mbuf_block->magic = MBUF_BLOCK_MAGIC;
+	mbuf_block->size_class = size_class;
+	mbuf_block->flags = flags;
 	mbuf_block->pool  = pool;
 	mbuf_block->offset = 0;
 
@@ -119,50 +125,177 @@ _mbuf_block_init(struct mbuf_pool *pool, char *buf, size_t block_offset)
 	return mbuf_block;
 }
 
+static inline struct mbuf_slab *
+_mbuf_slab_of(struct mbuf_block *mbuf_block)
+{
+	return (struct mbuf_slab *) ((uintptr_t) mbuf_block & ~((uintptr_t) MBUF_SLAB_SIZE - 1));
+}
+
+static bool
+_mbuf_size_class_uses_slabs(struct mbuf_pool *pool, struct mbuf_size_class *cls)
+{
+	// Don't bother with slabs for size classes so large that only a
+	// few blocks would fit in a slab.
+	return pool->use_slabs
+		&& cls->mbuf_block_chunk_size <= (MBUF_SLAB_SIZE - MBUF_SLAB_HSIZE) / 8;
+}
+
+static struct mbuf_slab *
+_mbuf_slab_new(struct mbuf_pool *pool, unsigned int size_class)
+{
+	struct mbuf_size_class *cls = &pool->size_classes[size_class];
+	struct mbuf_slab *slab;
+	char *mem, *aligned;
+
+	/* Slabs are aligned on their size, so that the slab containing
+	 * a block can be found by just masking the block's address.
+	 * Over-allocate and unmap the unaligned head and tail.
+	 */
+	mem = (char *) mmap(NULL, 2 * MBUF_SLAB_SIZE, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANON, -1, 0);
+	if (OXT_UNLIKELY(mem == (char *) MAP_FAILED)) {
+		return NULL;
+	}
+	aligned = (char *) (((uintptr_t) mem + MBUF_SLAB_SIZE - 1)
+		& ~((uintptr_t) MBUF_SLAB_SIZE - 1));
+	if (aligned > mem) {
+		munmap(mem, aligned - mem);
+	}
+	munmap(aligned + MBUF_SLAB_SIZE, mem + 2 * MBUF_SLAB_SIZE - (aligned + MBUF_SLAB_SIZE));
+
+	#ifdef MADV_HUGEPAGE
+		if (pool->use_huge_pages) {
+			// Only a hint; the kernel may not support transparent huge pages.
+			madvise(aligned, MBUF_SLAB_SIZE, MADV_HUGEPAGE);
+		}
+	#endif
+
+	slab = (struct mbuf_slab *) aligned;
+	slab->magic = MBUF_SLAB_MAGIC;
+	slab->size_class = size_class;
+	slab->nchunks = (MBUF_SLAB_SIZE - MBUF_SLAB_HSIZE) / cls->mbuf_block_chunk_size;
+	slab->ncarved = 0;
+	slab->nfree = 0;
+	slab->releasing = false;
+	TAILQ_INSERT_TAIL(&cls->slabs, slab, next);
+	cls->nslabs++;
+	return slab;
+}
+
+static void
+_mbuf_slab_free(struct mbuf_pool *pool, struct mbuf_slab *slab)
+{
+	struct mbuf_size_class *cls = &pool->size_classes[slab->size_class];
+
+	assert(slab->magic == MBUF_SLAB_MAGIC);
+	assert(slab->nfree == slab->ncarved);
+
+	TAILQ_REMOVE(&cls->slabs, slab, next);
+	if (cls->carving_slab == slab) {
+		cls->carving_slab = NULL;
+	}
+	cls->nslabs--;
+	munmap((void *) slab, MBUF_SLAB_SIZE);
+}
+
+/*
+ * Carve a new chunk out of a slab. Chunks are carved lazily so that
+ * memory that is never used is never touched either.
+ */
+static char *
+_mbuf_slab_carve(struct mbuf_pool *pool, unsigned int size_class)
+{
+	struct mbuf_size_class *cls = &pool->size_classes[size_class];
+	struct mbuf_slab *slab = cls->carving_slab;
+	char *buf;
+
+	if (slab == NULL || slab->ncarved == slab->nchunks) {
+		slab = _mbuf_slab_new(pool, size_class);
+		if (OXT_UNLIKELY(slab == NULL)) {
+			return NULL;
+		}
+		cls->carving_slab = slab;
+	}
+
+	buf = (char *) slab + MBUF_SLAB_HSIZE + slab->ncarved * cls->mbuf_block_chunk_size;
+	slab->ncarved++;
+	return buf;
+}
+
 static struct mbuf_block *
-_mbuf_block_get(struct mbuf_pool *pool)
+_mbuf_block_get(struct mbuf_pool *pool, unsigned int size_class)
 {
+	struct mbuf_size_class *cls = &pool->size_classes[size_class];
 	struct mbuf_block *mbuf_block;
 	char *buf;
 
-	if (!STAILQ_EMPTY(&pool->free_mbuf_blockq)) {
-		assert(pool->nfree_mbuf_blockq > 0);
+	if (!STAILQ_EMPTY(&cls->free_mbuf_blockq)) {
+		assert(cls->nfree_mbuf_blockq > 0);
 
-		mbuf_block = STAILQ_FIRST(&pool->free_mbuf_blockq);
+		mbuf_block = STAILQ_FIRST(&cls->free_mbuf_blockq);
 		ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->magic == MBUF_BLOCK_MAGIC);
 		ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->refcount == 0);
+		ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->size_class == size_class);
 
+		cls->nfree_mbuf_blockq--;
 		pool->nfree_mbuf_blockq--;
-		STAILQ_REMOVE_HEAD(&pool->free_mbuf_blockq, next);
+		STAILQ_REMOVE_HEAD(&cls->free_mbuf_blockq, next);
+		if (mbuf_block->flags & MBUF_BLOCK_FLAG_IN_SLAB) {
+			_mbuf_slab_of(mbuf_block)->nfree--;
+		}
 		_mbuf_block_mark_as_active(pool, mbuf_block);
+		cls->nactive_mbuf_blockq++;
 		return mbuf_block;
 	}
 
-	buf = (char *) malloc(pool->mbuf_block_chunk_size);
+	if (_mbuf_size_class_uses_slabs(pool, cls)) {
+		buf = _mbuf_slab_carve(pool, size_class);
+		if (OXT_LIKELY(buf != NULL)) {
+			mbuf_block = _mbuf_block_init(pool, buf, cls->mbuf_block_offset,
+				size_class, MBUF_BLOCK_FLAG_IN_SLAB);
+			cls->nactive_mbuf_blockq++;
+			return mbuf_block;
+		}
+		// Fall back to malloc() if mmap() fails.
+	}
+
+	buf = (char *) malloc(cls->mbuf_block_chunk_size);
 	if (OXT_UNLIKELY(buf == NULL)) {
 		return NULL;
 	}
 
-	return _mbuf_block_init(pool, buf, pool->mbuf_block_offset);
+	mbuf_block = _mbuf_block_init(pool, buf, cls->mbuf_block_offset, size_class, 0);
+	cls->nactive_mbuf_blockq++;
+	return mbuf_block;
 }
 
 struct mbuf_block *
 mbuf_block_get(struct mbuf_pool *pool)
 {
+	return mbuf_block_get_from_size_class(pool, 0);
+}
+
+struct mbuf_block *
+mbuf_block_get_from_size_class(struct mbuf_pool *pool, unsigned int size_class)
+{
+	struct mbuf_size_class *cls;
 	struct mbuf_block *mbuf_block;
 	char *buf;
 
-	mbuf_block = _mbuf_block_get(pool);
+	assert(size_class < pool->nsize_classes);
+	cls = &pool->size_classes[size_class];
+
+	mbuf_block = _mbuf_block_get(pool, size_class);
 	if (OXT_UNLIKELY(mbuf_block == NULL)) {
 		return NULL;
 	}
 
-	buf = (char *)mbuf_block - pool->mbuf_block_offset;
+	buf = (char *)mbuf_block - cls->mbuf_block_offset;
 	mbuf_block->start = buf;
-	mbuf_block->end = buf + pool->mbuf_block_offset;
+	mbuf_block->end = buf + cls->mbuf_block_offset;
 
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block,
-		mbuf_block->end - mbuf_block->start == (int) pool->mbuf_block_offset);
+		mbuf_block->end - mbuf_block->start == (int) cls->mbuf_block_offset);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->start < mbuf_block->end);
 
 	#ifdef MBUF_DEBUG_REFCOUNTS
@@ -185,7 +318,7 @@ mbuf_block_new_standalone(struct mbuf_pool *pool, size_t size)
 		return NULL;
 	}
 
-	mbuf_block = _mbuf_block_init(pool, buf, block_offset);
+	mbuf_block = _mbuf_block_init(pool, buf, block_offset, 0, 0);
 	mbuf_block->start = buf;
 	mbuf_block->end = buf + size;
 	mbuf_block->offset = block_offset;
@@ -213,6 +346,7 @@ mbuf_block_free(struct mbuf_block *mbuf_block)
 
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, STAILQ_NEXT(mbuf_block, next) == NULL);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->magic == MBUF_BLOCK_MAGIC);
+	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, !(mbuf_block->flags & MBUF_BLOCK_FLAG_IN_SLAB));
 
 	#ifdef MBUF_ENABLE_DEBUGGING
 		TAILQ_REMOVE(&mbuf_block->pool->active_mbuf_blockq, mbuf_block, active_q);
@@ -224,7 +358,8 @@ mbuf_block_free(struct mbuf_block *mbuf_block)
 	if (mbuf_block->offset > 0) {
 		buf = (char *) mbuf_block - mbuf_block->offset;
 	} else {
-		buf = (char *) mbuf_block - mbuf_block->pool->mbuf_block_offset;
+		buf = (char *) mbuf_block
+			- mbuf_block->pool->size_classes[mbuf_block->size_class].mbuf_block_offset;
 	}
 	free(buf);
 }
@@ -232,6 +367,9 @@ mbuf_block_free(struct mbuf_block *mbuf_block)
 void
 mbuf_block_put(struct mbuf_block *mbuf_block)
 {
+	struct mbuf_pool *pool = mbuf_block->pool;
+	struct mbuf_size_class *cls = &pool->size_classes[mbuf_block->size_class];
+
 	#ifdef MBUF_DEBUG_REFCOUNTS
 		printf("[%p] mbuf_block put %p\n", oxt::thread_signature, mbuf_block);
 	#endif
@@ -241,13 +379,19 @@ mbuf_block_put(struct mbuf_block *mbuf_block)
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->refcount == 0);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->pool->nactive_mbuf_blockq > 0);
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->offset == 0);
-
-	mbuf_block->pool->nfree_mbuf_blockq++;
-	mbuf_block->pool->nactive_mbuf_blockq--;
-	STAILQ_INSERT_HEAD(&mbuf_block->pool->free_mbuf_blockq, mbuf_block, next);
+	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, cls->nactive_mbuf_blockq > 0);
+
+	pool->nfree_mbuf_blockq++;
+	pool->nactive_mbuf_blockq--;
+	cls->nfree_mbuf_blockq++;
+	cls->nactive_mbuf_blockq--;
+	STAILQ_INSERT_HEAD(&cls->free_mbuf_blockq, mbuf_block, next);
+	if (mbuf_block->flags & MBUF_BLOCK_FLAG_IN_SLAB) {
+		_mbuf_slab_of(mbuf_block)->nfree++;
+	}
 
 	#ifdef MBUF_ENABLE_DEBUGGING
-		TAILQ_REMOVE(&mbuf_block->pool->active_mbuf_blockq, mbuf_block, active_q);
+		TAILQ_REMOVE(&pool->active_mbuf_blockq, mbuf_block, active_q);
 	#endif
 }
 
@@ -268,18 +412,73 @@ _mbuf_block_assert_refcount_at_least_two(struct mbuf_block *mbuf_block) {
 	ASSERT_MBUF_BLOCK_PROPERTY(mbuf_block, mbuf_block->refcount >= 2);
 }
 
+static void
+_mbuf_size_class_init(struct mbuf_size_class *cls, size_t chunk_size)
+{
+	cls->nfree_mbuf_blockq = 0;
+	cls->nactive_mbuf_blockq = 0;
+	cls->nslabs = 0;
+	STAILQ_INIT(&cls->free_mbuf_blockq);
+	TAILQ_INIT(&cls->slabs);
+	cls->carving_slab = NULL;
+	cls->mbuf_block_chunk_size = chunk_size;
+	cls->mbuf_block_offset = chunk_size - MBUF_BLOCK_HSIZE;
+}
+
 void
 mbuf_pool_init(struct mbuf_pool *pool)
 {
 	pool->nfree_mbuf_blockq = 0;
 	pool->nactive_mbuf_blockq = 0;
-	STAILQ_INIT(&pool->free_mbuf_blockq);
 
 	#ifdef MBUF_ENABLE_DEBUGGING
 		TAILQ_INIT(&pool->active_mbuf_blockq);
 	#endif
 
 	pool->mbuf_block_offset = pool->mbuf_block_chunk_size - MBUF_BLOCK_HSIZE;
+	pool->nsize_classes = 1;
+	pool->use_slabs = false;
+	pool->use_huge_pages = false;
+	_mbuf_size_class_init(&pool->size_classes[0], pool->mbuf_block_chunk_size);
+}
+
+/*
+ * Configure the number of size classes. Size class 0 has the pool's
+ * mbuf_block_chunk_size, and every next size class is MBUF_SIZE_CLASS_FACTOR
+ * times larger. May only be called right after mbuf_pool_init().
+ */
+void
+mbuf_pool_set_size_classes(struct mbuf_pool *pool, unsigned int nsize_classes)
+{
+	size_t chunk_size = pool->mbuf_block_chunk_size;
+	unsigned int i;
+
+	assert(pool->nactive_mbuf_blockq == 0);
+	assert(pool->nfree_mbuf_blockq == 0);
+
+	nsize_classes = std::max(1u, std::min<unsigned int>(nsize_classes,
+		MBUF_POOL_MAX_SIZE_CLASSES));
+	for (i = 1; i < nsize_classes; i++) {
+		chunk_size *= MBUF_SIZE_CLASS_FACTOR;
+		if (chunk_size > MBUF_BLOCK_MAX_SIZE) {
+			break;
+		}
+		_mbuf_size_class_init(&pool->size_classes[i], chunk_size);
+	}
+	pool->nsize_classes = i;
+}
+
+/*
+ * Carve blocks out of slabs instead of malloc()ing them one by one.
+ * May only be called right after mbuf_pool_init().
+ */
+void
+mbuf_pool_use_slabs(struct mbuf_pool *pool, bool use_huge_pages)
+{
+	assert(pool->nactive_mbuf_blockq == 0);
+	assert(pool->nfree_mbuf_blockq == 0);
+	pool->use_slabs = true;
+	pool->use_huge_pages = use_huge_pages;
 }
 
 void
@@ -298,18 +497,116 @@ mbuf_pool_data_size(struct mbuf_pool *pool)
 	return pool->mbuf_block_offset;
 }
 
+size_t
+mbuf_pool_size_class_data_size(struct mbuf_pool *pool, unsigned int size_class)
+{
+	assert(size_class < pool->nsize_classes);
+	return pool->size_classes[size_class].mbuf_block_offset;
+}
+
+/*
+ * Return the number of bytes held by free blocks.
+ */
+size_t
+mbuf_pool_spare_memory(const struct mbuf_pool *pool)
+{
+	size_t result = 0;
+	for (unsigned int i = 0; i < pool->nsize_classes; i++) {
+		result += pool->size_classes[i].nfree_mbuf_blockq
+			* pool->size_classes[i].mbuf_block_chunk_size;
+	}
+	return result;
+}
+
+/*
+ * Return the number of bytes held by active blocks, excluding standalone ones.
+ */
+size_t
+mbuf_pool_active_memory(const struct mbuf_pool *pool)
+{
+	size_t result = 0;
+	for (unsigned int i = 0; i < pool->nsize_classes; i++) {
+		result += pool->size_classes[i].nactive_mbuf_blockq
+			* pool->size_classes[i].mbuf_block_chunk_size;
+	}
+	return result;
+}
+
+/*
+ * Free all free blocks, as far as possible. Blocks in slabs can only be freed
+ * together with their slab, so blocks in slabs that still have active blocks
+ * stay on the freelist.
+ */
 unsigned int
 mbuf_pool_compact(struct mbuf_pool *pool)
 {
-	unsigned int count = pool->nfree_mbuf_blockq;
+	return mbuf_pool_trim(pool, 0);
+}
 
-	while (!STAILQ_EMPTY(&pool->free_mbuf_blockq)) {
-		struct mbuf_block *mbuf_block = STAILQ_FIRST(&pool->free_mbuf_blockq);
-		mbuf_block_remove(&pool->free_mbuf_blockq, mbuf_block);
-		mbuf_block_free(mbuf_block);
-		pool->nfree_mbuf_blockq--;
+/*
+ * Free free blocks, starting with the largest size class, until at most
+ * `max_spare_memory` bytes are held by free blocks or until nothing more can
+ * be freed. Returns the number of blocks freed.
+ */
+unsigned int
+mbuf_pool_trim(struct mbuf_pool *pool, size_t max_spare_memory)
+{
+	size_t spare = mbuf_pool_spare_memory(pool);
+	unsigned int count = 0;
+	unsigned int i = pool->nsize_classes;
+
+	while (i > 0 && spare > max_spare_memory) {
+		struct mbuf_size_class *cls = &pool->size_classes[--i];
+		struct mbuf_slab *slab, *next_slab;
+		struct mbuf_block *mbuf_block;
+		struct mhdr kept;
+
+		/* Decide which slabs to release. A slab can only be
+		 * released if all the blocks carved out of it are free.
+		 */
+		TAILQ_FOREACH (slab, &cls->slabs, next) {
+			if (spare > max_spare_memory && slab->nfree == slab->ncarved) {
+				slab->releasing = true;
+				spare -= std::min<size_t>(spare,
+					slab->nfree * cls->mbuf_block_chunk_size);
+			}
+		}
+
+		/* Filter the freelist, preserving the order of the
+		 * blocks that we keep.
+		 */
+		STAILQ_INIT(&kept);
+		while (!STAILQ_EMPTY(&cls->free_mbuf_blockq)) {
+			mbuf_block = STAILQ_FIRST(&cls->free_mbuf_blockq);
+			mbuf_block_remove(&cls->free_mbuf_blockq, mbuf_block);
+
+			if (mbuf_block->flags & MBUF_BLOCK_FLAG_IN_SLAB) {
+				if (_mbuf_slab_of(mbuf_block)->releasing) {
+					cls->nfree_mbuf_blockq--;
+					pool->nfree_mbuf_blockq--;
+					count++;
+				} else {
+					STAILQ_INSERT_TAIL(&kept, mbuf_block, next);
+				}
+			} else if (spare > max_spare_memory) {
+				cls->nfree_mbuf_blockq--;
+				pool->nfree_mbuf_blockq--;
+				spare -= std::min(spare, cls->mbuf_block_chunk_size);
+				mbuf_block_free(mbuf_block);
+				count++;
+			} else {
+				STAILQ_INSERT_TAIL(&kept, mbuf_block, next);
+			}
+		}
+		STAILQ_CONCAT(&cls->free_mbuf_blockq, &kept);
+
+		for (slab = TAILQ_FIRST(&cls->slabs); slab != NULL; slab = next_slab) {
+			next_slab = TAILQ_NEXT(slab, next);
+			if (slab->releasing) {
+				_mbuf_slab_free(pool, slab);
+			}
+		}
 	}
-	assert(pool->nfree_mbuf_blockq == 0);
 
 	return count;
 }
@@ -379,13 +676,29 @@ mbuf_get(struct mbuf_pool *pool)
 	return mbuf(block, 0, block->end - block->start, mbuf::just_created_t());
 }
 
+mbuf
+mbuf_get_from_size_class(struct mbuf_pool *pool, unsigned int size_class)
+{
+	struct mbuf_block *block = mbuf_block_get_from_size_class(pool, size_class);
+	if (OXT_UNLIKELY(block == NULL)) {
+		return mbuf();
+	}
+
+	ASSERT_MBUF_BLOCK_PROPERTY(block, block->refcount == 1);
+	return mbuf(block, 0, block->end - block->start, mbuf::just_created_t());
+}
+
 mbuf
 mbuf_get_with_size(struct mbuf_pool *pool, size_t size)
 {
-	struct mbuf_block *block;
-	if (size <= mbuf_pool_data_size(pool)) {
-		block = mbuf_block_get(pool);
-	} else {
+	struct mbuf_block *block = NULL;
+	for (unsigned int i = 0; i < pool->nsize_classes; i++) {
+		if (size <= pool->size_classes[i].mbuf_block_offset) {
+			block = mbuf_block_get_from_size_class(pool, i);
+			break;
+		}
+	}
+	if (block == NULL) {
 		block = mbuf_block_new_standalone(pool, size);
 	}
 	if (OXT_UNLIKELY(block == NULL)) {
@@ -408,6 +721,8 @@ mbuf_block_print(struct mbuf_block *mbuf_block, std::ostream &stream)
 			mbuf_block->end - mbuf_block->start)) << "\"\n"
 		"mbuf_block.refcount: " << mbuf_block->refcount << "\n"
 		"mbuf_block.offset: " << mbuf_block->offset << "\n"
+		"mbuf_block.size_class: " << (unsigned int) mbuf_block->size_class << "\n"
+		"mbuf_block.flags: " << (unsigned int) mbuf_block->flags << "\n"
 		"mbuf_block.pool: " << (void *) mbuf_block->pool << "\n"
 		"mbuf_block.pool.nfree_mbuf_blockq: " << mbuf_block->pool->nfree_mbuf_blockq << "\n"
 		"mbuf_block.pool.nactive_mbuf_blockq: " << mbuf_block->pool->nactive_mbuf_blockq << "\n"
@@ -54,6 +54,17 @@
  * This approach is similar to how Node.js manages buffer slices.
  * We also got rid of the global variables, and put them in an mbuf_pool
  * struct, which acts like a context structure.
+ *
+ * Furthermore, a pool can have multiple size classes (by default just one).
+ * Each size class is MBUF_SIZE_CLASS_FACTOR times larger than the previous
+ * one and has its own freelist. This allows readers that consistently fill
+ * their buffers (e.g. when proxying a large response) to read larger chunks
+ * at once, so that fewer blocks have to be allocated, refcounted and freed.
+ *
+ * Finally, a pool can carve its blocks out of MBUF_SLAB_SIZE slabs that are
+ * allocated with mmap() and that are optionally backed by transparent huge
+ * pages, instead of allocating every block with malloc(). Slabs are returned
+ * to the operating system by mbuf_pool_trim() once all their blocks are free.
  */
 
 //#define MBUF_ENABLE_DEBUGGING
@@ -67,6 +78,7 @@ using namespace boost;
 
 
 struct mbuf_block;
+struct mbuf_slab;
 struct mhdr;
 
 typedef void (*mbuf_block_copy_t)(struct mbuf_block *, void *);
@@ -74,6 +86,8 @@ typedef void (*mbuf_block_copy_t)(struct mbuf_block *, void *);
 /* See _mbuf_block_init() for format description */
 struct mbuf_block {
 	boost::uint32_t    magic;     /* mbuf_block magic (const) */
+	boost::uint8_t     size_class; /* index into pool->size_classes (const) */
+	boost::uint8_t     flags;     /* MBUF_BLOCK_FLAG_* (const) */
 	STAILQ_ENTRY(struct mbuf_block) next;         /* next free mbuf_block */
 	#ifdef MBUF_ENABLE_DEBUGGING
 		TAILQ_ENTRY(struct mbuf_block) active_q;  /* prev and next active mbuf_block */
@@ -93,16 +107,47 @@ STAILQ_HEAD(mhdr, struct mbuf_block);
 	TAILQ_HEAD(active_mbuf_block_list, struct mbuf_block);
 #endif
 
-struct mbuf_pool {
+/* Header of a slab. Blocks are carved out of the remainder of the slab. */
+struct mbuf_slab {
+	boost::uint32_t magic;      /* mbuf_slab magic (const) */
+	boost::uint32_t size_class; /* size class of the blocks in this slab (const) */
+	boost::uint32_t nchunks;    /* # blocks that fit in this slab (const) */
+	boost::uint32_t ncarved;    /* # blocks that have been carved out so far */
+	boost::uint32_t nfree;      /* # carved blocks that are on the freelist */
+	bool            releasing;  /* whether mbuf_pool_trim() is releasing this slab */
+	TAILQ_ENTRY(struct mbuf_slab) next;
+};
+
+TAILQ_HEAD(mbuf_slab_list, struct mbuf_slab);
+
+#define MBUF_POOL_MAX_SIZE_CLASSES 3
+
+struct mbuf_size_class {
 	boost::uint32_t nfree_mbuf_blockq;   /* # free mbuf_block */
 	boost::uint32_t nactive_mbuf_blockq; /* # active (non-free) mbuf_block */
-	struct mhdr free_mbuf_blockq; /* free mbuf_block q */
+	boost::uint32_t nslabs;              /* # slabs */
+	struct mhdr free_mbuf_blockq;        /* free mbuf_block q */
+	struct mbuf_slab_list slabs;         /* all slabs of this size class */
+	struct mbuf_slab *carving_slab;      /* slab that still has uncarved blocks */
+
+	size_t mbuf_block_chunk_size; /* mbuf_block chunk size - header + data (const) */
+	size_t mbuf_block_offset;     /* mbuf_block offset in chunk (const) */
+};
+
+struct mbuf_pool {
+	boost::uint32_t nfree_mbuf_blockq;   /* # free mbuf_block, in all size classes */
+	boost::uint32_t nactive_mbuf_blockq; /* # active (non-free) mbuf_block, including standalone ones */
 	#ifdef MBUF_ENABLE_DEBUGGING
 		struct active_mbuf_block_list active_mbuf_blockq; /* active mbuf_block q */
 	#endif
 
-	size_t mbuf_block_chunk_size; /* mbuf_block chunk size - header + data (const) */
-	size_t mbuf_block_offset;     /* mbuf_block offset in chunk (const) */
+	size_t mbuf_block_chunk_size; /* mbuf_block chunk size of size class 0 - header + data (const) */
+	size_t mbuf_block_offset;     /* mbuf_block offset in chunk of size class 0 (const) */
+
+	unsigned int nsize_classes;   /* # size classes (const) */
+	bool use_slabs;               /* carve blocks out of slabs (const) */
+	bool use_huge_pages;          /* advise the kernel to back slabs with huge pages (const) */
+	struct mbuf_size_class size_classes[MBUF_POOL_MAX_SIZE_CLASSES];
 };
 
 #define MBUF_BLOCK_MAGIC      0xdeadbeef
@@ -110,16 +155,29 @@ struct mbuf_pool {
 #define MBUF_BLOCK_MAX_SIZE   16777216
 #define MBUF_BLOCK_SIZE       16384
 #define MBUF_BLOCK_HSIZE      sizeof(struct mbuf_block)
+#define MBUF_BLOCK_FLAG_IN_SLAB 1
+
+#define MBUF_SIZE_CLASS_FACTOR 4
+#define MBUF_SLAB_MAGIC       0x51ab51ab
+#define MBUF_SLAB_SIZE        (2 * 1024 * 1024)
+#define MBUF_SLAB_HSIZE       ((sizeof(struct mbuf_slab) + 63) & ~((size_t) 63))
 
 #define MBUF_BLOCK_EMPTY(mbuf_block) ((mbuf_block)->pos  == (mbuf_block)->last)
 #define MBUF_BLOCK_FULL(mbuf_block)  ((mbuf_block)->last == (mbuf_block)->end)
 
 void mbuf_pool_init(struct mbuf_pool *pool);
+void mbuf_pool_set_size_classes(struct mbuf_pool *pool, unsigned int nsize_classes);
+void mbuf_pool_use_slabs(struct mbuf_pool *pool, bool use_huge_pages);
 void mbuf_pool_deinit(struct mbuf_pool *pool);
 size_t mbuf_pool_data_size(struct mbuf_pool *pool);
+size_t mbuf_pool_size_class_data_size(struct mbuf_pool *pool, unsigned int size_class);
+size_t mbuf_pool_spare_memory(const struct mbuf_pool *pool);
+size_t mbuf_pool_active_memory(const struct mbuf_pool *pool);
 unsigned int mbuf_pool_compact(struct mbuf_pool *pool);
+unsigned int mbuf_pool_trim(struct mbuf_pool *pool, size_t max_spare_memory);
 
 struct mbuf_block *mbuf_block_get(struct mbuf_pool *pool);
+struct mbuf_block *mbuf_block_get_from_size_class(struct mbuf_pool *pool, unsigned int size_class);
 void mbuf_block_put(struct mbuf_block *mbuf_block);
 
 void mbuf_block_ref(struct mbuf_block *mbuf_block);
@@ -279,6 +337,7 @@ public:
 
 mbuf mbuf_block_subset(struct mbuf_block *mbuf_block, unsigned int start, unsigned int len);
 mbuf mbuf_get(struct mbuf_pool *pool);
+mbuf mbuf_get_from_size_class(struct mbuf_pool *pool, unsigned int size_class);
 mbuf mbuf_get_with_size(struct mbuf_pool *pool, size_t size);
 
 
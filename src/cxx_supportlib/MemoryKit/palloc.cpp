@@ -128,7 +128,10 @@ psg_reset_pool(psg_pool_t *pool, size_t size)
 		}
 	}
 
-	if (pool->data.next == NULL) {
+	/* The pool can only be reused as-is if it consists of a single
+	 * block of the requested size.
+	 */
+	if (pool->data.next == NULL && (size_t) (pool->data.end - (char *) pool) == size) {
 		psg_init_pool(pool, size);
 		return true;
 	} else {
@@ -27,7 +27,7 @@
 #define _PASSENGER_SAFE_LIBEV_H_
 
 #include <ev++.h>
-#include <vector>
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <boost/thread.hpp>
@@ -35,8 +35,12 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
 #include <oxt/thread.hpp>
+#include <oxt/macros.hpp>
 #include <LoggingKit/LoggingKit.h>
+#include <DataStructures/MpscQueue.h>
 
 namespace Passenger {
 
@@ -46,24 +50,68 @@ using namespace boost;
 
 /**
  * Class for thread-safely using libev.
+ *
+ * Callbacks that are scheduled with runLater() are passed to the event loop
+ * thread through a lock-free multi-producer single-consumer queue. The queue
+ * nodes are taken from a lock-free free list of pre-allocated Command objects,
+ * so scheduling a callback does not take a lock and normally does not allocate
+ * memory, except for what boost::function needs for storing the callback.
+ * The event loop is woken up with a single ev_async_send() per batch of
+ * callbacks.
+ *
+ * The number of callbacks that may be waiting to be run is limited (see
+ * setMaxPendingCommands()). When that limit is reached, runLater() blocks
+ * until the event loop has run some of them, except on the event loop
+ * thread itself: there blocking would deadlock, so the limit is exceeded
+ * instead. Because a blocked thread waits for the event loop, it must not
+ * hold locks that callbacks on the event loop need.
  */
 class SafeLibev {
 private:
 	// 2^28-1. Command IDs are 28-bit so that we can pack DataSource's state and
 	// its planId in 32-bits total.
 	static const unsigned int MAX_COMMAND_ID = 268435455;
+	// A command ID consists of the index of the Command object in the pool
+	// (the lower COMMAND_SLOT_BITS bits) and a generation number (the upper
+	// 8 bits) that changes every time the Command object is reused, so that
+	// cancelCommand() does not cancel a newer command by accident.
+	// The generation number is never 0, so neither is the command ID.
+	static const unsigned int COMMAND_SLOT_BITS = 20;
+	static const unsigned int COMMAND_SLOT_MASK = (1 << COMMAND_SLOT_BITS) - 1;
+	static const unsigned int COMMAND_CHUNK_BITS = 8;
+	static const unsigned int COMMAND_CHUNK_SIZE = 1 << COMMAND_CHUNK_BITS;
+	static const unsigned int MAX_COMMAND_CHUNKS = 1 << (COMMAND_SLOT_BITS - COMMAND_CHUNK_BITS);
+	static const boost::uint32_t NO_COMMAND_SLOT = 0xFFFFFFFF;
 
 	typedef boost::function<void ()> Callback;
 
+	enum CommandState {
+		CS_FREE,
+		CS_PENDING,
+		CS_CANCELED,
+		CS_RUNNING
+	};
+
 	struct Command {
+		boost::atomic<Command *> mpscNext;
+		Command *batchNext;
+		// Slot of the next Command in the free list.
+		boost::atomic<boost::uint32_t> freeNext;
+		// (command ID << 2) | CommandState. Changing the state with a
+		// compare-and-swap on the whole tag makes sure that a stale
+		// command ID cannot affect a reused Command object.
+		boost::atomic<boost::uint32_t> tag;
 		Callback callback;
-		unsigned int id: 31;
-		bool canceled: 1;
-
-		Command(unsigned int _id, const Callback &_callback)
-			: callback(_callback),
-			  id(_id),
-			  canceled(false)
+		boost::uint32_t slot;
+		boost::uint8_t generation;
+
+		Command()
+			: mpscNext(NULL),
+			  batchNext(NULL),
+			  freeNext(NO_COMMAND_SLOT),
+			  tag(CS_FREE),
+			  slot(0),
+			  generation(0)
 			{ }
 	};
 
@@ -73,8 +121,26 @@ private:
 
 	boost::mutex syncher;
 	boost::condition_variable cond;
-	vector<Command> commands;
-	unsigned int nextCommandId;
+
+	MpscQueue<Command> commands;
+	// Whether ev_async_send() has been called for commands that
+	// runCommands() hasn't picked up yet.
+	boost::atomic<bool> asyncPending;
+	// Free list of Command objects: the lower 32 bits contain the slot of
+	// the first Command, the upper 32 bits contain a counter that is
+	// increased on every change in order to prevent the ABA problem.
+	boost::atomic<boost::uint64_t> freeCommands;
+	boost::atomic<Command *> commandChunks[MAX_COMMAND_CHUNKS];
+	// Protected by `commandChunksSyncher`.
+	unsigned int commandChunkCount;
+	unsigned int maxCommandChunks;
+	boost::mutex commandChunksSyncher;
+
+	// Number of threads that are blocked in runLater() until the event loop
+	// frees some Command objects. Such threads wait on `commandsFreed`.
+	boost::atomic<unsigned int> waitingProducers;
+	boost::mutex commandsFreedSyncher;
+	boost::condition_variable commandsFreed;
 
 	static void asyncHandler(EV_P_ ev_async *w, int revents) {
 		SafeLibev *self = (SafeLibev *) w->data;
@@ -86,16 +152,155 @@ private:
 		(*callback)();
 	}
 
+	static boost::uint32_t makeTag(unsigned int id, CommandState state) {
+		return (id << 2) | state;
+	}
+
+	Command *lookupCommand(boost::uint32_t slot) const {
+		Command *chunk = commandChunks[slot >> COMMAND_CHUNK_BITS].load(
+			boost::memory_order_acquire);
+		if (chunk == NULL) {
+			return NULL;
+		} else {
+			return &chunk[slot & (COMMAND_CHUNK_SIZE - 1)];
+		}
+	}
+
+	/**
+	 * Adds a chunk of Command objects to the free list. Returns false if
+	 * that isn't possible because the limit has been reached. If
+	 * `ignoreLimit` is true then only the size of `commandChunks` limits
+	 * the number of chunks.
+	 */
+	bool addCommandChunk(bool ignoreLimit = false) {
+		boost::lock_guard<boost::mutex> l(commandChunksSyncher);
+		if ((boost::uint32_t) freeCommands.load(boost::memory_order_acquire) != NO_COMMAND_SLOT) {
+			// Another thread has added a chunk in the mean time.
+			return true;
+		}
+		if (commandChunkCount >= (ignoreLimit ? MAX_COMMAND_CHUNKS : maxCommandChunks)) {
+			return false;
+		}
+
+		Command *chunk = new Command[COMMAND_CHUNK_SIZE];
+		boost::uint32_t firstSlot = commandChunkCount * COMMAND_CHUNK_SIZE;
+		for (unsigned int i = 0; i < COMMAND_CHUNK_SIZE; i++) {
+			chunk[i].slot = firstSlot + i;
+			if (i < COMMAND_CHUNK_SIZE - 1) {
+				chunk[i].freeNext.store(firstSlot + i + 1, boost::memory_order_relaxed);
+			}
+		}
+		commandChunks[commandChunkCount].store(chunk, boost::memory_order_release);
+		commandChunkCount++;
+
+		Command *last = &chunk[COMMAND_CHUNK_SIZE - 1];
+		boost::uint64_t head = freeCommands.load(boost::memory_order_relaxed);
+		boost::uint64_t newHead;
+		do {
+			last->freeNext.store((boost::uint32_t) head, boost::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | firstSlot;
+		} while (!freeCommands.compare_exchange_weak(head, newHead,
+			boost::memory_order_release, boost::memory_order_relaxed));
+		return true;
+	}
+
+	void waitForFreeCommands() {
+		waitingProducers.fetch_add(1, boost::memory_order_seq_cst);
+		{
+			boost::unique_lock<boost::mutex> l(commandsFreedSyncher);
+			while ((boost::uint32_t) freeCommands.load(boost::memory_order_seq_cst)
+				== NO_COMMAND_SLOT)
+			{
+				commandsFreed.wait(l);
+			}
+		}
+		waitingProducers.fetch_sub(1, boost::memory_order_seq_cst);
+	}
+
+	/**
+	 * Takes a Command object from the free list. If the limit has been
+	 * reached, then either waits until the event loop frees one, or, if
+	 * `wait` is false, exceeds the limit. Only returns NULL if `wait` is
+	 * false and the command ID space is exhausted.
+	 */
+	Command *allocateCommand(bool wait) {
+		boost::uint64_t head = freeCommands.load(boost::memory_order_acquire);
+		while (true) {
+			boost::uint32_t slot = (boost::uint32_t) head;
+			if (OXT_UNLIKELY(slot == NO_COMMAND_SLOT)) {
+				if (!addCommandChunk(!wait)) {
+					if (!wait) {
+						return NULL;
+					}
+					waitForFreeCommands();
+				}
+				head = freeCommands.load(boost::memory_order_acquire);
+				continue;
+			}
+
+			Command *command = lookupCommand(slot);
+			boost::uint64_t newHead = (((head >> 32) + 1) << 32)
+				| command->freeNext.load(boost::memory_order_relaxed);
+			if (freeCommands.compare_exchange_weak(head, newHead,
+				boost::memory_order_acquire, boost::memory_order_acquire))
+			{
+				return command;
+			}
+		}
+	}
+
+	void freeCommand(Command *command) {
+		command->callback.clear();
+		command->tag.store(CS_FREE, boost::memory_order_relaxed);
+
+		boost::uint64_t head = freeCommands.load(boost::memory_order_relaxed);
+		boost::uint64_t newHead;
+		do {
+			command->freeNext.store((boost::uint32_t) head, boost::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | command->slot;
+		} while (!freeCommands.compare_exchange_weak(head, newHead,
+			boost::memory_order_release, boost::memory_order_relaxed));
+	}
+
 	void runCommands() {
-		boost::unique_lock<boost::mutex> l(syncher);
-		vector<Command> commands = this->commands;
-		this->commands.clear();
-		l.unlock();
-
-		vector<Command>::const_iterator it, end = commands.end();
-		for (it = commands.begin(); it != end; it++) {
-			if (!it->canceled) {
-				it->callback();
+		Command *first = NULL, *last = NULL, *command;
+
+		asyncPending.store(false, boost::memory_order_seq_cst);
+
+		// Take all pending commands before running any of them, so that
+		// commands scheduled by the callbacks are run in the next event
+		// loop iteration, just like events that arrive in the mean time.
+		while ((command = commands.pop()) != NULL) {
+			command->batchNext = NULL;
+			if (last == NULL) {
+				first = command;
+			} else {
+				last->batchNext = command;
+			}
+			last = command;
+		}
+
+		command = first;
+		while (command != NULL) {
+			Command *next = command->batchNext;
+			unsigned int id = command->tag.load(boost::memory_order_acquire) >> 2;
+			boost::uint32_t expected = makeTag(id, CS_PENDING);
+			if (command->tag.compare_exchange_strong(expected, makeTag(id, CS_RUNNING),
+				boost::memory_order_acq_rel))
+			{
+				command->callback();
+			}
+			freeCommand(command);
+			command = next;
+		}
+
+		if (first != NULL) {
+			// Pairs with the increment in waitForFreeCommands(): either the
+			// producer sees the freed commands, or we see the producer.
+			boost::atomic_thread_fence(boost::memory_order_seq_cst);
+			if (waitingProducers.load(boost::memory_order_relaxed) > 0) {
+				boost::lock_guard<boost::mutex> l(commandsFreedSyncher);
+				commandsFreed.notify_all();
 			}
 		}
 	}
@@ -124,20 +329,21 @@ private:
 		cond.notify_all();
 	}
 
-	void incNextCommandId() {
-		if (nextCommandId == MAX_COMMAND_ID) {
-			nextCommandId = 1;
-		} else {
-			nextCommandId++;
-		}
-	}
-
 public:
 	/** SafeLibev takes over ownership of the loop object. */
-	SafeLibev(struct ev_loop *loop) {
+	SafeLibev(struct ev_loop *loop)
+		: asyncPending(false),
+		  freeCommands(NO_COMMAND_SLOT),
+		  commandChunkCount(0),
+		  maxCommandChunks(MAX_COMMAND_CHUNKS),
+		  waitingProducers(0)
+	{
 		this->loop = loop;
 		loopThread = pthread_self();
-		nextCommandId = 1;
+		for (unsigned int i = 0; i < MAX_COMMAND_CHUNKS; i++) {
+			commandChunks[i].store(NULL, boost::memory_order_relaxed);
+		}
+		addCommandChunk();
 
 		ev_async_init(&async, asyncHandler);
 		ev_set_priority(&async, EV_MAXPRI);
@@ -151,6 +357,11 @@ public:
 		P_LOG_FILE_DESCRIPTOR_CLOSE(ev_loop_get_pipe(loop, 1));
 		P_LOG_FILE_DESCRIPTOR_CLOSE(ev_backend_fd(loop));
 		ev_loop_destroy(loop);
+
+		// Callbacks that haven't been run by now are never run.
+		for (unsigned int i = 0; i < commandChunkCount; i++) {
+			delete[] commandChunks[i].load(boost::memory_order_relaxed);
+		}
 	}
 
 	void destroy() {
@@ -161,6 +372,20 @@ public:
 		return loop;
 	}
 
+	/**
+	 * Limits the number of callbacks that may be waiting to be run. The
+	 * limit is rounded up to a multiple of 256, and cannot be lowered below
+	 * the number of Command objects that have already been allocated.
+	 */
+	void setMaxPendingCommands(unsigned int max) {
+		boost::lock_guard<boost::mutex> l(commandChunksSyncher);
+		unsigned int chunks = (max + COMMAND_CHUNK_SIZE - 1) / COMMAND_CHUNK_SIZE;
+		if (chunks > MAX_COMMAND_CHUNKS) {
+			chunks = MAX_COMMAND_CHUNKS;
+		}
+		maxCommandChunks = std::max(commandChunkCount, chunks);
+	}
+
 	void setCurrentThread() {
 		loopThread = pthread_self();
 		#ifdef OXT_THREAD_LOCAL_KEYWORD_SUPPORTED
@@ -192,13 +417,12 @@ public:
 			watcher.set(loop);
 			watcher.start();
 		} else {
-			boost::unique_lock<boost::mutex> l(syncher);
+			// runLater() may block, so it must be called before
+			// taking `syncher`: see runSync().
 			bool done = false;
-			commands.push_back(Command(nextCommandId,
-				boost::bind(&SafeLibev::startWatcherAndNotify<Watcher>,
-					this, &watcher, &done)));
-			incNextCommandId();
-			ev_async_send(loop, &async);
+			runLater(boost::bind(&SafeLibev::startWatcherAndNotify<Watcher>,
+				this, &watcher, &done));
+			boost::unique_lock<boost::mutex> l(syncher);
 			while (!done) {
 				cond.wait(l);
 			}
@@ -210,13 +434,10 @@ public:
 		if (onEventLoopThread()) {
 			watcher.stop();
 		} else {
-			boost::unique_lock<boost::mutex> l(syncher);
 			bool done = false;
-			commands.push_back(Command(nextCommandId,
-				boost::bind(&SafeLibev::stopWatcherAndNotify<Watcher>,
-					this, &watcher, &done)));
-			incNextCommandId();
-			ev_async_send(loop, &async);
+			runLater(boost::bind(&SafeLibev::stopWatcherAndNotify<Watcher>,
+				this, &watcher, &done));
+			boost::unique_lock<boost::mutex> l(syncher);
 			while (!done) {
 				cond.wait(l);
 			}
@@ -234,13 +455,14 @@ public:
 
 	void runSync(const Callback &callback) {
 		assert(callback);
-		boost::unique_lock<boost::mutex> l(syncher);
+		// runLater() may block until the event loop has caught up. Meanwhile
+		// the event loop may be running another thread's runAndNotify(),
+		// which needs `syncher`, so don't hold it while calling runLater().
+		// `done` is only accessed while holding `syncher`.
 		bool done = false;
-		commands.push_back(Command(nextCommandId,
-			boost::bind(&SafeLibev::runAndNotify, this,
-				&callback, &done)));
-		incNextCommandId();
-		ev_async_send(loop, &async);
+		runLater(boost::bind(&SafeLibev::runAndNotify, this,
+			&callback, &done));
+		boost::unique_lock<boost::mutex> l(syncher);
 		while (!done) {
 			cond.wait(l);
 		}
@@ -262,17 +484,41 @@ public:
 		}
 	}
 
+	/**
+	 * Schedules a callback to be run on the event loop thread, in a next
+	 * event loop iteration. May be called from any thread. Returns an ID
+	 * that can be passed to cancelCommand().
+	 *
+	 * If too many callbacks are already waiting to be run, then this method
+	 * blocks until the event loop has caught up. When called on the event
+	 * loop thread it cannot wait, so it exceeds the limit instead. Should
+	 * even the command ID space run out, then the callback is scheduled with
+	 * a libev timer and 0 is returned: such a callback cannot be cancelled.
+	 */
 	unsigned int runLater(const Callback &callback) {
 		assert(callback);
-		unsigned int result;
-		{
-			boost::unique_lock<boost::mutex> l(syncher);
-			commands.push_back(Command(nextCommandId, callback));
-			result = nextCommandId;
-			incNextCommandId();
+		bool loopThread = onEventLoopThread();
+		Command *command = allocateCommand(!loopThread);
+		if (OXT_UNLIKELY(command == NULL)) {
+			assert(loopThread);
+			runAfter(0, callback);
+			return 0;
+		}
+
+		command->generation++;
+		if (command->generation == 0) {
+			command->generation = 1;
 		}
-		ev_async_send(loop, &async);
-		return result;
+		unsigned int id = ((unsigned int) command->generation << COMMAND_SLOT_BITS)
+			| command->slot;
+		command->callback = callback;
+		command->tag.store(makeTag(id, CS_PENDING), boost::memory_order_release);
+		commands.push(command);
+
+		if (!asyncPending.exchange(true, boost::memory_order_seq_cst)) {
+			ev_async_send(loop, &async);
+		}
+		return id;
 	}
 
 	/**
@@ -283,21 +529,17 @@ public:
 	 * been called or is currently being called.
 	 */
 	bool cancelCommand(unsigned int id) {
-		if (id == 0) {
+		if (id == 0 || id > MAX_COMMAND_ID) {
 			return false;
 		}
 
-		boost::unique_lock<boost::mutex> l(syncher);
-		// TODO: we can do a binary search because the command ID
-		// is monotically increasing except on overflow.
-		vector<Command>::iterator it, end = commands.end();
-		for (it = commands.begin(); it != end; it++) {
-			if (it->id == id) {
-				it->canceled = true;
-				return true;
-			}
+		Command *command = lookupCommand(id & COMMAND_SLOT_MASK);
+		if (command == NULL) {
+			return false;
 		}
-		return false;
+		boost::uint32_t expected = makeTag(id, CS_PENDING);
+		return command->tag.compare_exchange_strong(expected, makeTag(id, CS_CANCELED),
+			boost::memory_order_acq_rel);
 	}
 };
 
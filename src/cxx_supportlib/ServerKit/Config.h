@@ -56,9 +56,15 @@ using namespace std;
  *   file_buffered_channel_auto_truncate_file             boolean            -   default(true)
  *   file_buffered_channel_buffer_dir                     string             -   default
  *   file_buffered_channel_delay_in_file_mode_switching   unsigned integer   -   default(0)
+ *   file_buffered_channel_max_disk_buffering             unsigned integer   -   default(0)
  *   file_buffered_channel_max_disk_chunk_read_size       unsigned integer   -   default(0)
+ *   file_buffered_channel_spool_arena                    boolean            -   default(false)
+ *   file_buffered_channel_spool_extent_size              unsigned integer   -   default(1048576)
  *   file_buffered_channel_threshold                      unsigned integer   -   default(131072)
  *   mbuf_block_chunk_size                                unsigned integer   -   default(4096),read_only
+ *   mbuf_block_size_classes                              unsigned integer   -   default(3),read_only
+ *   mbuf_pool_huge_pages                                 boolean            -   default(false),read_only
+ *   mbuf_pool_max_spare_memory                           unsigned integer   -   default(8388608)
  *   secure_mode_password                                 string             -   secret
  *
  * END
@@ -78,6 +84,13 @@ private:
 		return updates;
 	}
 
+	static void validate(const ConfigKit::Store &config, vector<ConfigKit::Error> &errors) {
+		if (config["file_buffered_channel_spool_extent_size"].asUInt() == 0) {
+			errors.push_back(ConfigKit::Error(
+				"'{{file_buffered_channel_spool_extent_size}}' must be greater than 0"));
+		}
+	}
+
 public:
 	Schema() {
 		using namespace ConfigKit;
@@ -89,13 +102,20 @@ public:
 		add("file_buffered_channel_delay_in_file_mode_switching", UINT_TYPE, OPTIONAL, 0);
 		add("file_buffered_channel_max_disk_chunk_read_size", UINT_TYPE, OPTIONAL, 0);
 		add("file_buffered_channel_auto_truncate_file", BOOL_TYPE, OPTIONAL, true);
+		add("file_buffered_channel_spool_arena", BOOL_TYPE, OPTIONAL, false);
+		add("file_buffered_channel_spool_extent_size", UINT_TYPE, OPTIONAL, 1024 * 1024);
+		add("file_buffered_channel_max_disk_buffering", UINT_TYPE, OPTIONAL, 0);
 		// For unit testing purposes
 		add("file_buffered_channel_auto_start_mover", BOOL_TYPE, OPTIONAL, true);
 
 		add("mbuf_block_chunk_size", UINT_TYPE, OPTIONAL | READ_ONLY,
 			DEFAULT_MBUF_CHUNK_SIZE);
+		add("mbuf_block_size_classes", UINT_TYPE, OPTIONAL | READ_ONLY, 3);
+		add("mbuf_pool_huge_pages", BOOL_TYPE, OPTIONAL | READ_ONLY, false);
+		add("mbuf_pool_max_spare_memory", UINT_TYPE, OPTIONAL, 8 * 1024 * 1024);
 		add("secure_mode_password", STRING_TYPE, OPTIONAL | SECRET);
 
+		addValidator(validate);
 		addNormalizer(normalize);
 
 		finalize();
@@ -109,6 +129,9 @@ struct FileBufferedChannelConfig {
 	unsigned int maxDiskChunkReadSize;
 	bool autoTruncateFile;
 	bool autoStartMover;
+	bool spoolArena;
+	unsigned int spoolExtentSize;
+	unsigned int maxDiskBuffering;
 
 	FileBufferedChannelConfig(const ConfigKit::Store &config)
 		: bufferDir(config["file_buffered_channel_buffer_dir"].asString()),
@@ -116,7 +139,10 @@ struct FileBufferedChannelConfig {
 		  delayInFileModeSwitching(config["file_buffered_channel_delay_in_file_mode_switching"].asUInt()),
 		  maxDiskChunkReadSize(config["file_buffered_channel_max_disk_chunk_read_size"].asUInt()),
 		  autoTruncateFile(config["file_buffered_channel_auto_truncate_file"].asBool()),
-		  autoStartMover(config["file_buffered_channel_auto_start_mover"].asBool())
+		  autoStartMover(config["file_buffered_channel_auto_start_mover"].asBool()),
+		  spoolArena(config["file_buffered_channel_spool_arena"].asBool()),
+		  spoolExtentSize(config["file_buffered_channel_spool_extent_size"].asUInt()),
+		  maxDiskBuffering(config["file_buffered_channel_max_disk_buffering"].asUInt())
 		{ }
 
 	void swap(FileBufferedChannelConfig &other) BOOST_NOEXCEPT_OR_NOTHROW {
@@ -126,20 +152,26 @@ struct FileBufferedChannelConfig {
 		std::swap(maxDiskChunkReadSize, other.maxDiskChunkReadSize);
 		std::swap(autoTruncateFile, other.autoTruncateFile);
 		std::swap(autoStartMover, other.autoStartMover);
+		std::swap(spoolArena, other.spoolArena);
+		std::swap(spoolExtentSize, other.spoolExtentSize);
+		std::swap(maxDiskBuffering, other.maxDiskBuffering);
 	}
 };
 
 struct Config {
 	string secureModePassword;
+	unsigned int mbufPoolMaxSpareMemory;
 	FileBufferedChannelConfig fileBufferedChannelConfig;
 
 	Config(const ConfigKit::Store &config)
 		: secureModePassword(config["secure_mode_password"].asString()),
+		  mbufPoolMaxSpareMemory(config["mbuf_pool_max_spare_memory"].asUInt()),
 		  fileBufferedChannelConfig(config)
 		{ }
 
 	void swap(Config &other) BOOST_NOEXCEPT_OR_NOTHROW {
 		secureModePassword.swap(other.secureModePassword);
+		std::swap(mbufPoolMaxSpareMemory, other.mbufPoolMaxSpareMemory);
 		fileBufferedChannelConfig.swap(other.fileBufferedChannelConfig);
 	}
 };
@@ -28,10 +28,13 @@
 
 #include <string>
 #include <boost/config.hpp>
+#include <boost/make_shared.hpp>
 
 #include <ServerKit/Config.h>
+#include <ServerKit/SpoolArena.h>
 #include <ConfigKit/ConfigKit.h>
 #include <MemoryKit/mbuf.h>
+#include <LoggingKit/LoggingKit.h>
 #include <LoggingKit/Assert.h>
 #include <SafeLibev.h>
 #include <Exceptions.h>
@@ -51,6 +54,7 @@ using namespace std;
 class Context {
 private:
 	ConfigKit::Store configStore;
+	SpoolArenaPtr spoolArena;
 
 public:
 	typedef ServerKit::ConfigChangeRequest ConfigChangeRequest;
@@ -84,6 +88,39 @@ public:
 
 		mbuf_pool.mbuf_block_chunk_size = configStore["mbuf_block_chunk_size"].asUInt();
 		MemoryKit::mbuf_pool_init(&mbuf_pool);
+		MemoryKit::mbuf_pool_set_size_classes(&mbuf_pool,
+			configStore["mbuf_block_size_classes"].asUInt());
+		MemoryKit::mbuf_pool_use_slabs(&mbuf_pool,
+			configStore["mbuf_pool_huge_pages"].asBool());
+	}
+
+	/**
+	 * Returns the arena that FileBufferedChannels in this context spool their
+	 * data to. The arena file is created in the background on first use.
+	 * Returns NULL if spooling to an arena is disabled, while the arena file
+	 * is being created, or if it could not be created. In those cases channels
+	 * fall back to creating buffer files of their own.
+	 *
+	 * Must be called from the event loop. The extent size is only read when
+	 * the arena is created.
+	 */
+	SpoolArenaPtr getSpoolArena() {
+		const FileBufferedChannelConfig &fbcConfig = config.fileBufferedChannelConfig;
+
+		if (!fbcConfig.spoolArena) {
+			return SpoolArenaPtr();
+		}
+		if (spoolArena == NULL) {
+			spoolArena = boost::make_shared<SpoolArena>(libev, libuv,
+				fbcConfig.bufferDir, fbcConfig.spoolExtentSize,
+				fbcConfig.maxDiskBuffering);
+			spoolArena->open();
+		}
+		if (spoolArena->isOpen()) {
+			return spoolArena;
+		} else {
+			return SpoolArenaPtr();
+		}
 	}
 
 	bool configure(const Json::Value &updates, vector<ConfigKit::Error> &errors) {
@@ -108,6 +145,9 @@ public:
 	void commitConfigChange(ConfigChangeRequest &req) BOOST_NOEXCEPT_OR_NOTHROW {
 		configStore.swap(*req.configStore);
 		config.swap(*req.config);
+		if (spoolArena != NULL) {
+			spoolArena->setMaxSize(config.fileBufferedChannelConfig.maxDiskBuffering);
+		}
 	}
 
 	Json::Value inspectConfig() const {
@@ -122,10 +162,20 @@ public:
 		mbufDoc["active_blocks"] = (Json::UInt) mbuf_pool.nactive_mbuf_blockq;
 		mbufDoc["chunk_size"] = (Json::UInt) mbuf_pool.mbuf_block_chunk_size;
 		mbufDoc["offset"] = (Json::UInt) mbuf_pool.mbuf_block_offset;
-		mbufDoc["spare_memory"] = byteSizeToJson(mbuf_pool.nfree_mbuf_blockq
-			* mbuf_pool.mbuf_block_chunk_size);
-		mbufDoc["active_memory"] = byteSizeToJson(mbuf_pool.nactive_mbuf_blockq
-			* mbuf_pool.mbuf_block_chunk_size);
+		mbufDoc["spare_memory"] = byteSizeToJson(MemoryKit::mbuf_pool_spare_memory(&mbuf_pool));
+		mbufDoc["active_memory"] = byteSizeToJson(MemoryKit::mbuf_pool_active_memory(&mbuf_pool));
+
+		Json::Value sizeClassesDoc(Json::arrayValue);
+		for (unsigned int i = 0; i < mbuf_pool.nsize_classes; i++) {
+			const struct MemoryKit::mbuf_size_class *cls = &mbuf_pool.size_classes[i];
+			Json::Value classDoc;
+			classDoc["chunk_size"] = (Json::UInt) cls->mbuf_block_chunk_size;
+			classDoc["free_blocks"] = (Json::UInt) cls->nfree_mbuf_blockq;
+			classDoc["active_blocks"] = (Json::UInt) cls->nactive_mbuf_blockq;
+			classDoc["slabs"] = (Json::UInt) cls->nslabs;
+			sizeClassesDoc.append(classDoc);
+		}
+		mbufDoc["size_classes"] = sizeClassesDoc;
 		#ifdef MBUF_ENABLE_DEBUGGING
 			struct MemoryKit::active_mbuf_block_list *list =
 				const_cast<struct MemoryKit::active_mbuf_block_list *>(
@@ -148,6 +198,9 @@ public:
 		#endif
 
 		doc["mbuf_pool"] = mbufDoc;
+		if (spoolArena != NULL) {
+			doc["spool_arena"] = spoolArena->inspectStateAsJson();
+		}
 
 		return doc;
 	}
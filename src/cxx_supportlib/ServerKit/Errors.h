@@ -55,6 +55,13 @@ enum Error {
 	// HttpServer special errors
 	EARLY_EOF_DETECTED          = -1020,
 
+	// HpackDecoder errors
+	HPACK_TRUNCATED_HEADER_BLOCK      = -1030,
+	HPACK_INVALID_INDEX               = -1031,
+	HPACK_INVALID_HUFFMAN_STRING      = -1032,
+	HPACK_INVALID_TABLE_SIZE_UPDATE   = -1033,
+	HPACK_HEADER_LIST_TOO_LARGE       = -1034,
+
 	// Error codes below -2000 are http_parser errors
 	HTTP_PARSER_ERRNO_BEGIN     = -2000,
 };
@@ -92,6 +99,16 @@ getErrorDesc(int errcode) {
 		return "A normal header was encountered after the security password header";
 	case EARLY_EOF_DETECTED:
 		return "The client connection is closed before the request is done processing";
+	case HPACK_TRUNCATED_HEADER_BLOCK:
+		return "HPACK header block is truncated";
+	case HPACK_INVALID_INDEX:
+		return "HPACK header block refers to a nonexistent table entry";
+	case HPACK_INVALID_HUFFMAN_STRING:
+		return "HPACK header block contains an invalid Huffman-encoded string";
+	case HPACK_INVALID_TABLE_SIZE_UPDATE:
+		return "HPACK header block contains an invalid dynamic table size update";
+	case HPACK_HEADER_LIST_TOO_LARGE:
+		return "HPACK header list is too large";
 	default:
 		if (errcode <= HTTP_PARSER_ERRNO_BEGIN) {
 			return http_errno_description((enum http_errno)
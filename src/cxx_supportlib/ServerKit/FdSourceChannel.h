@@ -46,6 +46,16 @@ class FdSourceChannel: protected Channel {
 private:
 	ev_io watcher;
 	MemoryKit::mbuf buffer;
+	/**
+	 * The mbuf pool size class that new buffers are allocated from.
+	 * Starts at the smallest class, and adapts to how much data the
+	 * fd yields per read() so that fast senders need fewer reads and
+	 * idle connections don't hold on to large blocks. After a short read,
+	 * the leftover space of a block is kept for the next read unless the
+	 * read caused a step down to a smaller class.
+	 */
+	unsigned int sizeClass;
+	bool keepPartialBuffer;
 
 	static void _onReadable(EV_P_ ev_io *io, int revents) {
 		static_cast<FdSourceChannel *>(io->data)->onReadable(io, revents);
@@ -73,7 +83,7 @@ private:
 
 		for (i = 0; i < burstReadCount && !done; i++) {
 			if (buffer.empty()) {
-				buffer = MemoryKit::mbuf_get(&ctx->mbuf_pool);
+				buffer = MemoryKit::mbuf_get_from_size_class(&ctx->mbuf_pool, sizeClass);
 			}
 
 			origBufferSize = buffer.size();
@@ -82,9 +92,17 @@ private:
 			} while (OXT_UNLIKELY(ret == -1 && errno == EINTR));
 			if (ret > 0) {
 				MemoryKit::mbuf buffer2(buffer, 0, ret);
+				adaptSizeClass(ret, origBufferSize);
 				if (size_t(ret) == size_t(buffer.size())) {
 					// Unref mbuf_block
 					buffer = MemoryKit::mbuf();
+				} else if (!keepPartialBuffer
+				 || buffer.mbuf_block->size_class > sizeClass)
+				{
+					// The read was small enough to step down to a smaller
+					// size class, so don't pin the larger block just for
+					// its leftover space.
+					buffer = MemoryKit::mbuf();
 				} else {
 					buffer = MemoryKit::mbuf(buffer, ret);
 				}
@@ -125,6 +143,26 @@ private:
 		}
 	}
 
+	void adaptSizeClass(size_t nread, size_t origBufferSize) {
+		struct MemoryKit::mbuf_pool *pool = &ctx->mbuf_pool;
+
+		if (nread == origBufferSize
+		 && origBufferSize == MemoryKit::mbuf_pool_size_class_data_size(pool, sizeClass))
+		{
+			if (sizeClass + 1 < pool->nsize_classes) {
+				sizeClass++;
+			}
+		} else {
+			// Step down to the smallest size class that would have
+			// comfortably held this read.
+			while (sizeClass > 0
+			 && nread < MemoryKit::mbuf_pool_size_class_data_size(pool, sizeClass - 1) / 2)
+			{
+				sizeClass--;
+			}
+		}
+	}
+
 	static void onChannelConsumed(Channel *channel, unsigned int size) {
 		FdSourceChannel *self = static_cast<FdSourceChannel *>(channel);
 		self->consumedCallback = NULL;
@@ -135,6 +173,8 @@ private:
 
 	void initialize() {
 		burstReadCount = 1;
+		sizeClass = 0;
+		keepPartialBuffer = true;
 		watcher.active = false;
 		watcher.fd = -1;
 		watcher.data = this;
@@ -168,10 +208,14 @@ public:
 	void reinitialize(int fd) {
 		Channel::reinitialize();
 		ev_io_init(&watcher, _onReadable, fd, EV_READ);
+		sizeClass = 0;
+		keepPartialBuffer = true;
 	}
 
 	void deinitialize() {
 		buffer = MemoryKit::mbuf();
+		sizeClass = 0;
+		keepPartialBuffer = true;
 		if (ev_is_active(&watcher)) {
 			ev_io_stop(ctx->libev->getLoop(), &watcher);
 		}
@@ -180,6 +224,19 @@ public:
 		Channel::deinitialize();
 	}
 
+	/**
+	 * Sets whether the unused remainder of a buffer is kept after a short
+	 * read, so that the next read() can fill it. This saves allocations on
+	 * busy fds, but pins an mbuf block while the fd is idle. The default
+	 * is true.
+	 */
+	void setKeepPartialBuffer(bool value) {
+		keepPartialBuffer = value;
+		if (!value) {
+			buffer = MemoryKit::mbuf();
+		}
+	}
+
 	// May only be called right after the constructor or reinitialize().
 	void startReading() {
 		startReadingInNextTick();
@@ -241,6 +298,7 @@ public:
 		Json::Value doc = Channel::inspectAsJson();
 		doc["initialized"] = watcher.fd != -1;
 		doc["io_watcher_active"] = (bool) watcher.active;
+		doc["buffer_size_class"] = sizeClass;
 		return doc;
 	}
 };
@@ -41,11 +41,13 @@
 #include <utility>
 #include <string>
 #include <deque>
+#include <boost/container/deque.hpp>
 #include <LoggingKit/LoggingKit.h>
 #include <ServerKit/Context.h>
 #include <ServerKit/Config.h>
 #include <ServerKit/Errors.h>
 #include <ServerKit/Channel.h>
+#include <ServerKit/SpoolArena.h>
 #include <JsonTools/JsonUtils.h>
 
 namespace Passenger {
@@ -80,6 +82,11 @@ using namespace std;
  * FileBufferedChannel operates by default in the in-memory mode. All data is buffered
  * in memory. Beyond a threshold (determined by `passedThreshold()`), it switches
  * to in-file mode.
+ *
+ * In the in-file mode, a channel normally creates a buffer file of its own. If
+ * `setSpoolToArena(true)` has been called, it spools to the Context's SpoolArena
+ * instead, which saves a file creation, unlink and close per switch, and allows
+ * limiting the total amount of disk space used by all channels.
  */
 class FileBufferedChannel: protected Channel {
 public:
@@ -188,6 +195,14 @@ public:
 		 */
 		WS_MOVING,
 
+		/**
+		 * The writer is spooling to a SpoolArena whose size limit has been
+		 * reached. It resumes moving buffers once space has been freed.
+		 *
+		 * @invariant nbuffers > 0
+		 */
+		WS_WAITING_FOR_SPACE,
+
 		/**
 		 * The writer has encountered EOF or an error. It cannot be reactivated
 		 * until the FileBufferedChannel is deinitialized and reinitialized.
@@ -317,6 +332,9 @@ private:
 	 *     +------------------------+    |     bytesBuffered
 	 *     |          ....          |  --+
 	 *     +------------------------+
+	 *
+	 * When spooling to a SpoolArena, these offsets are logical offsets.
+	 * `extents` maps them to places in the arena file.
 	 */
 	struct InFileMode {
 		/***** Common state *****/
@@ -328,10 +346,25 @@ private:
 
 		/**
 		 * The file descriptor of the temp file. It's -1 if the file is being
-		 * created.
+		 * created. When spooling to an arena, this is the arena's file
+		 * descriptor, which we don't own.
 		 */
 		int fd;
 
+		/**
+		 * The arena that we spool to, or NULL if we have a buffer file
+		 * of our own.
+		 */
+		SpoolArenaPtr arena;
+
+		/**
+		 * The arena extents that hold our data, in logical order. The first
+		 * one holds the logical range that starts at
+		 * `firstExtent * arena->getExtentSize()`.
+		 */
+		deque<off_t> extents;
+		boost::uint64_t firstExtent;
+
 
 		/***** Reader state *****/
 
@@ -375,9 +408,16 @@ private:
 		 */
 		boost::int64_t written;
 
+		/**
+		 * Registered with the arena while the writer is in
+		 * WS_WAITING_FOR_SPACE.
+		 */
+		SpoolArenaWaiter spaceWaiter;
+
 		InFileMode(uv_loop_t *_libuv)
 			: libuv(_libuv),
 			  fd(-1),
+			  firstExtent(0),
 			  readRequest(NULL),
 			  writerState(WS_INACTIVE),
 			  writerRequest(NULL),
@@ -388,11 +428,67 @@ private:
 		~InFileMode() {
 			P_ASSERT_EQ(readRequest, 0);
 			P_ASSERT_EQ(writerRequest, 0);
-			if (fd != -1) {
+			if (arena != NULL) {
+				arena->cancelWait(&spaceWaiter);
+				while (!extents.empty()) {
+					arena->release(extents.front());
+					extents.pop_front();
+				}
+			} else if (fd != -1) {
 				closeFdInBackground();
 			}
 		}
 
+		/**
+		 * Returns the place in the arena file that holds logical offset `pos`.
+		 */
+		off_t getArenaOffset(boost::uint64_t pos) const {
+			unsigned int extentSize = arena->getExtentSize();
+			return extents[pos / extentSize - firstExtent] + pos % extentSize;
+		}
+
+		/**
+		 * Returns the number of bytes from logical offset `pos` until the end
+		 * of the extent that holds it.
+		 */
+		size_t getExtentRemainder(boost::uint64_t pos) const {
+			unsigned int extentSize = arena->getExtentSize();
+			return extentSize - pos % extentSize;
+		}
+
+		/**
+		 * Allocates extents until the logical range up to `end` is covered.
+		 * Returns false if the arena is full.
+		 */
+		bool allocateExtentsUntil(boost::uint64_t end) {
+			unsigned int extentSize = arena->getExtentSize();
+			off_t offset;
+
+			while ((firstExtent + extents.size()) * extentSize < end) {
+				if (!arena->allocate(offset)) {
+					return false;
+				}
+				extents.push_back(offset);
+			}
+			return true;
+		}
+
+		/**
+		 * Gives back the extents that lie entirely before logical offset `pos`.
+		 */
+		void releaseExtentsBefore(boost::uint64_t pos) {
+			unsigned int extentSize = arena->getExtentSize();
+
+			while (!extents.empty() && (firstExtent + 1) * extentSize <= pos) {
+				arena->release(extents.front());
+				extents.pop_front();
+				firstExtent++;
+			}
+			if (extents.empty()) {
+				firstExtent = pos / extentSize;
+			}
+		}
+
 		void closeFdInBackground() {
 			uv_fs_t *req = (uv_fs_t *) malloc(sizeof(uv_fs_t));
 			if (req == NULL) {
@@ -431,6 +527,9 @@ private:
 	 */
 	int errcode;
 
+	/** Whether the in-file mode should spool to the Context's SpoolArena. */
+	bool spoolToArena;
+
 	/**
 	 * `firstBuffer` and `moreBuffers` together form a queue of buffers for the reader
 	 * and the writer to process.
@@ -438,7 +537,10 @@ private:
 	 * A deque allocates memory on the heap. In the common case where the channel callback
 	 * can keep up with the writes, we don't want to have any dynamic memory allocation
 	 * at all. That's why we store the first buffer in an instance variable. Only when
-	 * there is more than 1 buffer do we use the deque.
+	 * there is more than 1 buffer do we use the deque. Unlike some std::deque
+	 * implementations, boost::container::deque doesn't allocate anything until the
+	 * first element is added, so unused channels (e.g. the body buffer of a request
+	 * that doesn't buffer its body) don't hold any heap memory.
 	 *
 	 * Buffers are pushed to end of the queue, and popped from the beginning. In the in-memory
 	 * mode, the reader is responsible for popping buffers. In the in-file mode, the writer
@@ -446,7 +548,7 @@ private:
 	 */
 	boost::uint32_t bytesBuffered; // number of bytes buffered in memory
 	MemoryKit::mbuf firstBuffer;
-	deque<MemoryKit::mbuf> moreBuffers;
+	boost::container::deque<MemoryKit::mbuf> moreBuffers;
 
 	/**
 	 * @invariant
@@ -541,6 +643,13 @@ private:
 		}
 	}
 
+	void callWriterTerminatedCallback() {
+		if (writerTerminatedCallback) {
+			FBC_DEBUG("Calling writerTerminatedCallback");
+			writerTerminatedCallback(this);
+		}
+	}
+
 
 	/***** Reader *****/
 
@@ -728,6 +837,11 @@ private:
 		if (config->maxDiskChunkReadSize > 0 && size > config->maxDiskChunkReadSize) {
 			size = config->maxDiskChunkReadSize;
 		}
+		off_t offset = inFileMode->readOffset;
+		if (inFileMode->arena != NULL) {
+			size = std::min(size, inFileMode->getExtentRemainder(offset));
+			offset = inFileMode->getArenaOffset(offset);
+		}
 		FBC_DEBUG("Reader: reading next chunk from file, " << size << " bytes");
 		verifyInvariants();
 		ReadContext *readContext = new ReadContext(this);
@@ -738,7 +852,7 @@ private:
 		inFileMode->readRequest = readContext;
 
 		uv_fs_read(ctx->libuv, &readContext->req, inFileMode->fd,
-			&readContext->uvBuffer, 1, inFileMode->readOffset,
+			&readContext->uvBuffer, 1, offset,
 			_nextChunkDoneReading);
 		verifyInvariants();
 	}
@@ -773,6 +887,7 @@ private:
 			buffer = MemoryKit::mbuf(buffer, 0, fd);
 			inFileMode->readOffset += buffer.size();
 			inFileMode->written -= buffer.size();
+			releaseConsumedExtents();
 
 			FBC_DEBUG("Reader: feeding buffer, " << buffer.size() << " bytes");
 			readerState = RS_FEEDING;
@@ -808,7 +923,7 @@ private:
 
 		boost::int32_t target = -inFileMode->written;
 		boost::int32_t offset = 0;
-		deque<MemoryKit::mbuf>::iterator it, end = moreBuffers.end();
+		boost::container::deque<MemoryKit::mbuf>::iterator it, end = moreBuffers.end();
 
 		if (offset == target) {
 			return make_pair(firstBuffer, true);
@@ -838,14 +953,26 @@ private:
 		FBC_DEBUG("Switching to in-file mode");
 		mode = IN_FILE_MODE;
 		inFileMode = boost::make_shared<InFileMode>(ctx->libuv);
-		createBufferFile();
+		if (spoolToArena) {
+			inFileMode->arena = ctx->getSpoolArena();
+		}
+		if (inFileMode->arena != NULL) {
+			FBC_DEBUG("Writer: spooling to arena");
+			inFileMode->fd = inFileMode->arena->getFd();
+			inFileMode->spaceWaiter.callback = _spoolArenaHasSpace;
+			inFileMode->spaceWaiter.userData = this;
+			moveNextBufferToFile();
+		} else {
+			createBufferFile();
+		}
 	}
 
 	/**
 	 * "Truncates" the the temp file by closing it and creating
 	 * a new one, instead of calling `ftruncate()` or something.
 	 * This way, any pending I/O operations in the background won't
-	 * affect correctness.
+	 * affect correctness. Arena extents are given back once those
+	 * operations have finished.
 	 *
 	 * This method may call callbacks.
 	 */
@@ -1081,6 +1208,18 @@ private:
 		} else if (peekBuffer().empty()) {
 			FBC_DEBUG("Writer: EOF encountered. Transitioning to WS_TERMINATED");
 			inFileMode->writerState = WS_TERMINATED;
+			callWriterTerminatedCallback();
+			return;
+		}
+
+		if (inFileMode->arena != NULL
+		 && !inFileMode->allocateExtentsUntil(inFileMode->readOffset
+			+ inFileMode->written + peekBuffer().size()))
+		{
+			FBC_DEBUG("Writer: spool arena is full. Transitioning to WS_WAITING_FOR_SPACE");
+			inFileMode->writerState = WS_WAITING_FOR_SPACE;
+			inFileMode->arena->waitForSpace(&inFileMode->spaceWaiter);
+			verifyInvariants();
 			return;
 		}
 
@@ -1091,21 +1230,36 @@ private:
 		moveContext->inFileMode = inFileMode;
 		moveContext->buffer = peekBuffer();
 		moveContext->written = 0;
-		moveContext->uvBuffer = uv_buf_init(moveContext->buffer.start,
-			moveContext->buffer.size());
 
 		inFileMode->writerState = WS_MOVING;
 		inFileMode->writerRequest = moveContext;
-		int result = uv_fs_write(ctx->libuv, &moveContext->req, inFileMode->fd,
-			&moveContext->uvBuffer, 1,
-			inFileMode->readOffset + inFileMode->written,
+		writeRestOfBufferToFile(moveContext);
+		verifyInvariants();
+	}
+
+	void writeRestOfBufferToFile(MoveContext *moveContext) {
+		boost::uint64_t pos = inFileMode->readOffset + inFileMode->written
+			+ moveContext->written;
+		size_t size = moveContext->buffer.size() - moveContext->written;
+		off_t offset = pos;
+
+		if (inFileMode->arena != NULL) {
+			// A write may not cross an extent boundary. The rest is written
+			// by bufferWrittenToFile() as if it were a partial write.
+			size = std::min(size, inFileMode->getExtentRemainder(pos));
+			offset = inFileMode->getArenaOffset(pos);
+		}
+
+		moveContext->uvBuffer = uv_buf_init(
+			moveContext->buffer.start + moveContext->written, size);
+		int result = uv_fs_write(ctx->libuv, &moveContext->req,
+			inFileMode->fd, &moveContext->uvBuffer, 1, offset,
 			_bufferWrittenToFile);
 		if (result != 0) {
 			moveContext->req.result = result;
 			ctx->libev->runLater(boost::bind(_bufferWrittenToFile,
 				&moveContext->req));
 		}
-		verifyInvariants();
 	}
 
 	static void _bufferWrittenToFile(uv_fs_t *req) {
@@ -1137,6 +1291,7 @@ private:
 				FBC_DEBUG("Writer: move complete");
 				assert(peekBuffer().size() == moveContext->buffer.size());
 				inFileMode->written += moveContext->buffer.size();
+				releaseConsumedExtents();
 
 				popBuffer();
 				if (generation != this->generation || mode >= ERROR) {
@@ -1152,18 +1307,7 @@ private:
 			} else {
 				FBC_DEBUG("Writer: move incomplete, proceeding " <<
 					"with writing rest of buffer");
-				moveContext->uvBuffer = uv_buf_init(
-					moveContext->buffer.start + moveContext->written,
-					moveContext->buffer.size() - moveContext->written);
-				int result = uv_fs_write(ctx->libuv, &moveContext->req,
-					inFileMode->fd, &moveContext->uvBuffer, 1,
-					inFileMode->readOffset + inFileMode->written,
-					_bufferWrittenToFile);
-				if (result != 0) {
-					moveContext->req.result = result;
-					ctx->libev->runLater(boost::bind(_bufferWrittenToFile,
-						&moveContext->req));
-				}
+				writeRestOfBufferToFile(moveContext);
 				verifyInvariants();
 			}
 		} else {
@@ -1177,6 +1321,31 @@ private:
 	}
 
 
+	static void _spoolArenaHasSpace(SpoolArenaWaiter *waiter) {
+		FileBufferedChannel *self = static_cast<FileBufferedChannel *>(waiter->userData);
+		self->spoolArenaHasSpace();
+	}
+
+	void spoolArenaHasSpace() {
+		RefGuard guard(hooks, this, __FILE__, __LINE__);
+		P_ASSERT_EQ(mode, IN_FILE_MODE);
+		P_ASSERT_EQ(inFileMode->writerState, WS_WAITING_FOR_SPACE);
+		FBC_DEBUG("Writer: spool arena has space again");
+		moveNextBufferToFile();
+	}
+
+	/**
+	 * Gives back the arena extents that neither the reader nor the
+	 * writer need anymore.
+	 */
+	void releaseConsumedExtents() {
+		if (inFileMode->arena != NULL) {
+			inFileMode->releaseExtentsBefore(inFileMode->readOffset
+				+ std::min<boost::int64_t>(inFileMode->written, 0));
+		}
+	}
+
+
 	/***** Misc *****/
 
 	void setError(int errcode, const char *file, unsigned int line) {
@@ -1184,6 +1353,8 @@ private:
 			return;
 		}
 
+		bool wasInFileMode = mode == IN_FILE_MODE;
+
 		FBC_DEBUG_WITH_POS(file, line, "Setting error: errno=" <<
 			errcode << " (" << getErrorDesc(errcode) << ")");
 		cancelReader();
@@ -1201,6 +1372,9 @@ private:
 			FBC_DEBUG("Waiting until underlying channel becomes idle for error feeding");
 			mode = ERROR_WAITING;
 		}
+		if (wasInFileMode) {
+			callWriterTerminatedCallback();
+		}
 	}
 
 	void feedErrorWhenChannelIdleOrEnded() {
@@ -1244,6 +1418,9 @@ private:
 			inFileMode->writerRequest->cancel();
 			inFileMode->writerRequest = NULL;
 			break;
+		case WS_WAITING_FOR_SPACE:
+			inFileMode->arena->cancelWait(&inFileMode->spaceWaiter);
+			break;
 		case WS_TERMINATED:
 			return;
 		}
@@ -1278,6 +1455,8 @@ private:
 			return "WS_CREATING_FILE";
 		case WS_MOVING:
 			return "WS_MOVING";
+		case WS_WAITING_FOR_SPACE:
+			return "WS_WAITING_FOR_SPACE";
 		case WS_TERMINATED:
 			return "WS_TERMINATED";
 		default:
@@ -1354,6 +1533,15 @@ public:
 	 * the user is responsible for ensuring correctness of the variable's content.
 	 */
 	Callback dataFlushedCallback;
+	/**
+	 * Called when the in-file mode writer terminates, either because it has
+	 * moved everything up to EOF into the buffer file, or because of an error.
+	 * Use `getCompleteBufferFileFd()` to find out which one it was.
+	 *
+	 * N.B. this class intentionally doesn't manage writerTerminatedCallback in any way,
+	 * the user is responsible for ensuring correctness of the variable's content.
+	 */
+	Callback writerTerminatedCallback;
 
 	FileBufferedChannel()
 		: config(NULL),
@@ -1361,10 +1549,12 @@ public:
 		  readerState(RS_INACTIVE),
 		  nbuffers(0),
 		  errcode(0),
+		  spoolToArena(false),
 		  bytesBuffered(0),
 		  inFileMode(),
 		  buffersFlushedCallback(NULL),
-		  dataFlushedCallback(NULL)
+		  dataFlushedCallback(NULL),
+		  writerTerminatedCallback(NULL)
 	{
 		Channel::consumedCallback = onChannelConsumed;
 	}
@@ -1376,10 +1566,12 @@ public:
 		  readerState(RS_INACTIVE),
 		  nbuffers(0),
 		  errcode(0),
+		  spoolToArena(false),
 		  bytesBuffered(0),
 		  inFileMode(),
 		  buffersFlushedCallback(NULL),
-		  dataFlushedCallback(NULL)
+		  dataFlushedCallback(NULL),
+		  writerTerminatedCallback(NULL)
 	{
 		Channel::consumedCallback = onChannelConsumed;
 	}
@@ -1523,6 +1715,39 @@ public:
 		}
 	}
 
+	/**
+	 * Returns whether the in-file mode writer is still creating the buffer
+	 * file or moving buffers into it.
+	 */
+	bool isWritingToFile() const {
+		return mode == IN_FILE_MODE
+			&& (inFileMode->writerState == WS_CREATING_FILE
+				|| inFileMode->writerState == WS_MOVING
+				|| inFileMode->writerState == WS_WAITING_FOR_SPACE);
+	}
+
+	/**
+	 * If the entire stream, up to EOF, has been moved into the buffer file and
+	 * the reader hasn't consumed any of it yet, then returns the file
+	 * descriptor of that file. The data starts at offset 0 and is
+	 * `getBytesBufferedOnDisk()` bytes long. Returns -1 otherwise, which
+	 * includes the case where the data was spooled to a SpoolArena.
+	 *
+	 * The file descriptor remains owned by this FileBufferedChannel.
+	 */
+	int getCompleteBufferFileFd() const {
+		if (mode == IN_FILE_MODE
+		 && inFileMode->arena == NULL
+		 && inFileMode->writerState == WS_TERMINATED
+		 && inFileMode->readOffset == 0
+		 && inFileMode->written >= 0)
+		{
+			return inFileMode->fd;
+		} else {
+			return -1;
+		}
+	}
+
 	/**
 	 * Returns the total bytes buffered, both in-memory and on disk.
 	 */
@@ -1543,6 +1768,24 @@ public:
 		return bytesBuffered >= config->threshold;
 	}
 
+	/**
+	 * Sets whether the in-file mode should spool to the Context's SpoolArena
+	 * instead of to a buffer file of its own. Takes effect the next time
+	 * this channel switches to the in-file mode.
+	 */
+	void setSpoolToArena(bool enabled) {
+		spoolToArena = enabled;
+	}
+
+	/**
+	 * Whether this channel is in the in-file mode and spools to the
+	 * Context's SpoolArena. Its data is then not in a file of its own, so
+	 * `getCompleteBufferFileFd()` will never return a file descriptor.
+	 */
+	bool isSpoolingToArena() const {
+		return mode == IN_FILE_MODE && inFileMode->arena != NULL;
+	}
+
 	OXT_FORCE_INLINE
 	void setDataCallback(DataCallback callback) {
 		Channel::dataCallback = callback;
@@ -1573,6 +1816,11 @@ public:
 		dataFlushedCallback = callback;
 	}
 
+	OXT_FORCE_INLINE
+	void setWriterTerminatedCallback(Callback callback) {
+		writerTerminatedCallback = callback;
+	}
+
 	OXT_FORCE_INLINE
 	Hooks *getHooks() const {
 		return Channel::hooks;
@@ -1595,6 +1843,9 @@ public:
 			doc["writer_state"] = getWriterStateString();
 			doc["read_offset"] = byteSizeToJson(inFileMode->readOffset);
 			doc["written"] = signedByteSizeToJson(inFileMode->written);
+			if (inFileMode->arena != NULL) {
+				doc["spool_extents"] = (Json::UInt) inFileMode->extents.size();
+			}
 			break;
 		case ERROR:
 			doc["mode"] = "ERROR";
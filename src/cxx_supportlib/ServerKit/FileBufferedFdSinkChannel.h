@@ -98,6 +98,9 @@ public:
 		: errorCallback(NULL)
 	{
 		FileBufferedChannel::setDataCallback(onDataCallback);
+		// Slow clients may cause many output channels to switch to the
+		// in-file mode at the same time.
+		FileBufferedChannel::setSpoolToArena(true);
 		watcher.active = false;
 		watcher.fd = -1;
 		watcher.data = this;
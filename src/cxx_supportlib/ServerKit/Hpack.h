@@ -0,0 +1,507 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_HPACK_H_
+#define _PASSENGER_SERVER_KIT_HPACK_H_
+
+#include <boost/cstdint.hpp>
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstddef>
+#include <cstring>
+#include <StaticString.h>
+#include <ServerKit/Errors.h>
+
+namespace Passenger {
+namespace ServerKit {
+
+using namespace std;
+
+
+/*
+ * HPACK (RFC 7541) header compression, as used by HTTP/2.
+ *
+ * The decoder implements the full specification: the static table, the
+ * dynamic table with eviction and size updates, and Huffman-encoded strings.
+ * The encoder is stateless. It never adds entries to the peer's dynamic table
+ * (so it doesn't care about the peer's SETTINGS_HEADER_TABLE_SIZE), but it
+ * does refer to static table entries and Huffman-encodes strings whenever
+ * that's shorter.
+ */
+
+
+struct HpackStaticTableEntry {
+	const char *name;
+	unsigned int nameSize;
+	const char *value;
+	unsigned int valueSize;
+};
+
+/**
+ * Describes all Huffman codes with a given bit length. The HPACK Huffman
+ * code is canonical, so the codes with the same length are consecutive
+ * numbers, and the corresponding symbols are consecutive entries in
+ * HPACK_HUFFMAN_SYMBOLS_BY_CODE.
+ */
+struct HpackHuffmanCodeLength {
+	boost::uint32_t firstCode;
+	boost::uint16_t count;
+	boost::uint16_t offset;
+};
+
+struct HpackHeader {
+	string name;
+	string value;
+};
+
+static const unsigned int HPACK_STATIC_TABLE_SIZE = 61;
+static const unsigned int HPACK_HUFFMAN_EOS = 256;
+static const unsigned int HPACK_HUFFMAN_MAX_CODE_LENGTH = 30;
+/** The overhead that RFC 7541 section 4.1 adds to the size of every table entry. */
+static const unsigned int HPACK_ENTRY_OVERHEAD = 32;
+
+extern const HpackStaticTableEntry HPACK_STATIC_TABLE[];
+extern const boost::uint32_t HPACK_HUFFMAN_CODES[];
+extern const boost::uint8_t HPACK_HUFFMAN_CODE_LENGTHS[];
+extern const boost::uint16_t HPACK_HUFFMAN_SYMBOLS_BY_CODE[];
+extern const HpackHuffmanCodeLength HPACK_HUFFMAN_DECODING_TABLE[];
+
+
+/***** Primitives *****/
+
+inline void
+hpackEncodeInteger(string &output, unsigned char flags, unsigned int prefixBits,
+	boost::uint32_t value)
+{
+	boost::uint32_t max = (1u << prefixBits) - 1;
+	if (value < max) {
+		output.append(1, (char) (flags | value));
+	} else {
+		output.append(1, (char) (flags | max));
+		value -= max;
+		while (value >= 128) {
+			output.append(1, (char) ((value & 0x7f) | 0x80));
+			value >>= 7;
+		}
+		output.append(1, (char) value);
+	}
+}
+
+/**
+ * Decodes an integer with an N-bit prefix. Advances `pos` past the integer.
+ * Returns false if the input is truncated or if the integer is unreasonably
+ * large (more than 2^28).
+ */
+inline bool
+hpackDecodeInteger(const unsigned char *&pos, const unsigned char *end,
+	unsigned int prefixBits, boost::uint32_t &result)
+{
+	boost::uint32_t max = (1u << prefixBits) - 1;
+	unsigned int shift = 0;
+	unsigned char ch;
+
+	if (pos == end) {
+		return false;
+	}
+	result = *pos & max;
+	pos++;
+	if (result < max) {
+		return true;
+	}
+
+	do {
+		if (pos == end || shift > 21) {
+			return false;
+		}
+		ch = *pos;
+		pos++;
+		result += (boost::uint32_t) (ch & 0x7f) << shift;
+		shift += 7;
+	} while (ch & 0x80);
+	return true;
+}
+
+inline size_t
+hpackHuffmanEncodedSize(const StaticString &str) {
+	const unsigned char *pos = (const unsigned char *) str.data();
+	const unsigned char *end = pos + str.size();
+	size_t bits = 0;
+
+	while (pos < end) {
+		bits += HPACK_HUFFMAN_CODE_LENGTHS[*pos];
+		pos++;
+	}
+	return (bits + 7) / 8;
+}
+
+inline void
+hpackHuffmanEncode(string &output, const StaticString &str) {
+	const unsigned char *pos = (const unsigned char *) str.data();
+	const unsigned char *end = pos + str.size();
+	boost::uint64_t bits = 0;
+	unsigned int nbits = 0;
+
+	while (pos < end) {
+		unsigned int length = HPACK_HUFFMAN_CODE_LENGTHS[*pos];
+		bits = (bits << length) | HPACK_HUFFMAN_CODES[*pos];
+		nbits += length;
+		while (nbits >= 8) {
+			nbits -= 8;
+			output.append(1, (char) (bits >> nbits));
+		}
+		bits &= (1u << nbits) - 1;
+		pos++;
+	}
+	if (nbits > 0) {
+		// Pad with the most significant bits of the EOS code, i.e. all ones.
+		output.append(1, (char) ((bits << (8 - nbits)) | (0xff >> nbits)));
+	}
+}
+
+/**
+ * Decodes a Huffman-encoded string and appends the result to `output`.
+ * Returns false if the input contains the EOS symbol or invalid padding.
+ */
+inline bool
+hpackHuffmanDecode(string &output, const char *data, size_t size) {
+	const unsigned char *pos = (const unsigned char *) data;
+	const unsigned char *end = pos + size;
+	boost::uint32_t code = 0;
+	unsigned int length = 0;
+
+	while (pos < end) {
+		unsigned char ch = *pos;
+		for (int i = 7; i >= 0; i--) {
+			code = (code << 1) | ((ch >> i) & 1);
+			length++;
+
+			const HpackHuffmanCodeLength &entry = HPACK_HUFFMAN_DECODING_TABLE[length];
+			// Unsigned arithmetic: codes below `firstCode` wrap around
+			// and fail the comparison.
+			if (code - entry.firstCode < entry.count) {
+				unsigned int symbol = HPACK_HUFFMAN_SYMBOLS_BY_CODE[
+					entry.offset + code - entry.firstCode];
+				if (symbol == HPACK_HUFFMAN_EOS) {
+					return false;
+				}
+				output.append(1, (char) symbol);
+				code = 0;
+				length = 0;
+			} else if (length == HPACK_HUFFMAN_MAX_CODE_LENGTH) {
+				return false;
+			}
+		}
+		pos++;
+	}
+
+	// The padding must be shorter than 8 bits and must consist of
+	// the most significant bits of the EOS code, i.e. all ones.
+	return length < 8 && code == (1u << length) - 1;
+}
+
+/** Encodes a string literal, Huffman-encoded if that's shorter. */
+inline void
+hpackEncodeString(string &output, const StaticString &str) {
+	size_t huffmanSize = hpackHuffmanEncodedSize(str);
+	if (huffmanSize < str.size()) {
+		hpackEncodeInteger(output, 0x80, 7, huffmanSize);
+		hpackHuffmanEncode(output, str);
+	} else {
+		hpackEncodeInteger(output, 0x00, 7, str.size());
+		output.append(str.data(), str.size());
+	}
+}
+
+/**
+ * Returns the static table index (1-based) of the first entry with the
+ * given name, or 0 if there is none.
+ */
+inline unsigned int
+hpackLookupStaticName(const StaticString &name) {
+	for (unsigned int i = 0; i < HPACK_STATIC_TABLE_SIZE; i++) {
+		const HpackStaticTableEntry &entry = HPACK_STATIC_TABLE[i];
+		if (entry.nameSize == name.size()
+		 && memcmp(entry.name, name.data(), name.size()) == 0)
+		{
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+
+/***** Encoding *****/
+
+/**
+ * Encodes a header as a literal header field without indexing
+ * (RFC 7541 section 6.2.2). `name` must be in lowercase.
+ */
+inline void
+hpackEncodeHeader(string &output, const StaticString &name, const StaticString &value) {
+	unsigned int index = hpackLookupStaticName(name);
+	if (index != 0) {
+		hpackEncodeInteger(output, 0x00, 4, index);
+	} else {
+		output.append(1, '\0');
+		hpackEncodeString(output, name);
+	}
+	hpackEncodeString(output, value);
+}
+
+inline void
+hpackEncodeStatus(string &output, unsigned int status) {
+	// Static table entries 8-14 are ":status" with common values.
+	switch (status) {
+	case 200:
+		output.append(1, (char) (0x80 | 8));
+		return;
+	case 204:
+		output.append(1, (char) (0x80 | 9));
+		return;
+	case 206:
+		output.append(1, (char) (0x80 | 10));
+		return;
+	case 304:
+		output.append(1, (char) (0x80 | 11));
+		return;
+	case 400:
+		output.append(1, (char) (0x80 | 12));
+		return;
+	case 404:
+		output.append(1, (char) (0x80 | 13));
+		return;
+	case 500:
+		output.append(1, (char) (0x80 | 14));
+		return;
+	default:
+		char buf[3];
+		buf[0] = '0' + (status / 100) % 10;
+		buf[1] = '0' + (status / 10) % 10;
+		buf[2] = '0' + status % 10;
+		hpackEncodeInteger(output, 0x00, 4, 8);
+		hpackEncodeString(output, StaticString(buf, 3));
+		return;
+	}
+}
+
+
+/***** Decoding *****/
+
+/**
+ * Decodes the header blocks of one direction of an HTTP/2 connection. There
+ * must be one HpackDecoder per connection, and every header block must be
+ * passed to it in order, because header blocks may modify the dynamic table.
+ */
+class HpackDecoder {
+private:
+	/** Most recently inserted entry first. */
+	deque<HpackHeader> dynamicTable;
+	size_t dynamicTableSize;
+	/** The maximum size that the encoder selected with a table size update. */
+	size_t maxDynamicTableSize;
+	/** The maximum size that we allow the encoder to select, i.e. the value
+	 * of SETTINGS_HEADER_TABLE_SIZE that we advertised. */
+	size_t protocolMaxDynamicTableSize;
+	size_t maxHeaderListSize;
+
+	static size_t entrySize(const HpackHeader &header) {
+		return header.name.size() + header.value.size() + HPACK_ENTRY_OVERHEAD;
+	}
+
+	void evictUntil(size_t maxSize) {
+		while (dynamicTableSize > maxSize) {
+			dynamicTableSize -= entrySize(dynamicTable.back());
+			dynamicTable.pop_back();
+		}
+	}
+
+	void addToDynamicTable(const HpackHeader &header) {
+		size_t size = entrySize(header);
+		if (size > maxDynamicTableSize) {
+			// Not an error: the table is simply emptied.
+			evictUntil(0);
+		} else {
+			evictUntil(maxDynamicTableSize - size);
+			dynamicTable.push_front(header);
+			dynamicTableSize += size;
+		}
+	}
+
+	int lookup(boost::uint32_t index, HpackHeader &header, bool nameOnly) const {
+		if (index == 0) {
+			return HPACK_INVALID_INDEX;
+		} else if (index <= HPACK_STATIC_TABLE_SIZE) {
+			const HpackStaticTableEntry &entry = HPACK_STATIC_TABLE[index - 1];
+			header.name.assign(entry.name, entry.nameSize);
+			if (!nameOnly) {
+				header.value.assign(entry.value, entry.valueSize);
+			}
+			return 0;
+		} else if (index - HPACK_STATIC_TABLE_SIZE <= dynamicTable.size()) {
+			const HpackHeader &entry = dynamicTable[index - HPACK_STATIC_TABLE_SIZE - 1];
+			header.name = entry.name;
+			if (!nameOnly) {
+				header.value = entry.value;
+			}
+			return 0;
+		} else {
+			return HPACK_INVALID_INDEX;
+		}
+	}
+
+	static int decodeString(const unsigned char *&pos, const unsigned char *end,
+		string &result)
+	{
+		boost::uint32_t size;
+		bool huffman;
+
+		if (pos == end) {
+			return HPACK_TRUNCATED_HEADER_BLOCK;
+		}
+		huffman = *pos & 0x80;
+		if (!hpackDecodeInteger(pos, end, 7, size) || size > (size_t) (end - pos)) {
+			return HPACK_TRUNCATED_HEADER_BLOCK;
+		}
+		if (huffman) {
+			if (!hpackHuffmanDecode(result, (const char *) pos, size)) {
+				return HPACK_INVALID_HUFFMAN_STRING;
+			}
+		} else {
+			result.append((const char *) pos, size);
+		}
+		pos += size;
+		return 0;
+	}
+
+	int decodeLiteral(const unsigned char *&pos, const unsigned char *end,
+		unsigned int prefixBits, HpackHeader &header)
+	{
+		boost::uint32_t index;
+		int ret;
+
+		if (!hpackDecodeInteger(pos, end, prefixBits, index)) {
+			return HPACK_TRUNCATED_HEADER_BLOCK;
+		}
+		if (index == 0) {
+			ret = decodeString(pos, end, header.name);
+		} else {
+			ret = lookup(index, header, true);
+		}
+		if (ret == 0) {
+			ret = decodeString(pos, end, header.value);
+		}
+		return ret;
+	}
+
+public:
+	HpackDecoder(size_t _maxDynamicTableSize = 4096, size_t _maxHeaderListSize = 64 * 1024)
+		: dynamicTableSize(0),
+		  maxDynamicTableSize(_maxDynamicTableSize),
+		  protocolMaxDynamicTableSize(_maxDynamicTableSize),
+		  maxHeaderListSize(_maxHeaderListSize)
+		{ }
+
+	/**
+	 * Decodes a complete header block and appends the headers to `headers`.
+	 * Returns 0 on success or an Errors.h error code. After an error the
+	 * dynamic table is in an undefined state, so the connection must be
+	 * closed with a COMPRESSION_ERROR.
+	 */
+	int decode(const char *data, size_t size, vector<HpackHeader> &headers) {
+		const unsigned char *pos = (const unsigned char *) data;
+		const unsigned char *end = pos + size;
+		bool headerSeen = false;
+		size_t headerListSize = 0;
+		boost::uint32_t value;
+		int ret;
+
+		while (pos < end) {
+			unsigned char ch = *pos;
+
+			if ((ch & 0xe0) == 0x20) {
+				// Dynamic table size update. Only allowed at the
+				// beginning of a header block.
+				if (headerSeen || !hpackDecodeInteger(pos, end, 5, value)
+				 || value > protocolMaxDynamicTableSize)
+				{
+					return HPACK_INVALID_TABLE_SIZE_UPDATE;
+				}
+				maxDynamicTableSize = value;
+				evictUntil(maxDynamicTableSize);
+				continue;
+			}
+
+			headerSeen = true;
+			headers.push_back(HpackHeader());
+			HpackHeader &header = headers.back();
+
+			if (ch & 0x80) {
+				// Indexed header field
+				if (!hpackDecodeInteger(pos, end, 7, value)) {
+					return HPACK_TRUNCATED_HEADER_BLOCK;
+				}
+				ret = lookup(value, header, false);
+			} else if (ch & 0x40) {
+				// Literal header field with incremental indexing
+				ret = decodeLiteral(pos, end, 6, header);
+				if (ret == 0) {
+					addToDynamicTable(header);
+				}
+			} else {
+				// Literal header field without indexing, or never indexed
+				ret = decodeLiteral(pos, end, 4, header);
+			}
+			if (ret != 0) {
+				return ret;
+			}
+
+			headerListSize += entrySize(header);
+			if (headerListSize > maxHeaderListSize) {
+				return HPACK_HEADER_LIST_TOO_LARGE;
+			}
+		}
+
+		return 0;
+	}
+
+	size_t getDynamicTableSize() const {
+		return dynamicTableSize;
+	}
+
+	unsigned int getDynamicTableEntryCount() const {
+		return dynamicTable.size();
+	}
+
+	const HpackHeader &getDynamicTableEntry(unsigned int i) const {
+		return dynamicTable[i];
+	}
+};
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_HPACK_H_ */
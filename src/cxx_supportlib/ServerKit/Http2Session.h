@@ -0,0 +1,1723 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_HTTP2_SESSION_H_
+#define _PASSENGER_SERVER_KIT_HTTP2_SESSION_H_
+
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstddef>
+#include <cstring>
+#include <arpa/inet.h>
+#include <jsoncpp/json.h>
+#include <LoggingKit/LoggingKit.h>
+#include <StaticString.h>
+#include <StrIntTools/StrIntUtils.h>
+#include <ServerKit/Errors.h>
+#include <ServerKit/Hpack.h>
+#include <ServerKit/http_parser.h>
+
+namespace Passenger {
+namespace ServerKit {
+
+using namespace std;
+
+
+/**
+ * HTTP/2 (RFC 7540) wire format.
+ */
+namespace Http2 {
+	enum FrameType {
+		DATA          = 0x0,
+		HEADERS       = 0x1,
+		PRIORITY      = 0x2,
+		RST_STREAM    = 0x3,
+		SETTINGS      = 0x4,
+		PUSH_PROMISE  = 0x5,
+		PING          = 0x6,
+		GOAWAY        = 0x7,
+		WINDOW_UPDATE = 0x8,
+		CONTINUATION  = 0x9
+	};
+
+	enum FrameFlag {
+		FLAG_END_STREAM  = 0x1,
+		FLAG_ACK         = 0x1,
+		FLAG_END_HEADERS = 0x4,
+		FLAG_PADDED      = 0x8,
+		FLAG_PRIORITY    = 0x20
+	};
+
+	enum ErrorCode {
+		NO_ERROR            = 0x0,
+		PROTOCOL_ERROR      = 0x1,
+		INTERNAL_ERROR      = 0x2,
+		FLOW_CONTROL_ERROR  = 0x3,
+		SETTINGS_TIMEOUT    = 0x4,
+		STREAM_CLOSED       = 0x5,
+		FRAME_SIZE_ERROR    = 0x6,
+		REFUSED_STREAM      = 0x7,
+		CANCEL              = 0x8,
+		COMPRESSION_ERROR   = 0x9,
+		CONNECT_ERROR       = 0xa,
+		ENHANCE_YOUR_CALM   = 0xb,
+		INADEQUATE_SECURITY = 0xc,
+		HTTP_1_1_REQUIRED   = 0xd
+	};
+
+	enum Setting {
+		SETTINGS_HEADER_TABLE_SIZE      = 0x1,
+		SETTINGS_ENABLE_PUSH            = 0x2,
+		SETTINGS_MAX_CONCURRENT_STREAMS = 0x3,
+		SETTINGS_INITIAL_WINDOW_SIZE    = 0x4,
+		SETTINGS_MAX_FRAME_SIZE         = 0x5,
+		SETTINGS_MAX_HEADER_LIST_SIZE   = 0x6
+	};
+
+	struct FrameHeader {
+		boost::uint32_t length;
+		boost::uint8_t type;
+		boost::uint8_t flags;
+		boost::uint32_t streamId;
+	};
+
+	static const char CLIENT_PREFACE[] = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+	static const unsigned int CLIENT_PREFACE_SIZE = sizeof(CLIENT_PREFACE) - 1;
+	static const unsigned int FRAME_HEADER_SIZE = 9;
+	static const unsigned int DEFAULT_MAX_FRAME_SIZE = 16384;
+	static const unsigned int MAX_MAX_FRAME_SIZE = 16777215;
+	static const boost::int64_t DEFAULT_WINDOW_SIZE = 65535;
+	static const boost::int64_t MAX_WINDOW_SIZE = 0x7fffffff;
+
+	inline void
+	appendFrameHeader(string &buf, boost::uint32_t length, FrameType type,
+		unsigned char flags, boost::uint32_t streamId)
+	{
+		char header[FRAME_HEADER_SIZE];
+		header[0] = (char) (length >> 16);
+		header[1] = (char) (length >> 8);
+		header[2] = (char) length;
+		header[3] = (char) type;
+		header[4] = (char) flags;
+		streamId = htonl(streamId & 0x7fffffff);
+		memcpy(header + 5, &streamId, 4);
+		buf.append(header, FRAME_HEADER_SIZE);
+	}
+
+	inline FrameHeader
+	decodeFrameHeader(const char *buf) {
+		const unsigned char *data = (const unsigned char *) buf;
+		FrameHeader header;
+		boost::uint32_t n;
+
+		header.length = (data[0] << 16) | (data[1] << 8) | data[2];
+		header.type = data[3];
+		header.flags = data[4];
+		memcpy(&n, data + 5, 4);
+		header.streamId = ntohl(n) & 0x7fffffff;
+		return header;
+	}
+
+	inline boost::uint32_t
+	decodeUint32(const char *buf) {
+		boost::uint32_t n;
+		memcpy(&n, buf, 4);
+		return ntohl(n);
+	}
+
+	inline void
+	appendUint32(string &buf, boost::uint32_t value) {
+		value = htonl(value);
+		buf.append((const char *) &value, 4);
+	}
+
+	/**
+	 * Returns whether the given data, which is the beginning of what a client
+	 * sent on a new connection, looks like an HTTP/2 "prior knowledge" connection
+	 * preface. At least 3 bytes are needed to tell it apart from HTTP/1 requests
+	 * (e.g. "PROPFIND"); the rest of the preface is verified by Http2Session.
+	 */
+	inline bool
+	startsWithClientPreface(const char *data, size_t size) {
+		return size >= 3
+			&& memcmp(data, CLIENT_PREFACE, std::min<size_t>(size, CLIENT_PREFACE_SIZE)) == 0;
+	}
+}
+
+
+class Http2Session;
+
+/**
+ * Connects an Http2Session to the server that owns the underlying connection.
+ * The server serves every stream as one of its own requests: the session
+ * passes it the stream's request in HTTP/1.1 format, and the server passes
+ * its HTTP/1.1 response back with `Http2Session::writeStreamResponse()`.
+ *
+ * The handler may call back into the session from any of these callbacks.
+ */
+class Http2SessionHandler {
+public:
+	virtual ~Http2SessionHandler() { }
+
+	/**
+	 * Called when a new stream has been opened. Returns an object that
+	 * represents the stream on the handler's side, which is passed to the
+	 * other callbacks, or NULL if the handler cannot accept new requests
+	 * right now, in which case the session refuses the stream.
+	 */
+	virtual void *http2OpenStream(Http2Session *session, boost::uint32_t streamId) = 0;
+
+	/**
+	 * Passes request data of a stream to the handler: first the request
+	 * head, then the body. Returns the number of bytes consumed. If that is
+	 * less than `size`, then the session keeps the rest until the handler
+	 * calls `Http2Session::resumeStreamRequest()`. Returns -1 if the handler
+	 * isn't interested in (the rest of) the request body, e.g. because it
+	 * already responded.
+	 */
+	virtual ssize_t http2StreamRequestData(Http2Session *session, void *stream,
+		const char *data, size_t size) = 0;
+
+	/**
+	 * Called when the response of a stream that the handler had to pause
+	 * (see `Http2Session::shouldPauseStreamResponse()`) may continue.
+	 */
+	virtual void http2StreamWritable(Http2Session *session, void *stream) = 0;
+
+	/**
+	 * Called when a stream is closed before the handler has ended it, e.g.
+	 * because the client reset it or because the connection is closing.
+	 * The handler must not refer to the stream anymore.
+	 */
+	virtual void http2CloseStream(Http2Session *session, void *stream) = 0;
+
+	/**
+	 * Called when the session has frames to send to the client, and/or when
+	 * the session is finished and the connection should be closed once all
+	 * data is written. `data` may be swapped out.
+	 *
+	 * This is always the last thing that a session does before returning
+	 * from a call, so the handler may destroy the session.
+	 */
+	virtual void http2Flush(Http2Session *session, string &data, bool finished) = 0;
+};
+
+
+/**
+ * Serves one HTTP/2 connection by translating every stream into an HTTP/1.1
+ * request for the handler, and the handler's HTTP/1.1 response back into
+ * HEADERS and DATA frames. So every stream goes through the normal request
+ * lifecycle of the server that owns the connection, as a request of that
+ * connection's client.
+ *
+ * The session owns the HTTP/2 protocol state: the frame parser, the HPACK
+ * decoder, stream states and flow control windows. It does not do I/O on
+ * the connection itself; the owner passes received data to `feed()` and
+ * writes whatever the session passes to `Http2SessionHandler::http2Flush()`.
+ * Because the handler may call back into the session, frames are only
+ * flushed when the outermost call into the session returns.
+ *
+ * Flow control works end to end. We only extend a stream's receive window
+ * once the handler has consumed its request body, and we ask the handler
+ * to pause a stream's response when the client's flow control window is
+ * exhausted, or when the owner calls `throttleOutput()` because the
+ * connection's output buffer is full.
+ *
+ * Clients that open streams and then reset them right away ("rapid reset",
+ * CVE-2023-44487) are not limited by MAX_CONCURRENT_STREAMS, yet make the
+ * server start a request for every stream. So every connection has a budget
+ * of streams that may be reset by the client, refused or malformed. Every
+ * completed response earns a stream back, and the connection is closed with
+ * ENHANCE_YOUR_CALM when the budget runs out.
+ *
+ * Not supported: server push, priorities (PRIORITY frames are accepted but
+ * ignored), CONNECT requests, and upgrading HTTP/1.1 connections with
+ * "Upgrade: h2c" (RFC 9113 deprecates that mechanism). Clients use h2c with
+ * prior knowledge, e.g. `curl --http2-prior-knowledge`.
+ */
+class Http2Session {
+public:
+	static const unsigned int MAX_CONCURRENT_STREAMS = 100;
+	/** Maximum size of a compressed header block, including CONTINUATION frames. */
+	static const unsigned int MAX_HEADER_BLOCK_SIZE = 64 * 1024;
+	/** Pause a stream's response while this much of its body is
+	 * waiting for the client's flow control window to open. */
+	static const unsigned int STREAM_RESPONSE_BUFFER_LIMIT = 64 * 1024;
+	/** How many streams may be reset by the client, refused or malformed
+	 * (net of completed responses) before the connection is closed. */
+	static const unsigned int STREAM_RESET_BUDGET = 2 * MAX_CONCURRENT_STREAMS;
+
+	enum State {
+		EXPECTING_PREFACE,
+		EXPECTING_SETTINGS,
+		ACTIVE,
+		FINISHED
+	};
+
+private:
+	struct Stream {
+		Http2Session *session;
+		boost::uint32_t id;
+		/** The handler's object for this stream, or NULL once the handler has ended it. */
+		void *handlerData;
+
+		/** HTTP/1 request data that the handler hasn't consumed yet. */
+		string requestBuffer;
+		/** -1 if the request body is sent with chunked transfer encoding. */
+		boost::int64_t contentLength;
+		boost::uint64_t bodyBytesReceived;
+		boost::int64_t recvWindow;
+		bool remoteEnded;
+		/** Set while the handler cannot consume more request data. */
+		bool requestPaused;
+		/** Set if the handler doesn't want (the rest of) the request body. */
+		bool requestDiscarded;
+
+		http_parser parser;
+		bool headRequest;
+		bool lastCallbackWasValue;
+		vector<HpackHeader> responseHeaders;
+		/** Response body data waiting for the flow control window to open. */
+		string responseBody;
+		boost::int64_t sendWindow;
+		bool responseComplete;
+		/** Set once the last DATA frame has been queued. */
+		bool responseSent;
+		/** Set if the handler has paused the response and must be told when to continue. */
+		bool responseWaiting;
+	};
+
+	typedef map<boost::uint32_t, Stream *> StreamMap;
+
+	Http2SessionHandler *handler;
+	void *userData;
+	State state;
+	bool draining;
+	bool outputThrottled;
+	bool finishReported;
+	bool destroyPending;
+	/** Number of calls into the session that are in progress. */
+	unsigned int depth;
+
+	string inbuf;
+	string outbuf;
+
+	HpackDecoder hpackDecoder;
+	/** Non-zero while a header block is being continued with CONTINUATION frames. */
+	boost::uint32_t headerBlockStreamId;
+	unsigned char headerBlockFlags;
+	string headerBlock;
+
+	boost::uint32_t lastStreamId;
+	StreamMap streams;
+	/** Streams whose handler must be told that the response may continue. */
+	vector<boost::uint32_t> writableStreams;
+	unsigned int resetBudget;
+	boost::int64_t connSendWindow;
+	/** Bytes received since the last connection-level WINDOW_UPDATE. */
+	boost::uint32_t connRecvConsumed;
+	boost::int64_t peerInitialWindowSize;
+	boost::uint32_t peerMaxFrameSize;
+
+	unsigned long long totalStreams;
+	unsigned long long refusedStreams;
+
+
+	/***** Frame output *****/
+
+	void appendSettings() {
+		Http2::appendFrameHeader(outbuf, 6, Http2::SETTINGS, 0, 0);
+		outbuf.append(1, '\0');
+		outbuf.append(1, (char) Http2::SETTINGS_MAX_CONCURRENT_STREAMS);
+		Http2::appendUint32(outbuf, MAX_CONCURRENT_STREAMS);
+	}
+
+	void appendRstStream(boost::uint32_t streamId, Http2::ErrorCode code) {
+		Http2::appendFrameHeader(outbuf, 4, Http2::RST_STREAM, 0, streamId);
+		Http2::appendUint32(outbuf, code);
+	}
+
+	void appendWindowUpdate(boost::uint32_t streamId, boost::uint32_t increment) {
+		Http2::appendFrameHeader(outbuf, 4, Http2::WINDOW_UPDATE, 0, streamId);
+		Http2::appendUint32(outbuf, increment);
+	}
+
+	void appendGoAway(Http2::ErrorCode code) {
+		Http2::appendFrameHeader(outbuf, 8, Http2::GOAWAY, 0, 0);
+		Http2::appendUint32(outbuf, lastStreamId);
+		Http2::appendUint32(outbuf, code);
+	}
+
+	void appendHeaderBlock(boost::uint32_t streamId, const string &block, bool endStream) {
+		size_t pos = 0;
+		bool first = true;
+
+		do {
+			size_t size = std::min<size_t>(block.size() - pos, peerMaxFrameSize);
+			unsigned char flags = 0;
+			if (pos + size == block.size()) {
+				flags |= Http2::FLAG_END_HEADERS;
+			}
+			if (first && endStream) {
+				flags |= Http2::FLAG_END_STREAM;
+			}
+			Http2::appendFrameHeader(outbuf, size,
+				first ? Http2::HEADERS : Http2::CONTINUATION,
+				flags, streamId);
+			outbuf.append(block, pos, size);
+			pos += size;
+			first = false;
+		} while (pos < block.size());
+	}
+
+	/**
+	 * Passes queued frames to the handler. Must be the last thing that
+	 * an entry point does, because the handler may destroy this session.
+	 */
+	void flushOutput() {
+		bool finished = state == FINISHED && !finishReported;
+		if (finished) {
+			finishReported = true;
+		}
+		if (!outbuf.empty() || finished) {
+			string data;
+			data.swap(outbuf);
+			handler->http2Flush(this, data, finished);
+		}
+	}
+
+
+	/***** Entry points *****/
+
+	/**
+	 * Every public method that may call the handler is wrapped in
+	 * enter() and leave(), because the handler may call back into the
+	 * session. The outermost leave() tells the handler about streams
+	 * that may continue, and then either flushes the output or, if
+	 * `destroy()` was called meanwhile, frees the session. So leave()
+	 * must be the last thing that an entry point does.
+	 */
+	void enter() {
+		depth++;
+	}
+
+	void leave() {
+		if (depth == 1) {
+			notifyWritableStreams();
+		}
+		depth--;
+		if (depth == 0) {
+			if (destroyPending) {
+				delete this;
+			} else {
+				flushOutput();
+			}
+		}
+	}
+
+	void notifyWritableStreams() {
+		while (!writableStreams.empty() && !destroyPending) {
+			vector<boost::uint32_t> ids;
+			vector<boost::uint32_t>::const_iterator it;
+
+			ids.swap(writableStreams);
+			for (it = ids.begin(); it != ids.end() && !destroyPending; it++) {
+				Stream *stream = lookupStream(*it);
+				if (stream != NULL && stream->handlerData != NULL) {
+					handler->http2StreamWritable(this, stream->handlerData);
+				}
+			}
+		}
+	}
+
+
+	/***** Connection state *****/
+
+	void connectionError(Http2::ErrorCode code, const StaticString &reason) {
+		P_DEBUG("HTTP/2 connection error: " << reason << " (error code " << (int) code << ")");
+		appendGoAway(code);
+		finish();
+	}
+
+	void finish() {
+		closeAllStreams();
+		inbuf.clear();
+		headerBlock.clear();
+		state = FINISHED;
+	}
+
+	Stream *lookupStream(boost::uint32_t id) const {
+		StreamMap::const_iterator it = streams.find(id);
+		if (it == streams.end()) {
+			return NULL;
+		} else {
+			return it->second;
+		}
+	}
+
+	void closeStream(Stream *stream) {
+		void *handlerData = stream->handlerData;
+
+		P_TRACE(3, "HTTP/2 stream " << stream->id << ": closing");
+		streams.erase(stream->id);
+		delete stream;
+		if (handlerData != NULL) {
+			handler->http2CloseStream(this, handlerData);
+		}
+
+		if (draining && streams.empty() && state != FINISHED) {
+			finish();
+		}
+	}
+
+	void closeAllStreams() {
+		while (!streams.empty()) {
+			closeStream(streams.begin()->second);
+		}
+	}
+
+	void resetStream(Stream *stream, Http2::ErrorCode code) {
+		appendRstStream(stream->id, code);
+		closeStream(stream);
+	}
+
+	/**
+	 * Charges the reset budget for a stream that the client reset, or that
+	 * we refused or rejected as malformed. Closes the connection when the
+	 * budget runs out.
+	 */
+	void chargeResetBudget() {
+		if (resetBudget > 0) {
+			resetBudget--;
+		}
+		if (resetBudget == 0 && state != FINISHED) {
+			P_WARN("HTTP/2 client reset or opened invalid streams too often;"
+				" closing the connection");
+			connectionError(Http2::ENHANCE_YOUR_CALM, "too many streams reset or refused");
+		}
+	}
+
+
+	/***** Frame input *****/
+
+	static bool stripPadding(const Http2::FrameHeader &header, const char *&payload,
+		boost::uint32_t &length)
+	{
+		if (header.flags & Http2::FLAG_PADDED) {
+			if (length < 1) {
+				return false;
+			}
+			unsigned int padLength = (unsigned char) payload[0];
+			payload++;
+			length--;
+			if (padLength > length) {
+				return false;
+			}
+			length -= padLength;
+		}
+		return true;
+	}
+
+	void processFrame(const Http2::FrameHeader &header, const char *payload) {
+		P_TRACE(3, "HTTP/2 frame received: type=" << (int) header.type
+			<< ", flags=" << (int) header.flags << ", stream=" << header.streamId
+			<< ", length=" << header.length);
+
+		if (headerBlockStreamId != 0 && header.type != Http2::CONTINUATION) {
+			connectionError(Http2::PROTOCOL_ERROR, "expected CONTINUATION frame");
+			return;
+		}
+		if (state == EXPECTING_SETTINGS) {
+			if (header.type != Http2::SETTINGS || (header.flags & Http2::FLAG_ACK)) {
+				connectionError(Http2::PROTOCOL_ERROR, "connection preface must end with a SETTINGS frame");
+				return;
+			}
+			state = ACTIVE;
+		}
+
+		switch (header.type) {
+		case Http2::DATA:
+			processDataFrame(header, payload);
+			break;
+		case Http2::HEADERS:
+			processHeadersFrame(header, payload);
+			break;
+		case Http2::CONTINUATION:
+			processContinuationFrame(header, payload);
+			break;
+		case Http2::PRIORITY:
+			processPriorityFrame(header, payload);
+			break;
+		case Http2::RST_STREAM:
+			processRstStreamFrame(header, payload);
+			break;
+		case Http2::SETTINGS:
+			processSettingsFrame(header, payload);
+			break;
+		case Http2::PUSH_PROMISE:
+			connectionError(Http2::PROTOCOL_ERROR, "clients may not send PUSH_PROMISE");
+			break;
+		case Http2::PING:
+			processPingFrame(header, payload);
+			break;
+		case Http2::GOAWAY:
+			processGoAwayFrame(header, payload);
+			break;
+		case Http2::WINDOW_UPDATE:
+			processWindowUpdateFrame(header, payload);
+			break;
+		default:
+			// Unknown frame types must be ignored.
+			break;
+		}
+	}
+
+	void processDataFrame(const Http2::FrameHeader &header, const char *payload) {
+		boost::uint32_t length = header.length;
+		Stream *stream;
+
+		if (header.streamId == 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "DATA frame on stream 0");
+			return;
+		}
+
+		// Flow control covers the entire frame, including padding. The
+		// connection-level window is replenished right away; per-stream
+		// windows provide the backpressure.
+		if (connRecvConsumed + header.length > Http2::DEFAULT_WINDOW_SIZE) {
+			connectionError(Http2::FLOW_CONTROL_ERROR, "connection flow control window exceeded");
+			return;
+		}
+		connRecvConsumed += header.length;
+		if (connRecvConsumed >= Http2::DEFAULT_WINDOW_SIZE / 2) {
+			appendWindowUpdate(0, connRecvConsumed);
+			connRecvConsumed = 0;
+		}
+
+		if (!stripPadding(header, payload, length)) {
+			connectionError(Http2::PROTOCOL_ERROR, "invalid padding");
+			return;
+		}
+
+		stream = lookupStream(header.streamId);
+		if (stream == NULL) {
+			if (header.streamId > lastStreamId) {
+				connectionError(Http2::PROTOCOL_ERROR, "DATA frame on idle stream");
+			}
+			// Otherwise the stream has been closed or reset by us,
+			// and frames may still be in flight.
+			return;
+		}
+		if (stream->responseSent) {
+			// We have told the client that we don't need
+			// the rest of the request body.
+			return;
+		}
+		if (stream->remoteEnded) {
+			resetStream(stream, Http2::STREAM_CLOSED);
+			return;
+		}
+		if ((boost::int64_t) header.length > stream->recvWindow) {
+			resetStream(stream, Http2::FLOW_CONTROL_ERROR);
+			return;
+		}
+		stream->recvWindow -= header.length;
+		stream->bodyBytesReceived += length;
+		if (stream->contentLength >= 0
+		 && stream->bodyBytesReceived > (boost::uint64_t) stream->contentLength)
+		{
+			resetStream(stream, Http2::PROTOCOL_ERROR);
+			return;
+		}
+
+		if (length > 0 && !stream->requestDiscarded) {
+			if (stream->contentLength == -1) {
+				char buf[sizeof(boost::uint32_t) * 2 + 1];
+				unsigned int size = integerToHex(length, buf);
+				stream->requestBuffer.append(buf, size);
+				stream->requestBuffer.append("\r\n", 2);
+				stream->requestBuffer.append(payload, length);
+				stream->requestBuffer.append("\r\n", 2);
+			} else {
+				stream->requestBuffer.append(payload, length);
+			}
+		}
+		if (header.flags & Http2::FLAG_END_STREAM) {
+			if (!endRequestBody(stream)) {
+				return;
+			}
+		}
+		writeRequestBuffer(stream);
+	}
+
+	/**
+	 * Returns false if the stream has been reset.
+	 */
+	bool endRequestBody(Stream *stream) {
+		stream->remoteEnded = true;
+		if (stream->contentLength == -1) {
+			if (!stream->requestDiscarded) {
+				stream->requestBuffer.append("0\r\n\r\n");
+			}
+		} else if (stream->bodyBytesReceived != (boost::uint64_t) stream->contentLength) {
+			resetStream(stream, Http2::PROTOCOL_ERROR);
+			return false;
+		}
+		return true;
+	}
+
+	void processHeadersFrame(const Http2::FrameHeader &header, const char *payload) {
+		boost::uint32_t length = header.length;
+
+		if (header.streamId == 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "HEADERS frame on stream 0");
+			return;
+		}
+		if (!stripPadding(header, payload, length)) {
+			connectionError(Http2::PROTOCOL_ERROR, "invalid padding");
+			return;
+		}
+		if (header.flags & Http2::FLAG_PRIORITY) {
+			if (length < 5) {
+				connectionError(Http2::PROTOCOL_ERROR, "invalid priority");
+				return;
+			}
+			payload += 5;
+			length -= 5;
+		}
+
+		headerBlock.assign(payload, length);
+		headerBlockFlags = header.flags;
+		if (header.flags & Http2::FLAG_END_HEADERS) {
+			processHeaderBlock(header.streamId);
+		} else {
+			headerBlockStreamId = header.streamId;
+		}
+	}
+
+	void processContinuationFrame(const Http2::FrameHeader &header, const char *payload) {
+		if (headerBlockStreamId == 0 || header.streamId != headerBlockStreamId) {
+			connectionError(Http2::PROTOCOL_ERROR, "unexpected CONTINUATION frame");
+			return;
+		}
+		if (headerBlock.size() + header.length > MAX_HEADER_BLOCK_SIZE) {
+			connectionError(Http2::ENHANCE_YOUR_CALM, "header block too large");
+			return;
+		}
+		headerBlock.append(payload, header.length);
+		if (header.flags & Http2::FLAG_END_HEADERS) {
+			headerBlockStreamId = 0;
+			processHeaderBlock(header.streamId);
+		}
+	}
+
+	void processHeaderBlock(boost::uint32_t streamId) {
+		vector<HpackHeader> headers;
+		bool endStream = headerBlockFlags & Http2::FLAG_END_STREAM;
+		Stream *stream;
+
+		// Header blocks must always be decoded, even for streams that
+		// we are going to refuse, to keep the HPACK state in sync.
+		int ret = hpackDecoder.decode(headerBlock.data(), headerBlock.size(), headers);
+		string().swap(headerBlock);
+		if (ret != 0) {
+			connectionError(Http2::COMPRESSION_ERROR, getErrorDesc(ret));
+			return;
+		}
+
+		stream = lookupStream(streamId);
+		if (stream != NULL) {
+			// Trailers. We don't forward them to the HTTP/1 side.
+			if (stream->remoteEnded) {
+				resetStream(stream, Http2::STREAM_CLOSED);
+			} else if (!endStream) {
+				resetStream(stream, Http2::PROTOCOL_ERROR);
+			} else if (endRequestBody(stream)) {
+				writeRequestBuffer(stream);
+			}
+			return;
+		}
+		if (streamId <= lastStreamId) {
+			// The stream has been closed or reset by us.
+			return;
+		}
+		if (streamId % 2 == 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "clients must use odd stream IDs");
+			return;
+		}
+
+		lastStreamId = streamId;
+		if (draining) {
+			refusedStreams++;
+			appendRstStream(streamId, Http2::REFUSED_STREAM);
+		} else if (streams.size() >= MAX_CONCURRENT_STREAMS) {
+			refusedStreams++;
+			appendRstStream(streamId, Http2::REFUSED_STREAM);
+			chargeResetBudget();
+		} else {
+			openStream(streamId, headers, endStream);
+		}
+	}
+
+	void processPriorityFrame(const Http2::FrameHeader &header, const char *payload) {
+		if (header.streamId == 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "PRIORITY frame on stream 0");
+		} else if (header.length != 5) {
+			Stream *stream = lookupStream(header.streamId);
+			if (stream != NULL) {
+				resetStream(stream, Http2::FRAME_SIZE_ERROR);
+			} else {
+				appendRstStream(header.streamId, Http2::FRAME_SIZE_ERROR);
+			}
+		}
+	}
+
+	void processRstStreamFrame(const Http2::FrameHeader &header, const char *payload) {
+		if (header.streamId == 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "RST_STREAM frame on stream 0");
+			return;
+		}
+		if (header.length != 4) {
+			connectionError(Http2::FRAME_SIZE_ERROR, "invalid RST_STREAM frame size");
+			return;
+		}
+
+		Stream *stream = lookupStream(header.streamId);
+		if (stream != NULL) {
+			bool responseSent = stream->responseSent;
+			P_TRACE(2, "HTTP/2 stream " << stream->id << ": reset by client (error code "
+				<< Http2::decodeUint32(payload) << ")");
+			closeStream(stream);
+			if (!responseSent) {
+				chargeResetBudget();
+			}
+		} else if (header.streamId > lastStreamId) {
+			connectionError(Http2::PROTOCOL_ERROR, "RST_STREAM frame on idle stream");
+		}
+	}
+
+	void processSettingsFrame(const Http2::FrameHeader &header, const char *payload) {
+		bool windowGrew = false;
+
+		if (header.streamId != 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "SETTINGS frame on a stream");
+			return;
+		}
+		if (header.flags & Http2::FLAG_ACK) {
+			if (header.length != 0) {
+				connectionError(Http2::FRAME_SIZE_ERROR, "invalid SETTINGS ack size");
+			}
+			return;
+		}
+		if (header.length % 6 != 0) {
+			connectionError(Http2::FRAME_SIZE_ERROR, "invalid SETTINGS frame size");
+			return;
+		}
+
+		for (unsigned int i = 0; i < header.length; i += 6) {
+			unsigned int id = ((unsigned char) payload[i] << 8) | (unsigned char) payload[i + 1];
+			boost::uint32_t value = Http2::decodeUint32(payload + i + 2);
+
+			switch (id) {
+			case Http2::SETTINGS_ENABLE_PUSH:
+				if (value > 1) {
+					connectionError(Http2::PROTOCOL_ERROR, "invalid SETTINGS_ENABLE_PUSH");
+					return;
+				}
+				break;
+			case Http2::SETTINGS_INITIAL_WINDOW_SIZE: {
+				if (value > Http2::MAX_WINDOW_SIZE) {
+					connectionError(Http2::FLOW_CONTROL_ERROR, "invalid SETTINGS_INITIAL_WINDOW_SIZE");
+					return;
+				}
+				boost::int64_t delta = (boost::int64_t) value - peerInitialWindowSize;
+				StreamMap::iterator it, end = streams.end();
+				for (it = streams.begin(); it != end; it++) {
+					it->second->sendWindow += delta;
+					if (it->second->sendWindow > Http2::MAX_WINDOW_SIZE) {
+						connectionError(Http2::FLOW_CONTROL_ERROR, "flow control window too large");
+						return;
+					}
+				}
+				peerInitialWindowSize = value;
+				windowGrew = windowGrew || delta > 0;
+				break;
+			}
+			case Http2::SETTINGS_MAX_FRAME_SIZE:
+				if (value < Http2::DEFAULT_MAX_FRAME_SIZE || value > Http2::MAX_MAX_FRAME_SIZE) {
+					connectionError(Http2::PROTOCOL_ERROR, "invalid SETTINGS_MAX_FRAME_SIZE");
+					return;
+				}
+				peerMaxFrameSize = value;
+				break;
+			default:
+				// SETTINGS_HEADER_TABLE_SIZE doesn't matter because our encoder
+				// doesn't use the dynamic table. We don't push streams, so
+				// SETTINGS_MAX_CONCURRENT_STREAMS doesn't matter either.
+				// Unknown settings must be ignored.
+				break;
+			}
+		}
+
+		Http2::appendFrameHeader(outbuf, 0, Http2::SETTINGS, Http2::FLAG_ACK, 0);
+		if (windowGrew) {
+			sendAllResponseBodies();
+		}
+	}
+
+	void processPingFrame(const Http2::FrameHeader &header, const char *payload) {
+		if (header.streamId != 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "PING frame on a stream");
+		} else if (header.length != 8) {
+			connectionError(Http2::FRAME_SIZE_ERROR, "invalid PING frame size");
+		} else if (!(header.flags & Http2::FLAG_ACK)) {
+			Http2::appendFrameHeader(outbuf, 8, Http2::PING, Http2::FLAG_ACK, 0);
+			outbuf.append(payload, 8);
+		}
+	}
+
+	void processGoAwayFrame(const Http2::FrameHeader &header, const char *payload) {
+		if (header.streamId != 0) {
+			connectionError(Http2::PROTOCOL_ERROR, "GOAWAY frame on a stream");
+		} else if (header.length < 8) {
+			connectionError(Http2::FRAME_SIZE_ERROR, "invalid GOAWAY frame size");
+		} else {
+			P_TRACE(2, "HTTP/2 client is going away (error code "
+				<< Http2::decodeUint32(payload + 4) << ")");
+			// Finish the streams that are in progress, but don't accept new ones.
+			draining = true;
+			if (streams.empty()) {
+				finish();
+			}
+		}
+	}
+
+	void processWindowUpdateFrame(const Http2::FrameHeader &header, const char *payload) {
+		if (header.length != 4) {
+			connectionError(Http2::FRAME_SIZE_ERROR, "invalid WINDOW_UPDATE frame size");
+			return;
+		}
+
+		boost::uint32_t increment = Http2::decodeUint32(payload) & 0x7fffffff;
+		if (header.streamId == 0) {
+			if (increment == 0) {
+				connectionError(Http2::PROTOCOL_ERROR, "zero WINDOW_UPDATE increment");
+				return;
+			}
+			connSendWindow += increment;
+			if (connSendWindow > Http2::MAX_WINDOW_SIZE) {
+				connectionError(Http2::FLOW_CONTROL_ERROR, "flow control window too large");
+				return;
+			}
+			sendAllResponseBodies();
+		} else {
+			Stream *stream = lookupStream(header.streamId);
+			if (stream == NULL) {
+				if (header.streamId > lastStreamId) {
+					connectionError(Http2::PROTOCOL_ERROR, "WINDOW_UPDATE frame on idle stream");
+				}
+				return;
+			}
+			if (increment == 0) {
+				resetStream(stream, Http2::PROTOCOL_ERROR);
+				return;
+			}
+			stream->sendWindow += increment;
+			if (stream->sendWindow > Http2::MAX_WINDOW_SIZE) {
+				resetStream(stream, Http2::FLOW_CONTROL_ERROR);
+				return;
+			}
+			sendResponseBody(stream);
+		}
+	}
+
+
+	/***** Requests *****/
+
+	static bool isTokenChar(unsigned char ch) {
+		return (ch >= 'a' && ch <= 'z')
+			|| (ch >= 'A' && ch <= 'Z')
+			|| (ch >= '0' && ch <= '9')
+			|| strchr("!#$%&'*+-.^_`|~", ch) != NULL;
+	}
+
+	static bool isValidToken(const string &str) {
+		if (str.empty()) {
+			return false;
+		}
+		for (string::size_type i = 0; i < str.size(); i++) {
+			if (!isTokenChar(str[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool isValidHeaderName(const string &name) {
+		// HTTP/2 requires header names to be in lowercase.
+		for (string::size_type i = 0; i < name.size(); i++) {
+			if (name[i] >= 'A' && name[i] <= 'Z') {
+				return false;
+			}
+		}
+		return isValidToken(name);
+	}
+
+	static bool isValidHeaderValue(const string &value) {
+		// Anything that would let the client inject data into the
+		// HTTP/1 request is forbidden.
+		return value.find_first_of(StaticString("\r\n\0", 3)) == string::npos;
+	}
+
+	static bool isValidRequestTarget(const string &str) {
+		if (str.empty()) {
+			return false;
+		}
+		for (string::size_type i = 0; i < str.size(); i++) {
+			unsigned char ch = str[i];
+			if (ch <= ' ' || ch == 0x7f) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool isConnectionSpecificHeader(const string &name) {
+		return name == "connection"
+			|| name == "keep-alive"
+			|| name == "proxy-connection"
+			|| name == "transfer-encoding"
+			|| name == "upgrade";
+	}
+
+	/**
+	 * Converts the request headers of a stream into an HTTP/1.1 request head.
+	 * Returns NULL on success, or a description of why the request is malformed.
+	 */
+	static const char *buildHttp1Request(const vector<HpackHeader> &headers, bool endStream,
+		string &request, boost::int64_t &contentLength)
+	{
+		const string *method = NULL, *scheme = NULL, *path = NULL, *authority = NULL;
+		const string *host = NULL;
+		string otherHeaders, cookie;
+		bool regularHeaderSeen = false;
+		vector<HpackHeader>::const_iterator it, end = headers.end();
+
+		contentLength = -1;
+		for (it = headers.begin(); it != end; it++) {
+			const string &name = it->name;
+			const string &value = it->value;
+
+			if (!isValidHeaderValue(value)) {
+				return "invalid header value";
+			}
+
+			if (!name.empty() && name[0] == ':') {
+				const string **field;
+				if (regularHeaderSeen) {
+					return "pseudo-header after regular header";
+				} else if (name == ":method") {
+					field = &method;
+				} else if (name == ":scheme") {
+					field = &scheme;
+				} else if (name == ":path") {
+					field = &path;
+				} else if (name == ":authority") {
+					field = &authority;
+				} else {
+					return "unknown pseudo-header";
+				}
+				if (*field != NULL) {
+					return "duplicate pseudo-header";
+				}
+				*field = &value;
+				continue;
+			}
+
+			regularHeaderSeen = true;
+			if (!isValidHeaderName(name)) {
+				return "invalid header name";
+			} else if (isConnectionSpecificHeader(name)) {
+				return "connection-specific header";
+			} else if (name == "te") {
+				if (value != "trailers") {
+					return "invalid TE header";
+				}
+			} else if (name == "cookie") {
+				// HTTP/2 clients may split cookies into multiple headers.
+				if (!cookie.empty()) {
+					cookie.append("; ", 2);
+				}
+				cookie.append(value);
+			} else if (name == "host") {
+				host = &value;
+			} else if (name == "expect") {
+				// We don't forward interim responses, so we
+				// don't pass "Expect: 100-continue" either.
+			} else {
+				if (name == "content-length") {
+					if (value.empty() || value.size() > 18
+					 || value.find_first_not_of("0123456789") != string::npos)
+					{
+						return "invalid Content-Length";
+					}
+					boost::int64_t length = stringToULL(value);
+					if (contentLength != -1 && contentLength != length) {
+						return "conflicting Content-Length headers";
+					}
+					contentLength = length;
+				}
+				otherHeaders.append(name);
+				otherHeaders.append(": ", 2);
+				otherHeaders.append(value);
+				otherHeaders.append("\r\n", 2);
+			}
+		}
+
+		if (method == NULL || scheme == NULL || path == NULL) {
+			// This also rejects CONNECT requests, which we don't support.
+			return "missing pseudo-header";
+		}
+		if (!isValidToken(*method) || !isValidRequestTarget(*path)) {
+			return "invalid request line";
+		}
+		if (authority != NULL && !authority->empty()) {
+			if (!isValidRequestTarget(*authority)) {
+				return "invalid :authority";
+			}
+			host = authority;
+		}
+		if (endStream && contentLength > 0) {
+			return "Content-Length does not match request body";
+		}
+
+		request.reserve(method->size() + path->size() + otherHeaders.size()
+			+ cookie.size() + 128);
+		request.append(*method);
+		request.append(1, ' ');
+		request.append(*path);
+		request.append(" HTTP/1.1\r\n");
+		if (host != NULL) {
+			request.append("Host: ");
+			request.append(*host);
+			request.append("\r\n", 2);
+		}
+		request.append(otherHeaders);
+		if (!cookie.empty()) {
+			request.append("Cookie: ");
+			request.append(cookie);
+			request.append("\r\n", 2);
+		}
+		if (!endStream && contentLength == -1) {
+			request.append("Transfer-Encoding: chunked\r\n");
+		} else if (contentLength == -1) {
+			contentLength = 0;
+		}
+		request.append("Connection: close\r\n\r\n");
+		return NULL;
+	}
+
+	void openStream(boost::uint32_t id, const vector<HpackHeader> &headers, bool endStream) {
+		string request;
+		boost::int64_t contentLength;
+		const char *error;
+
+		error = buildHttp1Request(headers, endStream, request, contentLength);
+		if (error != NULL) {
+			P_DEBUG("HTTP/2 stream " << id << ": malformed request: " << error);
+			appendRstStream(id, Http2::PROTOCOL_ERROR);
+			chargeResetBudget();
+			return;
+		}
+
+		Stream *stream = new Stream();
+		stream->session = this;
+		stream->id = id;
+		stream->handlerData = NULL;
+		stream->requestBuffer.swap(request);
+		stream->contentLength = contentLength;
+		stream->bodyBytesReceived = 0;
+		stream->recvWindow = Http2::DEFAULT_WINDOW_SIZE;
+		stream->remoteEnded = endStream;
+		stream->requestPaused = false;
+		stream->requestDiscarded = false;
+		http_parser_init(&stream->parser, HTTP_RESPONSE);
+		stream->parser.data = stream;
+		stream->headRequest = findHeader(headers, ":method") == "HEAD";
+		stream->lastCallbackWasValue = false;
+		stream->sendWindow = peerInitialWindowSize;
+		stream->responseComplete = false;
+		stream->responseSent = false;
+		stream->responseWaiting = false;
+		streams.insert(make_pair(id, stream));
+		totalStreams++;
+
+		stream->handlerData = handler->http2OpenStream(this, id);
+		if (stream->handlerData == NULL) {
+			refusedStreams++;
+			resetStream(stream, Http2::REFUSED_STREAM);
+			chargeResetBudget();
+			return;
+		}
+		P_TRACE(2, "HTTP/2 stream " << id << ": opened");
+		writeRequestBuffer(stream);
+	}
+
+	static StaticString findHeader(const vector<HpackHeader> &headers, const StaticString &name) {
+		vector<HpackHeader>::const_iterator it, end = headers.end();
+		for (it = headers.begin(); it != end; it++) {
+			if (name == it->name) {
+				return it->value;
+			}
+		}
+		return StaticString();
+	}
+
+	/**
+	 * Passes buffered request data to the handler, and extends the stream's
+	 * receive window once the handler has consumed it. The handler may
+	 * close the stream.
+	 */
+	void writeRequestBuffer(Stream *stream) {
+		if (stream->requestPaused) {
+			return;
+		}
+
+		if (!stream->requestBuffer.empty()) {
+			boost::uint32_t id = stream->id;
+			string data;
+			ssize_t ret;
+
+			data.swap(stream->requestBuffer);
+			ret = handler->http2StreamRequestData(this, stream->handlerData,
+				data.data(), data.size());
+			stream = lookupStream(id);
+			if (stream == NULL) {
+				return;
+			}
+
+			if (ret == -1 || stream->requestDiscarded) {
+				P_TRACE(2, "HTTP/2 stream " << id << ": discarding request body");
+				stream->requestDiscarded = true;
+				stream->requestBuffer.clear();
+			} else if ((size_t) ret < data.size()) {
+				// Keep the rest, plus whatever was received meanwhile,
+				// until the handler calls resumeStreamRequest().
+				data.erase(0, ret);
+				data.append(stream->requestBuffer);
+				stream->requestBuffer.swap(data);
+				stream->requestPaused = true;
+				return;
+			}
+		}
+
+		if (!stream->remoteEnded
+		 && Http2::DEFAULT_WINDOW_SIZE - stream->recvWindow >= Http2::DEFAULT_WINDOW_SIZE / 2)
+		{
+			appendWindowUpdate(stream->id, Http2::DEFAULT_WINDOW_SIZE - stream->recvWindow);
+			stream->recvWindow = Http2::DEFAULT_WINDOW_SIZE;
+		}
+	}
+
+
+	/***** Responses *****/
+
+	static void initializeParserSettings(http_parser_settings &settings) {
+		memset(&settings, 0, sizeof(settings));
+		settings.on_header_field = onResponseHeaderField;
+		settings.on_header_value = onResponseHeaderValue;
+		settings.on_headers_complete = onResponseHeadersComplete;
+		settings.on_body = onResponseBody;
+		settings.on_message_complete = onResponseMessageComplete;
+	}
+
+	static int onResponseHeaderField(http_parser *parser, const char *data, size_t size) {
+		Stream *stream = static_cast<Stream *>(parser->data);
+		if (stream->responseHeaders.empty() || stream->lastCallbackWasValue) {
+			stream->responseHeaders.push_back(HpackHeader());
+			stream->lastCallbackWasValue = false;
+		}
+		stream->responseHeaders.back().name.append(data, size);
+		return 0;
+	}
+
+	static int onResponseHeaderValue(http_parser *parser, const char *data, size_t size) {
+		Stream *stream = static_cast<Stream *>(parser->data);
+		stream->responseHeaders.back().value.append(data, size);
+		stream->lastCallbackWasValue = true;
+		return 0;
+	}
+
+	static int onResponseHeadersComplete(http_parser *parser) {
+		Stream *stream = static_cast<Stream *>(parser->data);
+		stream->session->sendResponseHeaders(stream);
+		// http_parser cannot know by itself that responses
+		// to HEAD requests have no body.
+		return stream->headRequest ? 1 : 0;
+	}
+
+	static int onResponseBody(http_parser *parser, const char *data, size_t size) {
+		Stream *stream = static_cast<Stream *>(parser->data);
+		stream->responseBody.append(data, size);
+		return 0;
+	}
+
+	static int onResponseMessageComplete(http_parser *parser) {
+		Stream *stream = static_cast<Stream *>(parser->data);
+		if (parser->status_code / 100 != 1) {
+			// Anything after the final response is ignored.
+			stream->responseComplete = true;
+			http_parser_pause(parser, 1);
+		}
+		return 0;
+	}
+
+	void sendResponseHeaders(Stream *stream) {
+		string block;
+		vector<HpackHeader>::iterator it, end = stream->responseHeaders.end();
+
+		hpackEncodeStatus(block, stream->parser.status_code);
+		for (it = stream->responseHeaders.begin(); it != end; it++) {
+			string &name = it->name;
+			for (string::size_type i = 0; i < name.size(); i++) {
+				if (name[i] >= 'A' && name[i] <= 'Z') {
+					name[i] = name[i] - 'A' + 'a';
+				}
+			}
+			// The Status header is a CGI-ism which HTTP/1 clients ignore.
+			if (!isConnectionSpecificHeader(name) && name != "status") {
+				hpackEncodeHeader(block, name, it->value);
+			}
+		}
+		stream->responseHeaders.clear();
+		stream->lastCallbackWasValue = false;
+
+		P_TRACE(2, "HTTP/2 stream " << stream->id << ": sending response headers (status "
+			<< stream->parser.status_code << ")");
+		appendHeaderBlock(stream->id, block, false);
+	}
+
+	void sendResponseBody(Stream *stream) {
+		while (true) {
+			boost::int64_t size = std::min<boost::int64_t>(stream->responseBody.size(),
+				peerMaxFrameSize);
+			size = std::min(size, connSendWindow);
+			size = std::min(size, stream->sendWindow);
+			size = std::max<boost::int64_t>(size, 0);
+			bool last = stream->responseComplete
+				&& !stream->responseSent
+				&& (size_t) size == stream->responseBody.size();
+			if (size == 0 && !last) {
+				break;
+			}
+
+			Http2::appendFrameHeader(outbuf, size, Http2::DATA,
+				last ? Http2::FLAG_END_STREAM : 0, stream->id);
+			outbuf.append(stream->responseBody, 0, size);
+			stream->responseBody.erase(0, size);
+			connSendWindow -= size;
+			stream->sendWindow -= size;
+
+			if (last) {
+				P_TRACE(2, "HTTP/2 stream " << stream->id << ": response complete");
+				stream->responseSent = true;
+				if (!stream->remoteEnded) {
+					// Tell the client that we don't need the rest of the request body.
+					appendRstStream(stream->id, Http2::NO_ERROR);
+					stream->remoteEnded = true;
+					stream->requestDiscarded = true;
+					stream->requestBuffer.clear();
+				}
+				if (resetBudget < STREAM_RESET_BUDGET) {
+					resetBudget++;
+				}
+				if (stream->handlerData == NULL) {
+					closeStream(stream);
+				}
+				return;
+			}
+		}
+
+		if (stream->responseWaiting && !isResponseBufferFull(stream)) {
+			stream->responseWaiting = false;
+			writableStreams.push_back(stream->id);
+		}
+	}
+
+	void sendAllResponseBodies() {
+		StreamMap::iterator it = streams.begin();
+		while (it != streams.end()) {
+			Stream *stream = it->second;
+			// sendResponseBody() may close the stream.
+			it++;
+			sendResponseBody(stream);
+		}
+	}
+
+	bool isResponseBufferFull(const Stream *stream) const {
+		return outputThrottled || stream->responseBody.size() >= STREAM_RESPONSE_BUFFER_LIMIT;
+	}
+
+	/**
+	 * Parses (part of) the handler's HTTP/1 response. `size` == 0
+	 * means that the handler has ended the response.
+	 */
+	void processResponseData(Stream *stream, const char *data, size_t size) {
+		http_parser_settings settings;
+		size_t ret;
+
+		initializeParserSettings(settings);
+		ret = http_parser_execute(&stream->parser, &settings, data, size);
+		if (!stream->responseComplete) {
+			if (size == 0) {
+				P_DEBUG("HTTP/2 stream " << stream->id << ": request ended"
+					" before the response was complete");
+				resetStream(stream, Http2::INTERNAL_ERROR);
+				return;
+			} else if (HTTP_PARSER_ERRNO(&stream->parser) != HPE_OK || ret != size) {
+				P_WARN("HTTP/2 stream " << stream->id << ": cannot parse response: "
+					<< http_errno_description(HTTP_PARSER_ERRNO(&stream->parser)));
+				abortResponse(stream);
+				return;
+			}
+		}
+		sendResponseBody(stream);
+	}
+
+	/**
+	 * Resets a stream whose response cannot be sent. The handler is in the
+	 * middle of writing that response, so instead of calling it back, we
+	 * keep the stream around (ignoring the rest of the response) until the
+	 * handler ends it.
+	 */
+	void abortResponse(Stream *stream) {
+		appendRstStream(stream->id, Http2::INTERNAL_ERROR);
+		stream->remoteEnded = true;
+		stream->requestDiscarded = true;
+		stream->requestBuffer.clear();
+		stream->responseComplete = true;
+		stream->responseSent = true;
+		stream->responseBody.clear();
+	}
+
+	/** Use destroy() instead. */
+	~Http2Session() {
+		StreamMap::iterator it, end = streams.end();
+		for (it = streams.begin(); it != end; it++) {
+			delete it->second;
+		}
+	}
+
+	const char *getStateString() const {
+		switch (state) {
+		case EXPECTING_PREFACE:
+			return "EXPECTING_PREFACE";
+		case EXPECTING_SETTINGS:
+			return "EXPECTING_SETTINGS";
+		case ACTIVE:
+			return "ACTIVE";
+		case FINISHED:
+			return "FINISHED";
+		default:
+			return "UNKNOWN";
+		}
+	}
+
+public:
+	Http2Session(Http2SessionHandler *_handler, void *_userData = NULL)
+		: handler(_handler),
+		  userData(_userData),
+		  state(EXPECTING_PREFACE),
+		  draining(false),
+		  outputThrottled(false),
+		  finishReported(false),
+		  destroyPending(false),
+		  depth(0),
+		  headerBlockStreamId(0),
+		  headerBlockFlags(0),
+		  lastStreamId(0),
+		  resetBudget(STREAM_RESET_BUDGET),
+		  connSendWindow(Http2::DEFAULT_WINDOW_SIZE),
+		  connRecvConsumed(0),
+		  peerInitialWindowSize(Http2::DEFAULT_WINDOW_SIZE),
+		  peerMaxFrameSize(Http2::DEFAULT_MAX_FRAME_SIZE),
+		  totalStreams(0),
+		  refusedStreams(0)
+	{
+		// The server connection preface. It's sent with the
+		// first flushOutput(), i.e. at the end of the first feed().
+		appendSettings();
+	}
+
+	/**
+	 * Closes all streams, calling `http2CloseStream()` for the ones that
+	 * the handler hasn't ended yet, and frees the session without passing
+	 * anything to `http2Flush()` anymore. If this is called from a handler
+	 * callback, then the session is freed when the outermost call into the
+	 * session returns.
+	 */
+	void destroy() {
+		if (destroyPending) {
+			return;
+		}
+		enter();
+		destroyPending = true;
+		state = FINISHED;
+		finishReported = true;
+		closeAllStreams();
+		leave();
+	}
+
+	/**
+	 * Processes data received from the client, starting with the connection
+	 * preface.
+	 */
+	void feed(const char *data, size_t size) {
+		size_t pos = 0;
+
+		if (state == FINISHED) {
+			return;
+		}
+		enter();
+		inbuf.append(data, size);
+
+		if (state == EXPECTING_PREFACE) {
+			size_t n = std::min<size_t>(inbuf.size(), Http2::CLIENT_PREFACE_SIZE);
+			if (memcmp(inbuf.data(), Http2::CLIENT_PREFACE, n) != 0) {
+				connectionError(Http2::PROTOCOL_ERROR, "invalid connection preface");
+			} else if (inbuf.size() >= Http2::CLIENT_PREFACE_SIZE) {
+				pos = Http2::CLIENT_PREFACE_SIZE;
+				state = EXPECTING_SETTINGS;
+			}
+		}
+
+		while (state != EXPECTING_PREFACE && state != FINISHED
+		 && inbuf.size() - pos >= Http2::FRAME_HEADER_SIZE)
+		{
+			Http2::FrameHeader header = Http2::decodeFrameHeader(inbuf.data() + pos);
+			if (header.length > Http2::DEFAULT_MAX_FRAME_SIZE) {
+				connectionError(Http2::FRAME_SIZE_ERROR, "frame too large");
+				break;
+			}
+			if (inbuf.size() - pos - Http2::FRAME_HEADER_SIZE < header.length) {
+				break;
+			}
+			processFrame(header, inbuf.data() + pos + Http2::FRAME_HEADER_SIZE);
+			pos += Http2::FRAME_HEADER_SIZE + header.length;
+		}
+
+		if (state == FINISHED) {
+			inbuf.clear();
+		} else {
+			inbuf.erase(0, pos);
+		}
+		leave();
+	}
+
+	/**
+	 * Starts a graceful shutdown: sends GOAWAY, refuses new streams, and
+	 * finishes the session once the current streams are done.
+	 */
+	void shutdown() {
+		if (state == FINISHED || draining) {
+			return;
+		}
+		enter();
+		draining = true;
+		appendGoAway(Http2::NO_ERROR);
+		if (streams.empty()) {
+			finish();
+		}
+		leave();
+	}
+
+	/**
+	 * Makes `shouldPauseStreamResponse()` return true for all streams until
+	 * `resumeOutput()` is called. The owner calls this when the connection's
+	 * output buffer is full.
+	 */
+	void throttleOutput() {
+		outputThrottled = true;
+	}
+
+	void resumeOutput() {
+		StreamMap::iterator it, end = streams.end();
+
+		enter();
+		outputThrottled = false;
+		for (it = streams.begin(); it != end; it++) {
+			Stream *stream = it->second;
+			if (stream->responseWaiting && !isResponseBufferFull(stream)) {
+				stream->responseWaiting = false;
+				writableStreams.push_back(stream->id);
+			}
+		}
+		leave();
+	}
+
+	/**
+	 * Passes (part of) the handler's HTTP/1.1 response for the given stream.
+	 */
+	void writeStreamResponse(boost::uint32_t id, const char *data, size_t size) {
+		Stream *stream = lookupStream(id);
+		if (stream == NULL || size == 0 || stream->responseComplete) {
+			return;
+		}
+		enter();
+		processResponseData(stream, data, size);
+		leave();
+	}
+
+	/**
+	 * Returns whether the handler should stop producing the response for
+	 * the given stream, because the client or the connection cannot keep
+	 * up. If so, the session calls `http2StreamWritable()` once the
+	 * response may continue.
+	 */
+	bool shouldPauseStreamResponse(boost::uint32_t id) {
+		Stream *stream = lookupStream(id);
+		if (stream != NULL && !stream->responseSent && isResponseBufferFull(stream)) {
+			stream->responseWaiting = true;
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	/**
+	 * Called by the handler when it is done with the given stream. The
+	 * session doesn't call the handler for this stream anymore. If the
+	 * response is incomplete, then the client is told that the stream
+	 * failed, unless the response is delimited by the end of the stream.
+	 */
+	void endStreamResponse(boost::uint32_t id) {
+		Stream *stream = lookupStream(id);
+		if (stream == NULL) {
+			return;
+		}
+		enter();
+		stream->handlerData = NULL;
+		stream->requestDiscarded = true;
+		stream->requestBuffer.clear();
+		if (!stream->responseComplete) {
+			processResponseData(stream, "", 0);
+		} else if (stream->responseSent) {
+			closeStream(stream);
+		}
+		leave();
+	}
+
+	/**
+	 * Called by the handler when the response for the given stream cannot
+	 * be completed, e.g. because the application sent a malformed response.
+	 * The stream is reset with INTERNAL_ERROR, and the rest of its response
+	 * is ignored. The other streams are not affected. The handler must still
+	 * call `endStreamResponse()`.
+	 */
+	void resetStreamResponse(boost::uint32_t id) {
+		Stream *stream = lookupStream(id);
+		if (stream == NULL || stream->responseSent) {
+			return;
+		}
+		enter();
+		P_DEBUG("HTTP/2 stream " << id << ": resetting because the response cannot be completed");
+		abortResponse(stream);
+		leave();
+	}
+
+	/**
+	 * Called by the handler when it can consume request data for
+	 * the given stream again, after `http2StreamRequestData()`
+	 * didn't consume everything.
+	 */
+	void resumeStreamRequest(boost::uint32_t id) {
+		Stream *stream = lookupStream(id);
+		if (stream == NULL || !stream->requestPaused) {
+			return;
+		}
+		enter();
+		stream->requestPaused = false;
+		writeRequestBuffer(stream);
+		leave();
+	}
+
+	bool isFinished() const {
+		return state == FINISHED;
+	}
+
+	bool isDraining() const {
+		return draining;
+	}
+
+	unsigned int getStreamCount() const {
+		return streams.size();
+	}
+
+	void *getUserData() const {
+		return userData;
+	}
+
+	Json::Value inspectStateAsJson() const {
+		Json::Value doc;
+		StreamMap::const_iterator it, end = streams.end();
+
+		doc["state"] = getStateString();
+		doc["draining"] = draining;
+		doc["output_throttled"] = outputThrottled;
+		doc["stream_count"] = (Json::UInt) streams.size();
+		doc["last_stream_id"] = lastStreamId;
+		doc["total_streams"] = (Json::UInt64) totalStreams;
+		doc["refused_streams"] = (Json::UInt64) refusedStreams;
+		doc["reset_budget"] = resetBudget;
+		doc["send_window"] = (Json::Int64) connSendWindow;
+		doc["hpack_dynamic_table_size"] = (Json::UInt) hpackDecoder.getDynamicTableSize();
+
+		doc["streams"] = Json::Value(Json::objectValue);
+		for (it = streams.begin(); it != end; it++) {
+			const Stream *stream = it->second;
+			Json::Value subdoc;
+			subdoc["request_bytes_buffered"] = (Json::UInt) stream->requestBuffer.size();
+			subdoc["response_bytes_buffered"] = (Json::UInt) stream->responseBody.size();
+			subdoc["send_window"] = (Json::Int64) stream->sendWindow;
+			subdoc["receive_window"] = (Json::Int64) stream->recvWindow;
+			subdoc["request_ended"] = stream->remoteEnded;
+			subdoc["request_paused"] = stream->requestPaused;
+			subdoc["response_complete"] = stream->responseComplete;
+			subdoc["response_waiting"] = stream->responseWaiting;
+			doc["streams"][toString(stream->id)] = subdoc;
+		}
+
+		return doc;
+	}
+};
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_HTTP2_SESSION_H_ */
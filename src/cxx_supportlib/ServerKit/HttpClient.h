@@ -34,6 +34,9 @@ namespace Passenger {
 namespace ServerKit {
 
 
+class Http2Session;
+
+
 template<typename Request = HttpRequest>
 class BaseHttpClient: public BaseClient {
 public:
@@ -47,11 +50,22 @@ public:
 	 *         currentRequest->httpState != HttpRequest::IN_FREELIST
 	 */
 	Request *currentRequest;
+	/**
+	 * Set if the client has switched to HTTP/2. From then on, every HTTP/2
+	 * stream is served as a separate request of this client, and none of
+	 * them becomes the `currentRequest`.
+	 *
+	 * @invariant
+	 *     if http2Session != NULL:
+	 *         currentRequest == NULL
+	 */
+	Http2Session *http2Session;
 	unsigned int requestsBegun;
 
 	BaseHttpClient(void *server)
 		: BaseClient(server),
 		  currentRequest(NULL),
+		  http2Session(NULL),
 		  requestsBegun(0)
 		{ }
 };
@@ -169,6 +169,13 @@ public:
 	 */
 	int nextRequestEarlyReadError;
 
+	/**
+	 * If this request is an HTTP/2 stream of `client->http2Session`, then
+	 * this is the stream ID. Otherwise 0. The response of such a request
+	 * goes through the session instead of directly to `client->output`.
+	 */
+	boost::uint32_t http2StreamId;
+
 
 	BaseHttpRequest()
 		: refcount(1),
@@ -176,7 +183,8 @@ public:
 		  pool(NULL),
 		  headers(16),
 		  secureHeaders(32),
-		  bodyAlreadyRead(0)
+		  bodyAlreadyRead(0),
+		  http2StreamId(0)
 	{
 		psg_lstr_init(&path);
 		aux.bodyInfo.contentLength = 0; // Sets the entire union to 0.
@@ -42,6 +42,7 @@
 #include <ServerKit/HttpRequestRef.h>
 #include <ServerKit/HttpHeaderParser.h>
 #include <ServerKit/HttpChunkedBodyParser.h>
+#include <ServerKit/Http2Session.h>
 #include <Algorithms/MovingAverage.h>
 #include <Integrations/LibevJsonUtils.h>
 #include <SystemTools/SystemTime.h>
@@ -67,6 +68,7 @@ extern const unsigned int DEFAULT_INTERNAL_SERVER_ERROR_RESPONSE_SIZE;
  *
  *   accept_burst_count           unsigned integer   -   default(32)
  *   client_freelist_limit        unsigned integer   -   default(0)
+ *   http2                        boolean            -   default(false)
  *   min_spare_clients            unsigned integer   -   default(0)
  *   request_freelist_limit       unsigned integer   -   default(1024)
  *   start_reading_after_accept   boolean            -   default(true)
@@ -79,6 +81,7 @@ private:
 		using namespace ConfigKit;
 
 		add("request_freelist_limit", UINT_TYPE, OPTIONAL, 1024);
+		add("http2", BOOL_TYPE, OPTIONAL, false);
 	}
 
 public:
@@ -98,13 +101,16 @@ public:
 
 struct HttpServerConfigRealization {
 	unsigned int requestFreelistLimit;
+	bool http2;
 
 	HttpServerConfigRealization(const ConfigKit::Store &config)
-		: requestFreelistLimit(config["request_freelist_limit"].asUInt())
+		: requestFreelistLimit(config["request_freelist_limit"].asUInt()),
+		  http2(config["http2"].asBool())
 		{ }
 
 	void swap(HttpServerConfigRealization &other) BOOST_NOEXCEPT_OR_NOTHROW {
 		std::swap(requestFreelistLimit, other.requestFreelistLimit);
+		std::swap(http2, other.http2);
 	}
 };
 
@@ -126,12 +132,15 @@ public:
 	FreeRequestList freeRequests;
 	unsigned int freeRequestCount;
 	unsigned long totalRequestsBegun, lastTotalRequestsBegun;
+	unsigned int http2SessionCount;
+	unsigned long totalHttp2Sessions;
 	double requestBeginSpeed1m, requestBeginSpeed1h;
 
 private:
 	/***** Types and nested classes *****/
 
 	typedef BaseServer<DerivedServer, Client> ParentClass;
+	typedef typename ParentClass::ClientRefType ClientRefType;
 
 	class RequestHooksImpl: public HooksImpl {
 	public:
@@ -157,6 +166,46 @@ private:
 
 	friend class RequestHooksImpl;
 
+	class Http2SessionHandlerImpl: public Http2SessionHandler {
+	public:
+		virtual void *http2OpenStream(Http2Session *session, boost::uint32_t streamId) {
+			Client *client     = static_cast<Client *>(session->getUserData());
+			HttpServer *server = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+			return static_cast<BaseHttpRequest *>(server->openHttp2Stream(client, streamId));
+		}
+
+		virtual ssize_t http2StreamRequestData(Http2Session *session, void *stream,
+			const char *data, size_t size)
+		{
+			Request *req       = static_cast<Request *>(static_cast<BaseHttpRequest *>(stream));
+			Client *client     = static_cast<Client *>(req->client);
+			HttpServer *server = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+			return server->feedHttp2StreamRequest(client, req, data, size);
+		}
+
+		virtual void http2StreamWritable(Http2Session *session, void *stream) {
+			Request *req       = static_cast<Request *>(static_cast<BaseHttpRequest *>(stream));
+			Client *client     = static_cast<Client *>(req->client);
+			HttpServer *server = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+			server->onHttp2StreamWritable(client, req);
+		}
+
+		virtual void http2CloseStream(Http2Session *session, void *stream) {
+			Request *req       = static_cast<Request *>(static_cast<BaseHttpRequest *>(stream));
+			Client *client     = static_cast<Client *>(req->client);
+			HttpServer *server = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+			server->closeHttp2Stream(client, req);
+		}
+
+		virtual void http2Flush(Http2Session *session, string &data, bool finished) {
+			Client *client     = static_cast<Client *>(session->getUserData());
+			HttpServer *server = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+			server->writeHttp2Output(client, data, finished);
+		}
+	};
+
+	friend class Http2SessionHandlerImpl;
+
 
 	/***** Configuration *****/
 
@@ -166,6 +215,7 @@ private:
 	/***** Working state *****/
 
 	RequestHooksImpl requestHooksImpl;
+	Http2SessionHandlerImpl http2SessionHandler;
 	object_pool<HttpHeaderParserState> headerParserStatePool;
 
 
@@ -262,7 +312,7 @@ private:
 	/***** Request deinitialization and preparation for next request *****/
 
 	void deinitializeRequestAndAddToFreelist(Client *client, Request *req) {
-		assert(client->currentRequest == req);
+		assert(client->currentRequest == req || req->http2StreamId != 0);
 
 		if (req->httpState != Request::WAITING_FOR_REFERENCES) {
 			req->httpState = Request::WAITING_FOR_REFERENCES;
@@ -326,6 +376,9 @@ private:
 	{
 		if (buffer.size() > 0) {
 			size_t ret;
+			if (OXT_UNLIKELY(shouldSwitchToHttp2(client, req, buffer))) {
+				return switchToHttp2(client, req, buffer);
+			}
 			SKC_TRACE(client, 3, "Parsing " << buffer.size() <<
 				" bytes of HTTP header: \"" << cEscapeString(StaticString(
 					buffer.start, buffer.size())) << "\"");
@@ -399,9 +452,7 @@ private:
 			// Data
 			if (!req->bodyChannel.acceptingInput()) {
 				if (req->bodyChannel.mayAcceptInputLater()) {
-					client->input.stop();
-					req->bodyChannel.consumedCallback =
-						onRequestBodyChannelConsumed;
+					waitForRequestBodyChannelConsumption(client, req);
 					return Channel::Result(0, false);
 				} else {
 					return Channel::Result(0, true);
@@ -435,9 +486,7 @@ private:
 				}
 				return Channel::Result(remaining, false);
 			} else if (req->bodyChannel.mayAcceptInputLater()) {
-				client->input.stop();
-				req->bodyChannel.consumedCallback =
-					onRequestBodyChannelConsumed;
+				waitForRequestBodyChannelConsumption(client, req);
 				return Channel::Result(remaining, false);
 			} else {
 				return Channel::Result(remaining, true);
@@ -466,9 +515,7 @@ private:
 			// Data
 			if (!req->bodyChannel.acceptingInput()) {
 				if (req->bodyChannel.mayAcceptInputLater()) {
-					client->input.stop();
-					req->bodyChannel.consumedCallback =
-						onRequestBodyChannelConsumed;
+					waitForRequestBodyChannelConsumption(client, req);
 					return Channel::Result(0, false);
 				} else {
 					return Channel::Result(0, true);
@@ -508,15 +555,16 @@ private:
 						if (req->bodyChannel.acceptingInput()) {
 							req->bodyChannel.feed(MemoryKit::mbuf());
 						} else if (req->bodyChannel.mayAcceptInputLater()) {
-							client->input.stop();
-							req->bodyChannel.consumedCallback = onRequestBodyChannelConsumed;
+							waitForRequestBodyChannelConsumption(client, req);
 						}
 					}
 				}
 				return Channel::Result(event.consumed, false);
 			case HttpChunkedEvent::ERROR:
 				assert(event.end);
-				client->input.stop();
+				if (req->http2StreamId == 0) {
+					client->input.stop();
+				}
 				req->wantKeepAlive = false;
 				req->bodyChannel.feedError(event.errcode);
 				return Channel::Result(event.consumed, true);
@@ -547,9 +595,7 @@ private:
 			// Data
 			if (!req->bodyChannel.acceptingInput()) {
 				if (req->bodyChannel.mayAcceptInputLater()) {
-					client->input.stop();
-					req->bodyChannel.consumedCallback =
-						onRequestBodyChannelConsumed;
+					waitForRequestBodyChannelConsumption(client, req);
 					return Channel::Result(0, false);
 				} else {
 					return Channel::Result(0, true);
@@ -565,9 +611,7 @@ private:
 				if (req->bodyChannel.acceptingInput()) {
 					return Channel::Result(buffer.size(), false);
 				} else if (req->bodyChannel.mayAcceptInputLater()) {
-					client->input.stop();
-					req->bodyChannel.consumedCallback =
-						onRequestBodyChannelConsumed;
+					waitForRequestBodyChannelConsumption(client, req);
 					return Channel::Result(buffer.size(), false);
 				} else {
 					return Channel::Result(buffer.size(), true);
@@ -599,6 +643,19 @@ private:
 		}
 	}
 
+	/**
+	 * Stops reading the request body until the body channel has consumed
+	 * the data that it has been fed. For HTTP/2 streams, the session stops
+	 * passing data for this stream only, and keeps reading the connection
+	 * for the other streams.
+	 */
+	void waitForRequestBodyChannelConsumption(Client *client, Request *req) {
+		if (req->http2StreamId == 0) {
+			client->input.stop();
+		}
+		req->bodyChannel.consumedCallback = onRequestBodyChannelConsumed;
+	}
+
 	Channel::Result feedBodyChannelError(Client *client, Request *req, int errcode) {
 		if (req->bodyChannel.acceptingInput()) {
 			req->bodyChannel.feedError(errcode);
@@ -620,14 +677,14 @@ private:
 	/***** Miscellaneous *****/
 
 	void writeDefault500Response(Client *client, Request *req) {
-		writeSimpleResponse(client, 500, NULL, DEFAULT_INTERNAL_SERVER_ERROR_RESPONSE);
+		writeSimpleResponse(client, req, 500, NULL, DEFAULT_INTERNAL_SERVER_ERROR_RESPONSE);
 	}
 
 	void endWithErrorResponse(Client **client, Request **req, int code, const StaticString &body) {
 		HeaderTable headers;
 		headers.insert((*req)->pool, "connection", "close");
 		headers.insert((*req)->pool, "cache-control", "no-cache, no-store, must-revalidate");
-		writeSimpleResponse(*client, code, &headers, body);
+		writeSimpleResponse(*client, *req, code, &headers, body);
 		endRequest(client, req);
 	}
 
@@ -690,6 +747,194 @@ private:
 	}
 
 
+	/***** HTTP/2 *****/
+
+	bool shouldSwitchToHttp2(Client *client, Request *req, const MemoryKit::mbuf &buffer) const {
+		// Only clients with prior knowledge are supported, so the
+		// connection preface must be the very first thing we receive.
+		return configRlz.http2
+			&& req->http2StreamId == 0
+			&& client->requestsBegun == 0
+			&& req->parserState.headerParser->state == HttpHeaderParserState::PARSING_NOT_STARTED
+			&& Http2::startsWithClientPreface(buffer.start, buffer.size());
+	}
+
+	Channel::Result switchToHttp2(Client *client, Request *req, const MemoryKit::mbuf &buffer) {
+		SKC_DEBUG(client, "Switching to HTTP/2");
+		deinitializeRequestAndAddToFreelist(client, req);
+		client->currentRequest = NULL;
+		unrefRequest(req, __FILE__, __LINE__);
+
+		client->http2Session = new Http2Session(&http2SessionHandler, client);
+		http2SessionCount++;
+		totalHttp2Sessions++;
+		return processClientDataWhenHttp2(client, buffer, 0);
+	}
+
+	Channel::Result processClientDataWhenHttp2(Client *client, const MemoryKit::mbuf &buffer,
+		int errcode)
+	{
+		if (buffer.size() > 0) {
+			SKC_TRACE(client, 3, "Processing " << buffer.size() << " bytes of HTTP/2 data");
+			client->http2Session->feed(buffer.start, buffer.size());
+			// The session may have finished, in which case the client
+			// may have been disconnected and the session destroyed.
+			if (client->connected() && HttpServer::serverState != HttpServer::ACTIVE) {
+				client->http2Session->shutdown();
+			}
+			return Channel::Result(buffer.size(), !client->connected());
+		} else if (errcode == 0 || errcode == ECONNRESET) {
+			SKC_TRACE(client, 2, "HTTP/2 client sent EOF");
+			this->disconnect(&client);
+			return Channel::Result(0, true);
+		} else {
+			SKC_TRACE(client, 2, "HTTP/2 client socket error: " << getErrorDesc(errcode)
+				<< " (errno=" << errcode << ")");
+			this->disconnect(&client);
+			return Channel::Result(0, true);
+		}
+	}
+
+	/**
+	 * Every HTTP/2 stream is served as a request of the connection's client,
+	 * next to the other streams. Such requests are never the client's
+	 * `currentRequest`; they are owned by the session until they end.
+	 */
+	Request *openHttp2Stream(Client *client, boost::uint32_t streamId) {
+		Request *req;
+
+		if (HttpServer::serverState != HttpServer::ACTIVE) {
+			return NULL;
+		}
+		req = checkoutRequestObject(client);
+		if (req == NULL) {
+			return NULL;
+		}
+
+		SKC_TRACE(client, 2, "Serving HTTP/2 stream " << streamId);
+		// A request object references its client object.
+		// This reference will be removed when the request ends,
+		// in requestReachedZeroRefcount().
+		this->refClient(client, __FILE__, __LINE__);
+		req->client = client;
+		reinitializeRequest(client, req);
+		req->http2StreamId = streamId;
+		return req;
+	}
+
+	/**
+	 * Passes the HTTP/1 request data of an HTTP/2 stream through the same
+	 * parsing code as data from HTTP/1 clients. Returns the number of bytes
+	 * consumed, or -1 if the request doesn't want any more data.
+	 */
+	ssize_t feedHttp2StreamRequest(Client *client, Request *req, const char *data,
+		size_t size)
+	{
+		RequestRef ref(req, __FILE__, __LINE__);
+		MemoryKit::mbuf_pool &mbuf_pool = this->getContext()->mbuf_pool;
+		size_t pos = 0;
+
+		while (pos < size) {
+			if (req->ended()) {
+				return -1;
+			} else if (req->bodyChannel.consumedCallback != NULL) {
+				// Waiting for the body channel; see waitForRequestBodyChannelConsumption().
+				return pos;
+			}
+
+			// Channels may hold on to the buffers that they are fed.
+			MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
+			size_t n = std::min<size_t>(size - pos, buffer.size());
+			memcpy(buffer.start, data + pos, n);
+			Channel::Result result = processHttp2StreamRequestData(client, req,
+				MemoryKit::mbuf(buffer, 0, n));
+			if (result.consumed <= 0 && !req->ended()
+			 && req->bodyChannel.consumedCallback == NULL)
+			{
+				return -1;
+			}
+			pos += std::max<int>(result.consumed, 0);
+		}
+		return pos;
+	}
+
+	Channel::Result processHttp2StreamRequestData(Client *client, Request *req,
+		const MemoryKit::mbuf &buffer)
+	{
+		req->lastDataReceiveTime = ev_now(this->getLoop());
+		if (req->httpState == Request::PARSING_HEADERS) {
+			return processClientDataWhenParsingHeaders(client, req, buffer, 0);
+		}
+		switch (req->bodyType) {
+		case Request::RBT_CONTENT_LENGTH:
+			return processClientDataWhenParsingBody(client, req, buffer, 0);
+		case Request::RBT_CHUNKED:
+			return processClientDataWhenParsingChunkedBody(client, req, buffer, 0);
+		default:
+			// The session only passes request bodies that the request
+			// head announces, and never connection upgrades.
+			return Channel::Result(buffer.size(), false);
+		}
+	}
+
+	/**
+	 * Called when the session closes a stream whose request hasn't ended
+	 * yet, e.g. because the client reset the stream.
+	 */
+	void closeHttp2Stream(Client *client, Request *req) {
+		SKC_TRACE(client, 2, "HTTP/2 stream " << req->http2StreamId << " closed");
+		deinitializeRequestAndAddToFreelist(client, req);
+		unrefRequest(req, __FILE__, __LINE__);
+	}
+
+	void writeHttp2Output(Client *client, const string &data, bool finished) {
+		ClientRefType ref(client, __FILE__, __LINE__);
+		MemoryKit::mbuf_pool &mbuf_pool = this->getContext()->mbuf_pool;
+		size_t pos = 0;
+
+		while (pos < data.size() && client->connected()) {
+			MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
+			size_t size = std::min<size_t>(data.size() - pos, buffer.size());
+			memcpy(buffer.start, data.data() + pos, size);
+			client->output.feedWithoutRefGuard(MemoryKit::mbuf(buffer, 0, size));
+			pos += size;
+		}
+		if (!client->connected()) {
+			return;
+		}
+
+		if (finished) {
+			SKC_TRACE(client, 2, "HTTP/2 session finished");
+			if (!client->output.ended()) {
+				client->output.feedWithoutRefGuard(MemoryKit::mbuf());
+			}
+			if (client->output.endAcked()) {
+				this->disconnect(&client);
+			}
+			// Otherwise, _onClientOutputDataFlushed() disconnects the client.
+		} else if (client->output.passedThreshold()) {
+			SKC_TRACE(client, 2, "HTTP/2 output buffers full; throttling streams");
+			client->http2Session->throttleOutput();
+			client->output.setBuffersFlushedCallback(_onHttp2OutputBuffersFlushed);
+		}
+	}
+
+	static void _onHttp2OutputBuffersFlushed(FileBufferedChannel *_channel) {
+		FileBufferedFdSinkChannel *channel =
+			reinterpret_cast<FileBufferedFdSinkChannel *>(_channel);
+		Client *client = static_cast<Client *>(static_cast<BaseClient *>(
+			channel->getHooks()->userData));
+		HttpServer *self = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+
+		client->output.clearBuffersFlushedCallback();
+		if (client->connected() && client->http2Session != NULL) {
+			SKC_TRACE_FROM_STATIC(self, client, 2,
+				"HTTP/2 output buffers flushed; resuming streams");
+			client->http2Session->resumeOutput();
+		}
+	}
+
+
 	/***** Channel callbacks *****/
 
 	static void _onClientOutputDataFlushed(FileBufferedChannel *_channel) {
@@ -704,6 +949,13 @@ private:
 		{
 			client->currentRequest->httpState = Request::WAITING_FOR_REFERENCES;
 			self->doneWithCurrentRequest(&client);
+		} else if (client->http2Session != NULL && client->connected()) {
+			if (client->output.ended()) {
+				self->disconnect(&client);
+			} else {
+				// Resumes the streams that were paused by throttleHttp2Output().
+				client->http2Session->resumeOutput();
+			}
 		}
 	}
 
@@ -729,6 +981,10 @@ private:
 		if (channel->acceptingInput()) {
 			if (req->bodyFullyRead()) {
 				req->bodyChannel.feed(MemoryKit::mbuf());
+			} else if (req->http2StreamId != 0) {
+				if (client->http2Session != NULL) {
+					client->http2Session->resumeStreamRequest(req->http2StreamId);
+				}
 			} else {
 				client->input.start();
 			}
@@ -781,6 +1037,9 @@ protected:
 		int errcode)
 	{
 		SKC_LOG_EVENT(HttpServer, client, "onClientDataReceived");
+		if (client->http2Session != NULL) {
+			return processClientDataWhenHttp2(client, buffer, errcode);
+		}
 		assert(client->currentRequest != NULL);
 		Request *req = client->currentRequest;
 		RequestRef ref(req, __FILE__, __LINE__);
@@ -839,16 +1098,44 @@ protected:
 			client->currentRequest = NULL;
 			unrefRequest(req, __FILE__, __LINE__);
 		}
+
+		if (client->http2Session != NULL) {
+			// Closes the requests of the streams that are still open.
+			Http2Session *session = client->http2Session;
+			client->http2Session = NULL;
+			http2SessionCount--;
+			session->destroy();
+		}
 	}
 
 	virtual void deinitializeClient(Client *client) {
 		ParentClass::deinitializeClient(client);
 		client->currentRequest = NULL;
+		assert(client->http2Session == NULL);
 	}
 
 	virtual bool shouldDisconnectClientOnShutdown(Client *client) {
-		return client->currentRequest == NULL
-			|| client->currentRequest->upgraded();
+		// HTTP/2 clients are shut down gracefully by onShutdown().
+		return (client->currentRequest == NULL && client->http2Session == NULL)
+			|| (client->currentRequest != NULL && client->currentRequest->upgraded());
+	}
+
+	virtual void onShutdown(bool forceDisconnect) {
+		ParentClass::onShutdown(forceDisconnect);
+		if (forceDisconnect || http2SessionCount == 0) {
+			return;
+		}
+
+		// Shutting down a session may disconnect its client,
+		// so we operate on a copy of the client list.
+		vector<ClientRefType> clients = this->getActiveClients();
+		typename vector<ClientRefType>::iterator it, end = clients.end();
+		for (it = clients.begin(); it != end; it++) {
+			Client *client = it->get();
+			if (client->connected() && client->http2Session != NULL) {
+				client->http2Session->shutdown();
+			}
+		}
 	}
 
 	virtual void onUpdateStatistics() {
@@ -894,7 +1181,11 @@ protected:
 		const MemoryKit::mbuf &buffer, int errcode)
 	{
 		if (errcode != 0 || buffer.empty()) {
-			this->disconnect(&client);
+			if (req->http2StreamId != 0) {
+				endRequest(&client, &req);
+			} else {
+				this->disconnect(&client);
+			}
 		}
 		return Channel::Result(buffer.size(), false);
 	}
@@ -907,6 +1198,14 @@ protected:
 		return false;
 	}
 
+	/**
+	 * Called when a response that was paused because of
+	 * `http2ResponseBufferFull()` may continue.
+	 */
+	virtual void onHttp2StreamWritable(Client *client, Request *req) {
+		// Do nothing.
+	}
+
 	virtual LoggingKit::Level getClientOutputErrorDisconnectionLogLevel(
 		Client *client, int errcode) const
 	{
@@ -925,6 +1224,7 @@ protected:
 		ParentClass::reinitializeClient(client, fd);
 		client->requestsBegun = 0;
 		assert(client->currentRequest == NULL);
+		assert(client->http2Session == NULL);
 	}
 
 	virtual void reinitializeRequest(Client *client, Request *req) {
@@ -936,6 +1236,7 @@ protected:
 		req->wantKeepAlive = false;
 		req->responseBegun = false;
 		req->detectingNextRequestEarlyReadError = false;
+		req->http2StreamId = 0;
 		req->parserState.headerParser = headerParserStatePool.construct();
 		createRequestHeaderParser(this->getContext(), req).initialize();
 		if (OXT_UNLIKELY(req->pool == NULL)) {
@@ -955,19 +1256,11 @@ protected:
 	}
 
 	/**
-	 * Must be idempotent, because onClientDisconnecting() can call it
-	 * after endRequest() is called.
+	 * Releases the request headers, including the buffers that their data
+	 * lives in. Subclasses may call this early if they no longer need the
+	 * headers, e.g. after a connection upgrade.
 	 */
-	virtual void deinitializeRequest(Client *client, Request *req) {
-		if (req->httpState == Request::PARSING_HEADERS
-		 && req->parserState.headerParser != NULL)
-		{
-			headerParserStatePool.destroy(req->parserState.headerParser);
-			req->parserState.headerParser = NULL;
-		}
-
-		psg_lstr_deinit(&req->path);
-
+	void releaseRequestHeaders(Request *req) {
 		HeaderTable::Iterator it(req->headers);
 		while (*it != NULL) {
 			psg_lstr_deinit(&it->header->key);
@@ -984,14 +1277,31 @@ protected:
 			it.next();
 		}
 
+		req->headers.clear();
+		req->secureHeaders.clear();
+	}
+
+	/**
+	 * Must be idempotent, because onClientDisconnecting() can call it
+	 * after endRequest() is called.
+	 */
+	virtual void deinitializeRequest(Client *client, Request *req) {
+		if (req->httpState == Request::PARSING_HEADERS
+		 && req->parserState.headerParser != NULL)
+		{
+			headerParserStatePool.destroy(req->parserState.headerParser);
+			req->parserState.headerParser = NULL;
+		}
+
+		psg_lstr_deinit(&req->path);
+		releaseRequestHeaders(req);
+
 		if (req->pool != NULL && !psg_reset_pool(req->pool, PSG_DEFAULT_POOL_SIZE)) {
 			psg_destroy_pool(req->pool);
 			req->pool = NULL;
 		}
 
 		req->httpState = Request::WAITING_FOR_REFERENCES;
-		req->headers.clear();
-		req->secureHeaders.clear();
 		req->bodyChannel.consumedCallback = NULL;
 		req->bodyChannel.deinitialize();
 	}
@@ -1012,6 +1322,8 @@ public:
 		  freeRequestCount(0),
 		  totalRequestsBegun(0),
 		  lastTotalRequestsBegun(0),
+		  http2SessionCount(0),
+		  totalHttp2Sessions(0),
 		  requestBeginSpeed1m(-1),
 		  requestBeginSpeed1h(-1),
 		  configRlz(ParentClass::config),
@@ -1081,23 +1393,70 @@ public:
 			&& HttpServer::serverState < HttpServer::SHUTTING_DOWN;
 	}
 
+	void writeResponse(Client *client, Request *req, const MemoryKit::mbuf &buffer) {
+		req->responseBegun = true;
+		req->lastDataSendTime = ev_now(this->getLoop());
+		if (req->http2StreamId != 0) {
+			if (client->http2Session != NULL) {
+				client->http2Session->writeStreamResponse(req->http2StreamId,
+					buffer.start, buffer.size());
+			}
+		} else {
+			client->output.feedWithoutRefGuard(buffer);
+		}
+	}
+
+	void writeResponse(Client *client, Request *req, const char *data, unsigned int size) {
+		writeResponse(client, req, MemoryKit::mbuf(data, size));
+	}
+
+	void writeResponse(Client *client, Request *req, const StaticString &data) {
+		writeResponse(client, req, data.data(), data.size());
+	}
+
 	void writeResponse(Client *client, const MemoryKit::mbuf &buffer) {
-		client->currentRequest->responseBegun = true;
-		client->currentRequest->lastDataSendTime = ev_now(this->getLoop());
-		client->output.feedWithoutRefGuard(buffer);
+		writeResponse(client, client->currentRequest, buffer);
 	}
 
 	void writeResponse(Client *client, const char *data, unsigned int size) {
-		writeResponse(client, MemoryKit::mbuf(data, size));
+		writeResponse(client, client->currentRequest, MemoryKit::mbuf(data, size));
 	}
 
 	void writeResponse(Client *client, const StaticString &data) {
-		writeResponse(client, data.data(), data.size());
+		writeResponse(client, client->currentRequest, data.data(), data.size());
+	}
+
+	/**
+	 * Returns whether the response for the given HTTP/2 request should be
+	 * paused because the client cannot receive it fast enough. If so,
+	 * `onHttp2StreamWritable()` is called once it may continue.
+	 */
+	bool http2ResponseBufferFull(Client *client, Request *req) {
+		return client->http2Session != NULL
+			&& client->http2Session->shouldPauseStreamResponse(req->http2StreamId);
+	}
+
+	/**
+	 * Makes `http2ResponseBufferFull()` return true for all streams of the
+	 * given HTTP/2 client until its output has been flushed. Every stream
+	 * that pauses because of this gets its own `onHttp2StreamWritable()`.
+	 */
+	void throttleHttp2Output(Client *client) {
+		if (client->http2Session != NULL) {
+			client->http2Session->throttleOutput();
+		}
 	}
 
 	void
 	writeSimpleResponse(Client *client, int code, const HeaderTable *headers,
 		const StaticString &body)
+	{
+		writeSimpleResponse(client, client->currentRequest, code, headers, body);
+	}
+
+	void
+	writeSimpleResponse(Client *client, Request *req, int code, const HeaderTable *headers,
+		const StaticString &body)
 	{
 		unsigned int headerBufSize = 300;
 
@@ -1110,7 +1469,6 @@ public:
 			}
 		}
 
-		Request *req = client->currentRequest;
 		char *header = (char *) psg_pnalloc(req->pool, headerBufSize);
 		char statusBuffer[50];
 		char *pos = header;
@@ -1196,9 +1554,9 @@ public:
 
 		pos = appendData(pos, end, P_STATIC_STRING("\r\n"));
 
-		writeResponse(client, header, pos - header);
+		writeResponse(client, req, header, pos - header);
 		if (!req->ended() && req->method != HTTP_HEAD) {
-			writeResponse(client, body.data(), body.size());
+			writeResponse(client, req, body.data(), body.size());
 		}
 	}
 
@@ -1215,7 +1573,7 @@ public:
 		}
 
 		SKC_TRACE(c, 2, "Ending request");
-		assert(c->currentRequest == req);
+		assert(c->currentRequest == req || req->http2StreamId != 0);
 
 		if (OXT_UNLIKELY(!req->responseBegun)) {
 			writeDefault500Response(c, req);
@@ -1224,6 +1582,15 @@ public:
 			}
 		}
 
+		if (req->http2StreamId != 0) {
+			// The session has copied the response, so unlike below,
+			// the pool doesn't need to outlive the request.
+			c->http2Session->endStreamResponse(req->http2StreamId);
+			deinitializeRequestAndAddToFreelist(c, req);
+			unrefRequest(req, __FILE__, __LINE__);
+			return true;
+		}
+
 		// The memory buffers that we're writing out during the
 		// FLUSHING_OUTPUT state might live in the palloc pool,
 		// so we want to deinitialize the request while preserving
@@ -1252,6 +1619,34 @@ public:
 		return true;
 	}
 
+	/**
+	 * Ends a request whose response cannot be completed. An HTTP/1 client
+	 * is disconnected, because that is the only way to tell it that the
+	 * response is broken. For an HTTP/2 stream, only that stream is reset;
+	 * the other streams of the connection go on.
+	 */
+	void endRequestWithError(Client **client, Request **request, const StaticString &message,
+		LoggingKit::Level logLevel = LoggingKit::WARN)
+	{
+		Request *req = *request;
+
+		if (req->http2StreamId == 0) {
+			*request = NULL;
+			this->disconnectWithError(client, message, logLevel);
+			return;
+		}
+
+		SKC_LOG(*client, logLevel, "Resetting HTTP/2 stream " << req->http2StreamId
+			<< " with error: " << message);
+		if ((*client)->http2Session != NULL) {
+			(*client)->http2Session->resetStreamResponse(req->http2StreamId);
+		}
+		// Don't let endRequest() write a default response
+		// into a stream that has been reset.
+		req->responseBegun = true;
+		endRequest(client, request);
+	}
+
 	void endAsBadRequest(Client **client, Request **req, const StaticString &body) {
 		endWithErrorResponse(client, req, 400, body);
 	}
@@ -1279,6 +1674,8 @@ public:
 		Json::Value doc = ParentClass::inspectStateAsJson();
 		doc["free_request_count"] = freeRequestCount;
 		doc["total_requests_begun"] = (Json::UInt64) totalRequestsBegun;
+		doc["http2_session_count"] = http2SessionCount;
+		doc["total_http2_sessions"] = (Json::UInt64) totalHttp2Sessions;
 		doc["request_begin_speed"]["1m"] = averageSpeedToJson(
 			capFloatPrecision(requestBeginSpeed1m * 60),
 			"minute", "1 minute", -1);
@@ -1293,6 +1690,9 @@ public:
 		if (client->currentRequest) {
 			doc["current_request"] = inspectRequestStateAsJson(client->currentRequest);
 		}
+		if (client->http2Session != NULL) {
+			doc["http2_session"] = client->http2Session->inspectStateAsJson();
+		}
 		doc["requests_begun"] = client->requestsBegun;
 		doc["lingering_request_count"] = client->lingeringRequestCount;
 		return doc;
@@ -441,6 +441,9 @@ private:
 		this->onUpdateStatistics();
 		this->onFinalizeStatisticsUpdate();
 
+		// Return memory that was needed for a traffic spike back to the OS.
+		MemoryKit::mbuf_pool_trim(&ctx->mbuf_pool, ctx->config.mbufPoolMaxSpareMemory);
+
 		timer.repeat = timeToNextMultipleD(5, ev_now(this->getLoop()));
 		timer.again();
 	}
@@ -0,0 +1,474 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_SPOOL_ARENA_H_
+#define _PASSENGER_SERVER_KIT_SPOOL_ARENA_H_
+
+#include <boost/cstdint.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/system_calls.hpp>
+#include <sys/types.h>
+#include <uv.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <psg_sysqueue.h>
+#include <jsoncpp/json.h>
+#include <LoggingKit/LoggingKit.h>
+#include <SafeLibev.h>
+#include <Exceptions.h>
+#include <JsonTools/JsonUtils.h>
+
+namespace Passenger {
+namespace ServerKit {
+
+using namespace std;
+
+
+/**
+ * An entry in a SpoolArena's wait list. See `SpoolArena::waitForSpace()`.
+ */
+struct SpoolArenaWaiter {
+	TAILQ_ENTRY(SpoolArenaWaiter) next;
+	void (*callback)(SpoolArenaWaiter *waiter);
+	void *userData;
+	bool waiting;
+
+	SpoolArenaWaiter()
+		: callback(NULL),
+		  userData(NULL),
+		  waiting(false)
+		{ }
+};
+
+/**
+ * A single temp file that the FileBufferedChannels of an event loop spool
+ * their data to, instead of each creating, unlinking and closing a file of
+ * their own. The file is divided into fixed-size extents. A channel obtains
+ * extents as it writes and gives them back once they have been read, after
+ * which they are reused by other channels. The disk space of freed extents is
+ * returned to the filesystem with a punched hole (where supported).
+ *
+ * The file is created, and holes are punched, in the libuv thread pool so
+ * that the event loop never blocks on the filesystem. Until the file has been
+ * created `isOpen()` is false and the arena must not be used. Freed extents are
+ * only reused after their hole has been punched, because a hole punched later
+ * would destroy data written into the extent in the meantime. Extents freed
+ * while a punch is in progress are punched together in the next one.
+ *
+ * The total size of extents in use may be limited. Once that limit is reached,
+ * `allocate()` fails. Callers may then register themselves with
+ * `waitForSpace()`, and are called back (in the next event loop iteration)
+ * when extents have been freed.
+ *
+ * This class is not thread-safe. It must only be used from the event loop
+ * that it belongs to.
+ */
+class SpoolArena: public boost::enable_shared_from_this<SpoolArena>,
+	public boost::noncopyable
+{
+private:
+	TAILQ_HEAD(WaiterList, SpoolArenaWaiter);
+
+	enum State {
+		CREATING_FILE,
+		OPEN,
+		CREATION_FAILED
+	};
+
+	struct FileCreationJob {
+		uv_work_t req;
+		boost::shared_ptr<SpoolArena> self;
+		string dir;
+		string path;
+		int fd;
+		int errcode;
+	};
+
+	struct HolePunchJob {
+		uv_work_t req;
+		boost::shared_ptr<SpoolArena> self;
+		int fd;
+		unsigned int extentSize;
+		vector<off_t> offsets;
+		int errcode;
+		bool unsupported;
+	};
+
+	SafeLibevPtr libev;
+	uv_loop_t *libuv;
+	string dir;
+	string path;
+	int fd;
+	State state;
+	unsigned int extentSize;
+	/** Maximum total size of the extents in use, or 0 for no limit. */
+	boost::uint64_t maxSize;
+	/** Offset at which the next new extent will be placed. */
+	boost::uint64_t fileSize;
+	vector<off_t> freeExtents;
+	/** Freed extents whose hole has not been punched yet. */
+	vector<off_t> extentsToPunch;
+	unsigned int extentsInUse;
+	/** Freed extents that are in `extentsToPunch` or in a running HolePunchJob. */
+	unsigned int extentsBeingPunched;
+	unsigned int nwaiters;
+	WaiterList waiters;
+	bool wakeupScheduled;
+	bool punching;
+	bool punchHoles;
+
+	static void createFileInThreadPool(uv_work_t *req) {
+		FileCreationJob *job = static_cast<FileCreationJob *>(req->data);
+
+		#ifdef O_TMPFILE
+			job->fd = ::open(job->dir.c_str(), O_TMPFILE | O_RDWR | O_EXCL, 0600);
+			if (job->fd != -1) {
+				job->path = job->dir;
+				return;
+			}
+			// The filesystem doesn't support O_TMPFILE.
+		#endif
+
+		string tmpl = job->dir + "/spool.XXXXXX";
+		vector<char> buf(tmpl.begin(), tmpl.end());
+		buf.push_back('\0');
+		job->fd = mkstemp(&buf[0]);
+		if (job->fd == -1) {
+			job->errcode = errno;
+			job->path = tmpl;
+			return;
+		}
+		job->path = &buf[0];
+		// Nobody else needs to open it.
+		unlink(job->path.c_str());
+	}
+
+	static void _fileCreated(uv_work_t *req, int status) {
+		FileCreationJob *job = static_cast<FileCreationJob *>(req->data);
+		job->self->fileCreated(job);
+		delete job;
+	}
+
+	void fileCreated(FileCreationJob *job) {
+		if (job->fd == -1) {
+			P_ERROR("Cannot create spool arena file " << job->path << ": "
+				<< strerror(job->errcode) << " (errno=" << job->errcode
+				<< "). Falling back to per-channel buffer files");
+			state = CREATION_FAILED;
+		} else {
+			P_LOG_FILE_DESCRIPTOR_OPEN4(job->fd, __FILE__, __LINE__, "SpoolArena file");
+			fd = job->fd;
+			path = job->path;
+			state = OPEN;
+		}
+	}
+
+	static void punchHolesInThreadPool(uv_work_t *req) {
+		HolePunchJob *job = static_cast<HolePunchJob *>(req->data);
+
+		#if defined(FALLOC_FL_PUNCH_HOLE) && defined(FALLOC_FL_KEEP_SIZE)
+			vector<off_t>::const_iterator it, end = job->offsets.end();
+			for (it = job->offsets.begin(); it != end; it++) {
+				int ret;
+				do {
+					ret = fallocate(job->fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+						*it, job->extentSize);
+				} while (ret == -1 && errno == EINTR);
+				if (ret == -1) {
+					job->errcode = errno;
+					if (job->errcode == EOPNOTSUPP || job->errcode == ENOSYS) {
+						job->unsupported = true;
+						return;
+					}
+				}
+			}
+		#else
+			job->unsupported = true;
+		#endif
+	}
+
+	static void _holesPunched(uv_work_t *req, int status) {
+		HolePunchJob *job = static_cast<HolePunchJob *>(req->data);
+		job->self->holesPunched(job);
+		delete job;
+	}
+
+	void holesPunched(HolePunchJob *job) {
+		if (job->unsupported) {
+			P_DEBUG("The filesystem of spool arena file " << path
+				<< " does not support punching holes; freed extents keep"
+				" their disk space");
+			punchHoles = false;
+		} else if (job->errcode != 0) {
+			P_DEBUG("Cannot punch hole in spool arena file " << path
+				<< ": " << strerror(job->errcode) << " (errno="
+				<< job->errcode << ")");
+		}
+		makeExtentsFree(job->offsets);
+		punching = false;
+		if (!punchHoles) {
+			makeExtentsFree(extentsToPunch);
+			extentsToPunch.clear();
+		} else if (!extentsToPunch.empty()) {
+			startPunchingHoles();
+		}
+		scheduleWakeup();
+	}
+
+	void startPunchingHoles() {
+		HolePunchJob *job = new HolePunchJob();
+		job->req.data = job;
+		job->self = shared_from_this();
+		job->fd = fd;
+		job->extentSize = extentSize;
+		job->offsets.swap(extentsToPunch);
+		job->errcode = 0;
+		job->unsupported = false;
+
+		int result = uv_queue_work(libuv, &job->req, punchHolesInThreadPool, _holesPunched);
+		if (result != 0) {
+			P_DEBUG("Cannot punch holes in spool arena file " << path
+				<< ": cannot initiate I/O operation: " << uv_strerror(result)
+				<< " (errno=" << -result << ")");
+			makeExtentsFree(job->offsets);
+			delete job;
+			scheduleWakeup();
+		} else {
+			punching = true;
+		}
+	}
+
+	void makeExtentsFree(const vector<off_t> &offsets) {
+		assert(extentsBeingPunched >= offsets.size());
+		freeExtents.insert(freeExtents.end(), offsets.begin(), offsets.end());
+		extentsBeingPunched -= offsets.size();
+	}
+
+	bool mayAllocateNewExtent() const {
+		return maxSize == 0
+			|| (boost::uint64_t) (extentsInUse + extentsBeingPunched + 1)
+				* extentSize <= maxSize;
+	}
+
+	void scheduleWakeup() {
+		if (!wakeupScheduled && nwaiters > 0) {
+			wakeupScheduled = true;
+			libev->runLater(boost::bind(&SpoolArena::wakeWaiters,
+				shared_from_this()));
+		}
+	}
+
+	void wakeWaiters() {
+		wakeupScheduled = false;
+		while (!TAILQ_EMPTY(&waiters) && hasSpace()) {
+			SpoolArenaWaiter *waiter = TAILQ_FIRST(&waiters);
+			TAILQ_REMOVE(&waiters, waiter, next);
+			nwaiters--;
+			waiter->waiting = false;
+			waiter->callback(waiter);
+		}
+	}
+
+public:
+	/**
+	 * The arena file will be created in `_dir` once `open()` is called.
+	 */
+	SpoolArena(const SafeLibevPtr &_libev, uv_loop_t *_libuv, const string &_dir,
+		unsigned int _extentSize, boost::uint64_t _maxSize = 0)
+		: libev(_libev),
+		  libuv(_libuv),
+		  dir(_dir),
+		  fd(-1),
+		  state(CREATING_FILE),
+		  extentSize(_extentSize),
+		  maxSize(_maxSize),
+		  fileSize(0),
+		  extentsInUse(0),
+		  extentsBeingPunched(0),
+		  nwaiters(0),
+		  wakeupScheduled(false),
+		  punching(false),
+		  punchHoles(true)
+	{
+		assert(extentSize > 0);
+		TAILQ_INIT(&waiters);
+	}
+
+	~SpoolArena() {
+		P_ASSERT_EQ(nwaiters, 0u);
+		if (fd != -1) {
+			P_LOG_FILE_DESCRIPTOR_CLOSE(fd);
+			oxt::syscalls::close(fd);
+		}
+	}
+
+	/**
+	 * Starts creating the arena file in the background. `isOpen()` becomes
+	 * true once that has succeeded. If it fails, an error is logged and
+	 * `isOpen()` stays false.
+	 */
+	void open() {
+		FileCreationJob *job = new FileCreationJob();
+		job->req.data = job;
+		job->self = shared_from_this();
+		job->dir = dir;
+		job->fd = -1;
+		job->errcode = 0;
+
+		int result = uv_queue_work(libuv, &job->req, createFileInThreadPool, _fileCreated);
+		if (result != 0) {
+			job->path = dir;
+			job->errcode = -result;
+			fileCreated(job);
+			delete job;
+		}
+	}
+
+	bool isOpen() const {
+		return state == OPEN;
+	}
+
+	int getFd() const {
+		return fd;
+	}
+
+	unsigned int getExtentSize() const {
+		return extentSize;
+	}
+
+	void setMaxSize(boost::uint64_t value) {
+		maxSize = value;
+		scheduleWakeup();
+	}
+
+	bool hasSpace() const {
+		return !freeExtents.empty() || mayAllocateNewExtent();
+	}
+
+	/**
+	 * Allocates an extent and stores its offset in the arena file into
+	 * `offset`. Returns false if the size limit has been reached.
+	 */
+	bool allocate(off_t &offset) {
+		if (!freeExtents.empty()) {
+			offset = freeExtents.back();
+			freeExtents.pop_back();
+		} else if (mayAllocateNewExtent()) {
+			offset = fileSize;
+			fileSize += extentSize;
+		} else {
+			return false;
+		}
+		extentsInUse++;
+		return true;
+	}
+
+	/**
+	 * Gives back an extent obtained through `allocate()`. Its data is
+	 * discarded.
+	 */
+	void release(off_t offset) {
+		assert(extentsInUse > 0);
+		extentsInUse--;
+		if (punchHoles) {
+			extentsToPunch.push_back(offset);
+			extentsBeingPunched++;
+			if (!punching) {
+				startPunchingHoles();
+			}
+		} else {
+			freeExtents.push_back(offset);
+			scheduleWakeup();
+		}
+	}
+
+	/**
+	 * Registers `waiter` to be called back once `hasSpace()` becomes true.
+	 * `waiter->callback` is called once, after which the waiter is no longer
+	 * registered.
+	 */
+	void waitForSpace(SpoolArenaWaiter *waiter) {
+		assert(!waiter->waiting);
+		assert(waiter->callback != NULL);
+		waiter->waiting = true;
+		TAILQ_INSERT_TAIL(&waiters, waiter, next);
+		nwaiters++;
+		if (hasSpace()) {
+			scheduleWakeup();
+		}
+	}
+
+	void cancelWait(SpoolArenaWaiter *waiter) {
+		if (waiter->waiting) {
+			TAILQ_REMOVE(&waiters, waiter, next);
+			nwaiters--;
+			waiter->waiting = false;
+		}
+	}
+
+	Json::Value inspectStateAsJson() const {
+		Json::Value doc;
+		switch (state) {
+		case CREATING_FILE:
+			doc["state"] = "CREATING_FILE";
+			break;
+		case OPEN:
+			doc["state"] = "OPEN";
+			doc["path"] = path;
+			break;
+		case CREATION_FAILED:
+			doc["state"] = "CREATION_FAILED";
+			break;
+		}
+		doc["extent_size"] = byteSizeToJson(extentSize);
+		doc["extents_in_use"] = extentsInUse;
+		doc["extents_being_punched"] = extentsBeingPunched;
+		doc["free_extents"] = (Json::UInt) freeExtents.size();
+		doc["in_use"] = byteSizeToJson((size_t) extentsInUse * extentSize);
+		doc["file_size"] = byteSizeToJson((size_t) fileSize);
+		if (maxSize > 0) {
+			doc["max_size"] = byteSizeToJson((size_t) maxSize);
+		}
+		doc["waiters"] = nwaiters;
+		return doc;
+	}
+};
+
+typedef boost::shared_ptr<SpoolArena> SpoolArenaPtr;
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_SPOOL_ARENA_H_ */
@@ -676,6 +676,29 @@ escapeHTML(const StaticString &input) {
 	return result;
 }
 
+string
+escapePrometheusLabelValue(const StaticString &input) {
+	string result;
+	const char *current = input.data();
+	const char *end = current + input.size();
+
+	result.reserve(input.size());
+	while (current < end) {
+		char c = *current;
+		if (c == '\\') {
+			result.append("\\\\");
+		} else if (c == '"') {
+			result.append("\\\"");
+		} else if (c == '\n') {
+			result.append("\\n");
+		} else {
+			result.append(1, c);
+		}
+		current++;
+	}
+	return result;
+}
+
 string
 urldecode(const StaticString &url) {
 	const char *pos = url.data();
@@ -479,6 +479,12 @@ string cEscapeString(const StaticString &input);
  */
 string escapeHTML(const StaticString &input);
 
+/**
+ * Escapes the given string for use as a label value in the Prometheus text
+ * exposition format, i.e. escapes backslashes, double quotes and newlines.
+ */
+string escapePrometheusLabelValue(const StaticString &input);
+
 /**
  * URL-decodes the given string.
  *
@@ -0,0 +1,351 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SYSTEM_TOOLS_CPU_TOPOLOGY_H_
+#define _PASSENGER_SYSTEM_TOOLS_CPU_TOPOLOGY_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cerrno>
+#include <sys/types.h>
+#include <unistd.h>
+#include <dirent.h>
+#ifdef __linux__
+	#include <sched.h>
+#endif
+#include <StaticString.h>
+#include <FileTools/FileManip.h>
+#include <StrIntTools/StrIntUtils.h>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * Describes the NUMA nodes of this machine and the CPUs that belong to
+ * them, limited to the CPUs that this process is allowed to run on. On
+ * systems without NUMA information (including non-Linux systems), the
+ * topology consists of a single node that contains all CPUs.
+ *
+ * Nodes are referred to by their index in this object, which may differ
+ * from the node number that the kernel assigned to them.
+ */
+class CpuTopology {
+public:
+	struct Node {
+		/** The node number as assigned by the kernel. */
+		unsigned int id;
+		/** Sorted. */
+		vector<unsigned int> cpus;
+	};
+
+private:
+	vector<Node> nodes;
+
+	static bool parseNumber(const char *&pos, const char *end, unsigned int &result) {
+		const char *start = pos;
+		result = 0;
+		while (pos < end && *pos >= '0' && *pos <= '9') {
+			result = result * 10 + (*pos - '0');
+			pos++;
+		}
+		return pos != start;
+	}
+
+	static bool compareNodeIds(const Node &a, const Node &b) {
+		return a.id < b.id;
+	}
+
+	static vector<unsigned int> intersect(const vector<unsigned int> &a,
+		const vector<unsigned int> &b)
+	{
+		vector<unsigned int> result;
+		set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+			back_inserter(result));
+		return result;
+	}
+
+	static vector<unsigned int> getAllowedCpus() {
+		vector<unsigned int> result;
+
+		#ifdef __linux__
+			cpu_set_t cpus;
+			CPU_ZERO(&cpus);
+			if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) {
+				for (unsigned int i = 0; i < CPU_SETSIZE; i++) {
+					if (CPU_ISSET(i, &cpus)) {
+						result.push_back(i);
+					}
+				}
+			}
+		#endif
+		if (result.empty()) {
+			unsigned int n = std::max(1u, boost::thread::hardware_concurrency());
+			for (unsigned int i = 0; i < n; i++) {
+				result.push_back(i);
+			}
+		}
+		return result;
+	}
+
+public:
+	/**
+	 * Parses a CPU list in the format that Linux uses in sysfs and in
+	 * cpusets, e.g. "0-3,8,10-11". The result is sorted and contains no
+	 * duplicates. Returns false if the string is malformed.
+	 */
+	static bool parseCpuList(const StaticString &str, vector<unsigned int> &cpus) {
+		const char *pos = str.data();
+		const char *end = str.data() + str.size();
+
+		cpus.clear();
+		while (end > pos && (end[-1] == '\n' || end[-1] == ' ')) {
+			end--;
+		}
+		while (pos < end) {
+			unsigned int first, last;
+
+			if (!parseNumber(pos, end, first)) {
+				return false;
+			}
+			last = first;
+			if (pos < end && *pos == '-') {
+				pos++;
+				if (!parseNumber(pos, end, last) || last < first) {
+					return false;
+				}
+			}
+			for (unsigned int i = first; i <= last; i++) {
+				cpus.push_back(i);
+			}
+
+			if (pos < end) {
+				if (*pos != ',') {
+					return false;
+				}
+				pos++;
+			}
+		}
+
+		sort(cpus.begin(), cpus.end());
+		cpus.erase(unique(cpus.begin(), cpus.end()), cpus.end());
+		return true;
+	}
+
+	/**
+	 * The inverse of parseCpuList(). `cpus` must be sorted.
+	 */
+	static string formatCpuList(const vector<unsigned int> &cpus) {
+		string result;
+		unsigned int i = 0;
+
+		while (i < cpus.size()) {
+			unsigned int j = i;
+			while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+				j++;
+			}
+			if (!result.empty()) {
+				result.append(1, ',');
+			}
+			result.append(toString(cpus[i]));
+			if (j > i) {
+				result.append(1, '-');
+				result.append(toString(cpus[j]));
+			}
+			i = j + 1;
+		}
+		return result;
+	}
+
+	/**
+	 * Binds the given process (0 for the calling process) to the given CPUs.
+	 * Returns 0 on success, or an errno code on failure. Always fails with
+	 * ENOSYS on systems that don't support this.
+	 *
+	 * sched_setaffinity() only binds a single thread. If `allThreads` is true,
+	 * then the other threads listed in /proc/<pid>/task are bound too. A
+	 * thread that is created by a not yet bound thread inherits the old
+	 * affinity, so the list is scanned until it yields no new threads.
+	 * Without /proc, only the main thread is bound.
+	 */
+	static int setProcessAffinity(pid_t pid, const vector<unsigned int> &cpus,
+		bool allThreads = false)
+	{
+		#ifdef __linux__
+			cpu_set_t set;
+			vector<unsigned int>::const_iterator it;
+
+			CPU_ZERO(&set);
+			for (it = cpus.begin(); it != cpus.end(); it++) {
+				if (*it < CPU_SETSIZE) {
+					CPU_SET(*it, &set);
+				}
+			}
+			if (sched_setaffinity(pid, sizeof(set), &set) != 0) {
+				return errno;
+			}
+			if (!allThreads) {
+				return 0;
+			}
+
+			string taskDir = "/proc/" + toString(pid == 0 ? getpid() : pid) + "/task";
+			vector<pid_t> boundThreads;
+			bool foundNewThreads = true;
+			boundThreads.push_back(pid == 0 ? getpid() : pid);
+			while (foundNewThreads) {
+				DIR *dir = opendir(taskDir.c_str());
+				struct dirent *ent;
+
+				if (dir == NULL) {
+					return 0;
+				}
+				foundNewThreads = false;
+				while ((ent = readdir(dir)) != NULL) {
+					if (ent->d_name[0] < '0' || ent->d_name[0] > '9') {
+						continue;
+					}
+					pid_t tid = (pid_t) atoi(ent->d_name);
+					if (std::find(boundThreads.begin(), boundThreads.end(), tid)
+						!= boundThreads.end())
+					{
+						continue;
+					}
+					boundThreads.push_back(tid);
+					foundNewThreads = true;
+					// The thread may have exited in the mean time.
+					if (sched_setaffinity(tid, sizeof(set), &set) != 0 && errno != ESRCH) {
+						int e = errno;
+						closedir(dir);
+						return e;
+					}
+				}
+				closedir(dir);
+			}
+			return 0;
+		#else
+			return ENOSYS;
+		#endif
+	}
+
+	/**
+	 * Detects the topology from the given sysfs directory (which contains
+	 * `node<N>/cpulist` files), limited to `allowedCpus` (which must be sorted).
+	 * Nodes without any allowed CPUs are left out.
+	 */
+	static CpuTopology detect(const string &sysfsNodeDir,
+		const vector<unsigned int> &allowedCpus)
+	{
+		CpuTopology topology;
+		DIR *dir = opendir(sysfsNodeDir.c_str());
+
+		if (dir != NULL) {
+			struct dirent *ent;
+			while ((ent = readdir(dir)) != NULL) {
+				string name(ent->d_name);
+				if (!startsWith(name, "node") || name.size() == 4
+				 || name.find_first_not_of("0123456789", 4) != string::npos)
+				{
+					continue;
+				}
+
+				string path = sysfsNodeDir + "/" + name + "/cpulist";
+				Node node;
+				if (fileExists(path) && parseCpuList(unsafeReadFile(path), node.cpus)) {
+					node.id = stringToUint(name.substr(4));
+					node.cpus = intersect(node.cpus, allowedCpus);
+					if (!node.cpus.empty()) {
+						topology.nodes.push_back(node);
+					}
+				}
+			}
+			closedir(dir);
+		}
+
+		if (topology.nodes.empty()) {
+			Node node;
+			node.id = 0;
+			node.cpus = allowedCpus;
+			topology.nodes.push_back(node);
+		} else {
+			sort(topology.nodes.begin(), topology.nodes.end(), compareNodeIds);
+		}
+		return topology;
+	}
+
+	/**
+	 * Detects the topology of this machine, limited to the CPUs that this
+	 * process may run on.
+	 */
+	static CpuTopology detect() {
+		return detect("/sys/devices/system/node", getAllowedCpus());
+	}
+
+	unsigned int getNodeCount() const {
+		return nodes.size();
+	}
+
+	const Node &getNode(unsigned int index) const {
+		return nodes[index];
+	}
+
+	/**
+	 * Determines where the thread with the given index (of a group of threads
+	 * that are to be spread over the machine) should run. Consecutive
+	 * threads are assigned to different nodes, so that each node gets its
+	 * fair share of threads, and threads on the same node get different CPUs
+	 * as long as there are enough of them.
+	 */
+	void getThreadPlacement(unsigned int threadIndex, unsigned int &nodeIndex,
+		unsigned int &cpu) const
+	{
+		nodeIndex = threadIndex % nodes.size();
+		const vector<unsigned int> &cpus = nodes[nodeIndex].cpus;
+		cpu = cpus[(threadIndex / nodes.size()) % cpus.size()];
+	}
+
+	string inspect() const {
+		string result;
+		for (unsigned int i = 0; i < nodes.size(); i++) {
+			if (i > 0) {
+				result.append("; ");
+			}
+			result.append("node " + toString(nodes[i].id) + ": CPUs "
+				+ formatCpuList(nodes[i].cpus));
+		}
+		return result;
+	}
+};
+
+typedef boost::shared_ptr<CpuTopology> CpuTopologyPtr;
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_SYSTEM_TOOLS_CPU_TOPOLOGY_H_ */
@@ -55,4 +55,47 @@ pp_cached_file_stat_perform(PP_CachedFileStat *cstat,
 	}
 }
 
+/**
+ * Attaches the stat cache that is shared with the Core in the given
+ * instance directory, creating it if the Core hasn't done so yet.
+ * Processes forked afterwards share it too. Returns 0 on success,
+ * or -1 with errno set on failure.
+ */
+int
+pp_cached_file_stat_attach_shared(PP_CachedFileStat *cstat, const char *instance_dir) {
+	try {
+		((Passenger::CachedFileStat *) cstat)->setSharedCache(
+			boost::make_shared<Passenger::SharedFileStatCache>(
+				Passenger::SharedFileStatCache::getPathInInstanceDir(instance_dir),
+				(unsigned int) Passenger::SharedFileStatCache::DEFAULT_SIZE));
+		return 0;
+	} catch (const Passenger::SystemException &e) {
+		errno = e.code();
+		return -1;
+	} catch (const Passenger::RuntimeException &) {
+		errno = EINVAL;
+		return -1;
+	} catch (const std::bad_alloc &) {
+		errno = ENOMEM;
+		return -1;
+	}
+}
+
+void
+pp_cached_file_stat_get_shared_stats(PP_CachedFileStat *cstat,
+                                     unsigned long long *hits,
+                                     unsigned long long *misses)
+{
+	const boost::shared_ptr<Passenger::SharedFileStatCache> &sharedCache =
+		((Passenger::CachedFileStat *) cstat)->getSharedCache();
+	if (sharedCache != NULL) {
+		Passenger::SharedFileStatCache::Stats stats = sharedCache->getStats();
+		*hits = stats.hits;
+		*misses = stats.misses;
+	} else {
+		*hits = 0;
+		*misses = 0;
+	}
+}
+
 } // extern "C"
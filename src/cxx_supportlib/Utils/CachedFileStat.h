@@ -43,6 +43,10 @@ int  pp_cached_file_stat_perform(PP_CachedFileStat *cstat,
                                  const char *filename,
                                  struct stat *buf,
                                  unsigned int throttle_rate);
+int  pp_cached_file_stat_attach_shared(PP_CachedFileStat *cstat, const char *instance_dir);
+void pp_cached_file_stat_get_shared_stats(PP_CachedFileStat *cstat,
+                                          unsigned long long *hits,
+                                          unsigned long long *misses);
 
 
 #ifdef __cplusplus
@@ -41,6 +41,7 @@
 #include <StaticString.h>
 #include <SystemTools/SystemTime.h>
 #include <DataStructures/StringMap.h>
+#include <Utils/SharedFileStatCache.h>
 
 namespace Passenger {
 
@@ -56,6 +57,10 @@ using namespace boost;
  * The cache has a maximum size, which may be altered during runtime. If a
  * file that wasn't in the cache is being stat()ed, and the cache is full,
  * then the oldest cache entry will be removed.
+ *
+ * A SharedFileStatCache may be attached, in which case stat information is
+ * shared with other processes and the local cache is only used for filenames
+ * that the shared cache cannot store.
  */
 class CachedFileStat {
 public:
@@ -147,6 +152,7 @@ public:
 	unsigned int maxSize;
 	EntryList entries;
 	EntryMap cache;
+	boost::shared_ptr<SharedFileStatCache> sharedCache;
 
 	/**
 	 * Creates a new CachedFileStat object.
@@ -176,9 +182,14 @@ public:
 	 * @throws boost::thread_interrupted
 	 */
 	int stat(const StaticString &filename, struct stat *buf, unsigned int throttleRate = 0) {
+		int ret;
+
+		if (sharedCache != NULL && sharedCache->stat(filename, buf, throttleRate, ret)) {
+			return ret;
+		}
+
 		EntryList::iterator it(cache.get(filename, entries.end()));
 		EntryPtr entry;
-		int ret;
 
 		if (it == entries.end()) {
 			// Filename not in cache.
@@ -229,7 +240,18 @@ public:
 	}
 
 	/**
-	 * Returns whether `filename` is in the cache.
+	 * Attaches a shared cache, or detaches it if `cache` is NULL.
+	 */
+	void setSharedCache(const boost::shared_ptr<SharedFileStatCache> &cache) {
+		sharedCache = cache;
+	}
+
+	const boost::shared_ptr<SharedFileStatCache> &getSharedCache() const {
+		return sharedCache;
+	}
+
+	/**
+	 * Returns whether `filename` is in the local cache.
 	 */
 	bool knows(const StaticString &filename) const {
 		return cache.has(filename);
@@ -0,0 +1,678 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2026 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SHARED_FILE_STAT_CACHE_H_
+#define _PASSENGER_SHARED_FILE_STAT_CACHE_H_
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <oxt/system_calls.hpp>
+#include <oxt/macros.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <StaticString.h>
+#include <Exceptions.h>
+#include <SystemTools/SystemTime.h>
+#include <DataStructures/HashedStaticString.h>
+#include <StrIntTools/StrIntUtils.h>
+#include <Utils/ScopeGuard.h>
+
+namespace tut {
+	struct CachedFileStatTest;
+}
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * A stat() cache that lives in shared memory, so that several processes
+ * (e.g. all Nginx workers, or all Apache children, and the Core) share the
+ * same throttled stat information instead of each repeating the same
+ * stat() calls.
+ *
+ * The cache is a fixed-size, set-associative table of slots. Every slot is
+ * protected by a sequence lock: readers never block and never write to
+ * the slot's entry, they simply retry if the sequence number changed while
+ * they were copying. The only thing that readers write is an entry's last
+ * access time, once per second.
+ *
+ * One process can become the cache's refresher (see `becomeRefresher()`)
+ * and call `refresh()` about once per second. It re-stats the entries that
+ * are in use, so that readers find them fresh and don't stat() themselves.
+ * If there is no refresher, or it falls behind, then the first reader that
+ * notices an expired or missing entry performs the stat() and publishes the
+ * result. If another process is publishing into the same slot at the same
+ * time, the result is simply not published.
+ *
+ * A writer records its PID in the sequence number and the time at which it
+ * started. If a writer dies in the middle of an update (e.g. an Apache child
+ * that is killed) or stays in it for longer than ABANDONED_WRITE_TIMEOUT
+ * seconds, the next process that needs the slot takes it over instead of
+ * treating it as busy forever. A writer that was only stopped may still
+ * finish its update after such a takeover, so every entry carries a
+ * checksum, and readers treat an entry whose checksum doesn't match as
+ * missing.
+ *
+ * Filenames that do not fit in a slot are not cached; `stat()` returns false
+ * for them so that the caller can fall back to a local cache.
+ *
+ * The memory is either an anonymous shared mapping, which is inherited by
+ * child processes that are forked after construction, or a file that
+ * unrelated processes can map.
+ *
+ * This class is thread-safe and process-safe.
+ */
+class SharedFileStatCache {
+public:
+	static const unsigned int MAX_FILENAME_SIZE = 256;
+	static const unsigned int ASSOCIATIVITY = 4;
+	static const unsigned int ABANDONED_WRITE_TIMEOUT = 5;
+	/** The number of entries that the web server modules and the Core use. */
+	static const unsigned int DEFAULT_SIZE = 1024;
+	/**
+	 * The refresher leaves entries alone that readers haven't used
+	 * for this many seconds.
+	 */
+	static const unsigned int DEFAULT_REFRESH_MAX_IDLE_TIME = 60;
+
+	struct Stats {
+		boost::uint64_t hits;
+		boost::uint64_t misses;
+		/** Entries published by readers. */
+		boost::uint64_t refreshes;
+		/** Entries published by the refresher. */
+		boost::uint64_t backgroundRefreshes;
+		boost::uint64_t contended;
+		boost::uint64_t takeovers;
+		/** Entries found to be torn by a writer that had been taken over. */
+		boost::uint64_t torn;
+		/** The PID of the refresher, or 0 if there is none. */
+		pid_t refresherPid;
+	};
+
+private:
+	static const boost::uint32_t MAGIC = 0x50534644; // "PSFD"
+	static const unsigned int MAX_READ_ATTEMPTS = 16;
+
+	struct Header {
+		boost::uint32_t magic;
+		boost::uint32_t setCount;
+		boost::atomic<boost::int32_t> refresherPid;
+		boost::atomic<boost::uint64_t> hits;
+		boost::atomic<boost::uint64_t> misses;
+		boost::atomic<boost::uint64_t> refreshes;
+		boost::atomic<boost::uint64_t> backgroundRefreshes;
+		boost::atomic<boost::uint64_t> contended;
+		boost::atomic<boost::uint64_t> takeovers;
+		boost::atomic<boost::uint64_t> torn;
+	};
+
+	struct Slot {
+		/**
+		 * The low 32 bits are odd while a writer is updating this slot.
+		 * The high 32 bits then hold the writer's PID, and are 0 otherwise.
+		 */
+		boost::atomic<boost::uint64_t> seq;
+		/** When the current writer started, in SystemTime::get() seconds. */
+		boost::atomic<boost::int64_t> writeStartTime;
+		/** When a reader last used this entry, in SystemTime::get() seconds. */
+		boost::atomic<boost::int64_t> lastAccessTime;
+		boost::uint32_t hash;
+		boost::uint32_t checksum;
+		time_t lastTime;
+		int lastResult;
+		int lastErrno;
+		struct stat info;
+		boost::uint16_t filenameSize;
+		char filename[MAX_FILENAME_SIZE];
+	};
+
+	enum ProbeResult {
+		PROBE_MATCH,
+		PROBE_MISMATCH,
+		PROBE_TORN,
+		PROBE_BUSY
+	};
+
+	struct Snapshot {
+		time_t lastTime;
+		int lastResult;
+		int lastErrno;
+		struct stat info;
+	};
+
+	Header *header;
+	Slot *slots;
+	size_t mappingSize;
+
+	friend struct tut::CachedFileStatTest;
+
+	static unsigned int calculateSetCount(unsigned int size) {
+		return std::max(1u, (size + ASSOCIATIVITY - 1) / ASSOCIATIVITY);
+	}
+
+	static size_t calculateMappingSize(unsigned int setCount) {
+		return sizeof(Header) + sizeof(Slot) * setCount * ASSOCIATIVITY;
+	}
+
+	static pid_t getWriterPid(boost::uint64_t seq) {
+		return (pid_t) (seq >> 32);
+	}
+
+	static bool processExists(pid_t pid) {
+		return !(kill(pid, 0) == -1 && errno == ESRCH);
+	}
+
+	static boost::uint32_t fnv1a(boost::uint32_t hash, const void *data, size_t size) {
+		const unsigned char *bytes = (const unsigned char *) data;
+		for (size_t i = 0; i < size; i++) {
+			hash = (hash ^ bytes[i]) * 16777619u;
+		}
+		return hash;
+	}
+
+	/**
+	 * `info` is always copied with memcpy(), so that its
+	 * padding bytes are the same in every copy.
+	 */
+	static boost::uint32_t calculateChecksum(boost::uint32_t hash, const StaticString &filename,
+		const Snapshot &snapshot)
+	{
+		boost::uint32_t result = 2166136261u;
+		result = fnv1a(result, &hash, sizeof(hash));
+		result = fnv1a(result, filename.data(), filename.size());
+		result = fnv1a(result, &snapshot.lastTime, sizeof(snapshot.lastTime));
+		result = fnv1a(result, &snapshot.lastResult, sizeof(snapshot.lastResult));
+		result = fnv1a(result, &snapshot.lastErrno, sizeof(snapshot.lastErrno));
+		result = fnv1a(result, &snapshot.info, sizeof(snapshot.info));
+		return result;
+	}
+
+	/**
+	 * Checks whether the writer that set the slot's sequence number to
+	 * `seq` has died, or has been writing for so long that it has
+	 * probably been stopped.
+	 */
+	static bool isAbandoned(const Slot *slot, boost::uint64_t seq, time_t currentTime) {
+		pid_t pid = getWriterPid(seq);
+		if (pid != 0 && !processExists(pid)) {
+			return true;
+		}
+		return currentTime - slot->writeStartTime.load(boost::memory_order_relaxed)
+			>= (boost::int64_t) ABANDONED_WRITE_TIMEOUT;
+	}
+
+	/**
+	 * `seq` is set to the sequence number that was last observed. On
+	 * PROBE_BUSY that is an odd number.
+	 */
+	ProbeResult probe(const Slot *slot, boost::uint32_t hash,
+		const StaticString &filename, Snapshot &snapshot,
+		boost::uint64_t &seq) const
+	{
+		for (unsigned int i = 0; i < MAX_READ_ATTEMPTS; i++) {
+			boost::uint32_t checksum = 0;
+
+			seq = slot->seq.load(boost::memory_order_acquire);
+			if (seq & 1) {
+				continue;
+			}
+
+			bool matches = slot->hash == hash
+				&& slot->filenameSize == filename.size()
+				&& memcmp(slot->filename, filename.data(), filename.size()) == 0;
+			snapshot.lastTime = slot->lastTime;
+			if (matches) {
+				checksum = slot->checksum;
+				snapshot.lastResult = slot->lastResult;
+				snapshot.lastErrno = slot->lastErrno;
+				memcpy(&snapshot.info, &slot->info, sizeof(snapshot.info));
+			}
+
+			boost::atomic_thread_fence(boost::memory_order_acquire);
+			if (slot->seq.load(boost::memory_order_relaxed) == seq) {
+				if (!matches) {
+					return PROBE_MISMATCH;
+				} else if (checksum != calculateChecksum(hash, filename, snapshot)) {
+					return PROBE_TORN;
+				} else {
+					return PROBE_MATCH;
+				}
+			}
+		}
+		return PROBE_BUSY;
+	}
+
+	/**
+	 * Publishes into `slot`, but only if the slot still has sequence number
+	 * `seq`. If that is odd, then it belongs to an abandoned write, and the
+	 * slot is taken over. `accessed` tells whether a reader is using this
+	 * entry, as opposed to the refresher.
+	 */
+	bool publish(Slot *slot, boost::uint64_t seq, boost::uint32_t hash,
+		const StaticString &filename, const Snapshot &snapshot, bool accessed)
+	{
+		boost::uint32_t counter;
+		boost::uint64_t claimedSeq;
+
+		if (seq & 1) {
+			counter = (boost::uint32_t) seq + 2;
+		} else {
+			counter = (boost::uint32_t) seq + 1;
+		}
+		claimedSeq = ((boost::uint64_t) getpid() << 32) | counter;
+
+		// Set before claiming, so that a claimed slot never carries the
+		// previous writer's start time. A concurrent writer that then fails
+		// to claim the slot can only move it forward.
+		slot->writeStartTime.store(snapshot.lastTime, boost::memory_order_relaxed);
+		if (!slot->seq.compare_exchange_strong(seq, claimedSeq,
+			boost::memory_order_acq_rel, boost::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		slot->hash = hash;
+		slot->lastTime = snapshot.lastTime;
+		slot->lastResult = snapshot.lastResult;
+		slot->lastErrno = snapshot.lastErrno;
+		memcpy(&slot->info, &snapshot.info, sizeof(slot->info));
+		slot->filenameSize = filename.size();
+		memcpy(slot->filename, filename.data(), filename.size());
+		slot->checksum = calculateChecksum(hash, filename, snapshot);
+		if (accessed) {
+			slot->lastAccessTime.store(snapshot.lastTime, boost::memory_order_relaxed);
+		}
+
+		// If this write took so long that it was taken over, then
+		// leave the slot to the new writer.
+		slot->seq.compare_exchange_strong(claimedSeq, (boost::uint32_t) (counter + 1),
+			boost::memory_order_release, boost::memory_order_relaxed);
+		return true;
+	}
+
+	static void performStat(const StaticString &filename, Snapshot &snapshot,
+		time_t currentTime)
+	{
+		char ntFilename[MAX_FILENAME_SIZE];
+		memcpy(ntFilename, filename.data(), filename.size());
+		ntFilename[filename.size()] = '\0';
+		snapshot.lastResult = oxt::syscalls::stat(ntFilename, &snapshot.info);
+		snapshot.lastErrno = errno;
+		snapshot.lastTime = currentTime;
+	}
+
+	void initializeMapping(void *memory, unsigned int setCount) {
+		header = (Header *) memory;
+		slots = (Slot *) ((char *) memory + sizeof(Header));
+		header->setCount = setCount;
+		header->magic = MAGIC;
+	}
+
+	/**
+	 * Creates the cache file under a temporary name and links it into
+	 * place once it is initialized, so that other processes never map a
+	 * file that is still being initialized. Returns false if another
+	 * process created the file first.
+	 */
+	bool createFile(const string &path, unsigned int setCount) {
+		string tmpPath = path + ".tmp." + toString(getpid());
+		void *memory;
+		int fd, e;
+
+		fd = oxt::syscalls::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+		if (fd == -1) {
+			e = errno;
+			throw FileSystemException("Cannot create shared stat cache file " + tmpPath,
+				e, tmpPath);
+		}
+		FdGuard guard(fd, __FILE__, __LINE__);
+
+		mappingSize = calculateMappingSize(setCount);
+		if (ftruncate(fd, mappingSize) == -1) {
+			e = errno;
+			oxt::syscalls::unlink(tmpPath.c_str());
+			throw FileSystemException("Cannot resize shared stat cache file " + tmpPath,
+				e, tmpPath);
+		}
+		memory = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (memory == MAP_FAILED) {
+			e = errno;
+			oxt::syscalls::unlink(tmpPath.c_str());
+			throw FileSystemException("Cannot map shared stat cache file " + tmpPath,
+				e, tmpPath);
+		}
+		initializeMapping(memory, setCount);
+
+		if (link(tmpPath.c_str(), path.c_str()) == -1) {
+			e = errno;
+			oxt::syscalls::unlink(tmpPath.c_str());
+			munmap(memory, mappingSize);
+			if (e == EEXIST) {
+				return false;
+			}
+			throw FileSystemException("Cannot create shared stat cache file " + path,
+				e, path);
+		}
+		oxt::syscalls::unlink(tmpPath.c_str());
+		return true;
+	}
+
+	void attachFile(const string &path) {
+		struct stat buf;
+		void *memory;
+		int fd, e;
+
+		fd = oxt::syscalls::open(path.c_str(), O_RDWR);
+		if (fd == -1) {
+			e = errno;
+			throw FileSystemException("Cannot open shared stat cache file " + path,
+				e, path);
+		}
+		FdGuard guard(fd, __FILE__, __LINE__);
+
+		if (fstat(fd, &buf) == -1) {
+			e = errno;
+			throw FileSystemException("Cannot stat shared stat cache file " + path,
+				e, path);
+		}
+		if ((size_t) buf.st_size < sizeof(Header)) {
+			throw RuntimeException(path + " is not a shared stat cache file");
+		}
+		mappingSize = buf.st_size;
+		memory = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (memory == MAP_FAILED) {
+			e = errno;
+			throw FileSystemException("Cannot map shared stat cache file " + path,
+				e, path);
+		}
+
+		header = (Header *) memory;
+		slots = (Slot *) ((char *) memory + sizeof(Header));
+		if (header->magic != MAGIC || header->setCount == 0
+		 || calculateMappingSize(header->setCount) != mappingSize)
+		{
+			munmap(memory, mappingSize);
+			throw RuntimeException(path + " is not a shared stat cache file");
+		}
+	}
+
+public:
+	/**
+	 * Returns the path of the cache file that the Core and the web server
+	 * share in the given instance directory.
+	 */
+	static string getPathInInstanceDir(const StaticString &instanceDir) {
+		return instanceDir + "/stat_cache";
+	}
+
+	/**
+	 * Creates a cache with room for about `size` entries in an anonymous
+	 * shared mapping. Child processes forked after this point share it.
+	 *
+	 * @throws SystemException
+	 */
+	SharedFileStatCache(unsigned int size) {
+		unsigned int setCount = calculateSetCount(size);
+		void *memory;
+
+		mappingSize = calculateMappingSize(setCount);
+		memory = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+		if (memory == MAP_FAILED) {
+			int e = errno;
+			throw SystemException("Cannot create a shared memory stat cache", e);
+		}
+		initializeMapping(memory, setCount);
+	}
+
+	/**
+	 * Maps the cache in the given file, so that unrelated processes can share
+	 * it. If the file doesn't exist yet, then it is created with room for
+	 * about `size` entries; otherwise `size` is ignored.
+	 *
+	 * @throws SystemException
+	 * @throws RuntimeException The file is not a cache file.
+	 */
+	SharedFileStatCache(const string &path, unsigned int size) {
+		if (!createFile(path, calculateSetCount(size))) {
+			attachFile(path);
+		}
+	}
+
+	~SharedFileStatCache() {
+		munmap(header, mappingSize);
+	}
+
+	/**
+	 * Stats the given file, using the shared cached information if it
+	 * is less than `throttleRate` seconds old. On success, the return value
+	 * of stat() is stored in `result`, and `errno` is set as stat() would.
+	 *
+	 * Returns false, without doing anything, if `filename` cannot be
+	 * stored in the cache.
+	 *
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	bool stat(const StaticString &filename, struct stat *buf, unsigned int throttleRate,
+		int &result)
+	{
+		if (filename.empty() || filename.size() >= MAX_FILENAME_SIZE) {
+			return false;
+		}
+
+		boost::uint32_t hash = HashedStaticString(filename).hash();
+		Slot *set = slots + (hash % header->setCount) * ASSOCIATIVITY;
+		Slot *victim = NULL;
+		boost::uint64_t victimSeq = 0;
+		time_t victimTime = 0;
+		time_t currentTime = SystemTime::get();
+		Snapshot snapshot;
+
+		for (unsigned int i = 0; i < ASSOCIATIVITY; i++) {
+			boost::uint64_t seq;
+			ProbeResult probeResult = probe(&set[i], hash, filename, snapshot, seq);
+			if (probeResult == PROBE_MATCH) {
+				if ((unsigned int) (currentTime - snapshot.lastTime) < throttleRate) {
+					header->hits.fetch_add(1, boost::memory_order_relaxed);
+					if (set[i].lastAccessTime.load(boost::memory_order_relaxed) != currentTime) {
+						set[i].lastAccessTime.store(currentTime, boost::memory_order_relaxed);
+					}
+					*buf = snapshot.info;
+					errno = snapshot.lastErrno;
+					result = snapshot.lastResult;
+					return true;
+				}
+				victim = &set[i];
+				victimSeq = seq;
+				break;
+			} else if (probeResult == PROBE_TORN) {
+				header->torn.fetch_add(1, boost::memory_order_relaxed);
+				victim = &set[i];
+				victimSeq = seq;
+				break;
+			} else if (probeResult == PROBE_BUSY) {
+				if (!(victimSeq & 1) && isAbandoned(&set[i], seq, currentTime)) {
+					// Reclaim abandoned slots before anything else.
+					victim = &set[i];
+					victimSeq = seq;
+				}
+			} else if (!(victimSeq & 1)
+				&& (victim == NULL || snapshot.lastTime < victimTime))
+			{
+				// Replace the least recently refreshed slot.
+				victim = &set[i];
+				victimSeq = seq;
+				victimTime = snapshot.lastTime;
+			}
+		}
+
+		header->misses.fetch_add(1, boost::memory_order_relaxed);
+		performStat(filename, snapshot, currentTime);
+
+		if (victim != NULL && publish(victim, victimSeq, hash, filename, snapshot, true)) {
+			header->refreshes.fetch_add(1, boost::memory_order_relaxed);
+			if (victimSeq & 1) {
+				header->takeovers.fetch_add(1, boost::memory_order_relaxed);
+			}
+		} else {
+			header->contended.fetch_add(1, boost::memory_order_relaxed);
+		}
+
+		*buf = snapshot.info;
+		errno = snapshot.lastErrno;
+		result = snapshot.lastResult;
+		return true;
+	}
+
+	/**
+	 * Makes the calling process the refresher of this cache, unless another
+	 * process that still exists already is. Returns whether the calling
+	 * process is the refresher.
+	 */
+	bool becomeRefresher() {
+		boost::int32_t pid = getpid();
+		boost::int32_t current = header->refresherPid.load(boost::memory_order_relaxed);
+
+		while (true) {
+			if (current == pid) {
+				return true;
+			} else if (current != 0 && processExists(current)) {
+				return false;
+			} else if (header->refresherPid.compare_exchange_weak(current, pid,
+				boost::memory_order_relaxed))
+			{
+				return true;
+			}
+		}
+	}
+
+	/**
+	 * Stops being the refresher, if the calling process is the refresher.
+	 */
+	void resignRefresher() {
+		boost::int32_t pid = getpid();
+		header->refresherPid.compare_exchange_strong(pid, 0,
+			boost::memory_order_relaxed);
+	}
+
+	/**
+	 * Re-stats the entries that readers have used in the last `maxIdleTime`
+	 * seconds, and that weren't refreshed yet during the current second.
+	 * The refresher calls this about once per second. Returns the number of
+	 * entries that were refreshed.
+	 *
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	unsigned int refresh(unsigned int maxIdleTime) {
+		unsigned int setCount = header->setCount;
+		unsigned int result = 0;
+		time_t currentTime = SystemTime::get();
+
+		for (unsigned int i = 0; i < setCount * ASSOCIATIVITY; i++) {
+			Slot *slot = &slots[i];
+			char filename[MAX_FILENAME_SIZE];
+			boost::uint16_t filenameSize;
+			boost::uint32_t hash, checksum;
+			Snapshot snapshot;
+
+			boost::uint64_t seq = slot->seq.load(boost::memory_order_acquire);
+			if ((seq & 1)
+			 || currentTime - slot->lastAccessTime.load(boost::memory_order_relaxed)
+				> (boost::int64_t) maxIdleTime)
+			{
+				continue;
+			}
+			filenameSize = std::min<boost::uint16_t>(slot->filenameSize,
+				MAX_FILENAME_SIZE - 1);
+			memcpy(filename, slot->filename, filenameSize);
+			hash = slot->hash;
+			checksum = slot->checksum;
+			snapshot.lastTime = slot->lastTime;
+			snapshot.lastResult = slot->lastResult;
+			snapshot.lastErrno = slot->lastErrno;
+			memcpy(&snapshot.info, &slot->info, sizeof(snapshot.info));
+			boost::atomic_thread_fence(boost::memory_order_acquire);
+			if (slot->seq.load(boost::memory_order_relaxed) != seq
+			 || filenameSize == 0
+			 || snapshot.lastTime >= currentTime
+			 || checksum != calculateChecksum(hash, StaticString(filename, filenameSize),
+				snapshot))
+			{
+				// Changed, empty, already fresh, or torn; readers replace torn entries.
+				continue;
+			}
+
+			performStat(StaticString(filename, filenameSize), snapshot, currentTime);
+			if (publish(slot, seq, hash, StaticString(filename, filenameSize),
+				snapshot, false))
+			{
+				header->backgroundRefreshes.fetch_add(1, boost::memory_order_relaxed);
+				result++;
+			}
+		}
+		return result;
+	}
+
+	/** Returns the number of entries that fit in the cache. */
+	unsigned int capacity() const {
+		return header->setCount * ASSOCIATIVITY;
+	}
+
+	/** Returns the counters, aggregated over all processes that share this cache. */
+	Stats getStats() const {
+		Stats stats;
+		stats.hits = header->hits.load(boost::memory_order_relaxed);
+		stats.misses = header->misses.load(boost::memory_order_relaxed);
+		stats.refreshes = header->refreshes.load(boost::memory_order_relaxed);
+		stats.backgroundRefreshes = header->backgroundRefreshes.load(boost::memory_order_relaxed);
+		stats.contended = header->contended.load(boost::memory_order_relaxed);
+		stats.takeovers = header->takeovers.load(boost::memory_order_relaxed);
+		stats.torn = header->torn.load(boost::memory_order_relaxed);
+		stats.refresherPid = header->refresherPid.load(boost::memory_order_relaxed);
+		return stats;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_SHARED_FILE_STAT_CACHE_H_ */
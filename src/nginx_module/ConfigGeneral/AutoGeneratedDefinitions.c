@@ -358,6 +358,22 @@
     offsetof(passenger_loc_conf_t, autogenerated.min_instances),
     NULL
 },
+{
+    ngx_string("passenger_capacity_weight"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_capacity_weight,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.capacity_weight),
+    NULL
+},
+{
+    ngx_string("passenger_capacity_reservation"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_capacity_reservation,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.capacity_reservation),
+    NULL
+},
 {
     ngx_string("passenger_start_timeout"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
@@ -430,6 +446,14 @@
     offsetof(passenger_loc_conf_t, autogenerated.max_preloader_idle_time),
     NULL
 },
+{
+    ngx_string("passenger_memory_limit"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_memory_limit,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.memory_limit),
+    NULL
+},
 {
     ngx_string("passenger_env_var"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE2,
@@ -534,6 +558,22 @@
     offsetof(passenger_loc_conf_t, autogenerated.max_requests),
     NULL
 },
+{
+    ngx_string("passenger_request_priority"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_request_priority,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.request_priority),
+    NULL
+},
+{
+    ngx_string("passenger_max_request_queue_time"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
+    passenger_conf_set_max_request_queue_time,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.max_request_queue_time),
+    NULL
+},
 {
     ngx_string("passenger_base_uri"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
@@ -686,6 +726,14 @@
     offsetof(passenger_loc_conf_t, autogenerated.sticky_sessions),
     NULL
 },
+{
+    ngx_string("passenger_sticky_sessions_consistent_hashing"),
+    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_FLAG,
+    passenger_conf_set_sticky_sessions_consistent_hashing,
+    NGX_HTTP_LOC_CONF_OFFSET,
+    offsetof(passenger_loc_conf_t, autogenerated.sticky_sessions_consistent_hashing),
+    NULL
+},
 {
     ngx_string("passenger_sticky_sessions_cookie_name"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
@@ -726,14 +774,6 @@
     0,
     NULL
 },
-{
-    ngx_string("passenger_memory_limit"),
-    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
-    passenger_enterprise_only,
-    NGX_HTTP_LOC_CONF_OFFSET,
-    0,
-    NULL
-},
 {
     ngx_string("passenger_concurrency_model"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
@@ -774,14 +814,6 @@
     0,
     NULL
 },
-{
-    ngx_string("passenger_max_request_queue_time"),
-    NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
-    passenger_enterprise_only,
-    NGX_HTTP_LOC_CONF_OFFSET,
-    0,
-    NULL
-},
 {
     ngx_string("passenger_app_log_file"),
     NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_HTTP_LIF_CONF | NGX_CONF_TAKE1,
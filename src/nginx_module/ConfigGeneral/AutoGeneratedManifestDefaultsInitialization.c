@@ -227,6 +227,18 @@ set_manifest_autogenerated_app_conf_defaults(manifest_gen_ctx_t *ctx, PsgJsonVal
         sizeof("passenger_min_instances") - 1,
         1);
 
+    add_manifest_options_container_static_default_uint(ctx,
+        options_container,
+        "passenger_capacity_weight",
+        sizeof("passenger_capacity_weight") - 1,
+        1);
+
+    add_manifest_options_container_static_default_uint(ctx,
+        options_container,
+        "passenger_capacity_reservation",
+        sizeof("passenger_capacity_reservation") - 1,
+        0);
+
     add_manifest_options_container_static_default_uint(ctx,
         options_container,
         "passenger_start_timeout",
@@ -273,6 +285,12 @@ set_manifest_autogenerated_app_conf_defaults(manifest_gen_ctx_t *ctx, PsgJsonVal
         sizeof("passenger_max_preloader_idle_time") - 1,
         300);
 
+    add_manifest_options_container_static_default_uint(ctx,
+        options_container,
+        "passenger_memory_limit",
+        sizeof("passenger_memory_limit") - 1,
+        0);
+
     add_manifest_options_container_dynamic_default(ctx,
         options_container,
         "passenger_spawn_method",
@@ -355,6 +373,19 @@ set_manifest_autogenerated_loc_conf_defaults(manifest_gen_ctx_t *ctx, PsgJsonVal
         sizeof("passenger_max_requests") - 1,
         0);
 
+    add_manifest_options_container_static_default_str(ctx,
+        options_container,
+        "passenger_request_priority",
+        sizeof("passenger_request_priority") - 1,
+        "normal",
+        sizeof("normal") - 1);
+
+    add_manifest_options_container_static_default_uint(ctx,
+        options_container,
+        "passenger_max_request_queue_time",
+        sizeof("passenger_max_request_queue_time") - 1,
+        0);
+
     add_manifest_options_container_static_default_uint(ctx,
         options_container,
         "passenger_headers_hash_max_size",
@@ -430,6 +461,12 @@ set_manifest_autogenerated_loc_conf_defaults(manifest_gen_ctx_t *ctx, PsgJsonVal
         sizeof("passenger_sticky_sessions") - 1,
         0);
 
+    add_manifest_options_container_static_default_bool(ctx,
+        options_container,
+        "passenger_sticky_sessions_consistent_hashing",
+        sizeof("passenger_sticky_sessions_consistent_hashing") - 1,
+        0);
+
     add_manifest_options_container_static_default_str(ctx,
         options_container,
         "passenger_sticky_sessions_cookie_name",
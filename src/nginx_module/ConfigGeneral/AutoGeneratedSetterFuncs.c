@@ -553,6 +553,30 @@ passenger_conf_set_min_instances(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     return ngx_conf_set_num_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_capacity_weight(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.capacity_weight_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.capacity_weight_source_file,
+        &passenger_conf->autogenerated.capacity_weight_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
+static char *
+passenger_conf_set_capacity_reservation(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.capacity_reservation_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.capacity_reservation_source_file,
+        &passenger_conf->autogenerated.capacity_reservation_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_start_timeout(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_loc_conf_t *passenger_conf = conf;
@@ -661,6 +685,18 @@ passenger_conf_set_max_preloader_idle_time(ngx_conf_t *cf, ngx_command_t *cmd, v
     return ngx_conf_set_num_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_memory_limit(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.memory_limit_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.memory_limit_source_file,
+        &passenger_conf->autogenerated.memory_limit_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_env_var(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_loc_conf_t *passenger_conf = conf;
@@ -805,6 +841,30 @@ passenger_conf_set_max_requests(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     return ngx_conf_set_num_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_request_priority(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.request_priority_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.request_priority_source_file,
+        &passenger_conf->autogenerated.request_priority_source_line);
+
+    return ngx_conf_set_str_slot(cf, cmd, conf);
+}
+
+static char *
+passenger_conf_set_max_request_queue_time(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.max_request_queue_time_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.max_request_queue_time_source_file,
+        &passenger_conf->autogenerated.max_request_queue_time_source_line);
+
+    return ngx_conf_set_num_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_base_uri(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_loc_conf_t *passenger_conf = conf;
@@ -961,6 +1021,18 @@ passenger_conf_set_sticky_sessions(ngx_conf_t *cf, ngx_command_t *cmd, void *con
     return ngx_conf_set_flag_slot(cf, cmd, conf);
 }
 
+static char *
+passenger_conf_set_sticky_sessions_consistent_hashing(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
+    passenger_loc_conf_t *passenger_conf = conf;
+
+    passenger_conf->autogenerated.sticky_sessions_consistent_hashing_explicitly_set = 1;
+    record_loc_conf_source_location(cf, passenger_conf,
+        &passenger_conf->autogenerated.sticky_sessions_consistent_hashing_source_file,
+        &passenger_conf->autogenerated.sticky_sessions_consistent_hashing_source_line);
+
+    return ngx_conf_set_flag_slot(cf, cmd, conf);
+}
+
 static char *
 passenger_conf_set_sticky_sessions_cookie_name(ngx_conf_t *cf, ngx_command_t *cmd, void *conf) {
     passenger_loc_conf_t *passenger_conf = conf;
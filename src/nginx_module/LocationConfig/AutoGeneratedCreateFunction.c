@@ -52,6 +52,8 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->environment.len  = 0;
     conf->friendly_error_pages = NGX_CONF_UNSET;
     conf->min_instances = NGX_CONF_UNSET_UINT;
+    conf->capacity_weight = NGX_CONF_UNSET_UINT;
+    conf->capacity_reservation = NGX_CONF_UNSET_UINT;
     conf->start_timeout = NGX_CONF_UNSET_UINT;
     conf->user.data = NULL;
     conf->user.len  = 0;
@@ -66,6 +68,7 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->app_rights.len  = 0;
     conf->debugger = NGX_CONF_UNSET;
     conf->max_preloader_idle_time = NGX_CONF_UNSET;
+    conf->memory_limit = NGX_CONF_UNSET_UINT;
     conf->env_vars = NULL;
     conf->spawn_method.data = NULL;
     conf->spawn_method.len  = 0;
@@ -85,6 +88,9 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->force_max_concurrent_requests_per_process = NGX_CONF_UNSET;
     conf->enabled = NGX_CONF_UNSET;
     conf->max_requests = NGX_CONF_UNSET_UINT;
+    conf->request_priority.data = NULL;
+    conf->request_priority.len  = 0;
+    conf->max_request_queue_time = NGX_CONF_UNSET_UINT;
     conf->base_uris = NGX_CONF_UNSET_PTR;
     conf->document_root.data = NULL;
     conf->document_root.len  = 0;
@@ -93,6 +99,7 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->request_queue_overflow_status_code = NGX_CONF_UNSET;
     conf->buffer_upload = NGX_CONF_UNSET;
     conf->sticky_sessions = NGX_CONF_UNSET;
+    conf->sticky_sessions_consistent_hashing = NGX_CONF_UNSET;
     conf->sticky_sessions_cookie_name.data = NULL;
     conf->sticky_sessions_cookie_name.len  = 0;
     conf->sticky_sessions_cookie_attributes.data = NULL;
@@ -130,6 +137,14 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->min_instances_source_file.len = 0;
     conf->min_instances_source_line = 0;
     conf->min_instances_explicitly_set = 0;
+    conf->capacity_weight_source_file.data = NULL;
+    conf->capacity_weight_source_file.len = 0;
+    conf->capacity_weight_source_line = 0;
+    conf->capacity_weight_explicitly_set = 0;
+    conf->capacity_reservation_source_file.data = NULL;
+    conf->capacity_reservation_source_file.len = 0;
+    conf->capacity_reservation_source_line = 0;
+    conf->capacity_reservation_explicitly_set = 0;
     conf->start_timeout_source_file.data = NULL;
     conf->start_timeout_source_file.len = 0;
     conf->start_timeout_source_line = 0;
@@ -166,6 +181,10 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->max_preloader_idle_time_source_file.len = 0;
     conf->max_preloader_idle_time_source_line = 0;
     conf->max_preloader_idle_time_explicitly_set = 0;
+    conf->memory_limit_source_file.data = NULL;
+    conf->memory_limit_source_file.len = 0;
+    conf->memory_limit_source_line = 0;
+    conf->memory_limit_explicitly_set = 0;
     conf->env_vars_source_file.data = NULL;
     conf->env_vars_source_file.len = 0;
     conf->env_vars_source_line = 0;
@@ -218,6 +237,14 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->max_requests_source_file.len = 0;
     conf->max_requests_source_line = 0;
     conf->max_requests_explicitly_set = 0;
+    conf->request_priority_source_file.data = NULL;
+    conf->request_priority_source_file.len = 0;
+    conf->request_priority_source_line = 0;
+    conf->request_priority_explicitly_set = 0;
+    conf->max_request_queue_time_source_file.data = NULL;
+    conf->max_request_queue_time_source_file.len = 0;
+    conf->max_request_queue_time_source_line = 0;
+    conf->max_request_queue_time_explicitly_set = 0;
     conf->base_uris_source_file.data = NULL;
     conf->base_uris_source_file.len = 0;
     conf->base_uris_source_line = 0;
@@ -294,6 +321,10 @@ passenger_create_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t  *con
     conf->sticky_sessions_source_file.len = 0;
     conf->sticky_sessions_source_line = 0;
     conf->sticky_sessions_explicitly_set = 0;
+    conf->sticky_sessions_consistent_hashing_source_file.data = NULL;
+    conf->sticky_sessions_consistent_hashing_source_file.len = 0;
+    conf->sticky_sessions_consistent_hashing_source_line = 0;
+    conf->sticky_sessions_consistent_hashing_explicitly_set = 0;
     conf->sticky_sessions_cookie_name_source_file.data = NULL;
     conf->sticky_sessions_cookie_name_source_file.len = 0;
     conf->sticky_sessions_cookie_name_source_line = 0;
@@ -96,6 +96,26 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         len += sizeof("\r\n") - 1;
     }
 
+    if (conf->autogenerated.capacity_weight != NGX_CONF_UNSET_UINT) {
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.capacity_weight);
+        len += sizeof("!~PASSENGER_CAPACITY_WEIGHT: ") - 1;
+        len += end - int_buf;
+        len += sizeof("\r\n") - 1;
+    }
+
+    if (conf->autogenerated.capacity_reservation != NGX_CONF_UNSET_UINT) {
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.capacity_reservation);
+        len += sizeof("!~PASSENGER_CAPACITY_RESERVATION: ") - 1;
+        len += end - int_buf;
+        len += sizeof("\r\n") - 1;
+    }
+
     if (conf->autogenerated.start_timeout != NGX_CONF_UNSET_UINT) {
         end = ngx_snprintf(int_buf,
             sizeof(int_buf) - 1,
@@ -153,6 +173,16 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         len += sizeof("\r\n") - 1;
     }
 
+    if (conf->autogenerated.memory_limit != NGX_CONF_UNSET_UINT) {
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.memory_limit);
+        len += sizeof("!~PASSENGER_MEMORY_LIMIT: ") - 1;
+        len += end - int_buf;
+        len += sizeof("\r\n") - 1;
+    }
+
     if (conf->autogenerated.spawn_method.data != NULL) {
         len += sizeof("!~PASSENGER_SPAWN_METHOD: ") - 1;
         len += conf->autogenerated.spawn_method.len;
@@ -221,6 +251,22 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         len += sizeof("\r\n") - 1;
     }
 
+    if (conf->autogenerated.request_priority.data != NULL) {
+        len += sizeof("!~PASSENGER_REQUEST_PRIORITY: ") - 1;
+        len += conf->autogenerated.request_priority.len;
+        len += sizeof("\r\n") - 1;
+    }
+
+    if (conf->autogenerated.max_request_queue_time != NGX_CONF_UNSET_UINT) {
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.max_request_queue_time);
+        len += sizeof("!~PASSENGER_MAX_REQUEST_QUEUE_TIME: ") - 1;
+        len += end - int_buf;
+        len += sizeof("\r\n") - 1;
+    }
+
     if (conf->autogenerated.request_queue_overflow_status_code != NGX_CONF_UNSET) {
         end = ngx_snprintf(int_buf,
             sizeof(int_buf) - 1,
@@ -238,6 +284,13 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
             : sizeof("f\r\n") - 1;
     }
 
+    if (conf->autogenerated.sticky_sessions_consistent_hashing != NGX_CONF_UNSET) {
+        len += sizeof("!~PASSENGER_STICKY_SESSIONS_CONSISTENT_HASHING: ") - 1;
+        len += conf->autogenerated.sticky_sessions_consistent_hashing
+            ? sizeof("t\r\n") - 1
+            : sizeof("f\r\n") - 1;
+    }
+
     if (conf->autogenerated.sticky_sessions_cookie_name.data != NULL) {
         len += sizeof("!~PASSENGER_STICKY_SESSIONS_COOKIE_NAME: ") - 1;
         len += conf->autogenerated.sticky_sessions_cookie_name.len;
@@ -336,6 +389,28 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         pos = ngx_copy(pos, int_buf, end - int_buf);
         pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
     }
+    if (conf->autogenerated.capacity_weight != NGX_CONF_UNSET_UINT) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_CAPACITY_WEIGHT: ",
+            sizeof("!~PASSENGER_CAPACITY_WEIGHT: ") - 1);
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.capacity_weight);
+        pos = ngx_copy(pos, int_buf, end - int_buf);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
+    if (conf->autogenerated.capacity_reservation != NGX_CONF_UNSET_UINT) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_CAPACITY_RESERVATION: ",
+            sizeof("!~PASSENGER_CAPACITY_RESERVATION: ") - 1);
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.capacity_reservation);
+        pos = ngx_copy(pos, int_buf, end - int_buf);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
     if (conf->autogenerated.start_timeout != NGX_CONF_UNSET_UINT) {
         pos = ngx_copy(pos,
             "!~PASSENGER_START_TIMEOUT: ",
@@ -414,6 +489,17 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         pos = ngx_copy(pos, int_buf, end - int_buf);
         pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
     }
+    if (conf->autogenerated.memory_limit != NGX_CONF_UNSET_UINT) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_MEMORY_LIMIT: ",
+            sizeof("!~PASSENGER_MEMORY_LIMIT: ") - 1);
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.memory_limit);
+        pos = ngx_copy(pos, int_buf, end - int_buf);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
     if (conf->autogenerated.spawn_method.data != NULL) {
         pos = ngx_copy(pos,
             "!~PASSENGER_SPAWN_METHOD: ",
@@ -505,6 +591,26 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         pos = ngx_copy(pos, int_buf, end - int_buf);
         pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
     }
+    if (conf->autogenerated.request_priority.data != NULL) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_REQUEST_PRIORITY: ",
+            sizeof("!~PASSENGER_REQUEST_PRIORITY: ") - 1);
+        pos = ngx_copy(pos,
+            conf->autogenerated.request_priority.data,
+            conf->autogenerated.request_priority.len);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
+    if (conf->autogenerated.max_request_queue_time != NGX_CONF_UNSET_UINT) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_MAX_REQUEST_QUEUE_TIME: ",
+            sizeof("!~PASSENGER_MAX_REQUEST_QUEUE_TIME: ") - 1);
+        end = ngx_snprintf(int_buf,
+            sizeof(int_buf) - 1,
+            "%ui",
+            conf->autogenerated.max_request_queue_time);
+        pos = ngx_copy(pos, int_buf, end - int_buf);
+        pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+    }
     if (conf->autogenerated.request_queue_overflow_status_code != NGX_CONF_UNSET) {
         pos = ngx_copy(pos,
             "!~PASSENGER_REQUEST_QUEUE_OVERFLOW_STATUS_CODE: ",
@@ -527,6 +633,17 @@ passenger_serialize_autogenerated_loc_conf_to_headers(ngx_conf_t *cf, passenger_
         }
     }
 
+    if (conf->autogenerated.sticky_sessions_consistent_hashing != NGX_CONF_UNSET) {
+        pos = ngx_copy(pos,
+            "!~PASSENGER_STICKY_SESSIONS_CONSISTENT_HASHING: ",
+            sizeof("!~PASSENGER_STICKY_SESSIONS_CONSISTENT_HASHING: ") - 1);
+        if (conf->autogenerated.sticky_sessions_consistent_hashing) {
+            pos = ngx_copy(pos, "t\r\n", sizeof("t\r\n") - 1);
+        } else {
+            pos = ngx_copy(pos, "f\r\n", sizeof("f\r\n") - 1);
+        }
+    }
+
     if (conf->autogenerated.sticky_sessions_cookie_name.data != NULL) {
         pos = ngx_copy(pos,
             "!~PASSENGER_STICKY_SESSIONS_COOKIE_NAME: ",
@@ -142,6 +142,32 @@ generate_config_manifest_for_autogenerated_loc_conf(manifest_gen_ctx_t *ctx, pas
         psg_json_value_set_uint(hierarchy_member, "value",
             plcf->autogenerated.min_instances);
     }
+    if (plcf->autogenerated.capacity_weight_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_capacity_weight",
+            sizeof("passenger_capacity_weight") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.capacity_weight_source_file,
+            plcf->autogenerated.capacity_weight_source_line);
+        psg_json_value_set_uint(hierarchy_member, "value",
+            plcf->autogenerated.capacity_weight);
+    }
+    if (plcf->autogenerated.capacity_reservation_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_capacity_reservation",
+            sizeof("passenger_capacity_reservation") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.capacity_reservation_source_file,
+            plcf->autogenerated.capacity_reservation_source_line);
+        psg_json_value_set_uint(hierarchy_member, "value",
+            plcf->autogenerated.capacity_reservation);
+    }
     if (plcf->autogenerated.start_timeout_explicitly_set) {
         find_or_create_manifest_app_and_loc_options_containers(ctx,
             plcf, cscf, clcf, &app_options_container, &loc_options_container);
@@ -264,6 +290,19 @@ generate_config_manifest_for_autogenerated_loc_conf(manifest_gen_ctx_t *ctx, pas
         psg_json_value_set_int(hierarchy_member, "value",
             plcf->autogenerated.max_preloader_idle_time);
     }
+    if (plcf->autogenerated.memory_limit_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            app_options_container,
+            "passenger_memory_limit",
+            sizeof("passenger_memory_limit") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.memory_limit_source_file,
+            plcf->autogenerated.memory_limit_source_line);
+        psg_json_value_set_uint(hierarchy_member, "value",
+            plcf->autogenerated.memory_limit);
+    }
     if (plcf->autogenerated.env_vars_explicitly_set) {
         find_or_create_manifest_app_and_loc_options_containers(ctx,
             plcf, cscf, clcf, &app_options_container, &loc_options_container);
@@ -439,6 +478,33 @@ generate_config_manifest_for_autogenerated_loc_conf(manifest_gen_ctx_t *ctx, pas
         psg_json_value_set_uint(hierarchy_member, "value",
             plcf->autogenerated.max_requests);
     }
+    if (plcf->autogenerated.request_priority_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            loc_options_container,
+            "passenger_request_priority",
+            sizeof("passenger_request_priority") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.request_priority_source_file,
+            plcf->autogenerated.request_priority_source_line);
+        psg_json_value_set_str(hierarchy_member, "value",
+            (const char *) plcf->autogenerated.request_priority.data,
+            plcf->autogenerated.request_priority.len);
+    }
+    if (plcf->autogenerated.max_request_queue_time_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            loc_options_container,
+            "passenger_max_request_queue_time",
+            sizeof("passenger_max_request_queue_time") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.max_request_queue_time_source_file,
+            plcf->autogenerated.max_request_queue_time_source_line);
+        psg_json_value_set_uint(hierarchy_member, "value",
+            plcf->autogenerated.max_request_queue_time);
+    }
     if (plcf->autogenerated.base_uris_explicitly_set) {
         find_or_create_manifest_app_and_loc_options_containers(ctx,
             plcf, cscf, clcf, &app_options_container, &loc_options_container);
@@ -622,6 +688,19 @@ generate_config_manifest_for_autogenerated_loc_conf(manifest_gen_ctx_t *ctx, pas
         psg_json_value_set_bool(hierarchy_member, "value",
             plcf->autogenerated.sticky_sessions);
     }
+    if (plcf->autogenerated.sticky_sessions_consistent_hashing_explicitly_set) {
+        find_or_create_manifest_app_and_loc_options_containers(ctx,
+            plcf, cscf, clcf, &app_options_container, &loc_options_container);
+        option_container = find_or_create_manifest_option_container(ctx,
+            loc_options_container,
+            "passenger_sticky_sessions_consistent_hashing",
+            sizeof("passenger_sticky_sessions_consistent_hashing") - 1);
+        hierarchy_member = add_manifest_option_container_hierarchy_member(option_container,
+            &plcf->autogenerated.sticky_sessions_consistent_hashing_source_file,
+            plcf->autogenerated.sticky_sessions_consistent_hashing_source_line);
+        psg_json_value_set_bool(hierarchy_member, "value",
+            plcf->autogenerated.sticky_sessions_consistent_hashing);
+    }
     if (plcf->autogenerated.sticky_sessions_cookie_name_explicitly_set) {
         find_or_create_manifest_app_and_loc_options_containers(ctx,
             plcf, cscf, clcf, &app_options_container, &loc_options_container);
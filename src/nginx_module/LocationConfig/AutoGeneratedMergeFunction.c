@@ -64,6 +64,12 @@ passenger_merge_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t *conf,
     ngx_conf_merge_uint_value(conf->min_instances,
         prev->min_instances,
         1);
+    ngx_conf_merge_uint_value(conf->capacity_weight,
+        prev->capacity_weight,
+        1);
+    ngx_conf_merge_uint_value(conf->capacity_reservation,
+        prev->capacity_reservation,
+        0);
     ngx_conf_merge_uint_value(conf->start_timeout,
         prev->start_timeout,
         90);
@@ -93,6 +99,9 @@ passenger_merge_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t *conf,
     ngx_conf_merge_value(conf->max_preloader_idle_time,
         prev->max_preloader_idle_time,
         300);
+    ngx_conf_merge_uint_value(conf->memory_limit,
+        prev->memory_limit,
+        0);
     if (merge_string_keyval_table(cf, &prev->env_vars, &conf->env_vars) != NGX_OK) {
         ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
             "cannot merge \"passenger_env_var\" configurations");
@@ -134,6 +143,12 @@ passenger_merge_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t *conf,
     ngx_conf_merge_uint_value(conf->max_requests,
         prev->max_requests,
         0);
+    ngx_conf_merge_str_value(conf->request_priority,
+        prev->request_priority,
+        "normal");
+    ngx_conf_merge_uint_value(conf->max_request_queue_time,
+        prev->max_request_queue_time,
+        0);
     if (merge_string_array(cf, &prev->base_uris, &conf->base_uris) != NGX_OK) {
         ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
             "cannot merge \"passenger_base_uri\" configurations");
@@ -157,6 +172,9 @@ passenger_merge_autogenerated_loc_conf(passenger_autogenerated_loc_conf_t *conf,
     ngx_conf_merge_value(conf->sticky_sessions,
         prev->sticky_sessions,
         0);
+    ngx_conf_merge_value(conf->sticky_sessions_consistent_hashing,
+        prev->sticky_sessions_consistent_hashing,
+        0);
     ngx_conf_merge_str_value(conf->sticky_sessions_cookie_name,
         prev->sticky_sessions_cookie_name,
         "_passenger_route");
@@ -42,6 +42,8 @@ typedef struct {
     ngx_flag_t abort_websockets_on_process_shutdown;
     ngx_array_t *base_uris;
     ngx_flag_t buffer_upload;
+    ngx_uint_t capacity_reservation;
+    ngx_uint_t capacity_weight;
     ngx_flag_t debugger;
     ngx_flag_t enabled;
     ngx_array_t *env_vars;
@@ -53,12 +55,15 @@ typedef struct {
     ngx_flag_t load_shell_envvars;
     ngx_int_t max_preloader_idle_time;
     ngx_uint_t max_request_queue_size;
+    ngx_uint_t max_request_queue_time;
     ngx_uint_t max_requests;
+    ngx_uint_t memory_limit;
     ngx_uint_t min_instances;
     ngx_array_t *monitor_log_file;
     ngx_int_t request_queue_overflow_status_code;
     ngx_uint_t start_timeout;
     ngx_flag_t sticky_sessions;
+    ngx_flag_t sticky_sessions_consistent_hashing;
     ngx_str_t app_group_name;
     ngx_str_t app_log_file;
     ngx_str_t app_rights;
@@ -72,6 +77,7 @@ typedef struct {
     ngx_str_t meteor_app_settings;
     ngx_str_t nodejs;
     ngx_str_t python;
+    ngx_str_t request_priority;
     ngx_str_t restart_dir;
     ngx_str_t ruby;
     ngx_str_t spawn_method;
@@ -90,6 +96,8 @@ typedef struct {
     ngx_str_t app_type_source_file;
     ngx_str_t base_uris_source_file;
     ngx_str_t buffer_upload_source_file;
+    ngx_str_t capacity_reservation_source_file;
+    ngx_str_t capacity_weight_source_file;
     ngx_str_t debugger_source_file;
     ngx_str_t direct_instance_request_address_source_file;
     ngx_str_t document_root_source_file;
@@ -105,12 +113,15 @@ typedef struct {
     ngx_str_t load_shell_envvars_source_file;
     ngx_str_t max_preloader_idle_time_source_file;
     ngx_str_t max_request_queue_size_source_file;
+    ngx_str_t max_request_queue_time_source_file;
     ngx_str_t max_requests_source_file;
+    ngx_str_t memory_limit_source_file;
     ngx_str_t meteor_app_settings_source_file;
     ngx_str_t min_instances_source_file;
     ngx_str_t monitor_log_file_source_file;
     ngx_str_t nodejs_source_file;
     ngx_str_t python_source_file;
+    ngx_str_t request_priority_source_file;
     ngx_str_t request_queue_overflow_status_code_source_file;
     ngx_str_t restart_dir_source_file;
     ngx_str_t ruby_source_file;
@@ -118,6 +129,7 @@ typedef struct {
     ngx_str_t start_timeout_source_file;
     ngx_str_t startup_file_source_file;
     ngx_str_t sticky_sessions_source_file;
+    ngx_str_t sticky_sessions_consistent_hashing_source_file;
     ngx_str_t sticky_sessions_cookie_attributes_source_file;
     ngx_str_t sticky_sessions_cookie_name_source_file;
     ngx_str_t upstream_config_buffer_size_source_file;
@@ -143,6 +155,8 @@ typedef struct {
     ngx_uint_t app_type_source_line;
     ngx_uint_t base_uris_source_line;
     ngx_uint_t buffer_upload_source_line;
+    ngx_uint_t capacity_reservation_source_line;
+    ngx_uint_t capacity_weight_source_line;
     ngx_uint_t debugger_source_line;
     ngx_uint_t direct_instance_request_address_source_line;
     ngx_uint_t document_root_source_line;
@@ -158,12 +172,15 @@ typedef struct {
     ngx_uint_t load_shell_envvars_source_line;
     ngx_uint_t max_preloader_idle_time_source_line;
     ngx_uint_t max_request_queue_size_source_line;
+    ngx_uint_t max_request_queue_time_source_line;
     ngx_uint_t max_requests_source_line;
+    ngx_uint_t memory_limit_source_line;
     ngx_uint_t meteor_app_settings_source_line;
     ngx_uint_t min_instances_source_line;
     ngx_uint_t monitor_log_file_source_line;
     ngx_uint_t nodejs_source_line;
     ngx_uint_t python_source_line;
+    ngx_uint_t request_priority_source_line;
     ngx_uint_t request_queue_overflow_status_code_source_line;
     ngx_uint_t restart_dir_source_line;
     ngx_uint_t ruby_source_line;
@@ -171,6 +188,7 @@ typedef struct {
     ngx_uint_t start_timeout_source_line;
     ngx_uint_t startup_file_source_line;
     ngx_uint_t sticky_sessions_source_line;
+    ngx_uint_t sticky_sessions_consistent_hashing_source_line;
     ngx_uint_t sticky_sessions_cookie_attributes_source_line;
     ngx_uint_t sticky_sessions_cookie_name_source_line;
     ngx_uint_t upstream_config_buffer_size_source_line;
@@ -196,6 +214,8 @@ typedef struct {
     ngx_int_t app_type_explicitly_set;
     ngx_int_t base_uris_explicitly_set;
     ngx_int_t buffer_upload_explicitly_set;
+    ngx_int_t capacity_reservation_explicitly_set;
+    ngx_int_t capacity_weight_explicitly_set;
     ngx_int_t debugger_explicitly_set;
     ngx_int_t direct_instance_request_address_explicitly_set;
     ngx_int_t document_root_explicitly_set;
@@ -211,12 +231,15 @@ typedef struct {
     ngx_int_t load_shell_envvars_explicitly_set;
     ngx_int_t max_preloader_idle_time_explicitly_set;
     ngx_int_t max_request_queue_size_explicitly_set;
+    ngx_int_t max_request_queue_time_explicitly_set;
     ngx_int_t max_requests_explicitly_set;
+    ngx_int_t memory_limit_explicitly_set;
     ngx_int_t meteor_app_settings_explicitly_set;
     ngx_int_t min_instances_explicitly_set;
     ngx_int_t monitor_log_file_explicitly_set;
     ngx_int_t nodejs_explicitly_set;
     ngx_int_t python_explicitly_set;
+    ngx_int_t request_priority_explicitly_set;
     ngx_int_t request_queue_overflow_status_code_explicitly_set;
     ngx_int_t restart_dir_explicitly_set;
     ngx_int_t ruby_explicitly_set;
@@ -224,6 +247,7 @@ typedef struct {
     ngx_int_t start_timeout_explicitly_set;
     ngx_int_t startup_file_explicitly_set;
     ngx_int_t sticky_sessions_explicitly_set;
+    ngx_int_t sticky_sessions_consistent_hashing_explicitly_set;
     ngx_int_t sticky_sessions_cookie_attributes_explicitly_set;
     ngx_int_t sticky_sessions_cookie_name_explicitly_set;
     ngx_int_t upstream_config_buffer_size_explicitly_set;
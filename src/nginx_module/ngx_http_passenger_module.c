@@ -515,11 +515,24 @@ pre_config_init(ngx_conf_t *cf)
     pp_schema_string.len  = sizeof("passenger:") - 1;
     pp_placeholder_upstream_address.data = (u_char *) "unix:/passenger_core";
     pp_placeholder_upstream_address.len  = sizeof("unix:/passenger_core") - 1;
+    /* Free the previous cycle's detector before the stat cache that it uses,
+     * so that reloads don't leak shared stat cache mappings.
+     */
+    if (psg_app_type_detector != NULL) {
+        psg_app_type_detector_free(psg_app_type_detector);
+    }
+    if (pp_stat_cache != NULL) {
+        pp_cached_file_stat_free(pp_stat_cache);
+    }
     pp_stat_cache = pp_cached_file_stat_new(1024);
     psg_wrapper_registry = psg_wrapper_registry_new();
     psg_wrapper_registry_finalize(psg_wrapper_registry);
     psg_app_type_detector = psg_app_type_detector_new(psg_wrapper_registry,
-        DEFAULT_STAT_THROTTLE_RATE);
+        pp_stat_cache, DEFAULT_STAT_THROTTLE_RATE);
+    /* Every worker inherits its own copy of the detector, so the result
+     * cache is worker-local and needs no locking.
+     */
+    psg_app_type_detector_set_result_cache_size(psg_app_type_detector, 1024);
     psg_watchdog_launcher = psg_watchdog_launcher_new(IM_NGINX, &error_message);
 
     if (psg_watchdog_launcher == NULL) {
@@ -551,6 +564,17 @@ init_module(ngx_cycle_t *cycle) {
             passenger_main_conf.autogenerated.root_dir.len = 0;
             return NGX_OK;
         }
+        /* Workers are forked after this point, so they all share the stat
+         * information that the Core refreshes, instead of each statting the
+         * same files.
+         */
+        if (pp_cached_file_stat_attach_shared(pp_stat_cache,
+                psg_watchdog_launcher_get_instance_dir(psg_watchdog_launcher, NULL)) == -1)
+        {
+            ngx_log_error(NGX_LOG_WARN, cycle->log, ngx_errno,
+                          "Cannot attach the shared stat cache; using a "
+                          "per-worker stat cache instead");
+        }
         pp_current_cycle = cycle;
     }
     return NGX_OK;
@@ -584,6 +608,12 @@ init_worker_process(ngx_cycle_t *cycle) {
  */
 static void
 exit_master(ngx_cycle_t *cycle) {
+    unsigned long long hits, misses;
+
+    pp_cached_file_stat_get_shared_stats(pp_stat_cache, &hits, &misses);
+    ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                  "Passenger shared stat cache: %uL hits, %uL misses",
+                  (uint64_t) hits, (uint64_t) misses);
     shutdown_watchdog();
 }
 
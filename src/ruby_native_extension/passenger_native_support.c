@@ -94,6 +94,8 @@
 static VALUE mPassenger;
 static VALUE mNativeSupport;
 static VALUE S_ProcessTimes;
+static VALUE str_name_value_separator;
+static VALUE str_crlf;
 #ifdef HAVE_KQUEUE
 	static VALUE cFileSystemWatcher;
 #endif
@@ -146,6 +148,215 @@ split_by_null_into_hash(VALUE self, VALUE data) {
 	return result;
 }
 
+#ifndef HAVE_RB_INTERNED_STR
+	/* A small cache of frozen header name strings, used by #parse_session_headers
+	 * on Rubies that don't have rb_interned_str(). Header names are repeated in
+	 * every request, so this way they are allocated only once. The cache is
+	 * never evicted, so that header names which are sent by a client once can't
+	 * push out the common ones; names that don't fit are simply not cached.
+	 */
+	#define HEADER_NAME_CACHE_SIZE 512
+	#define HEADER_NAME_CACHE_MAX_PROBES 8
+	#define HEADER_NAME_CACHE_MAX_LEN 64
+
+	typedef struct {
+		unsigned long hash;
+		VALUE str;
+	} HeaderNameCacheEntry;
+
+	static HeaderNameCacheEntry header_name_cache[HEADER_NAME_CACHE_SIZE];
+	/* Keeps the cached strings alive. */
+	static VALUE header_name_cache_strings;
+
+	static unsigned long
+	hash_header_name(const char *data, long len) {
+		/* FNV-1a */
+		unsigned long hash = 2166136261UL;
+		long i;
+
+		for (i = 0; i < len; i++) {
+			hash ^= (unsigned char) data[i];
+			hash *= 16777619UL;
+		}
+		return hash;
+	}
+#endif
+
+/* Returns a frozen string with the given contents, shared with all other
+ * header names with the same contents where possible.
+ */
+static VALUE
+lookup_header_name(const char *data, long len) {
+	#ifdef HAVE_RB_INTERNED_STR
+		return rb_interned_str(data, len);
+	#else
+		VALUE str;
+		unsigned long hash;
+		unsigned int i, index;
+		HeaderNameCacheEntry *entry;
+
+		if (len <= HEADER_NAME_CACHE_MAX_LEN) {
+			hash = hash_header_name(data, len);
+			for (i = 0; i < HEADER_NAME_CACHE_MAX_PROBES; i++) {
+				index = (unsigned int) ((hash + i) % HEADER_NAME_CACHE_SIZE);
+				entry = &header_name_cache[index];
+				if (entry->str == 0) {
+					str = rb_str_new(data, len);
+					OBJ_FREEZE(str);
+					rb_ary_push(header_name_cache_strings, str);
+					entry->hash = hash;
+					entry->str = str;
+					return str;
+				} else if (entry->hash == hash
+					&& RSTRING_LEN(entry->str) == len
+					&& memcmp(RSTRING_PTR(entry->str), data, len) == 0)
+				{
+					return entry->str;
+				}
+			}
+		}
+
+		str = rb_str_new(data, len);
+		OBJ_FREEZE(str);
+		return str;
+	#endif
+}
+
+/**
+ * Decodes the session protocol header that the Passenger Core sends at the
+ * beginning of a request, and returns it as a hash that can be used as the
+ * basis for a Rack env. Like #split_by_null_into_hash, but the keys are
+ * frozen and shared between requests, and the values are copy-on-write
+ * substrings of +data+, so that their contents are only copied when they
+ * are modified.
+ */
+static VALUE
+parse_session_headers(VALUE self, VALUE data) {
+	const char *cdata, *begin, *current, *end, *key_begin;
+	long key_len;
+	VALUE result, key, value;
+
+	Check_Type(data, T_STRING);
+	cdata = RSTRING_PTR(data);
+	end   = cdata + RSTRING_LEN(data);
+
+	#ifdef HAVE_RB_HASH_NEW_CAPA
+	{
+		long count = 0;
+
+		current = cdata;
+		while ((current = memchr(current, '\0', end - current)) != NULL) {
+			count++;
+			current++;
+		}
+		result = rb_hash_new_capa(count / 2);
+	}
+	#else
+		result = rb_hash_new();
+	#endif
+
+	begin = cdata;
+	while (begin < end) {
+		current = memchr(begin, '\0', end - begin);
+		if (current == NULL) {
+			break;
+		}
+		key_begin = begin;
+		key_len   = current - begin;
+		begin     = current + 1;
+
+		current = memchr(begin, '\0', end - begin);
+		if (current == NULL) {
+			break;
+		}
+		key   = lookup_header_name(key_begin, key_len);
+		value = rb_str_substr(data, begin - cdata, current - begin);
+		rb_hash_aset(result, key, value);
+		begin = current + 1;
+	}
+	return result;
+}
+
+static void
+append_header_components(VALUE result, VALUE key, VALUE value) {
+	const char *cvalue = RSTRING_PTR(value);
+	const char *begin, *current, *end;
+	long len = RSTRING_LEN(value);
+
+	/* Like String#split("\n"): trailing empty lines are dropped. */
+	while (len > 0 && cvalue[len - 1] == '\n') {
+		len--;
+	}
+	if (len == 0) {
+		return;
+	}
+
+	end = cvalue + len;
+	current = memchr(cvalue, '\n', len);
+	if (current == NULL && len == RSTRING_LEN(value)) {
+		rb_ary_push(result, key);
+		rb_ary_push(result, str_name_value_separator);
+		rb_ary_push(result, value);
+		rb_ary_push(result, str_crlf);
+		return;
+	}
+
+	begin = cvalue;
+	while (1) {
+		current = memchr(begin, '\n', end - begin);
+		if (current == NULL) {
+			current = end;
+		}
+		rb_ary_push(result, key);
+		rb_ary_push(result, str_name_value_separator);
+		rb_ary_push(result, rb_str_substr(value, begin - cvalue, current - begin));
+		rb_ary_push(result, str_crlf);
+		if (current == end) {
+			break;
+		}
+		begin = current + 1;
+	}
+}
+
+static int
+append_header_components_iterator(VALUE key, VALUE value, VALUE result) {
+	if (TYPE(value) != T_STRING) {
+		if (TYPE(key) == T_STRING
+		 && RSTRING_LEN(key) == sizeof("rack.hijack") - 1
+		 && memcmp(RSTRING_PTR(key), "rack.hijack", sizeof("rack.hijack") - 1) == 0)
+		{
+			return ST_CONTINUE;
+		}
+		value = rb_obj_as_string(value);
+	}
+	append_header_components(result, key, value);
+	return ST_CONTINUE;
+}
+
+/**
+ * Generates the status line and header lines of an HTTP response from a
+ * Rack status and headers hash, as an array of strings that can be passed
+ * to #writev. Header values that contain newlines are turned into multiple
+ * header lines. The "rack.hijack" callback, if any, is skipped.
+ *
+ *   generate_headers_array(200, { "Content-Type" => "text/html" })
+ *   # => ["HTTP/1.1 200 Whatever\r\n", "Content-Type", ": ", "text/html", "\r\n"]
+ */
+static VALUE
+generate_headers_array(VALUE self, VALUE status, VALUE headers) {
+	VALUE result, status_line;
+
+	Check_Type(headers, T_HASH);
+	status_line = rb_str_new_cstr("HTTP/1.1 ");
+	rb_str_append(status_line, rb_obj_as_string(status));
+	rb_str_cat2(status_line, " Whatever\r\n");
+
+	result = rb_ary_new2(1 + 4 * RHASH_SIZE(headers));
+	rb_ary_push(result, status_line);
+	rb_hash_foreach(headers, append_header_components_iterator, result);
+	return result;
+}
+
 typedef struct {
 	/* The IO vectors in this group. */
 	struct iovec *io_vectors;
@@ -975,8 +1186,19 @@ Init_passenger_native_support() {
 
 	S_ProcessTimes = rb_struct_define("ProcessTimes", "utime", "stime", NULL);
 
+	str_name_value_separator = rb_obj_freeze(rb_str_new_cstr(": "));
+	rb_global_variable(&str_name_value_separator);
+	str_crlf = rb_obj_freeze(rb_str_new_cstr("\r\n"));
+	rb_global_variable(&str_crlf);
+	#ifndef HAVE_RB_INTERNED_STR
+		header_name_cache_strings = rb_ary_new();
+		rb_global_variable(&header_name_cache_strings);
+	#endif
+
 	rb_define_singleton_method(mNativeSupport, "disable_stdio_buffering", disable_stdio_buffering, 0);
 	rb_define_singleton_method(mNativeSupport, "split_by_null_into_hash", split_by_null_into_hash, 1);
+	rb_define_singleton_method(mNativeSupport, "parse_session_headers", parse_session_headers, 1);
+	rb_define_singleton_method(mNativeSupport, "generate_headers_array", generate_headers_array, 2);
 	rb_define_singleton_method(mNativeSupport, "writev", f_writev, 2);
 	rb_define_singleton_method(mNativeSupport, "writev2", f_writev2, 3);
 	rb_define_singleton_method(mNativeSupport, "writev3", f_writev3, 4);
@@ -388,6 +388,20 @@
     :header    => 'PASSENGER_MIN_PROCESSES',
     :desc      => 'The minimum number of application instances to keep when cleaning idle instances.'
   },
+  {
+    :name      => 'PassengerCapacityWeight',
+    :type      => :integer,
+    :min_value => 0,
+    :default   => 1,
+    :desc      => 'The share of the pool that this application gets relative to other applications when the pool is full.'
+  },
+  {
+    :name      => 'PassengerCapacityReservation',
+    :type      => :integer,
+    :min_value => 0,
+    :default   => 0,
+    :desc      => 'The number of processes that this application keeps when the pool is full.'
+  },
   {
     :name      => 'PassengerUser',
     :type      => :string,
@@ -407,6 +421,31 @@
     :default   => 0,
     :desc      => 'The maximum number of requests that an application instance may process.'
   },
+  {
+    :name      => 'PassengerMemoryLimit',
+    :type      => :integer,
+    :htaccess_context => ['OR_LIMIT'],
+    :min_value => 0,
+    :default   => 0,
+    :desc      => 'The maximum amount of memory in MB that an application instance may use.'
+  },
+  {
+    :name      => 'PassengerRequestPriority',
+    :type      => :string,
+    :context   => :location,
+    :htaccess_context => ['OR_ALL'],
+    :default   => 'normal',
+    :desc      => "The priority class (high, normal or low) of requests in the application's request queue."
+  },
+  {
+    :name      => 'PassengerMaxRequestQueueTime',
+    :type      => :integer,
+    :context   => :location,
+    :htaccess_context => ['OR_ALL'],
+    :min_value => 0,
+    :default   => 0,
+    :desc      => 'The maximum number of seconds that a request may remain in the queue before it is dropped.'
+  },
   {
     :name      => "PassengerStartTimeout",
     :type      => :integer,
@@ -544,6 +583,14 @@
     :default   => false,
     :desc      => 'Whether to enable sticky sessions.'
   },
+  {
+    :name      => 'PassengerStickySessionsConsistentHashing',
+    :type      => :flag,
+    :context   => :location,
+    :htaccess_context => ['OR_ALL'],
+    :default   => false,
+    :desc      => 'Whether to route sticky sessions of processes that are gone by consistent hashing.'
+  },
   {
     :name      => 'PassengerStickySessionsCookieName',
     :type      => :string,
@@ -591,15 +638,6 @@
     :field     => nil,
     :desc      => "Use Flying #{SHORT_PROGRAM_NAME}"
   },
-  {
-    :name      => 'PassengerMemoryLimit',
-    :type      => :integer,
-    :htaccess_context => ['OR_LIMIT'],
-    :min_value => 0,
-    :function  => 'cmd_passenger_enterprise_only',
-    :field     => nil,
-    :desc      => 'The maximum amount of memory in MB that an application instance may use.'
-  },
   {
     :name      => 'PassengerMaxInstances',
     :type      => :integer,
@@ -657,16 +695,6 @@
     :field     => nil,
     :desc      => 'The maximum time (in seconds) that the current application may spend on a request.'
   },
-  {
-    :name      => 'PassengerMaxRequestQueueTime',
-    :type      => :integer,
-    :context   => :location,
-    :htaccess_context => ['OR_ALL'],
-    :min_value => 0,
-    :function  => 'cmd_passenger_enterprise_only',
-    :field     => nil,
-    :desc      => 'The maximum number of seconds that a request may remain in the queue before it is dropped.'
-  },
   {
     :name      => 'PassengerAppLogFile',
     :type      => :string,
@@ -347,6 +347,10 @@ def locate_source_file(path)
     :source   => 'ServerKit/Implementation.cpp',
     :category => :other,
     :optimize => true
+  define_component 'ServerKit/Hpack.o',
+    :source   => 'ServerKit/Hpack.cpp',
+    :category => :other,
+    :optimize => true
   define_component 'DataStructures/LString.o',
     :source   => 'DataStructures/LString.cpp',
     :category => :other
@@ -410,6 +410,18 @@
     :default  => 1,
     :header   => 'PASSENGER_MIN_PROCESSES'
   },
+  {
+    :name     => 'passenger_capacity_weight',
+    :scope    => :application,
+    :type     => :uinteger,
+    :default  => 1
+  },
+  {
+    :name     => 'passenger_capacity_reservation',
+    :scope    => :application,
+    :type     => :uinteger,
+    :default  => 0
+  },
   {
     :name     => 'passenger_start_timeout',
     :scope    => :application,
@@ -463,6 +475,12 @@
     :type     => :integer,
     :default  => DEFAULT_MAX_PRELOADER_IDLE_TIME
   },
+  {
+    :name     => 'passenger_memory_limit',
+    :scope    => :application,
+    :type     => :uinteger,
+    :default  => 0
+  },
   {
     :name     => 'passenger_env_var',
     :scope    => :application,
@@ -549,6 +567,18 @@
     :type     => :uinteger,
     :default  => 0
   },
+  {
+    :name     => 'passenger_request_priority',
+    :scope    => :location,
+    :type     => :string,
+    :default  => 'normal'
+  },
+  {
+    :name     => 'passenger_max_request_queue_time',
+    :scope    => :location,
+    :type     => :uinteger,
+    :default  => 0
+  },
   {
     :name     => 'passenger_base_uri',
     :scope    => :location,
@@ -689,6 +719,12 @@
     :type     => :flag,
     :default  => false
   },
+  {
+    :name     => 'passenger_sticky_sessions_consistent_hashing',
+    :scope    => :location,
+    :type     => :flag,
+    :default  => false
+  },
   {
     :name     => 'passenger_sticky_sessions_cookie_name',
     :scope    => :location,
@@ -726,13 +762,6 @@
     :function => 'passenger_enterprise_only',
     :field    => nil
   },
-  {
-    :name     => 'passenger_memory_limit',
-    :scope    => :application,
-    :type     => :integer,
-    :function => 'passenger_enterprise_only',
-    :field    => nil
-  },
   {
     :name     => 'passenger_concurrency_model',
     :scope    => :application,
@@ -768,13 +797,6 @@
     :function => 'passenger_enterprise_only',
     :field    => nil
   },
-  {
-    :name     => 'passenger_max_request_queue_time',
-    :scope    => :location,
-    :type     => :integer,
-    :function => 'passenger_enterprise_only',
-    :field    => nil
-  },
   {
     :name     => 'passenger_app_log_file',
     :scope    => :application,
@@ -334,7 +334,21 @@ def close_body(body, env, socket_wrapper)
         end
       end
 
-      def generate_headers_array(status, headers)
+      if defined?(PhusionPassenger::NativeSupport)
+        def generate_headers_array(status, headers)
+          if headers.is_a?(Hash)
+            PhusionPassenger::NativeSupport.generate_headers_array(status, headers)
+          else
+            generate_headers_array_in_ruby(status, headers)
+          end
+        end
+      else
+        def generate_headers_array(status, headers)
+          generate_headers_array_in_ruby(status, headers)
+        end
+      end
+
+      def generate_headers_array_in_ruby(status, headers)
         status_str = status.to_s
         result = ["HTTP/1.1 #{status_str} Whatever\r\n"]
         headers.each do |key, values|
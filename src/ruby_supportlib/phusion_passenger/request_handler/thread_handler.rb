@@ -215,7 +215,7 @@ def parse_session_request(connection, channel, buffer)
         if headers_data.nil?
           return
         end
-        headers = Utils::NativeSupportUtils.split_by_null_into_hash(headers_data)
+        headers = Utils::NativeSupportUtils.parse_session_headers(headers_data)
         if @connect_password && headers[PASSENGER_CONNECT_PASSWORD] != @connect_password
           warn "*** Passenger RequestHandler warning: " <<
             "someone tried to connect with an invalid connect password."
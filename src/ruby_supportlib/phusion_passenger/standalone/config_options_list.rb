@@ -116,6 +116,13 @@ module Standalone
         :desc      => "Override size of the socket backlog.\n" \
                       "Default: #{DEFAULT_SOCKET_BACKLOG}"
       },
+      {
+        :name      => :http2,
+        :type      => :boolean,
+        :desc      => "Accept HTTP/2 connections from clients\n" \
+                      "with prior knowledge (Builtin engine\n" \
+                      'only)'
+      },
       {
         :name      => :ssl,
         :type      => :boolean,
@@ -345,6 +352,21 @@ module Standalone
         :desc      => "Minimum number of processes per\n" \
                       'application. Default: 1'
       },
+      {
+        :name      => :capacity_weight,
+        :type      => :integer,
+        :min       => 0,
+        :desc      => "Share of the pool that applications get\n" \
+                      "relative to each other when the pool is\n" \
+                      'full. Default: 1'
+      },
+      {
+        :name      => :capacity_reservation,
+        :type      => :integer,
+        :min       => 0,
+        :desc      => "Number of processes that applications\n" \
+                      'keep when the pool is full. Default: 0'
+      },
       {
         :name      => :pool_idle_time,
         :type      => :integer,
@@ -394,7 +416,7 @@ module Standalone
         :type      => :integer,
         :type_desc => 'MB',
         :desc      => "Restart application processes that go over\n" \
-                      "the given memory limit (Enterprise only)"
+                      "the given memory limit"
       },
       {
         :name      => :rolling_restarts,
@@ -432,11 +454,32 @@ module Standalone
         :min       => 0,
         :desc      => "Specify request queue size. Default: #{DEFAULT_MAX_REQUEST_QUEUE_SIZE}"
       },
+      {
+        :name      => :max_request_queue_time,
+        :type      => :integer,
+        :type_desc => 'SECONDS',
+        :min       => 0,
+        :desc      => "Abort requests that have been in the\n" \
+                      "request queue for longer than this.\n" \
+                      'Default: 0 (never)'
+      },
+      {
+        :name      => :request_priority,
+        :type_desc => 'high|normal|low',
+        :desc      => "Priority class of requests in the request\n" \
+                      'queue. Default: normal'
+      },
       {
         :name      => :sticky_sessions,
         :type      => :boolean,
         :desc      => 'Enable sticky sessions'
       },
+      {
+        :name      => :sticky_sessions_consistent_hashing,
+        :type      => :boolean,
+        :desc      => "Route sticky sessions of processes that are\n" \
+                      "gone by consistent hashing"
+      },
       {
         :name      => :sticky_sessions_cookie_name,
         :type_desc => 'NAME',
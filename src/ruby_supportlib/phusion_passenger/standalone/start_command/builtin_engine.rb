@@ -138,6 +138,7 @@ def build_daemon_controller_options
           command << " --listen #{listen_address(@apps[0])}"
           command << " --no-graceful-exit"
           add_param(command, :socket_backlog, "--socket-backlog")
+          add_flag_param(command, :http2, "--http2")
           add_param(command, :environment, "--environment")
           add_param(command, :app_type, "--app-type")
           add_param(command, :startup_file, "--startup-file")
@@ -161,18 +162,23 @@ def build_daemon_controller_options
           add_flag_param(command, :load_shell_envvars, "--load-shell-envvars")
           add_param(command, :max_pool_size, "--max-pool-size")
           add_param(command, :min_instances, "--min-instances")
+          add_param(command, :capacity_weight, "--capacity-weight")
+          add_param(command, :capacity_reservation, "--capacity-reservation")
           add_param(command, :pool_idle_time, "--pool-idle-time")
           add_param(command, :max_preloader_idle_time, "--max-preloader-idle-time")
           add_param(command, :max_request_queue_size, "--max-request-queue-size")
+          add_param(command, :max_request_queue_time, "--max-request-queue-time")
+          add_param(command, :request_priority, "--request-priority")
           add_enterprise_param(command, :concurrency_model, "--concurrency-model")
           add_enterprise_param(command, :thread_count, "--app-thread-count")
           add_param(command, :max_requests, "--max-requests")
           add_enterprise_param(command, :max_request_time, "--max-request-time")
-          add_enterprise_param(command, :memory_limit, "--memory-limit")
+          add_param(command, :memory_limit, "--memory-limit")
           add_enterprise_flag_param(command, :rolling_restarts, "--rolling-restarts")
           add_enterprise_flag_param(command, :resist_deployment_errors, "--resist-deployment-errors")
           add_enterprise_flag_param(command, :debugger, "--debugger")
           add_flag_param(command, :sticky_sessions, "--sticky-sessions")
+          add_flag_param(command, :sticky_sessions_consistent_hashing, "--sticky-sessions-consistent-hashing")
           add_param(command, :vary_turbocache_by_cookie, "--vary-turbocache-by-cookie")
           add_param(command, :sticky_sessions_cookie_name, "--sticky-sessions-cookie-name")
           add_param(command, :sticky_sessions_cookie_attributes, "--sticky-sessions-cookie-attributes")
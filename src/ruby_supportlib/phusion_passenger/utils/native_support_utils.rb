@@ -38,6 +38,13 @@ def split_by_null_into_hash(data)
           return PhusionPassenger::NativeSupport.split_by_null_into_hash(data)
         end
 
+        # Decodes a session protocol header into a hash. Like
+        # #split_by_null_into_hash, but the keys are frozen and shared
+        # between calls.
+        def parse_session_headers(data)
+          return PhusionPassenger::NativeSupport.parse_session_headers(data)
+        end
+
         # Wrapper for getrusage().
         def process_times
           return PhusionPassenger::NativeSupport.process_times
@@ -54,6 +61,11 @@ def split_by_null_into_hash(data)
           return Hash[*args]
         end
 
+        # Hash[] already freezes string keys.
+        def parse_session_headers(data)
+          return split_by_null_into_hash(data)
+        end
+
         def process_times
           times = Process.times
           return ProcessTimes.new((times.utime * 1_000_000).to_i,
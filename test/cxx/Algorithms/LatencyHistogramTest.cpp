@@ -0,0 +1,91 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2018 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  See LICENSE file for license information.
+ */
+
+#include <TestSupport.h>
+#include <Algorithms/LatencyHistogram.h>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct Algorithms_LatencyHistogramTest: public TestBase {
+		LatencyHistogram histogram;
+	};
+
+	DEFINE_TEST_GROUP(Algorithms_LatencyHistogramTest);
+
+	TEST_METHOD(1) {
+		// An empty histogram reports zeroes.
+		ensure_equals(histogram.getCount(), 0u);
+		ensure_equals(histogram.getMax(), 0u);
+		ensure_equals(histogram.valueAtPercentile(50), 0u);
+	}
+
+	TEST_METHOD(2) {
+		// Bucket indices are contiguous and every value falls
+		// inside the bounds of its bucket.
+		unsigned int prevIndex = 0;
+		for (boost::uint64_t value = 0; value < 100000; value++) {
+			unsigned int index = LatencyHistogram::bucketIndex(value);
+			ensure("Indices never decrease", index >= prevIndex);
+			ensure("Indices have no gaps", index <= prevIndex + 1);
+			ensure("Value is within bucket", value <= LatencyHistogram::bucketUpperBound(index));
+			if (index > 0) {
+				ensure("Value is above previous bucket",
+					value > LatencyHistogram::bucketUpperBound(index - 1));
+			}
+			prevIndex = index;
+		}
+	}
+
+	TEST_METHOD(3) {
+		// Small values are recorded exactly.
+		for (unsigned int i = 0; i < 8; i++) {
+			ensure_equals(LatencyHistogram::bucketUpperBound(
+				LatencyHistogram::bucketIndex(i)), (boost::uint64_t) i);
+		}
+	}
+
+	TEST_METHOD(4) {
+		// Huge values end up in the last bucket.
+		ensure_equals(LatencyHistogram::bucketIndex((boost::uint64_t) -1),
+			LatencyHistogram::BUCKET_COUNT - 1);
+	}
+
+	TEST_METHOD(5) {
+		// Percentiles are reported with at most 12.5% error.
+		for (unsigned int i = 1; i <= 1000; i++) {
+			histogram.record(i * 1000);
+		}
+		ensure_equals(histogram.getCount(), 1000u);
+		ensure_equals(histogram.getMax(), 1000000u);
+
+		boost::uint64_t p50 = histogram.valueAtPercentile(50);
+		ensure(p50 >= 500000);
+		ensure(p50 <= 562500);
+		boost::uint64_t p99 = histogram.valueAtPercentile(99);
+		ensure(p99 >= 990000);
+		ensure(p99 <= 1000000);
+		ensure_equals(histogram.valueAtPercentile(100), 1000000u);
+	}
+
+	TEST_METHOD(6) {
+		// merge() combines counts, sums and maxima.
+		LatencyHistogram other;
+		histogram.record(10);
+		histogram.record(20);
+		other.record(5000);
+		histogram.merge(other);
+		ensure_equals(histogram.getCount(), 3u);
+		ensure_equals(histogram.getSum(), 5030u);
+		ensure_equals(histogram.getMax(), 5000u);
+		ensure_equals(histogram.countAtOrBelow(20), 2u);
+	}
+}
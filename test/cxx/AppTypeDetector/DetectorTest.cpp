@@ -0,0 +1,127 @@
+#include <TestSupport.h>
+#include <AppTypeDetector/Detector.h>
+#include <FileTools/FileManip.h>
+#include <SystemTools/SystemTime.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::AppTypeDetector;
+
+namespace tut {
+	struct AppTypeDetector_DetectorTest: public TestBase {
+		WrapperRegistry::Registry wrapperRegistry;
+		TempDir tmpDir;
+
+		AppTypeDetector_DetectorTest()
+			: tmpDir("tmp.detector")
+		{
+			wrapperRegistry.finalize();
+			makeDirTree("tmp.detector/app1/public");
+			makeDirTree("tmp.detector/app2/public");
+			SystemTime::force(10);
+		}
+
+		~AppTypeDetector_DetectorTest() {
+			SystemTime::release();
+		}
+	};
+
+	DEFINE_TEST_GROUP(AppTypeDetector_DetectorTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It detects the app type through the startup file");
+		Detector detector(wrapperRegistry);
+		createFile("tmp.detector/app1/config.ru", "");
+
+		Detector::Result result = detector.checkAppRoot("tmp.detector/app1");
+		ensure("(1)", !result.isNull());
+		ensure_equals("(2)", result.wrapperRegistryEntry->language, "ruby");
+
+		result = detector.checkDocumentRoot("tmp.detector/app1/public");
+		ensure("(3)", !result.isNull());
+		ensure_equals("(4)", result.wrapperRegistryEntry->language, "ruby");
+
+		result = detector.checkAppRoot("tmp.detector/app2");
+		ensure("(5)", result.isNull());
+		ensure_equals("(6)", detector.getResultCacheCount(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Cached results are reused until the throttle rate has passed");
+		Detector detector(wrapperRegistry, NULL, NULL, 5);
+		detector.setResultCacheSize(16);
+		createFile("tmp.detector/app1/config.ru", "");
+
+		Detector::Result result = detector.checkDocumentRoot("tmp.detector/app1/public");
+		ensure("(1)", !result.isNull());
+		ensure_equals("(2)", result.wrapperRegistryEntry->language, "ruby");
+		ensure_equals("(3)", detector.getResultCacheCount(), 1u);
+
+		unlink("tmp.detector/app1/config.ru");
+		createFile("tmp.detector/app1/passenger_wsgi.py", "");
+		SystemTime::force(14);
+		result = detector.checkDocumentRoot("tmp.detector/app1/public");
+		ensure_equals("(4)", result.wrapperRegistryEntry->language, "ruby");
+
+		SystemTime::force(15);
+		result = detector.checkDocumentRoot("tmp.detector/app1/public");
+		ensure("(5)", !result.isNull());
+		ensure_equals("(6)", result.wrapperRegistryEntry->language, "python");
+		ensure_equals("(7)", detector.getResultCacheCount(), 1u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Document roots and app roots are cached separately");
+		Detector detector(wrapperRegistry, NULL, NULL, 5);
+		detector.setResultCacheSize(16);
+		createFile("tmp.detector/app1/passenger_wsgi.py", "");
+
+		ensure("(1)", !detector.checkDocumentRoot("tmp.detector/app1/public").isNull());
+		ensure("(2)", !detector.checkDocumentRoot("tmp.detector/app1/public", true).isNull());
+		ensure("(3)", !detector.checkAppRoot("tmp.detector/app1").isNull());
+		ensure_equals("(4)", detector.getResultCacheCount(), 3u);
+
+		string appRoot;
+		ensure("(5)", !detector.checkDocumentRoot("tmp.detector/app1/public",
+			false, &appRoot).isNull());
+		ensure_equals("(6)", appRoot, "tmp.detector/app1");
+		ensure_equals("(7)", detector.getResultCacheCount(), 3u);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("The cache starts over when it is full");
+		Detector detector(wrapperRegistry, NULL, NULL, 5);
+		detector.setResultCacheSize(2);
+		createFile("tmp.detector/config.ru", "");
+		createFile("tmp.detector/app1/config.ru", "");
+		createFile("tmp.detector/app2/config.ru", "");
+
+		detector.checkAppRoot("tmp.detector/app1");
+		detector.checkAppRoot("tmp.detector/app2");
+		ensure_equals("(1)", detector.getResultCacheCount(), 2u);
+		detector.checkAppRoot("tmp.detector/app1");
+		ensure_equals("(2)", detector.getResultCacheCount(), 2u);
+		detector.checkAppRoot("tmp.detector");
+		ensure_equals("(3)", detector.getResultCacheCount(), 1u);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Failed detections are not cached and don't evict cached results");
+		Detector detector(wrapperRegistry, NULL, NULL, 5);
+		detector.setResultCacheSize(2);
+		createFile("tmp.detector/app2/config.ru", "");
+
+		ensure("(1)", !detector.checkAppRoot("tmp.detector/app2").isNull());
+		ensure("(2)", detector.checkDocumentRoot("tmp.detector/app1/public").isNull());
+		ensure("(3)", detector.checkAppRoot("tmp.detector/app1").isNull());
+		ensure("(4)", detector.checkAppRoot("tmp.detector").isNull());
+		ensure_equals("(5)", detector.getResultCacheCount(), 1u);
+
+		createFile("tmp.detector/app1/config.ru", "");
+		SystemTime::force(15);
+		Detector::Result result = detector.checkDocumentRoot("tmp.detector/app1/public");
+		ensure("(6)", !result.isNull());
+		ensure_equals("(7)", result.wrapperRegistryEntry->language, "ruby");
+		ensure_equals("(8)", detector.getResultCacheCount(), 2u);
+	}
+}
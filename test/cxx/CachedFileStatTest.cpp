@@ -2,6 +2,7 @@
 #include <Utils/CachedFileStat.hpp>
 #include <SystemTools/SystemTime.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <utime.h>
 
 using namespace std;
@@ -17,6 +18,26 @@ namespace tut {
 			unlink("test2.txt");
 			unlink("test3.txt");
 			unlink("test4.txt");
+			unlink("test.cache");
+		}
+
+		/**
+		 * Makes it look as if `pid` started updating the first slot of
+		 * `cache` at `startTime`, and never finished.
+		 */
+		void abandonWrite(SharedFileStatCache &cache, pid_t pid, time_t startTime) {
+			SharedFileStatCache::Slot *slot = &cache.slots[0];
+			boost::uint64_t seq = slot->seq.load();
+			slot->seq.store(((boost::uint64_t) pid << 32) | (boost::uint32_t) (seq + 1));
+			slot->writeStartTime.store(startTime);
+		}
+
+		/**
+		 * Makes it look as if a writer that was taken over changed the
+		 * entry in the first slot of `cache` afterwards.
+		 */
+		void tearEntry(SharedFileStatCache &cache) {
+			cache.slots[0].info.st_mtime++;
 		}
 	};
 
@@ -399,4 +420,261 @@ namespace tut {
 		ensure("(4)", stat.knows("test4.txt"));
 		ensure("(5)", stat.knows("test5.txt"));
 	}
+
+	/************ Tests involving a shared cache ************/
+
+	TEST_METHOD(20) {
+		set_test_name("A shared cache does not re-stat a file until the cache has expired");
+		CachedFileStat stat(1);
+		stat.setSharedCache(boost::make_shared<SharedFileStatCache>(16));
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		ensure_equals("(1)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("(2)", buf.st_mtime, (time_t) 1);
+
+		touch("test.txt", 1000);
+		ensure_equals("(3)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("(4)", buf.st_mtime, (time_t) 1);
+
+		SystemTime::force(6);
+		ensure_equals("(5)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("(6)", buf.st_mtime, (time_t) 1000);
+		ensure("(7)", !stat.knows("test.txt"));
+
+		SharedFileStatCache::Stats stats = stat.getSharedCache()->getStats();
+		ensure_equals("(8)", stats.hits, 1u);
+		ensure_equals("(9)", stats.misses, 2u);
+		ensure_equals("(10)", stats.refreshes, 2u);
+	}
+
+	TEST_METHOD(21) {
+		set_test_name("A shared cache remembers failed stats");
+		CachedFileStat stat(1);
+		stat.setSharedCache(boost::make_shared<SharedFileStatCache>(16));
+
+		SystemTime::force(5);
+		ensure_equals("(1)", stat.stat("test.txt", &buf, 1), -1);
+		ensure_equals("(2)", errno, ENOENT);
+
+		touch("test.txt");
+		errno = 0;
+		ensure_equals("(3)", stat.stat("test.txt", &buf, 1), -1);
+		ensure_equals("(4)", errno, ENOENT);
+	}
+
+	TEST_METHOD(22) {
+		set_test_name("Stat information is shared with child processes");
+		CachedFileStat stat(1);
+		stat.setSharedCache(boost::make_shared<SharedFileStatCache>(16));
+		pid_t pid;
+		int status;
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		pid = fork();
+		if (pid == 0) {
+			stat.stat("test.txt", &buf, 10);
+			_exit(0);
+		}
+		ensure("(1)", waitpid(pid, &status, 0) == pid);
+
+		touch("test.txt", 1000);
+		ensure_equals("(2)", stat.stat("test.txt", &buf, 10), 0);
+		ensure_equals("(3)", buf.st_mtime, (time_t) 1);
+		ensure_equals("(4)", stat.getSharedCache()->getStats().hits, 1u);
+	}
+
+	TEST_METHOD(23) {
+		set_test_name("A shared cache slot abandoned by a dead writer is taken over");
+		SharedFileStatCache cache(SharedFileStatCache::ASSOCIATIVITY);
+		pid_t pid;
+		int status, ret;
+
+		pid = fork();
+		if (pid == 0) {
+			_exit(0);
+		}
+		ensure("(1)", waitpid(pid, &status, 0) == pid);
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		cache.stat("test.txt", &buf, 1, ret);
+		abandonWrite(cache, pid, 5);
+
+		SystemTime::force(6);
+		touch("test.txt", 1000);
+		ensure("(2)", cache.stat("test.txt", &buf, 1, ret));
+		ensure_equals("(3)", buf.st_mtime, (time_t) 1000);
+		SharedFileStatCache::Stats stats = cache.getStats();
+		ensure_equals("(4)", stats.takeovers, 1u);
+		ensure_equals("(5)", stats.contended, 0u);
+
+		ensure("(6)", cache.stat("test.txt", &buf, 1, ret));
+		ensure_equals("(7)", cache.getStats().hits, 1u);
+	}
+
+	TEST_METHOD(24) {
+		set_test_name("Filenames that do not fit in a shared cache use the local cache");
+		CachedFileStat stat(1);
+		stat.setSharedCache(boost::make_shared<SharedFileStatCache>(16));
+		string filename;
+		while (filename.size() < SharedFileStatCache::MAX_FILENAME_SIZE) {
+			filename.append("./");
+		}
+		filename.append("test.txt");
+
+		touch("test.txt");
+		ensure_equals("(1)", stat.stat(filename, &buf, 1), 0);
+		ensure("(2)", stat.knows(filename));
+		ensure_equals("(3)", stat.getSharedCache()->getStats().misses, 0u);
+	}
+
+	TEST_METHOD(25) {
+		set_test_name("A full shared cache replaces the least recently refreshed entry");
+		SharedFileStatCache cache(SharedFileStatCache::ASSOCIATIVITY);
+		int ret;
+
+		ensure_equals("(1)", cache.capacity(), (unsigned int) SharedFileStatCache::ASSOCIATIVITY);
+		for (unsigned int i = 0; i <= SharedFileStatCache::ASSOCIATIVITY; i++) {
+			SystemTime::force(10 + i);
+			cache.stat("test" + toString(i) + ".txt", &buf, 100, ret);
+		}
+
+		SystemTime::force(20);
+		cache.stat("test1.txt", &buf, 100, ret);
+		cache.stat("test" + toString(SharedFileStatCache::ASSOCIATIVITY) + ".txt",
+			&buf, 100, ret);
+		ensure_equals("(2)", cache.getStats().hits, 2u);
+		cache.stat("test0.txt", &buf, 100, ret);
+		ensure_equals("(3)", cache.getStats().hits, 2u);
+	}
+
+	TEST_METHOD(26) {
+		set_test_name("A shared cache slot that is being written for too long is taken over");
+		SharedFileStatCache cache(SharedFileStatCache::ASSOCIATIVITY);
+		int ret;
+
+		SystemTime::force(5);
+		touch("test.txt");
+		touch("test2.txt");
+		cache.stat("test.txt", &buf, 1, ret);
+		abandonWrite(cache, getpid(), 5);
+
+		SystemTime::force(5 + SharedFileStatCache::ABANDONED_WRITE_TIMEOUT - 1);
+		cache.stat("test.txt", &buf, 1, ret);
+		ensure_equals("(1)", cache.getStats().takeovers, 0u);
+
+		SystemTime::force(5 + SharedFileStatCache::ABANDONED_WRITE_TIMEOUT);
+		cache.stat("test2.txt", &buf, 1, ret);
+		ensure_equals("(2)", cache.getStats().takeovers, 1u);
+	}
+
+	TEST_METHOD(27) {
+		set_test_name("A file-backed shared cache is shared by everyone who maps the file");
+		int ret;
+
+		SharedFileStatCache cache1("test.cache", 16);
+		SharedFileStatCache cache2("test.cache", 1000);
+		ensure_equals("(1)", cache2.capacity(), cache1.capacity());
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		cache1.stat("test.txt", &buf, 10, ret);
+
+		touch("test.txt", 1000);
+		ensure("(2)", cache2.stat("test.txt", &buf, 10, ret));
+		ensure_equals("(3)", buf.st_mtime, (time_t) 1);
+		ensure_equals("(4)", cache1.getStats().hits, 1u);
+	}
+
+	TEST_METHOD(28) {
+		set_test_name("A file that is not a shared cache is rejected");
+		createFile("test.cache", "hello world");
+		try {
+			SharedFileStatCache cache("test.cache", 16);
+			fail("RuntimeException expected");
+		} catch (const RuntimeException &) {
+			// Pass.
+		}
+		ensure("(1)", !fileExists("test.cache.tmp." + toString(getpid())));
+	}
+
+	TEST_METHOD(29) {
+		set_test_name("A shared cache entry that was torn by a taken over writer is re-stat()ted");
+		SharedFileStatCache cache(SharedFileStatCache::ASSOCIATIVITY);
+		int ret;
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		cache.stat("test.txt", &buf, 10, ret);
+		tearEntry(cache);
+
+		touch("test.txt", 1000);
+		ensure("(1)", cache.stat("test.txt", &buf, 10, ret));
+		ensure_equals("(2)", buf.st_mtime, (time_t) 1000);
+		SharedFileStatCache::Stats stats = cache.getStats();
+		ensure_equals("(3)", stats.torn, 1u);
+		ensure_equals("(4)", stats.hits, 0u);
+
+		ensure("(5)", cache.stat("test.txt", &buf, 10, ret));
+		ensure_equals("(6)", buf.st_mtime, (time_t) 1000);
+		ensure_equals("(7)", cache.getStats().hits, 1u);
+	}
+
+	TEST_METHOD(30) {
+		set_test_name("Only one existing process can be the refresher of a shared cache");
+		SharedFileStatCache cache(16);
+		pid_t pid;
+		int status;
+
+		ensure("(1)", cache.becomeRefresher());
+		ensure("(2)", cache.becomeRefresher());
+		ensure_equals("(3)", cache.getStats().refresherPid, getpid());
+
+		pid = fork();
+		if (pid == 0) {
+			_exit(cache.becomeRefresher() ? 1 : 0);
+		}
+		ensure("(4)", waitpid(pid, &status, 0) == pid);
+		ensure_equals("(5)", WEXITSTATUS(status), 0);
+
+		cache.resignRefresher();
+		pid = fork();
+		if (pid == 0) {
+			_exit(cache.becomeRefresher() ? 1 : 0);
+		}
+		ensure("(6)", waitpid(pid, &status, 0) == pid);
+		ensure_equals("(7)", WEXITSTATUS(status), 1);
+		ensure("(8)", cache.becomeRefresher());
+		ensure_equals("(9)", cache.getStats().refresherPid, getpid());
+	}
+
+	TEST_METHOD(31) {
+		set_test_name("The refresher re-stats the shared cache entries that are in use");
+		SharedFileStatCache cache(16);
+		int ret;
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		touch("test2.txt", 1);
+		cache.stat("test.txt", &buf, 1000, ret);
+		cache.stat("test2.txt", &buf, 1000, ret);
+
+		SystemTime::force(100);
+		cache.stat("test.txt", &buf, 1000, ret);
+		touch("test.txt", 1000);
+		touch("test2.txt", 1000);
+
+		SystemTime::force(101);
+		ensure_equals("(1)", cache.refresh(60), 1u);
+		ensure_equals("(2)", cache.refresh(60), 0u);
+		ensure_equals("(3)", cache.getStats().backgroundRefreshes, 1u);
+
+		ensure("(4)", cache.stat("test.txt", &buf, 1, ret));
+		ensure_equals("(5)", buf.st_mtime, (time_t) 1000);
+		ensure("(6)", cache.stat("test2.txt", &buf, 1000, ret));
+		ensure_equals("(7)", buf.st_mtime, (time_t) 1);
+		ensure_equals("(8)", cache.getStats().hits, 3u);
+	}
 }
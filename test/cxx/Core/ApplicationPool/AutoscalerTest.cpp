@@ -0,0 +1,117 @@
+#include <TestSupport.h>
+#include <Core/ApplicationPool/Autoscaler.h>
+
+using namespace Passenger;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace tut {
+	struct Core_ApplicationPool_AutoscalerTest: public TestBase {
+		AutoscalerConfig config;
+		Autoscaler autoscaler;
+		unsigned long long now;
+
+		Core_ApplicationPool_AutoscalerTest() {
+			config.enabled = true;
+			config.scaleDownDelay = 3;
+			now = 1000000000;
+		}
+
+		Autoscaler::Decision evaluate(unsigned int concurrency, unsigned int requests = 0,
+			unsigned int minBound = 1, unsigned int maxBound = 0)
+		{
+			for (unsigned int i = 0; i < requests; i++) {
+				autoscaler.recordRequest();
+			}
+			now += config.interval;
+			return autoscaler.evaluate(config, now, concurrency, 1, minBound, maxBound);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_ApplicationPool_AutoscalerTest);
+
+	TEST_METHOD(1) {
+		// The target never goes below the lower bound.
+		ensure_equals(evaluate(0), Autoscaler::AD_SCALE_UP);
+		ensure_equals(autoscaler.getTarget(), 1u);
+		ensure_equals(evaluate(0), Autoscaler::AD_NONE);
+		ensure_equals(autoscaler.getTarget(), 1u);
+	}
+
+	TEST_METHOD(2) {
+		// A rise in concurrency raises the target immediately,
+		// and the target stays within the upper bound.
+		evaluate(0, 0, 1, 6);
+		ensure_equals(evaluate(4, 20, 1, 6), Autoscaler::AD_SCALE_UP);
+		ensure(autoscaler.getTarget() >= 4u);
+		ensure(autoscaler.getTarget() <= 6u);
+		evaluate(20, 100, 1, 6);
+		ensure_equals(autoscaler.getTarget(), 6u);
+	}
+
+	TEST_METHOD(3) {
+		// The target goes down one process at a time, and only after the
+		// demand has been lower for scaleDownDelay evaluations.
+		evaluate(4, 20);
+		evaluate(4, 20);
+		ensure(autoscaler.getTarget() >= 4u);
+
+		unsigned int evaluationsSinceScaleUp = 0;
+		bool scaledDown = false;
+		for (unsigned int i = 0; i < 1000; i++) {
+			unsigned int prevTarget = autoscaler.getTarget();
+			Autoscaler::Decision decision = evaluate(0);
+			evaluationsSinceScaleUp++;
+			if (decision == Autoscaler::AD_SCALE_UP) {
+				ensure("Never scales up after the first scale down", !scaledDown);
+				evaluationsSinceScaleUp = 0;
+			} else if (decision == Autoscaler::AD_SCALE_DOWN) {
+				ensure(evaluationsSinceScaleUp >= config.scaleDownDelay);
+				ensure_equals(autoscaler.getTarget(), prevTarget - 1);
+				scaledDown = true;
+			} else {
+				ensure_equals(autoscaler.getTarget(), prevTarget);
+			}
+		}
+		ensure(scaledDown);
+		ensure_equals(autoscaler.getTarget(), 1u);
+	}
+
+	TEST_METHOD(4) {
+		// Decisions are logged in the XML inspection output.
+		evaluate(3, 10);
+		stringstream stream;
+		autoscaler.inspectXml(stream);
+		ensure(stream.str().find("<action>scale_up</action>") != string::npos);
+		ensure(stream.str().find("<target>" + toString(autoscaler.getTarget()) + "</target>")
+			!= string::npos);
+	}
+
+	TEST_METHOD(5) {
+		// With a lower bound of 0, the target goes down to zero
+		// processes once there is no demand anymore.
+		evaluate(4, 20, 0);
+		ensure(autoscaler.getTarget() >= 4u);
+		for (unsigned int i = 0; i < 1000 && autoscaler.getTarget() > 0; i++) {
+			evaluate(0, 0, 0);
+		}
+		ensure_equals(autoscaler.getTarget(), 0u);
+	}
+
+	TEST_METHOD(6) {
+		// The target is the predicted concurrency divided by the average
+		// process concurrency. If the processes handle an unlimited number
+		// of concurrent requests then the target only follows the bounds.
+		now += config.interval;
+		autoscaler.evaluate(config, now, 10, 2.5, 1, 0);
+		ensure_equals(autoscaler.getTarget(), 4u);
+
+		Autoscaler unlimited;
+		unlimited.evaluate(config, now, 10, 0, 2, 0);
+		ensure_equals(unlimited.getTarget(), 2u);
+		stringstream stream;
+		unlimited.inspectXml(stream);
+		ensure(stream.str().find("<process_concurrency>unlimited</process_concurrency>")
+			!= string::npos);
+	}
+}
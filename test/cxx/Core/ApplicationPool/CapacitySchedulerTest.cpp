@@ -0,0 +1,125 @@
+#include <TestSupport.h>
+#include <Core/ApplicationPool/CapacityScheduler.h>
+
+using namespace Passenger;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace tut {
+	struct Core_ApplicationPool_CapacitySchedulerTest: public TestBase {
+		vector<CapacityClaim> claims;
+
+		void addClaim(unsigned int weight, unsigned int demand,
+			unsigned int reservation = 0, unsigned int limit = 0)
+		{
+			CapacityClaim claim;
+			claim.weight = weight;
+			claim.demand = demand;
+			claim.reservation = reservation;
+			claim.limit = limit;
+			claims.push_back(claim);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_ApplicationPool_CapacitySchedulerTest);
+
+	TEST_METHOD(1) {
+		// Claims with equal weights get equal shares.
+		addClaim(1, 100);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 6);
+		ensure_equals(claims[0].share, 3u);
+		ensure_equals(claims[1].share, 3u);
+	}
+
+	TEST_METHOD(2) {
+		// Shares are proportional to the weights, and no
+		// capacity is left unused.
+		addClaim(2, 100);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 6);
+		ensure_equals(claims[0].share, 4u);
+		ensure_equals(claims[1].share, 2u);
+
+		claims.clear();
+		addClaim(1, 100);
+		addClaim(1, 100);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 4);
+		ensure_equals(claims[0].share + claims[1].share + claims[2].share, 4u);
+		ensure(claims[0].share >= 1 && claims[0].share <= 2);
+		ensure(claims[1].share >= 1 && claims[1].share <= 2);
+		ensure(claims[2].share >= 1 && claims[2].share <= 2);
+	}
+
+	TEST_METHOD(3) {
+		// A claim does not get more than it demands; the rest goes
+		// to the others.
+		addClaim(1, 1);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 6);
+		ensure_equals(claims[0].share, 1u);
+		ensure_equals(claims[1].share, 5u);
+
+		claims.clear();
+		addClaim(1, 1);
+		addClaim(1, 2);
+		computeCapacityShares(claims, 6);
+		ensure_equals(claims[0].share, 1u);
+		ensure_equals(claims[1].share, 2u);
+	}
+
+	TEST_METHOD(4) {
+		// A claim does not get more than its limit; the rest goes
+		// to the others.
+		addClaim(5, 100, 0, 2);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 6);
+		ensure_equals(claims[0].share, 2u);
+		ensure_equals(claims[1].share, 4u);
+	}
+
+	TEST_METHOD(5) {
+		// Reservations are granted before the rest is divided by weight.
+		addClaim(1, 100, 4);
+		addClaim(3, 100);
+		computeCapacityShares(claims, 8);
+		ensure_equals(claims[0].share, 5u);
+		ensure_equals(claims[1].share, 3u);
+	}
+
+	TEST_METHOD(6) {
+		// A reservation counts even if the claim demands less, but not
+		// beyond the limit.
+		addClaim(1, 0, 2);
+		addClaim(1, 0, 5, 1);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 10);
+		ensure_equals(claims[0].share, 2u);
+		ensure_equals(claims[1].share, 1u);
+		ensure_equals(claims[2].share, 7u);
+	}
+
+	TEST_METHOD(7) {
+		// Reservations that exceed the capacity are divided by weight.
+		addClaim(1, 100, 6);
+		addClaim(2, 100, 6);
+		computeCapacityShares(claims, 6);
+		ensure_equals(claims[0].share, 2u);
+		ensure_equals(claims[1].share, 4u);
+	}
+
+	TEST_METHOD(8) {
+		// A weight of 0 is treated as 1, and no claims or no capacity
+		// are handled.
+		computeCapacityShares(claims, 6);
+		addClaim(0, 100);
+		addClaim(1, 100);
+		computeCapacityShares(claims, 0);
+		ensure_equals(claims[0].share, 0u);
+		ensure_equals(claims[1].share, 0u);
+		computeCapacityShares(claims, 4);
+		ensure_equals(claims[0].share, 2u);
+		ensure_equals(claims[1].share, 2u);
+	}
+}
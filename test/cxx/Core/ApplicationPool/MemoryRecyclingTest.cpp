@@ -0,0 +1,118 @@
+#include <TestSupport.h>
+#include <Core/ApplicationPool/MemoryRecycling.h>
+
+using namespace Passenger;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace tut {
+	struct Core_ApplicationPool_MemoryRecyclingTest: public TestBase {
+		MemoryTrend trend;
+		unsigned long long now;
+
+		Core_ApplicationPool_MemoryRecyclingTest() {
+			now = 1000000000;
+		}
+
+		void addSample(size_t kb) {
+			trend.addSample(now, kb);
+			now += 60000000;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_ApplicationPool_MemoryRecyclingTest);
+
+	TEST_METHOD(1) {
+		// An empty trend reports no usage and no growth.
+		ensure_equals(trend.getSampleCount(), 0u);
+		ensure_equals(trend.getCurrent(), 0u);
+		ensure_equals(trend.getPeak(), 0u);
+		ensure_equals(trend.getGrowthRate(), 0.0);
+		addSample(1000);
+		ensure_equals(trend.getCurrent(), 1000u);
+		ensure_equals(trend.getGrowthRate(), 0.0);
+	}
+
+	TEST_METHOD(2) {
+		// The growth rate is reported in KB per minute.
+		addSample(1000);
+		addSample(1100);
+		addSample(1200);
+		addSample(1300);
+		ensure_equals(trend.getCurrent(), 1300u);
+		ensure_equals(trend.getPeak(), 1300u);
+		ensure(trend.getGrowthRate() > 99.9);
+		ensure(trend.getGrowthRate() < 100.1);
+	}
+
+	TEST_METHOD(3) {
+		// A stable footprint has no growth, and a single spike
+		// does not dominate the growth rate.
+		for (unsigned int i = 0; i < 5; i++) {
+			addSample(5000);
+		}
+		ensure_equals(trend.getGrowthRate(), 0.0);
+		addSample(9000);
+		for (unsigned int i = 0; i < 5; i++) {
+			addSample(5000);
+		}
+		ensure_equals(trend.getPeak(), 9000u);
+		ensure(trend.getGrowthRate() < 100);
+		ensure(trend.getGrowthRate() > -100);
+	}
+
+	TEST_METHOD(4) {
+		// Only the last MAX_SAMPLES samples are kept, while the peak
+		// covers all samples.
+		addSample(100000);
+		for (unsigned int i = 0; i < MemoryTrend::MAX_SAMPLES * 2; i++) {
+			addSample(1000 - i * 10);
+		}
+		ensure_equals(trend.getSampleCount(), (unsigned int) MemoryTrend::MAX_SAMPLES);
+		ensure_equals(trend.getCurrent(), 1000u - (MemoryTrend::MAX_SAMPLES * 2 - 1) * 10);
+		ensure_equals(trend.getPeak(), 100000u);
+		ensure(trend.getGrowthRate() > -10.1);
+		ensure(trend.getGrowthRate() < -9.9);
+	}
+
+	TEST_METHOD(5) {
+		// measure() uses the private dirty RSS plus swap by default, and
+		// the PSS plus swap if so configured and known.
+		MemoryRecyclingConfig config;
+		ProcessMetrics metrics;
+		metrics.pid = 1;
+		metrics.rss = 4000;
+		metrics.privateDirty = 1000;
+		metrics.pss = 2000;
+		metrics.swap = 10;
+		ensure_equals(config.measure(metrics), 1010u);
+
+		config.usePss = true;
+		ensure_equals(config.measure(metrics), 2010u);
+		metrics.pss = -1;
+		ensure_equals(config.measure(metrics), 1010u);
+	}
+
+	TEST_METHOD(6) {
+		// countRecentSamplesAbove() counts the consecutive most recent
+		// samples above the given value, and getInitial() returns the
+		// first sample even after it has been dropped.
+		ensure_equals(trend.countRecentSamplesAbove(0), 0u);
+		ensure_equals(trend.getInitial(), 0u);
+		addSample(2000);
+		addSample(500);
+		addSample(2000);
+		addSample(3000);
+		ensure_equals(trend.countRecentSamplesAbove(1000), 2u);
+		ensure_equals(trend.countRecentSamplesAbove(2000), 1u);
+		ensure_equals(trend.countRecentSamplesAbove(3000), 0u);
+		ensure_equals(trend.countRecentSamplesAbove(100), 4u);
+
+		for (unsigned int i = 0; i < MemoryTrend::MAX_SAMPLES; i++) {
+			addSample(1500);
+		}
+		ensure_equals(trend.countRecentSamplesAbove(1000),
+			(unsigned int) MemoryTrend::MAX_SAMPLES);
+		ensure_equals(trend.getInitial(), 2000u);
+	}
+}
@@ -2062,6 +2062,50 @@ namespace tut {
 		currentSession.reset();
 	}
 
+	TEST_METHOD(80) {
+		// In consistent hashing mode, sticky session IDs that do not belong
+		// to any process are always routed to the same process, and a process
+		// that replaces a detached one takes over its sticky session ID.
+		Options options = createOptions();
+		options.appGroupName = "test";
+		options.minProcesses = 2;
+		options.stickySessionsConsistentHashing = true;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		ProcessPtr process = currentSession->getProcess()->shared_from_this();
+		unsigned int id = currentSession->getStickySessionId();
+		pid_t pid = currentSession->getPid();
+		currentSession.reset();
+
+		options.stickySessionId = id + 1;
+		SessionPtr session = pool->get(options, &ticket);
+		pid_t unknownIdPid = session->getPid();
+		session.reset();
+		for (unsigned int i = 0; i < 5; i++) {
+			session = pool->get(options, &ticket);
+			ensure_equals("Unknown sticky session IDs are routed consistently",
+				session->getPid(), unknownIdPid);
+			session.reset();
+		}
+
+		pool->detachProcess(process);
+		EVENTUALLY(5,
+			LockGuard l(pool->syncher);
+			Process *replacement = pool->getGroup("test")->findProcessWithStickySessionId(id);
+			result = replacement != NULL && replacement->getPid() != pid;
+		);
+
+		options.stickySessionId = id;
+		session = pool->get(options, &ticket);
+		ensure_equals(session->getStickySessionId(), id);
+		ensure(session->getPid() != pid);
+	}
+
 	// TODO: Persistent connections.
 	// TODO: If one closes the session before it has reached EOF, and process's maximum concurrency
 	//       has already been reached, then the pool should ping the process so that it can detect
@@ -2088,6 +2132,569 @@ namespace tut {
 		pool->get(options, &ticket).reset();
 	}
 
+	TEST_METHOD(86) {
+		// A queued get action can be canceled. Its callback is never called.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		GroupPtr group = pool->findOrCreateGroup(options);
+		skDebugSupport.dummyConcurrency = 3;
+		initPoolDebugging();
+		pool->setMax(1);
+
+		pool->asyncGet(options, callback);
+		pool->asyncGet(options, callback);
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getWaitlist.size(), 2u);
+		}
+
+		ensure(pool->cancelAsyncGet(options, callback));
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getWaitlist.size(), 1u);
+		}
+
+		debug->messages->send("Proceed with spawn loop iteration 1");
+		debug->messages->send("Spawn loop done");
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = number > 1;
+		);
+		ensure("Nothing left to cancel", !pool->cancelAsyncGet(options, callback));
+	}
+
+	TEST_METHOD(87) {
+		// A get action that sits in the getWaitlist for longer than
+		// maxRequestQueueTime is aborted with a RequestQueueTimeoutException.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.maxRequestQueueTime = 1;
+		GroupPtr group = pool->findOrCreateGroup(options);
+		skDebugSupport.dummyConcurrency = 3;
+		initPoolDebugging();
+		pool->setMax(1);
+
+		pool->asyncGet(options, callback);
+		ensure_equals(number, 0);
+
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		{
+			LockGuard l(syncher);
+			ensure(currentSession == NULL);
+			ensure(dynamic_pointer_cast<RequestQueueTimeoutException>(currentException) != NULL);
+		}
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getWaitlist.size(), 0u);
+		}
+
+		debug->messages->send("Proceed with spawn loop iteration 1");
+		debug->messages->send("Spawn loop done");
+	}
+
+	TEST_METHOD(88) {
+		// Queued requests are ordered by weighted fair queueing on their
+		// priority class. All classes share one queue size limit, but when
+		// the queue is full a request displaces a lower priority one.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.maxRequestQueueSize = 3;
+		GroupPtr group = pool->findOrCreateGroup(options);
+		skDebugSupport.dummyConcurrency = 3;
+		initPoolDebugging();
+		pool->setMax(1);
+
+		Options lowOptions = options;
+		lowOptions.requestPriority = RP_LOW;
+		Options highOptions = options;
+		highOptions.requestPriority = RP_HIGH;
+
+		for (int i = 0; i < 3; i++) {
+			pool->asyncGet(lowOptions, callback);
+		}
+		try {
+			pool->get(lowOptions, &ticket);
+			fail("Expected RequestQueueFullException");
+		} catch (const RequestQueueFullException &e) {
+			// OK
+		}
+		pool->asyncGet(highOptions, callback);
+		pool->asyncGet(highOptions, callback);
+		ensure_equals(number, 2);
+		{
+			LockGuard l(syncher);
+			ensure(dynamic_pointer_cast<RequestQueueFullException>(currentException) != NULL);
+		}
+
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getWaitlist.size(), 3u);
+			ensure_equals(group->getWaitlistSize(RP_LOW), 1u);
+			ensure_equals(group->getWaitlistSize(RP_HIGH), 2u);
+			// The low priority waiters tagged 8 and 4 were displaced. The
+			// remaining one is tagged 0, the high priority waiters 0 and 1.
+			ensure_equals(group->getWaitlist[0].options->requestPriority, RP_LOW);
+			ensure_equals(group->getWaitlist[1].options->requestPriority, RP_HIGH);
+			ensure_equals(group->getWaitlist[2].options->requestPriority, RP_HIGH);
+		}
+
+		debug->messages->send("Proceed with spawn loop iteration 1");
+		debug->messages->send("Spawn loop done");
+		EVENTUALLY(5,
+			result = number == 5;
+		);
+	}
+
+	TEST_METHOD(89) {
+		// writePrometheusMetrics() reports pool, group and process state.
+		Options options = createOptions();
+		options.appGroupName = "test \"1\"";
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+
+		stringstream stream;
+		pool->writePrometheusMetrics(stream);
+		string metrics = stream.str();
+		ensure(metrics.find("# TYPE passenger_pool_processes gauge\n") != string::npos);
+		ensure(metrics.find("passenger_pool_processes 1\n") != string::npos);
+		ensure(metrics.find("passenger_group_processes{app_group=\"test \\\"1\\\"\"} 1\n")
+			!= string::npos);
+		ensure(metrics.find("passenger_process_sessions{app_group=\"test \\\"1\\\"\",pid=\""
+			+ toString(currentSession->getPid()) + "\"} 1\n")
+			!= string::npos);
+	}
+
+	TEST_METHOD(90) {
+		// The autoscaler spawns processes up to its target, and idle
+		// cleaning does not shut down processes below the target.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		AutoscalerConfig config;
+		config.enabled = true;
+		config.minProcesses = 3;
+		pool->setAutoscalerConfig(config);
+		pool->setMaxIdleTime(50000);
+
+		SessionPtr session = pool->get(options, &ticket);
+		session.reset();
+		pool->realGarbageCollect();
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 3;
+		);
+		SHOULD_NEVER_HAPPEN(200,
+			result = pool->getProcessCount() < 3;
+		);
+
+		LockGuard l(pool->syncher);
+		ensure_equals(pool->getGroup("test1")->autoscaler.getTarget(), 3u);
+		stringstream stream;
+		pool->getGroup("test1")->inspectXml(stream);
+		ensure(stream.str().find("<autoscaler><target>3</target>") != string::npos);
+	}
+
+	TEST_METHOD(91) {
+		// getStateSnapshot() reuses the last snapshot until the pool
+		// structure changes, and inspection is rendered from snapshots
+		// without holding the pool lock.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+
+		Pool::StateSnapshotPtr snapshot = pool->getStateSnapshot();
+		ensure_equals(snapshot->processCount, 1u);
+		ensure_equals(snapshot->groups.size(), 1u);
+		ensure_equals(snapshot->groups[0].name, "test1");
+		ensure_equals(snapshot->groups[0].processes.size(), 1u);
+		ensure_equals(snapshot->groups[0].processes[0].pid, currentSession->getPid());
+		ensure_equals(snapshot->groups[0].processes[0].sessions, 1);
+
+		pid_t pid = currentSession->getPid();
+		currentSession.reset();
+		Pool::StateSnapshotPtr snapshot2 = pool->getStateSnapshot();
+		ensure_equals("The snapshot is reused while the structure is unchanged",
+			snapshot2->generation, snapshot->generation);
+		ensure_equals("Session counters are up to date",
+			snapshot2->groups[0].processes[0].sessions, 0);
+		ensure_equals(snapshot2->groups[0].processes[0].processed, 1u);
+
+		pool->setMax(7);
+		snapshot2 = pool->getStateSnapshot();
+		ensure("A structural change causes a new snapshot to be taken",
+			snapshot2->generation != snapshot->generation);
+		ensure_equals(snapshot2->max, 7u);
+
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 2;
+		);
+		ensure_equals(currentSession->getPid(), pid);
+
+		ensure(pool->toXml().find("<pid>" + toString(currentSession->getPid()) + "</pid>")
+			!= string::npos);
+		ensure(pool->inspect().find("PID: " + toString(currentSession->getPid()))
+			!= string::npos);
+	}
+
+	TEST_METHOD(92) {
+		// Processes that exceed the group's memory limit in enough
+		// consecutive samples are replaced, largest first, with no more
+		// of them at the same time than the configured maximum.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.minProcesses = 2;
+		options.memoryLimit = 100;
+		MemoryRecyclingConfig config;
+		config.maxConcurrentRecycles = 1;
+		config.minSamplesOverLimit = 3;
+		pool->setMemoryRecyclingConfig(config);
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		currentSession.reset();
+
+		GroupPtr group = pool->getGroup("test1");
+		ProcessPtr process1, process2;
+		boost::container::vector<Callback> actions;
+		{
+			LockGuard l(pool->syncher);
+			process1 = group->enabledProcesses[0];
+			process2 = group->enabledProcesses[1];
+			process1->memoryTrend.addSample(SystemTime::getUsec(), 50 * 1024);
+			process2->memoryTrend.addSample(SystemTime::getUsec(), 50 * 1024);
+			for (unsigned int i = 0; i < 2; i++) {
+				process1->memoryTrend.addSample(SystemTime::getUsec(), 150 * 1024);
+				process2->memoryTrend.addSample(SystemTime::getUsec(), 200 * 1024);
+			}
+			pool->enforceMemoryLimits(actions);
+			ensure(actions.empty());
+			ensure_equals(process2->enabled, Process::ENABLED);
+			ensure_equals(group->memoryRecycles, 0u);
+
+			process1->memoryTrend.addSample(SystemTime::getUsec(), 150 * 1024);
+			process2->memoryTrend.addSample(SystemTime::getUsec(), 200 * 1024);
+			pool->enforceMemoryLimits(actions);
+			ensure_equals(process2->enabled, Process::DETACHED);
+			ensure(process2->recycling);
+			ensure_equals(process1->enabled, Process::ENABLED);
+			ensure(!process1->recycling);
+			ensure_equals(group->memoryRecycles, 1u);
+		}
+		Pool::runAllActions(actions);
+		actions.clear();
+
+		// A replacement is spawned.
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		ensure(pool->toXml().find("<memory_recycles>1</memory_recycles>") != string::npos);
+
+		// The next offender is recycled once the first one is gone.
+		EVENTUALLY(5,
+			LockGuard l(pool->syncher);
+			result = group->detachedProcesses.empty();
+		);
+		{
+			LockGuard l(pool->syncher);
+			pool->enforceMemoryLimits(actions);
+			ensure_equals(process1->enabled, Process::DETACHED);
+			ensure_equals(group->memoryRecycles, 2u);
+		}
+		Pool::runAllActions(actions);
+	}
+
+	TEST_METHOD(93) {
+		// In NUMA-aware mode, processes are spread over the nodes and
+		// requests prefer a process on the node of the calling thread.
+		vector<unsigned int> allowedCpus;
+		allowedCpus.push_back(0);
+		allowedCpus.push_back(1);
+		removeDirTree("tmp.numa");
+		makeDirTree("tmp.numa/node0");
+		makeDirTree("tmp.numa/node1");
+		createFile("tmp.numa/node0/cpulist", "0\n");
+		createFile("tmp.numa/node1/cpulist", "1\n");
+		context.cpuTopology = boost::make_shared<CpuTopology>(
+			CpuTopology::detect("tmp.numa", allowedCpus));
+		removeDirTree("tmp.numa");
+		ensure_equals(context.cpuTopology->getNodeCount(), 2u);
+
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.minProcesses = 2;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		currentSession.reset();
+
+		GroupPtr group = pool->getGroup("test1");
+		{
+			LockGuard l(pool->syncher);
+			int node1 = group->enabledProcesses[0]->numaNode;
+			int node2 = group->enabledProcesses[1]->numaNode;
+			ensure("(1)", node1 >= 0 && node1 <= 1);
+			ensure("(2)", node2 >= 0 && node2 <= 1);
+			ensure("(3)", node1 != node2);
+		}
+		ensure(pool->toXml().find("<numa_node>1</numa_node>") != string::npos);
+
+		options.numaNode = 1;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 2;
+		);
+		ensure_equals("(4)", currentSession->getProcess()->numaNode, 1);
+		currentSession.reset();
+
+		options.numaNode = 0;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 3;
+		);
+		ensure_equals("(5)", currentSession->getProcess()->numaNode, 0);
+		currentSession.reset();
+	}
+
+	TEST_METHOD(94) {
+		// When the pool is full, a group that is below its share of the
+		// capacity takes an idle process away from a group that is above
+		// its share, but only from processes older than the hysteresis.
+		Options options = createOptions();
+		retainSessions = true;
+		pool->setMax(4);
+
+		options.appGroupName = "test1";
+		options.minProcesses = 3;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 3;
+		);
+		clearAllSessions();
+
+		options.appGroupName = "test2";
+		options.minProcesses = 1;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 2;
+		);
+		ensure(pool->atFullCapacity());
+
+		GroupPtr group1 = pool->getGroup("test1");
+		GroupPtr group2 = pool->getGroup("test2");
+
+		// The processes of test1 are too young to be taken away.
+		pool->asyncGet(options, callback);
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals("(1)", group1->getProcessCount(), 3u);
+			ensure_equals("(2)", group2->capacityDeniedSpawns, 1u);
+			ensure_equals("(3)", group2->getWaitlist.size(), 1u);
+		}
+
+		// The failed attempt doesn't count as taking capacity, but test2
+		// doesn't look for capacity again until the retry interval has
+		// passed, nor does it count another denial.
+		unsigned long long lastAttemptTime;
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals("(4)", group2->lastCapacityRebalanceTime, 0ull);
+			lastAttemptTime = group2->lastCapacityRebalanceAttemptTime;
+		}
+		ensure("(5)", lastAttemptTime != 0);
+		pool->asyncGet(options, callback);
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals("(6)", group2->lastCapacityRebalanceAttemptTime, lastAttemptTime);
+			ensure_equals("(7)", group2->capacityDeniedSpawns, 1u);
+			ensure_equals("(8)", group2->getWaitlist.size(), 2u);
+		}
+
+		CapacitySchedulerConfig config;
+		config.rebalanceHysteresis = 1;
+		pool->setCapacitySchedulerConfig(config);
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 3;
+		);
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals("(9)", group1->getProcessCount(), 2u);
+			ensure_equals("(10)", group1->capacityEvictions, 1u);
+			ensure_equals("(11)", group2->getProcessCount(), 2u);
+			ensure_equals("(12)", group2->capacityDeniedSpawns, 1u);
+			ensure("(13)", group2->lastCapacityRebalanceTime != 0);
+		}
+		ensure("(14)", pool->toXml().find("<capacity_share>2</capacity_share>") != string::npos);
+
+		retainSessions = false;
+		clearAllSessions();
+		EVENTUALLY(5,
+			result = number == 5;
+		);
+	}
+
+	TEST_METHOD(95) {
+		// Expired waiters are aborted when a new request is queued, even
+		// if they are queued behind a fresh waiter of another priority class.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.maxRequestQueueTime = 10;
+		GroupPtr group = pool->findOrCreateGroup(options);
+		skDebugSupport.dummyConcurrency = 3;
+		initPoolDebugging();
+		pool->setMax(1);
+
+		// Use a point in time far enough in the future that the
+		// garbage collector doesn't abort the waiters on its own.
+		unsigned long long base = SystemTime::getUsec() + 3600000000ull;
+		Options lowOptions = options;
+		lowOptions.requestPriority = RP_LOW;
+		lowOptions.currentTime = base;
+		Options highOptions = options;
+		highOptions.requestPriority = RP_HIGH;
+		highOptions.currentTime = base + 9000000;
+		Options normalOptions = options;
+		normalOptions.currentTime = base + 11000000;
+
+		pool->asyncGet(lowOptions, callback);
+		pool->asyncGet(lowOptions, callback);
+		pool->asyncGet(highOptions, callback);
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getWaitlist.size(), 3u);
+			ensure_equals(group->getWaitlist[0].priority, RP_LOW);
+			ensure_equals(group->getWaitlist[1].priority, RP_HIGH);
+			ensure_equals(group->getWaitlist[2].priority, RP_LOW);
+		}
+
+		pool->asyncGet(normalOptions, callback);
+		ensure_equals(number, 2);
+		{
+			LockGuard l(syncher);
+			ensure(dynamic_pointer_cast<RequestQueueTimeoutException>(currentException) != NULL);
+		}
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals(group->getWaitlist.size(), 2u);
+			ensure_equals(group->getWaitlistSize(RP_LOW), 0u);
+			ensure_equals(group->getWaitlistSize(RP_HIGH), 1u);
+			ensure_equals(group->getWaitlistSize(RP_NORMAL), 1u);
+		}
+
+		debug->messages->send("Proceed with spawn loop iteration 1");
+		debug->messages->send("Spawn loop done");
+		EVENTUALLY(5,
+			result = number == 4;
+		);
+	}
+
+	TEST_METHOD(96) {
+		// Processes that already exceed the memory limit in their first
+		// sample are not recycled, because their replacements would exceed
+		// it too. This is logged once.
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.memoryLimit = 100;
+		MemoryRecyclingConfig config;
+		config.minSamplesOverLimit = 1;
+		pool->setMemoryRecyclingConfig(config);
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		currentSession.reset();
+
+		GroupPtr group = pool->getGroup("test1");
+		boost::container::vector<Callback> actions;
+		LockGuard l(pool->syncher);
+		ProcessPtr process = group->enabledProcesses[0];
+		ensure_equals(group->memoryLimitExceededAtStartLogged, 0u);
+		for (unsigned int i = 0; i < 3; i++) {
+			process->memoryTrend.addSample(SystemTime::getUsec(), 150 * 1024);
+			pool->enforceMemoryLimits(actions);
+			ensure(actions.empty());
+			ensure_equals(process->enabled, Process::ENABLED);
+			ensure(!process->recycling);
+		}
+		ensure_equals(group->memoryRecycles, 0u);
+		ensure_equals(group->memoryLimitExceededAtStartLogged, 100u);
+	}
+
+	TEST_METHOD(97) {
+		// A process on the NUMA node of the calling thread is only preferred
+		// while it is at most one session busier than the least busy process.
+		vector<unsigned int> allowedCpus;
+		allowedCpus.push_back(0);
+		allowedCpus.push_back(1);
+		removeDirTree("tmp.numa");
+		makeDirTree("tmp.numa/node0");
+		makeDirTree("tmp.numa/node1");
+		createFile("tmp.numa/node0/cpulist", "0\n");
+		createFile("tmp.numa/node1/cpulist", "1\n");
+		context.cpuTopology = boost::make_shared<CpuTopology>(
+			CpuTopology::detect("tmp.numa", allowedCpus));
+		removeDirTree("tmp.numa");
+		skDebugSupport.dummyConcurrency = 4;
+		retainSessions = true;
+
+		Options options = createOptions();
+		options.appGroupName = "test1";
+		options.minProcesses = 2;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		clearAllSessions();
+
+		options.numaNode = 1;
+		for (int i = 0; i < 2; i++) {
+			pool->asyncGet(options, callback);
+			EVENTUALLY(5,
+				result = number == 2 + i;
+			);
+			ensure_equals("(1)", currentSession->getProcess()->numaNode, 1);
+		}
+
+		// The local process now has two sessions while the other one has none.
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 4;
+		);
+		ensure_equals("(2)", currentSession->getProcess()->numaNode, 0);
+
+		// One session apart again: the local process wins.
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 5;
+		);
+		ensure_equals("(3)", currentSession->getProcess()->numaNode, 1);
+
+		retainSessions = false;
+		clearAllSessions();
+	}
+
 
 	/*****************************/
 }
@@ -19,6 +19,10 @@ namespace tut {
 			virtual void asyncGetFromApplicationPool(Request *req,
 				ApplicationPool2::GetCallback callback)
 			{
+				lastMaxRequests = req->options->maxRequests;
+				lastOptionsWerePrivate = req->privateOptions != NULL;
+				lastRequestPriority = req->options->requestPriority;
+				lastStickySessionId = req->stickySessionId;
 				callback(sessionToReturn, exceptionToReturn);
 				sessionToReturn.reset();
 			}
@@ -26,6 +30,10 @@ namespace tut {
 		public:
 			ApplicationPool2::AbstractSessionPtr sessionToReturn;
 			ApplicationPool2::ExceptionPtr exceptionToReturn;
+			unsigned long lastMaxRequests;
+			bool lastOptionsWerePrivate;
+			ApplicationPool2::RequestPriority lastRequestPriority;
+			unsigned int lastStickySessionId;
 
 			MyController(ServerKit::Context *context,
 				const Core::ControllerSchema &schema,
@@ -33,7 +41,11 @@ namespace tut {
 				const Core::ControllerSingleAppModeSchema &singleAppModeSchema,
 				const Json::Value &singleAppModeConfig)
 				: Core::Controller(context, schema, initialConfig, ConfigKit::DummyTranslator(),
-					&singleAppModeSchema, &singleAppModeConfig, ConfigKit::DummyTranslator())
+					&singleAppModeSchema, &singleAppModeConfig, ConfigKit::DummyTranslator()),
+				  lastMaxRequests(0),
+				  lastOptionsWerePrivate(false),
+				  lastRequestPriority(ApplicationPool2::RP_NORMAL),
+				  lastStickySessionId(0)
 				{ }
 		};
 
@@ -165,6 +177,57 @@ namespace tut {
 			controller->sessionToReturn.reset(&testSession, false);
 		}
 
+		void useRequestQueueFullException() {
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_setRequestQueueFullException, this));
+		}
+
+		void _setRequestQueueFullException() {
+			controller->exceptionToReturn = boost::make_shared<RequestQueueFullException>(1);
+		}
+
+		void getLastPoolOptionsInfo(unsigned long *maxRequests, bool *wasPrivate) {
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getLastPoolOptionsInfo,
+				this, maxRequests, wasPrivate));
+		}
+
+		void _getLastPoolOptionsInfo(unsigned long *maxRequests, bool *wasPrivate) {
+			*maxRequests = controller->lastMaxRequests;
+			*wasPrivate = controller->lastOptionsWerePrivate;
+		}
+
+		ApplicationPool2::RequestPriority getLastRequestPriority() {
+			ApplicationPool2::RequestPriority result;
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getLastRequestPriority,
+				this, &result));
+			return result;
+		}
+
+		void _getLastRequestPriority(ApplicationPool2::RequestPriority *result) {
+			*result = controller->lastRequestPriority;
+		}
+
+		unsigned int getLastStickySessionId() {
+			unsigned int result;
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getLastStickySessionId,
+				this, &result));
+			return result;
+		}
+
+		void _getLastStickySessionId(unsigned int *result) {
+			*result = controller->lastStickySessionId;
+		}
+
+		LatencyHistogram getLatencyHistogram(Core::LatencyStats::Phase phase) {
+			LatencyHistogram result;
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getLatencyHistogram,
+				this, phase, &result));
+			return result;
+		}
+
+		void _getLatencyHistogram(Core::LatencyStats::Phase phase, LatencyHistogram *result) {
+			*result = controller->getLatencyStatsSnapshot().total.histograms[phase];
+		}
+
 		MyController::State getServerState() {
 			Controller::State result;
 			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getServerState,
@@ -210,6 +273,79 @@ namespace tut {
 			return *peerRequestHeader;
 		}
 
+		string readPeerRequestHeaderWithBodyFd(FileDescriptor &bodyFd) {
+			// The body file descriptor is attached to the first byte of the
+			// session header's length prefix. That byte is consumed by
+			// readFileDescriptor(), but it is always 0 for headers that
+			// are smaller than 16 MB.
+			bodyFd.assign(readFileDescriptor(testSession.peerFd()), __FILE__, __LINE__);
+			unsigned char sizeBytes[3];
+			readExact(testSession.peerFd(), sizeBytes, 3);
+			unsigned int size = ((unsigned int) sizeBytes[0] << 16)
+				| ((unsigned int) sizeBytes[1] << 8)
+				| (unsigned int) sizeBytes[2];
+			peerRequestHeader.resize(size);
+			readExact(testSession.peerFd(), &peerRequestHeader[0], size);
+			return peerRequestHeader;
+		}
+
+		struct RequestMemoryUsage {
+			size_t poolBytes;
+			unsigned int poolBlocks;
+			unsigned int poolLargeAllocations;
+			size_t headerTableBytes;
+			bool tunneled;
+		};
+
+		void _measureRequestMemoryUsage(const char *clientName, RequestMemoryUsage *usage) {
+			Client *client = controller->lookupClient(clientName);
+			Request *req = static_cast<Request *>(client->currentRequest);
+
+			usage->poolBytes = 0;
+			usage->poolBlocks = 0;
+			for (psg_pool_t *p = req->pool; p != NULL; p = p->data.next) {
+				usage->poolBytes += p->data.end - (char *) p;
+				usage->poolBlocks++;
+			}
+			usage->poolLargeAllocations = 0;
+			for (psg_pool_large_t *l = req->pool->large; l != NULL; l = l->next) {
+				usage->poolLargeAllocations++;
+			}
+			usage->headerTableBytes = sizeof(ServerKit::HeaderTable::Cell) * (
+				req->headers.arraySize() + req->secureHeaders.arraySize()
+				+ req->appResponse.headers.arraySize()
+				+ req->appResponse.secureHeaders.arraySize());
+			usage->tunneled = req->tunneled;
+		}
+
+		RequestMemoryUsage measureRequestMemoryUsage(const char *clientName) {
+			RequestMemoryUsage usage;
+			bg.safe->runSync(boost::bind(&Core_ControllerTest::_measureRequestMemoryUsage,
+				this, clientName, &usage));
+			return usage;
+		}
+
+		void checkSpoolArenaOpen(bool *open) {
+			*open = context.getSpoolArena() != NULL;
+		}
+
+		void waitUntilSpoolArenaOpen() {
+			// The arena is opened asynchronously upon first use.
+			EVENTUALLY(5,
+				bool open = false;
+				bg.safe->runSync(boost::bind(&Core_ControllerTest::checkSpoolArenaOpen,
+					this, &open));
+				result = open;
+			);
+		}
+
+		void lowerFileBufferedChannelThreshold() {
+			Json::Value update;
+			vector<ConfigKit::Error> errors;
+			update["file_buffered_channel_threshold"] = 1;
+			ensure(context.configure(update, errors));
+		}
+
 		string readPeerBody() {
 			if (testSession.getProtocol() == "session") {
 				return readAll(testSession.peerFd(), std::numeric_limits<size_t>::max()).first;
@@ -340,6 +476,64 @@ namespace tut {
 			"GET /hello?foo=bar HTTP/1.1\r\n"));
 	}
 
+	TEST_METHOD(3) {
+		set_test_name("Session protocol: fields that are the same for all requests"
+			" to the app group, and environment variables, are passed and"
+			" updated when the environment variables change");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_ENV_VARS: Rk9PAGJhcgA=\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		ensure("(1)", containsSubstring(peerRequestHeader,
+			P_STATIC_STRING("SERVER_PROTOCOL\0HTTP/1.1\0")));
+		ensure("(2)", containsSubstring(peerRequestHeader,
+			P_STATIC_STRING("PASSENGER_CONNECT_PASSWORD\0")));
+		ensure("(3)", containsSubstring(peerRequestHeader,
+			P_STATIC_STRING("\0FOO\0bar\0")));
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Length: 2\r\n\r\n"
+			"ok");
+		waitUntilSessionClosed();
+		readAll(clientConnection, std::numeric_limits<size_t>::max());
+		EVENTUALLY(5,
+			result = inspectStateAsJson()["active_clients"].empty();
+		);
+
+		testSession.reset();
+		useTestSessionObject();
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_ENV_VARS: Rk9PAGJhegA=\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		ensure("(4)", containsSubstring(peerRequestHeader,
+			P_STATIC_STRING("SERVER_PROTOCOL\0HTTP/1.1\0")));
+		ensure("(5)", containsSubstring(peerRequestHeader,
+			P_STATIC_STRING("\0FOO\0baz\0")));
+		ensure("(6)", !containsSubstring(peerRequestHeader,
+			P_STATIC_STRING("\0FOO\0bar\0")));
+	}
+
 
 	/***** Passing request body to the app *****/
 
@@ -550,8 +744,143 @@ namespace tut {
 	}
 
 
+	TEST_METHOD(16) {
+		set_test_name("When body buffering on, the body was buffered to a file"
+			" and the application accepts body file descriptors:"
+			" it passes the buffer file to the application instead of"
+			" forwarding the body data");
+
+		lowerFileBufferedChannelThreshold();
+		testSession.setAcceptsBodyFd(true);
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: B\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 5\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"hello");
+		waitUntilSessionInitiated();
+
+		FileDescriptor bodyFd;
+		string header = readPeerRequestHeaderWithBodyFd(bodyFd);
+		ensure(containsSubstring(header,
+			P_STATIC_STRING("CONTENT_LENGTH\0005\000")));
+		ensure(containsSubstring(header,
+			P_STATIC_STRING("PASSENGER_BODY_FD_SIZE\0005\000")));
+
+		char buf[16];
+		ssize_t ret = pread(bodyFd, buf, sizeof(buf), 0);
+		ensure_equals(ret, (ssize_t) 5);
+		ensure_equals(StaticString(buf, 5), "hello");
+		ensure_equals(readPeerBody(), "");
+	}
+
+	TEST_METHOD(17) {
+		set_test_name("When body buffering on, the body was buffered in memory"
+			" and the application accepts body file descriptors:"
+			" it forwards the body data");
+
+		testSession.setAcceptsBodyFd(true);
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: B\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 5\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"hello");
+		waitUntilSessionInitiated();
+
+		string header = readPeerRequestHeader();
+		ensure(!containsSubstring(header,
+			P_STATIC_STRING("PASSENGER_BODY_FD_SIZE")));
+		ensure_equals(readPeerBody(), "hello");
+	}
+
+	TEST_METHOD(18) {
+		set_test_name("When body buffering on, the body was buffered to a file"
+			" but the application doesn't accept body file descriptors:"
+			" it forwards the body data");
+
+		lowerFileBufferedChannelThreshold();
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: B\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 5\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"hello");
+		waitUntilSessionInitiated();
+
+		string header = readPeerRequestHeader();
+		ensure(!containsSubstring(header,
+			P_STATIC_STRING("PASSENGER_BODY_FD_SIZE")));
+		ensure_equals(readPeerBody(), "hello");
+	}
+
+
 	/***** Application response body handling *****/
 
+	TEST_METHOD(19) {
+		set_test_name("When body buffering on, the body was buffered to a file,"
+			" the application accepts body file descriptors and the spool arena"
+			" is enabled: it still passes a buffer file of its own to the application");
+
+		Json::Value update;
+		vector<ConfigKit::Error> errors;
+		update["file_buffered_channel_spool_arena"] = true;
+		ensure(context.configure(update, errors));
+		lowerFileBufferedChannelThreshold();
+		testSession.setAcceptsBodyFd(true);
+		init();
+		useTestSessionObject();
+		waitUntilSpoolArenaOpen();
+
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~FLAGS: B\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 5\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"hello");
+		waitUntilSessionInitiated();
+
+		FileDescriptor bodyFd;
+		string header = readPeerRequestHeaderWithBodyFd(bodyFd);
+		ensure(containsSubstring(header,
+			P_STATIC_STRING("PASSENGER_BODY_FD_SIZE\0005\000")));
+
+		char buf[16];
+		ssize_t ret = pread(bodyFd, buf, sizeof(buf), 0);
+		ensure_equals(ret, (ssize_t) 5);
+		ensure_equals(StaticString(buf, 5), "hello");
+		ensure_equals(readPeerBody(), "");
+	}
+
 	TEST_METHOD(20) {
 		set_test_name("Fixed response body");
 
@@ -664,6 +993,101 @@ namespace tut {
 		ensure_equals(body, "hello");
 	}
 
+	TEST_METHOD(24) {
+		set_test_name("Upgraded connections are switched to a tunnel"
+			" that keeps forwarding data in both directions");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: upgrade\r\n"
+			"Upgrade: text\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		writeExact(testSession.peerFd(),
+			"HTTP/1.1 101 Switching Protocols\r\n"
+			"Connection: upgrade\r\n"
+			"Upgrade: text\r\n\r\n");
+		string header = readResponseHeader();
+		ensure("(1)", containsSubstring(header, "HTTP/1.1 101 Switching Protocols\r\n"));
+
+		EVENTUALLY(5,
+			Json::Value state = inspectStateAsJson();
+			result = state["active_clients"]["1-1"]["current_request"]["flags"]["tunneled"].asBool();
+		);
+		Json::Value state = inspectStateAsJson();
+		Json::Value reqState = state["active_clients"]["1-1"]["current_request"];
+		ensure_equals("(2)", reqState["host"].asString(), "localhost");
+		ensure_equals("(3)", reqState["path"].asString(), "/hello");
+
+		char buf[15];
+		unsigned int size;
+
+		writeExact(clientConnection, "ab");
+		size = readExact(testSession.peerFd(), buf, 2);
+		ensure_equals("(4)", size, 2u);
+		ensure_equals("(5)", StaticString(buf, 2), "ab");
+
+		writeExact(testSession.peerFd(), "cde");
+		size = readExact(clientConnection, buf, 3);
+		ensure_equals("(6)", size, 3u);
+		ensure_equals("(7)", StaticString(buf, 3), "cde");
+	}
+
+	TEST_METHOD(25) {
+		set_test_name("Tunnels only keep a small, exactly sized pool and release"
+			" the header tables of the request and the response");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_MAX_REQUESTS: 5\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Connection: upgrade\r\n"
+			"Upgrade: text\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		RequestMemoryUsage before = measureRequestMemoryUsage("1-1");
+		ensure("(1)", !before.tunneled);
+		ensure("(2)", before.headerTableBytes > 0);
+
+		writeExact(testSession.peerFd(),
+			"HTTP/1.1 101 Switching Protocols\r\n"
+			"Connection: upgrade\r\n"
+			"Upgrade: text\r\n\r\n");
+		readResponseHeader();
+		EVENTUALLY(5,
+			result = measureRequestMemoryUsage("1-1").tunneled;
+		);
+
+		// The pool holds the path, the host and a copy of the private
+		// pool options (because of PASSENGER_MAX_REQUESTS).
+		RequestMemoryUsage after = measureRequestMemoryUsage("1-1");
+		ensure_equals("(3)", after.poolBlocks, 1u);
+		ensure_equals("(4)", after.poolLargeAllocations, 0u);
+		ensure("(5)", after.poolBytes < sizeof(ApplicationPool2::Options) + 256);
+		ensure("(6)", after.poolBytes < before.poolBytes / 8);
+		ensure_equals("(7)", after.headerTableBytes, (size_t) 0);
+
+		char buf[2];
+		writeExact(clientConnection, "ab");
+		ensure_equals("(8)", readExact(testSession.peerFd(), buf, 2), 2u);
+		ensure_equals("(9)", StaticString(buf, 2), "ab");
+	}
+
 
 	/***** Application connection keep-alive *****/
 
@@ -1118,4 +1542,164 @@ namespace tut {
 		string header = readResponseHeader();
 		ensure(containsSubstring(header, "HTTP/1.1 502"));
 	}
+
+
+	/***** Pool options *****/
+
+	TEST_METHOD(60) {
+		set_test_name("Requests share the cached pool options unless they override"
+			" a per-request option, and such overrides do not leak into other requests");
+
+		init();
+		useRequestQueueFullException();
+		unsigned long maxRequests;
+		bool wasPrivate;
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_MAX_REQUESTS: 5\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		getLastPoolOptionsInfo(&maxRequests, &wasPrivate);
+		ensure_equals("(1)", maxRequests, 5ul);
+		ensure("(2)", wasPrivate);
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		getLastPoolOptionsInfo(&maxRequests, &wasPrivate);
+		ensure_equals("(3)", maxRequests, 0ul);
+		ensure("(4)", !wasPrivate);
+	}
+
+	TEST_METHOD(61) {
+		set_test_name("Requests are put in the priority class of the most specific"
+			" matching path rule, unless the web server sets a priority class");
+
+		config["request_priority_rules"].append("/health=high");
+		config["request_priority_rules"].append("/health/deep=low");
+		init();
+		useRequestQueueFullException();
+
+		connectToServer();
+		sendRequest(
+			"GET /health/ping HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		ensure_equals("(1)", getLastRequestPriority(), ApplicationPool2::RP_HIGH);
+
+		connectToServer();
+		sendRequest(
+			"GET /health/deep/db HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		ensure_equals("(2)", getLastRequestPriority(), ApplicationPool2::RP_LOW);
+
+		connectToServer();
+		sendRequest(
+			"GET /health/ping HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_REQUEST_PRIORITY: normal\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		ensure_equals("(3)", getLastRequestPriority(), ApplicationPool2::RP_NORMAL);
+
+		unsigned long maxRequests;
+		bool wasPrivate;
+		connectToServer();
+		sendRequest(
+			"GET /healthy HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		ensure_equals("(4)", getLastRequestPriority(), ApplicationPool2::RP_HIGH);
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		ensure_equals("(5)", getLastRequestPriority(), ApplicationPool2::RP_NORMAL);
+		getLastPoolOptionsInfo(&maxRequests, &wasPrivate);
+		ensure("(6)", !wasPrivate);
+	}
+
+	TEST_METHOD(62) {
+		set_test_name("Sticky session requests use the cached pool options as-is");
+
+		init();
+		useRequestQueueFullException();
+		unsigned long maxRequests;
+		bool wasPrivate;
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"!~: \r\n"
+			"!~PASSENGER_STICKY_SESSIONS: t\r\n"
+			"!~: \r\n"
+			"Host: localhost\r\n"
+			"Cookie: foo=bar; _passenger_route=42\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		getLastPoolOptionsInfo(&maxRequests, &wasPrivate);
+		ensure_equals("(1)", getLastStickySessionId(), 42u);
+		ensure("(2)", !wasPrivate);
+	}
+
+
+	/***** Latency statistics *****/
+
+	TEST_METHOD(65) {
+		set_test_name("The time to receive and parse request headers is recorded for"
+			" every request on a keep-alive connection, excluding idle time");
+
+		init();
+		useRequestQueueFullException();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"\r\n");
+		ensure(containsSubstring(readResponseHeader(), "HTTP/1.1 503"));
+		EVENTUALLY(5,
+			result = getLatencyHistogram(Core::LatencyStats::HEADERS_PARSED).getCount() == 1;
+		);
+
+		syscalls::usleep(300000);
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n");
+		syscalls::usleep(50000);
+		sendRequest(
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		EVENTUALLY(5,
+			result = getLatencyHistogram(Core::LatencyStats::HEADERS_PARSED).getCount() == 2;
+		);
+		LatencyHistogram histogram = getLatencyHistogram(Core::LatencyStats::HEADERS_PARSED);
+		ensure("(1)", histogram.getMax() >= 40000);
+		ensure("(2)", histogram.getMax() < 300000);
+	}
 }
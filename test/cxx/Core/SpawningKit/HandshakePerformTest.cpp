@@ -609,6 +609,47 @@ namespace tut {
 		}
 	}
 
+	TEST_METHOD(41) {
+		set_test_name("The result object records whether a socket accepts request"
+			" bodies as file descriptors");
+
+		init(SPAWN_DIRECTLY);
+		TempThread thr(boost::bind(&Core_SpawningKit_HandshakePerformTest::execute, this));
+
+		Json::Value doc = createGoodPropertiesJson();
+		doc["sockets"][0]["protocol"] = "session";
+		doc["sockets"][0]["accept_body_fd"] = true;
+		createFile(session->responseDir + "/properties.json", doc.toStyledString());
+		createFile(session->responseDir + "/steps/subprocess_listen/state",
+			"STEP_PERFORMED");
+		signalFinish();
+
+		EVENTUALLY(5,
+			result = counter == 1;
+		);
+
+		ensure_equals(session->result.sockets.size(), 1u);
+		ensure(session->result.sockets[0].acceptBodyFd);
+	}
+
+	TEST_METHOD(42) {
+		set_test_name("It raises an error if properties.json specifies a non-boolean"
+			" 'accept_body_fd' value");
+
+		init(SPAWN_DIRECTLY);
+		Json::Value doc = createGoodPropertiesJson();
+		doc["sockets"][0]["accept_body_fd"] = "yes";
+		createFile(session->responseDir + "/properties.json", doc.toStyledString());
+		TempThread thr(boost::bind(&Core_SpawningKit_HandshakePerformTest::signalFinish, this));
+
+		try {
+			execute();
+			fail("SpawnException expected");
+		} catch (const SpawnException &e) {
+			ensure("(1)", containsSubstring(e.getSummary(), "accept_body_fd"));
+		}
+	}
+
 
 	/***** Error response handling *****/
 
@@ -0,0 +1,136 @@
+#include <TestSupport.h>
+#include <BackgroundEventLoop.h>
+#include <SafeLibev.h>
+#include <EventLoopStallDetector.h>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct EventLoopStallDetectorTest: public TestBase {
+		BackgroundEventLoop bg;
+		EventLoopStallDetector detector;
+		boost::mutex syncher;
+		boost::condition_variable cond;
+		bool blocking;
+		bool released;
+
+		EventLoopStallDetectorTest()
+			: bg(false, false),
+			  detector(100),
+			  blocking(false),
+			  released(false)
+		{
+			if (defaultLogLevel == (LoggingKit::Level) DEFAULT_LOG_LEVEL) {
+				// If the user did not customize the test's log level,
+				// then we'll want to tone down the noise.
+				LoggingKit::setLevel(LoggingKit::CRIT);
+			}
+			detector.addEventLoop("test loop", &bg);
+			bg.start();
+		}
+
+		~EventLoopStallDetectorTest() {
+			release();
+			detector.stop();
+			bg.stop();
+		}
+
+		void blockEventLoop() {
+			TRACE_POINT();
+			boost::unique_lock<boost::mutex> l(syncher);
+			blocking = true;
+			cond.notify_all();
+			while (!released) {
+				cond.wait(l);
+			}
+			blocking = false;
+			cond.notify_all();
+		}
+
+		MonotonicTimeUsec startBlocking() {
+			bg.safe->runLater(boost::bind(&EventLoopStallDetectorTest::blockEventLoop, this));
+			boost::unique_lock<boost::mutex> l(syncher);
+			while (!blocking) {
+				cond.wait(l);
+			}
+			return bg.getIterationStartTime();
+		}
+
+		void release() {
+			boost::unique_lock<boost::mutex> l(syncher);
+			released = true;
+			cond.notify_all();
+			while (blocking) {
+				cond.wait(l);
+			}
+		}
+	};
+
+	DEFINE_TEST_GROUP(EventLoopStallDetectorTest);
+
+	TEST_METHOD(1) {
+		set_test_name("An idle event loop is not considered stalled");
+		EVENTUALLY(5,
+			result = bg.getIterationStartTime() == 0;
+		);
+		detector.check(SystemTime::getMonotonicUsec() + 10000000);
+		Json::Value doc = detector.inspectStateAsJson();
+		ensure_equals(doc["total_stalls"].asUInt(), 0u);
+		ensure(!doc["event_loops"]["test loop"]["stalled"].asBool());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("An event loop that is busy for less than the threshold is not considered stalled");
+		MonotonicTimeUsec start = startBlocking();
+		ensure("The iteration start time is published", start != 0);
+		detector.check(start + 99000);
+		Json::Value doc = detector.inspectStateAsJson();
+		ensure_equals(doc["total_stalls"].asUInt(), 0u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("A stall is detected, its backtrace is captured and its duration"
+			" is recorded when it's over");
+		MonotonicTimeUsec start = startBlocking();
+		detector.check(start + 150000);
+
+		Json::Value doc = detector.inspectStateAsJson();
+		ensure_equals("(1)", doc["total_stalls"].asUInt(), 1u);
+		ensure("(2)", doc["event_loops"]["test loop"]["stalled"].asBool());
+		ensure_equals("(3)", doc["recent_stalls"].size(), 1u);
+		ensure("(4)", doc["recent_stalls"][0]["in_progress"].asBool());
+		#ifdef OXT_BACKTRACE_IS_ENABLED
+			ensure("(5)", containsSubstring(doc["recent_stalls"][0]["backtrace"].asString(),
+				"blockEventLoop"));
+		#endif
+
+		// Still the same stall.
+		detector.check(start + 250000);
+		doc = detector.inspectStateAsJson();
+		ensure_equals("(6)", doc["total_stalls"].asUInt(), 1u);
+
+		release();
+		EVENTUALLY(5,
+			result = bg.getIterationStartTime() != start;
+		);
+		detector.check(start + 300000);
+		doc = detector.inspectStateAsJson();
+		ensure_equals("(7)", doc["total_stalls"].asUInt(), 1u);
+		ensure("(8)", !doc["event_loops"]["test loop"]["stalled"].asBool());
+		ensure_equals("(9)", doc["event_loops"]["test loop"]["durations"]["count"].asUInt(), 1u);
+		ensure_equals("(10)", doc["event_loops"]["test loop"]["durations"]["max_usec"].asUInt(), 250000u);
+		ensure("(11)", !doc["recent_stalls"][0]["in_progress"].asBool());
+		ensure_equals("(12)", doc["recent_stalls"][0]["duration_usec"].asUInt(), 250000u);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("A stopped event loop is not considered stalled");
+		startBlocking();
+		release();
+		bg.stop();
+		ensure_equals(bg.getIterationStartTime(), 0ull);
+	}
+}
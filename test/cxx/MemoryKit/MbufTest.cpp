@@ -264,4 +264,111 @@ namespace tut {
 		ensure_equals("(5)", pool.nfree_mbuf_blockq, 0u);
 		ensure_equals("(6)", pool.nactive_mbuf_blockq, 0u);
 	}
+
+	TEST_METHOD(24) {
+		set_test_name("Size classes");
+		mbuf_pool_set_size_classes(&pool, 3);
+		ensure_equals("(1)", pool.nsize_classes, 3u);
+		ensure_equals("(2)", pool.size_classes[0].mbuf_block_chunk_size,
+			(size_t) DEFAULT_MBUF_CHUNK_SIZE);
+		ensure_equals("(3)", pool.size_classes[1].mbuf_block_chunk_size,
+			(size_t) DEFAULT_MBUF_CHUNK_SIZE * MBUF_SIZE_CLASS_FACTOR);
+		ensure_equals("(4)", pool.size_classes[2].mbuf_block_chunk_size,
+			(size_t) DEFAULT_MBUF_CHUNK_SIZE * MBUF_SIZE_CLASS_FACTOR * MBUF_SIZE_CLASS_FACTOR);
+
+		{
+			mbuf buffer(mbuf_get_from_size_class(&pool, 1));
+			ensure_equals("(5)", buffer.size(), mbuf_pool_size_class_data_size(&pool, 1));
+			ensure_equals("(6)", (unsigned int) buffer.mbuf_block->size_class, 1u);
+			ensure_equals("(7)", pool.size_classes[1].nactive_mbuf_blockq, 1u);
+			ensure_equals("(8)", pool.nactive_mbuf_blockq, 1u);
+			ensure_equals("(9)", mbuf_pool_active_memory(&pool),
+				pool.size_classes[1].mbuf_block_chunk_size);
+		}
+		ensure_equals("(10)", pool.size_classes[1].nfree_mbuf_blockq, 1u);
+		ensure_equals("(11)", pool.size_classes[1].nactive_mbuf_blockq, 0u);
+		ensure_equals("(12)", pool.nfree_mbuf_blockq, 1u);
+		ensure_equals("(13)", mbuf_pool_spare_memory(&pool),
+			pool.size_classes[1].mbuf_block_chunk_size);
+
+		// Blocks are reused within their own size class only.
+		mbuf buffer(mbuf_get(&pool));
+		ensure_equals("(14)", (unsigned int) buffer.mbuf_block->size_class, 0u);
+		ensure_equals("(15)", pool.size_classes[1].nfree_mbuf_blockq, 1u);
+	}
+
+	TEST_METHOD(25) {
+		set_test_name("The number of size classes is limited by the maximum block size");
+		mbuf_pool_deinit(&pool);
+		pool.mbuf_block_chunk_size = MBUF_BLOCK_MAX_SIZE / 2;
+		mbuf_pool_init(&pool);
+		mbuf_pool_set_size_classes(&pool, 3);
+		ensure_equals(pool.nsize_classes, 1u);
+	}
+
+	TEST_METHOD(26) {
+		set_test_name("mbuf_get_with_size picks the smallest size class that fits");
+		mbuf_pool_set_size_classes(&pool, 3);
+		mbuf buffer(mbuf_get_with_size(&pool, mbuf_pool_size_class_data_size(&pool, 0)));
+		ensure_equals("(1)", (unsigned int) buffer.mbuf_block->size_class, 0u);
+		buffer = mbuf_get_with_size(&pool, mbuf_pool_size_class_data_size(&pool, 0) + 1);
+		ensure_equals("(2)", (unsigned int) buffer.mbuf_block->size_class, 1u);
+		ensure_equals("(3)", buffer.mbuf_block->offset, 0u);
+		buffer = mbuf_get_with_size(&pool, mbuf_pool_size_class_data_size(&pool, 2) + 1);
+		ensure("(4)", buffer.mbuf_block->offset > 0);
+	}
+
+	TEST_METHOD(27) {
+		set_test_name("Blocks are carved out of slabs, and fully free slabs are released by trimming");
+		mbuf_pool_set_size_classes(&pool, 2);
+		mbuf_pool_use_slabs(&pool, false);
+
+		mbuf buffer(mbuf_get(&pool));
+		mbuf buffer2(mbuf_get(&pool));
+		mbuf buffer3(mbuf_get_from_size_class(&pool, 1));
+		ensure("(1)", buffer.mbuf_block->flags & MBUF_BLOCK_FLAG_IN_SLAB);
+		ensure_equals("(2)", pool.size_classes[0].nslabs, 1u);
+		ensure_equals("(3)", pool.size_classes[1].nslabs, 1u);
+		ensure_equals("(4)",
+			(uintptr_t) buffer.mbuf_block & ~((uintptr_t) MBUF_SLAB_SIZE - 1),
+			(uintptr_t) buffer2.mbuf_block & ~((uintptr_t) MBUF_SLAB_SIZE - 1));
+		memset(buffer.start, 'x', buffer.size());
+		memset(buffer3.start, 'x', buffer3.size());
+
+		// A slab with active blocks cannot be released.
+		buffer = mbuf();
+		buffer3 = mbuf();
+		ensure_equals("(5)", mbuf_pool_compact(&pool), 1u);
+		ensure_equals("(6)", pool.size_classes[0].nslabs, 1u);
+		ensure_equals("(7)", pool.size_classes[0].nfree_mbuf_blockq, 1u);
+		ensure_equals("(8)", pool.size_classes[1].nslabs, 0u);
+		ensure_equals("(9)", pool.size_classes[1].nfree_mbuf_blockq, 0u);
+
+		// Nothing is released while the spare memory is under the limit.
+		buffer2 = mbuf();
+		ensure_equals("(10)", mbuf_pool_trim(&pool, 1024 * 1024), 0u);
+		ensure_equals("(11)", pool.size_classes[0].nslabs, 1u);
+		ensure_equals("(12)", mbuf_pool_trim(&pool, 0), 2u);
+		ensure_equals("(13)", pool.size_classes[0].nslabs, 0u);
+		ensure_equals("(14)", pool.nfree_mbuf_blockq, 0u);
+		ensure_equals("(15)", pool.nactive_mbuf_blockq, 0u);
+
+		// Slabs are created again on demand.
+		buffer = mbuf_get(&pool);
+		ensure_equals("(16)", pool.size_classes[0].nslabs, 1u);
+	}
+
+	TEST_METHOD(28) {
+		set_test_name("Trimming releases free blocks until the spare memory is under the limit");
+		mbuf buffers[4];
+		for (unsigned int i = 0; i < 4; i++) {
+			buffers[i] = mbuf_get(&pool);
+		}
+		for (unsigned int i = 0; i < 4; i++) {
+			buffers[i] = mbuf();
+		}
+		ensure_equals("(1)", mbuf_pool_spare_memory(&pool), 4 * pool.mbuf_block_chunk_size);
+		ensure_equals("(2)", mbuf_pool_trim(&pool, 2 * pool.mbuf_block_chunk_size), 2u);
+		ensure_equals("(3)", pool.nfree_mbuf_blockq, 2u);
+	}
 }
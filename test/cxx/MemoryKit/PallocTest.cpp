@@ -427,6 +427,20 @@ namespace tut {
 		TEST_LARGE_ALLOCATION();
 	}
 
+	TEST_METHOD(17) {
+		set_test_name("psg_reset_pool() fails to reset the pool for reuse if the pool"
+			" was created with a different size");
+		pool = psg_create_pool(1024);
+
+		volatile char *largebuf;
+		TEST_LARGE_ALLOCATION();
+		ensure("psg_reset_pool fails",
+			!psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE));
+		ensure_equals<void *>("Nothing is allocated through the large list",
+			pool->large, NULL);
+		ensure("The pool is still usable", psg_palloc(pool, 16) != NULL);
+	}
+
 	TEST_METHOD(20) {
 		set_test_name("Miscellaneous stress test");
 		pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
@@ -0,0 +1,240 @@
+#include <TestSupport.h>
+#include <BackgroundEventLoop.h>
+#include <SafeLibev.h>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <vector>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct SafeLibevTest: public TestBase {
+		BackgroundEventLoop bg;
+		boost::mutex syncher;
+		vector<int> log;
+		bool ranOnLoopThread;
+
+		SafeLibevTest()
+			: bg(false, false),
+			  ranOnLoopThread(true)
+			{ }
+
+		~SafeLibevTest() {
+			bg.stop();
+		}
+
+		void append(int value) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			log.push_back(value);
+			ranOnLoopThread = ranOnLoopThread && bg.safe->onEventLoopThread();
+		}
+
+		void appendAndScheduleMore(int value, int more) {
+			append(value);
+			bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, more));
+		}
+
+		void scheduleCommandsAndCancelOne(unsigned int *idToCancel) {
+			bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, 1));
+			*idToCancel = bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, 2));
+			bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, 3));
+		}
+
+		void scheduleMany(int base, int count) {
+			for (int i = 0; i < count; i++) {
+				bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, base + i));
+			}
+		}
+
+		void scheduleManyOnLoop(int count, int *zeroIds) {
+			for (int i = 0; i < count; i++) {
+				if (bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, i)) == 0) {
+					(*zeroIds)++;
+				}
+			}
+		}
+
+		void appendSync(int value) {
+			bg.safe->runSync(boost::bind(&SafeLibevTest::append, this, value));
+		}
+
+		unsigned int logSize() {
+			boost::lock_guard<boost::mutex> l(syncher);
+			return log.size();
+		}
+	};
+
+	DEFINE_TEST_GROUP(SafeLibevTest);
+
+	TEST_METHOD(1) {
+		set_test_name("runLater() runs callbacks on the event loop thread, in order");
+		bg.start();
+		for (int i = 0; i < 10; i++) {
+			bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, i));
+		}
+		EVENTUALLY(5,
+			result = logSize() == 10;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		for (int i = 0; i < 10; i++) {
+			ensure_equals(log[i], i);
+		}
+		ensure(ranOnLoopThread);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Callbacks scheduled by a callback are run after the"
+			" callbacks that were already scheduled");
+		bg.safe->runLater(boost::bind(&SafeLibevTest::appendAndScheduleMore, this, 1, 3));
+		bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, 2));
+		bg.start();
+		EVENTUALLY(5,
+			result = logSize() == 3;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure_equals(log[0], 1);
+		ensure_equals(log[1], 2);
+		ensure_equals(log[2], 3);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("cancelCommand() prevents a pending callback from running");
+		unsigned int id;
+		bg.start();
+		bg.safe->runSync(boost::bind(&SafeLibevTest::scheduleCommandsAndCancelOne,
+			this, &id));
+		// The commands cannot have run yet because runSync() ran on
+		// the event loop thread.
+		ensure(bg.safe->cancelCommand(id));
+		EVENTUALLY(5,
+			result = logSize() == 2;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = logSize() != 2;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure_equals(log[0], 1);
+		ensure_equals(log[1], 3);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("cancelCommand() returns false for callbacks that have already run,"
+			" even if their Command object has been reused");
+		bg.start();
+		unsigned int id = bg.safe->runLater(boost::bind(&SafeLibevTest::append, this, 1));
+		EVENTUALLY(5,
+			result = logSize() == 1;
+		);
+		ensure(!bg.safe->cancelCommand(id));
+		ensure(!bg.safe->cancelCommand(0));
+
+		unsigned int id2;
+		bg.safe->runSync(boost::bind(&SafeLibevTest::scheduleCommandsAndCancelOne,
+			this, &id2));
+		ensure(!bg.safe->cancelCommand(id));
+		ensure(bg.safe->cancelCommand(id2));
+		EVENTUALLY(5,
+			result = logSize() == 3;
+		);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Multiple threads can schedule many callbacks concurrently");
+		const int threadCount = 4;
+		const int perThread = 5000;
+		boost::thread_group threads;
+
+		bg.start();
+		for (int i = 0; i < threadCount; i++) {
+			threads.create_thread(boost::bind(&SafeLibevTest::scheduleMany, this,
+				i * perThread, perThread));
+		}
+		threads.join_all();
+		EVENTUALLY(10,
+			result = logSize() == (unsigned int) (threadCount * perThread);
+		);
+
+		// Callbacks from the same thread are run in the order in
+		// which they were scheduled.
+		boost::lock_guard<boost::mutex> l(syncher);
+		vector<int> last(threadCount, -1);
+		for (unsigned int i = 0; i < log.size(); i++) {
+			int thread = log[i] / perThread;
+			ensure("(1)", log[i] > last[thread]);
+			last[thread] = log[i];
+		}
+		ensure("(2)", ranOnLoopThread);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("When too many callbacks are pending, runLater() blocks until"
+			" the event loop has run some of them");
+		boost::thread *thread;
+
+		bg.safe->setMaxPendingCommands(256);
+		thread = new boost::thread(boost::bind(&SafeLibevTest::scheduleMany, this,
+			0, 1000));
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+		ensure("(1)", !thread->try_join_for(boost::chrono::milliseconds(0)));
+
+		bg.start();
+		thread->join();
+		delete thread;
+		EVENTUALLY(5,
+			result = logSize() == 1000;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		for (int i = 0; i < 1000; i++) {
+			ensure_equals("(2)", log[i], i);
+		}
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("When too many callbacks are pending, runLater() on the event"
+			" loop thread exceeds the limit instead of blocking or dropping callbacks");
+		int zeroIds = 0;
+
+		bg.safe->setMaxPendingCommands(256);
+		bg.start();
+		bg.safe->runSync(boost::bind(&SafeLibevTest::scheduleManyOnLoop, this,
+			1000, &zeroIds));
+		ensure_equals("(1)", zeroIds, 0);
+		EVENTUALLY(5,
+			result = logSize() == 1000;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		for (int i = 0; i < 1000; i++) {
+			ensure_equals("(2)", log[i], i);
+		}
+	}
+
+	TEST_METHOD(8) {
+		set_test_name("runSync() does not deadlock when it has to wait for free"
+			" commands while the event loop runs another thread's runSync()");
+		boost::thread *first, *filler, *second;
+
+		bg.safe->setMaxPendingCommands(256);
+		first = new boost::thread(boost::bind(&SafeLibevTest::appendSync, this, 1000));
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+		filler = new boost::thread(boost::bind(&SafeLibevTest::scheduleMany, this,
+			0, 255));
+		filler->join();
+		delete filler;
+		second = new boost::thread(boost::bind(&SafeLibevTest::appendSync, this, 2000));
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+		ensure("(1)", !second->try_join_for(boost::chrono::milliseconds(0)));
+
+		bg.start();
+		EVENTUALLY(5,
+			result = logSize() == 257;
+		);
+		ensure("(2)", first->try_join_for(boost::chrono::seconds(5)));
+		ensure("(3)", second->try_join_for(boost::chrono::seconds(5)));
+		delete first;
+		delete second;
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure_equals("(4)", log.front(), 1000);
+		ensure_equals("(5)", log.back(), 2000);
+	}
+}
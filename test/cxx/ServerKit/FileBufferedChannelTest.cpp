@@ -26,6 +26,7 @@ namespace tut {
 		bool endConsume;
 		unsigned int counter;
 		unsigned int buffersFlushed;
+		unsigned int writerTerminated;
 		string log;
 
 		ServerKit_FileBufferedChannelTest()
@@ -35,7 +36,8 @@ namespace tut {
 			  toConsume(CONSUME_FULLY),
 			  endConsume(false),
 			  counter(0),
-			  buffersFlushed(0)
+			  buffersFlushed(0),
+			  writerTerminated(0)
 		{
 			context.libev = bg.safe;
 			context.libuv = bg.libuv_loop;
@@ -95,6 +97,13 @@ namespace tut {
 			self->buffersFlushed++;
 		}
 
+		static void writerTerminatedCallback(FileBufferedChannel *channel) {
+			ServerKit_FileBufferedChannelTest *self = (ServerKit_FileBufferedChannelTest *)
+				channel->getHooks();
+			boost::lock_guard<boost::mutex> l(self->syncher);
+			self->writerTerminated++;
+		}
+
 		void feedChannel(const string &data) {
 			bg.safe->runLater(boost::bind(&ServerKit_FileBufferedChannelTest::_feedChannel,
 				this, data));
@@ -181,6 +190,17 @@ namespace tut {
 			*result = channel.getBytesBuffered();
 		}
 
+		int getChannelCompleteBufferFileFd() {
+			int result;
+			bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_getChannelCompleteBufferFileFd,
+				this, &result));
+			return result;
+		}
+
+		void _getChannelCompleteBufferFileFd(int *result) {
+			*result = channel.getCompleteBufferFileFd();
+		}
+
 		bool contextConfigure(const Json::Value &doc, vector<ConfigKit::Error> &errors) {
 			bool result;
 			bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_contextConfigure,
@@ -220,6 +240,29 @@ namespace tut {
 		void _setChannelDataCallback(FileBufferedChannel::DataCallback callback) {
 			channel.setDataCallback(callback);
 		}
+
+		Json::Value getSpoolArenaState() {
+			Json::Value result;
+			bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_getSpoolArenaState,
+				this, &result));
+			return result;
+		}
+
+		void _getSpoolArenaState(Json::Value *result) {
+			*result = context.inspectStateAsJson()["spool_arena"];
+		}
+
+		void openSpoolArena() {
+			bg.safe->runSync(boost::bind(&ServerKit_FileBufferedChannelTest::_openSpoolArena,
+				this));
+			EVENTUALLY(5,
+				result = getSpoolArenaState()["state"].asString() == "OPEN";
+			);
+		}
+
+		void _openSpoolArena() {
+			context.getSpoolArena();
+		}
 	};
 
 	DEFINE_TEST_GROUP_WITH_LIMIT(ServerKit_FileBufferedChannelTest, 100);
@@ -1079,4 +1122,231 @@ namespace tut {
 			ensure_equals(counter, 2u);
 		}
 	}
+
+
+	/***** Passing the buffer file *****/
+
+	TEST_METHOD(47) {
+		set_test_name("When stopped, once everything up to EOF has been moved to the"
+			" buffer file, it calls the writerTerminatedCallback and exposes that file");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		ensure(context.configure(config, errors));
+
+		channel.stop();
+		channel.setWriterTerminatedCallback(writerTerminatedCallback);
+		startLoop();
+
+		feedChannel("hello");
+		feedChannel("world");
+		ensure_equals(getChannelCompleteBufferFileFd(), -1);
+		feedChannel("");
+		EVENTUALLY(5,
+			LOCK();
+			result = writerTerminated == 1;
+		);
+
+		int fd = getChannelCompleteBufferFileFd();
+		ensure(fd != -1);
+		char buf[16];
+		ssize_t ret = pread(fd, buf, sizeof(buf), 0);
+		ensure_equals(ret, (ssize_t) 10);
+		ensure_equals(StaticString(buf, 10), "helloworld");
+		{
+			LOCK();
+			ensure(log.empty());
+		}
+	}
+
+	TEST_METHOD(48) {
+		set_test_name("It doesn't expose a buffer file if the data stayed in memory");
+
+		channel.stop();
+		channel.setWriterTerminatedCallback(writerTerminatedCallback);
+		startLoop();
+
+		feedChannel("hello");
+		feedChannel("");
+		ensure_equals(getChannelBytesBuffered(), 5u);
+		ensure_equals(getChannelCompleteBufferFileFd(), -1);
+		{
+			LOCK();
+			ensure_equals(writerTerminated, 0u);
+		}
+	}
+
+
+	/***** Spooling to an arena *****/
+
+	TEST_METHOD(49) {
+		set_test_name("When spooling to an arena, data that spans multiple extents"
+			" is read back correctly, and the extents are given back afterwards");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		config["file_buffered_channel_spool_arena"] = true;
+		config["file_buffered_channel_spool_extent_size"] = 4;
+		ensure(context.configure(config, errors));
+
+		channel.setSpoolToArena(true);
+		toConsume = -1;
+		startLoop();
+		openSpoolArena();
+
+		feedChannel("hello");
+		feedChannel("world!");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+		ensure_equals(getChannelBytesBuffered(), 0u);
+
+		toConsume = CONSUME_FULLY;
+		channelConsumed(sizeof("hello") - 1, false);
+		EVENTUALLY(5,
+			LOCK();
+			result = log ==
+				"Data: hello\n"
+				"Data: wor\n"
+				"Data: ld!\n";
+		);
+		EVENTUALLY(5,
+			result = getSpoolArenaState()["extents_in_use"].asUInt() == 0;
+		);
+	}
+
+	TEST_METHOD(50) {
+		set_test_name("When the arena's size limit has been reached, the writer waits"
+			" until there is space again");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		config["file_buffered_channel_spool_arena"] = true;
+		config["file_buffered_channel_spool_extent_size"] = 4;
+		config["file_buffered_channel_max_disk_buffering"] = 4;
+		ensure(context.configure(config, errors));
+
+		channel.setSpoolToArena(true);
+		toConsume = -1;
+		startLoop();
+		openSpoolArena();
+
+		feedChannel("hello");
+		feedChannel("world");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_WAITING_FOR_SPACE;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getChannelWriterState() != FileBufferedChannel::WS_WAITING_FOR_SPACE;
+		);
+		ensure_equals(getSpoolArenaState()["waiters"].asUInt(), 1u);
+
+		config = Json::Value();
+		config["file_buffered_channel_max_disk_buffering"] = 0;
+		ensure(contextConfigure(config, errors));
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+		ensure_equals(getChannelBytesBuffered(), 0u);
+
+		toConsume = CONSUME_FULLY;
+		channelConsumed(sizeof("hello") - 1, false);
+		EVENTUALLY(5,
+			LOCK();
+			result = log ==
+				"Data: hello\n"
+				"Data: wor\n"
+				"Data: ld\n";
+		);
+	}
+
+	TEST_METHOD(51) {
+		set_test_name("Extents that have been given back are reused");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		config["file_buffered_channel_spool_arena"] = true;
+		config["file_buffered_channel_spool_extent_size"] = 4;
+		ensure(context.configure(config, errors));
+
+		channel.setSpoolToArena(true);
+		toConsume = -1;
+		startLoop();
+		openSpoolArena();
+
+		feedChannel("hello");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+		channelConsumed(sizeof("hello") - 1, false);
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_MEMORY_MODE;
+		);
+		EVENTUALLY(5,
+			Json::Value state = getSpoolArenaState();
+			result = state["extents_in_use"].asUInt() == 0
+				&& state["extents_being_punched"].asUInt() == 0;
+		);
+		ensure_equals(getSpoolArenaState()["file_size"]["bytes"].asUInt(), 8u);
+
+		feedChannel("world");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+		ensure_equals(getSpoolArenaState()["file_size"]["bytes"].asUInt(), 8u);
+	}
+
+	TEST_METHOD(52) {
+		set_test_name("While the arena file is being created, the channel falls back"
+			" to a buffer file of its own");
+
+		Json::Value config;
+		vector<ConfigKit::Error> errors;
+		config["file_buffered_channel_threshold"] = 1;
+		config["file_buffered_channel_spool_arena"] = true;
+		config["file_buffered_channel_spool_extent_size"] = 4;
+		ensure(context.configure(config, errors));
+
+		channel.setSpoolToArena(true);
+		toConsume = -1;
+		startLoop();
+
+		feedChannel("hello");
+		feedChannel("world!");
+		EVENTUALLY(5,
+			result = getChannelMode() == FileBufferedChannel::IN_FILE_MODE;
+		);
+		EVENTUALLY(5,
+			result = getChannelWriterState() == FileBufferedChannel::WS_INACTIVE;
+		);
+
+		toConsume = CONSUME_FULLY;
+		channelConsumed(sizeof("hello") - 1, false);
+		EVENTUALLY(5,
+			LOCK();
+			result = log ==
+				"Data: hello\n"
+				"Data: world!\n";
+		);
+		EVENTUALLY(5,
+			result = getSpoolArenaState()["state"].asString() == "OPEN";
+		);
+		ensure_equals(getSpoolArenaState()["file_size"]["bytes"].asUInt(), 0u);
+	}
 }
@@ -0,0 +1,277 @@
+#include <TestSupport.h>
+#include <ServerKit/Hpack.h>
+#include <StrIntTools/StrIntUtils.h>
+
+using namespace Passenger;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace tut {
+	struct ServerKit_HpackTest: public TestBase {
+		HpackDecoder decoder;
+		vector<HpackHeader> headers;
+
+		static string fromHex(const StaticString &hex) {
+			string result;
+			for (string::size_type i = 0; i + 1 < hex.size(); i += 2) {
+				result.append(1, (char) hexToUint(hex.substr(i, 2)));
+			}
+			return result;
+		}
+
+		int decode(const StaticString &hex) {
+			string data = fromHex(hex);
+			headers.clear();
+			return decoder.decode(data.data(), data.size(), headers);
+		}
+
+		void ensureHeader(const char *message, unsigned int index,
+			const string &name, const string &value)
+		{
+			ensure(message, index < headers.size());
+			ensure_equals(message, headers[index].name, name);
+			ensure_equals(message, headers[index].value, value);
+		}
+
+		void ensureDynamicTableEntry(const char *message, unsigned int index,
+			const string &name, const string &value)
+		{
+			ensure(message, index < decoder.getDynamicTableEntryCount());
+			ensure_equals(message, decoder.getDynamicTableEntry(index).name, name);
+			ensure_equals(message, decoder.getDynamicTableEntry(index).value, value);
+		}
+	};
+
+	DEFINE_TEST_GROUP(ServerKit_HpackTest);
+
+	/***** Primitives *****/
+
+	TEST_METHOD(1) {
+		set_test_name("Integer encoding");
+		string output;
+
+		hpackEncodeInteger(output, 0, 5, 10);
+		ensure_equals("(1)", toHex(output), "0a");
+
+		output.clear();
+		hpackEncodeInteger(output, 0, 5, 1337);
+		ensure_equals("(2)", toHex(output), "1f9a0a");
+
+		output.clear();
+		hpackEncodeInteger(output, 0, 8, 42);
+		ensure_equals("(3)", toHex(output), "2a");
+
+		output.clear();
+		hpackEncodeInteger(output, 0x80, 7, 2);
+		ensure_equals("(4)", toHex(output), "82");
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Integer decoding");
+		string data = fromHex("1f9a0a");
+		const unsigned char *pos = (const unsigned char *) data.data();
+		boost::uint32_t result;
+
+		ensure("(1)", hpackDecodeInteger(pos, pos + data.size(), 5, result));
+		ensure_equals("(2)", result, 1337u);
+		ensure_equals("(3)", (const char *) pos, data.data() + data.size());
+
+		// Truncated
+		pos = (const unsigned char *) data.data();
+		ensure("(4)", !hpackDecodeInteger(pos, pos + 2, 5, result));
+
+		// Too large
+		data = fromHex("1fffffffffff0f");
+		pos = (const unsigned char *) data.data();
+		ensure("(5)", !hpackDecodeInteger(pos, pos + data.size(), 5, result));
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Huffman encoding and decoding");
+		string output;
+
+		hpackHuffmanEncode(output, "www.example.com");
+		ensure_equals("(1)", toHex(output), "f1e3c2e5f23a6ba0ab90f4ff");
+		ensure_equals("(2)", hpackHuffmanEncodedSize("www.example.com"), output.size());
+
+		string decoded;
+		ensure("(3)", hpackHuffmanDecode(decoded, output.data(), output.size()));
+		ensure_equals("(4)", decoded, "www.example.com");
+
+		output.clear();
+		hpackHuffmanEncode(output, "Mon, 21 Oct 2013 20:13:21 GMT");
+		ensure_equals("(5)", toHex(output), "d07abe941054d444a8200595040b8166e082a62d1bff");
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Huffman decoding rejects invalid padding");
+		string decoded;
+
+		// "a" is 00011, padded with zeroes instead of ones.
+		string data = fromHex("18");
+		ensure("(1)", !hpackHuffmanDecode(decoded, data.data(), data.size()));
+
+		// More than 7 bits of padding.
+		decoded.clear();
+		data = fromHex("1fff");
+		ensure("(2)", !hpackHuffmanDecode(decoded, data.data(), data.size()));
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Encoding headers and statuses");
+		string output;
+
+		hpackEncodeStatus(output, 200);
+		ensure_equals("(1)", toHex(output), "88");
+
+		output.clear();
+		hpackEncodeStatus(output, 302);
+		ensure_equals("(2)", toHex(output), "08826402");
+
+		output.clear();
+		hpackEncodeHeader(output, "custom-key", "custom-header");
+		headers.clear();
+		ensure_equals("(3)", decoder.decode(output.data(), output.size(), headers), 0);
+		ensureHeader("(4)", 0, "custom-key", "custom-header");
+		ensure_equals("(5)", decoder.getDynamicTableEntryCount(), 0u);
+
+		output.clear();
+		hpackEncodeHeader(output, "content-type", "text/html");
+		ensure_equals("(6)", (unsigned char) output[0], 0x0fu);
+		headers.clear();
+		ensure_equals("(7)", decoder.decode(output.data(), output.size(), headers), 0);
+		ensureHeader("(8)", 0, "content-type", "text/html");
+	}
+
+
+	/***** Decoding the RFC 7541 examples *****/
+
+	TEST_METHOD(10) {
+		set_test_name("Literal header field with indexing (C.2.1)");
+		ensure_equals("(1)", decode("400a637573746f6d2d6b65790d637573746f6d2d686561646572"), 0);
+		ensure_equals("(2)", headers.size(), 1u);
+		ensureHeader("(3)", 0, "custom-key", "custom-header");
+		ensure_equals("(4)", decoder.getDynamicTableSize(), 55u);
+	}
+
+	TEST_METHOD(11) {
+		set_test_name("Literal header field without indexing (C.2.2)");
+		ensure_equals("(1)", decode("040c2f73616d706c652f70617468"), 0);
+		ensureHeader("(2)", 0, ":path", "/sample/path");
+		ensure_equals("(3)", decoder.getDynamicTableSize(), 0u);
+	}
+
+	TEST_METHOD(12) {
+		set_test_name("Literal header field never indexed (C.2.3)");
+		ensure_equals("(1)", decode("100870617373776f726406736563726574"), 0);
+		ensureHeader("(2)", 0, "password", "secret");
+		ensure_equals("(3)", decoder.getDynamicTableSize(), 0u);
+	}
+
+	TEST_METHOD(13) {
+		set_test_name("Requests without Huffman coding (C.3)");
+
+		ensure_equals("(1)", decode("828684410f7777772e6578616d706c652e636f6d"), 0);
+		ensure_equals("(2)", headers.size(), 4u);
+		ensureHeader("(3)", 0, ":method", "GET");
+		ensureHeader("(4)", 1, ":scheme", "http");
+		ensureHeader("(5)", 2, ":path", "/");
+		ensureHeader("(6)", 3, ":authority", "www.example.com");
+		ensure_equals("(7)", decoder.getDynamicTableSize(), 57u);
+
+		ensure_equals("(8)", decode("828684be58086e6f2d6361636865"), 0);
+		ensure_equals("(9)", headers.size(), 5u);
+		ensureHeader("(10)", 3, ":authority", "www.example.com");
+		ensureHeader("(11)", 4, "cache-control", "no-cache");
+		ensure_equals("(12)", decoder.getDynamicTableSize(), 110u);
+
+		ensure_equals("(13)", decode("828785bf400a637573746f6d2d6b65790c637573746f6d2d76616c7565"), 0);
+		ensure_equals("(14)", headers.size(), 5u);
+		ensureHeader("(15)", 1, ":scheme", "https");
+		ensureHeader("(16)", 2, ":path", "/index.html");
+		ensureHeader("(17)", 3, ":authority", "www.example.com");
+		ensureHeader("(18)", 4, "custom-key", "custom-value");
+		ensure_equals("(19)", decoder.getDynamicTableSize(), 164u);
+		ensureDynamicTableEntry("(20)", 0, "custom-key", "custom-value");
+		ensureDynamicTableEntry("(21)", 1, "cache-control", "no-cache");
+		ensureDynamicTableEntry("(22)", 2, ":authority", "www.example.com");
+	}
+
+	TEST_METHOD(14) {
+		set_test_name("Requests with Huffman coding (C.4)");
+
+		ensure_equals("(1)", decode("828684418cf1e3c2e5f23a6ba0ab90f4ff"), 0);
+		ensureHeader("(2)", 3, ":authority", "www.example.com");
+		ensure_equals("(3)", decoder.getDynamicTableSize(), 57u);
+
+		ensure_equals("(4)", decode("828684be5886a8eb10649cbf"), 0);
+		ensureHeader("(5)", 4, "cache-control", "no-cache");
+		ensure_equals("(6)", decoder.getDynamicTableSize(), 110u);
+
+		ensure_equals("(7)", decode("828785bf408825a849e95ba97d7f8925a849e95bb8e8b4bf"), 0);
+		ensureHeader("(8)", 4, "custom-key", "custom-value");
+		ensure_equals("(9)", decoder.getDynamicTableSize(), 164u);
+	}
+
+	TEST_METHOD(15) {
+		set_test_name("Responses with dynamic table eviction (C.5)");
+		decoder = HpackDecoder(256);
+
+		ensure_equals("(1)", decode("4803333032580770726976617465611d"
+			"4d6f6e2c203231204f637420323031332032303a31333a323120474d54"
+			"6e1768747470733a2f2f7777772e6578616d706c652e636f6d"), 0);
+		ensure_equals("(2)", headers.size(), 4u);
+		ensureHeader("(3)", 0, ":status", "302");
+		ensureHeader("(4)", 1, "cache-control", "private");
+		ensureHeader("(5)", 2, "date", "Mon, 21 Oct 2013 20:13:21 GMT");
+		ensureHeader("(6)", 3, "location", "https://www.example.com");
+		ensure_equals("(7)", decoder.getDynamicTableSize(), 222u);
+
+		ensure_equals("(8)", decode("4803333037c1c0bf"), 0);
+		ensureHeader("(9)", 0, ":status", "307");
+		ensureHeader("(10)", 3, "location", "https://www.example.com");
+		ensure_equals("(11)", decoder.getDynamicTableSize(), 222u);
+		ensure_equals("(12)", decoder.getDynamicTableEntryCount(), 4u);
+		ensureDynamicTableEntry("(13)", 0, ":status", "307");
+		ensureDynamicTableEntry("(14)", 3, "cache-control", "private");
+	}
+
+
+	/***** Errors *****/
+
+	TEST_METHOD(20) {
+		set_test_name("Invalid indices are rejected");
+		ensure_equals("(1)", decode("80"), HPACK_INVALID_INDEX);
+		ensure_equals("(2)", decode("be"), HPACK_INVALID_INDEX);
+	}
+
+	TEST_METHOD(21) {
+		set_test_name("Truncated header blocks are rejected");
+		ensure_equals("(1)", decode("400a637573746f6d2d6b6579"), HPACK_TRUNCATED_HEADER_BLOCK);
+		ensure_equals("(2)", decode("1f"), HPACK_TRUNCATED_HEADER_BLOCK);
+	}
+
+	TEST_METHOD(22) {
+		set_test_name("Dynamic table size updates are only allowed at the beginning of"
+			" a header block, and may not exceed the protocol maximum");
+		ensure_equals("(1)", decode("3f11"), 0);
+		ensure_equals("(2)", decode("823f11"), HPACK_INVALID_TABLE_SIZE_UPDATE);
+		ensure_equals("(3)", decode("3fe21f"), HPACK_INVALID_TABLE_SIZE_UPDATE);
+	}
+
+	TEST_METHOD(23) {
+		set_test_name("Shrinking the dynamic table evicts entries");
+		ensure_equals("(1)", decode("400a637573746f6d2d6b65790d637573746f6d2d686561646572"), 0);
+		ensure_equals("(2)", decoder.getDynamicTableEntryCount(), 1u);
+		ensure_equals("(3)", decode("20"), 0);
+		ensure_equals("(4)", decoder.getDynamicTableEntryCount(), 0u);
+		ensure_equals("(5)", decoder.getDynamicTableSize(), 0u);
+	}
+
+	TEST_METHOD(24) {
+		set_test_name("Header lists larger than the limit are rejected");
+		decoder = HpackDecoder(4096, 100);
+		ensure_equals("(1)", decode("400a637573746f6d2d6b65790d637573746f6d2d686561646572"), 0);
+		ensure_equals("(2)", decode("bebebe"), HPACK_HEADER_LIST_TOO_LARGE);
+	}
+}
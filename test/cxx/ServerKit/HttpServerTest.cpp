@@ -13,6 +13,7 @@
 #include <Utils.h>
 #include <IOTools/IOUtils.h>
 #include <IOTools/BufferedIO.h>
+#include <ProcessManagement/Spawn.h>
 
 using namespace Passenger;
 using namespace Passenger::ServerKit;
@@ -83,14 +84,14 @@ namespace tut {
 				}
 			}
 
-			writeSimpleResponse(client, 200, &headers,
+			writeSimpleResponse(client, req, 200, &headers,
 				StaticString(response, pos - response));
 			endRequest(&client, &req);
 		}
 
 		void testBody(MyClient *client, MyRequest *req) {
 			if (!req->hasBody() && !req->upgraded()) {
-				writeSimpleResponse(client, 422, NULL, "Body required");
+				writeSimpleResponse(client, req, 422, NULL, "Body required");
 				if (!req->ended()) {
 					endRequest(&client, &req);
 				}
@@ -99,7 +100,7 @@ namespace tut {
 
 		void testBodyStop(MyClient *client, MyRequest *req) {
 			if (!req->hasBody() && !req->upgraded()) {
-				writeSimpleResponse(client, 422, NULL, "Body required");
+				writeSimpleResponse(client, req, 422, NULL, "Body required");
 				if (!req->ended()) {
 					endRequest(&client, &req);
 				}
@@ -122,7 +123,7 @@ namespace tut {
 			unsigned int size = stringToUint(StaticString(value->start->data, value->size));
 			char *body = (char *) psg_pnalloc(req->pool, size);
 			memset(body, 'x', size);
-			writeSimpleResponse(client, 200, NULL, StaticString(body, size));
+			writeSimpleResponse(client, req, 200, NULL, StaticString(body, size));
 			if (!req->ended()) {
 				endRequest(&client, &req);
 			}
@@ -130,9 +131,9 @@ namespace tut {
 
 		void testPath(MyClient *client, MyRequest *req) {
 			if (req->path.start->next == NULL) {
-				writeSimpleResponse(client, 200, NULL, "Contiguous: 1");
+				writeSimpleResponse(client, req, 200, NULL, "Contiguous: 1");
 			} else {
-				writeSimpleResponse(client, 500, NULL, "Contiguous: 0");
+				writeSimpleResponse(client, req, 500, NULL, "Contiguous: 0");
 			}
 			if (!req->ended()) {
 				endRequest(&client, &req);
@@ -144,9 +145,16 @@ namespace tut {
 			// Continues in onRequestEarlyHalfClose()
 		}
 
+		void testResponseError(MyClient *client, MyRequest *req) {
+			writeResponse(client, req, "HTTP/1.1 200 OK\r\n"
+				"Content-Length: 100\r\n\r\n"
+				"partial");
+			endRequestWithError(&client, &req, "response error test", LoggingKit::DEBUG);
+		}
+
 		void testEarlyReadErrorDetection(MyClient *client, MyRequest *req) {
 			req->nextRequestEarlyReadError = ENOSPC;
-			writeSimpleResponse(client, 200, NULL, "OK");
+			writeSimpleResponse(client, req, 200, NULL, "OK");
 			endRequest(&client, &req);
 		}
 
@@ -175,6 +183,8 @@ namespace tut {
 				testHalfClose(client, req);
 			} else if (psg_lstr_cmp(&req->path, "/early_read_error_detection_test")) {
 				testEarlyReadErrorDetection(client, req);
+			} else if (psg_lstr_cmp(&req->path, "/response_error_test")) {
+				testResponseError(client, req);
 			} else {
 				testRequest(client, req);
 			}
@@ -191,7 +201,7 @@ namespace tut {
 				// EOF
 				req->body.insert(0, toString(req->body.size()) + " bytes: ");
 				if (!req->testingHalfClose) {
-					writeSimpleResponse(client, 200, NULL, req->body);
+					writeSimpleResponse(client, req, 200, NULL, req->body);
 					endRequest(&client, &req);
 				}
 			} else {
@@ -199,7 +209,7 @@ namespace tut {
 				req->body.insert(0, string("Request body error: ") +
 					getErrorDesc(errcode) + "\n" +
 					toString(req->body.size()) + " bytes: ");
-				writeSimpleResponse(client, 422, NULL, req->body);
+				writeSimpleResponse(client, req, 422, NULL, req->body);
 				if (!req->ended()) {
 					endRequest(&client, &req);
 				}
@@ -306,7 +316,9 @@ namespace tut {
 
 			serverSocket = createUnixServer("tmp.server");
 
-			server = boost::make_shared<MyServer>(&context, schema);
+			Json::Value config;
+			config["http2"] = true;
+			server = boost::make_shared<MyServer>(&context, schema, config);
 			server->initialize();
 			server->listen(serverSocket);
 		}
@@ -498,9 +510,146 @@ namespace tut {
 			} while (true);
 			return result;
 		}
+
+		void sendHttp2Frame(Http2::FrameType type, unsigned char flags, boost::uint32_t streamId,
+			const StaticString &payload = StaticString())
+		{
+			string frame;
+			Http2::appendFrameHeader(frame, payload.size(), type, flags, streamId);
+			frame.append(payload.data(), payload.size());
+			writeExact(fd, frame);
+		}
+
+		Http2::FrameHeader readHttp2Frame(string &payload) {
+			char buf[Http2::FRAME_HEADER_SIZE];
+			unsigned long long timeout = 5000000;
+
+			ensure_equals("Frame header received",
+				readExact(fd, buf, sizeof(buf), &timeout),
+				Http2::FRAME_HEADER_SIZE);
+			Http2::FrameHeader header = Http2::decodeFrameHeader(buf);
+			payload.resize(header.length);
+			if (header.length > 0) {
+				ensure_equals("Frame payload received",
+					readExact(fd, &payload[0], header.length, &timeout),
+					header.length);
+			}
+			return header;
+		}
+
+		/** Reads frames until one that isn't a SETTINGS or WINDOW_UPDATE frame. */
+		Http2::FrameHeader readHttp2NonControlFrame(string &payload) {
+			Http2::FrameHeader header;
+			do {
+				header = readHttp2Frame(payload);
+			} while (header.type == Http2::SETTINGS || header.type == Http2::WINDOW_UPDATE);
+			return header;
+		}
+
+		void connectWithHttp2() {
+			string payload;
+
+			connectToServer();
+			writeExact(fd, StaticString(Http2::CLIENT_PREFACE, Http2::CLIENT_PREFACE_SIZE));
+			sendHttp2Frame(Http2::SETTINGS, 0, 0);
+
+			Http2::FrameHeader header = readHttp2Frame(payload);
+			ensure_equals<int>("Server sends SETTINGS first", header.type, Http2::SETTINGS);
+			ensure_equals<int>("(2)", header.flags, 0);
+			sendHttp2Frame(Http2::SETTINGS, Http2::FLAG_ACK, 0);
+		}
+
+		void sendHttp2Request(boost::uint32_t streamId, const StaticString &method,
+			const StaticString &path, bool endStream = true,
+			const StaticString &extraHeaderName = StaticString(),
+			const StaticString &extraHeaderValue = StaticString())
+		{
+			string block;
+			hpackEncodeHeader(block, ":method", method);
+			hpackEncodeHeader(block, ":scheme", "http");
+			if (!path.empty()) {
+				hpackEncodeHeader(block, ":path", path);
+			}
+			hpackEncodeHeader(block, ":authority", "foo");
+			if (!extraHeaderName.empty()) {
+				hpackEncodeHeader(block, extraHeaderName, extraHeaderValue);
+			}
+			sendHttp2Frame(Http2::HEADERS,
+				Http2::FLAG_END_HEADERS | (endStream ? Http2::FLAG_END_STREAM : 0),
+				streamId, block);
+		}
+
+		struct Http2Response {
+			vector<HpackHeader> headers;
+			string body;
+			bool reset;
+			boost::uint32_t resetCode;
+
+			Http2Response()
+				: reset(false),
+				  resetCode(0)
+				{ }
+
+			string header(const string &name) const {
+				for (unsigned int i = 0; i < headers.size(); i++) {
+					if (headers[i].name == name) {
+						return headers[i].value;
+					}
+				}
+				return string();
+			}
+		};
+
+		/**
+		 * Reads frames until the responses for the given number of streams are
+		 * complete, replenishing flow control windows along the way.
+		 */
+		map<boost::uint32_t, Http2Response> readHttp2Responses(unsigned int count = 1) {
+			map<boost::uint32_t, Http2Response> responses;
+			HpackDecoder decoder;
+			unsigned int done = 0;
+			string payload;
+
+			while (done < count) {
+				Http2::FrameHeader header = readHttp2Frame(payload);
+				Http2Response &response = responses[header.streamId];
+
+				switch (header.type) {
+				case Http2::HEADERS:
+					ensure_equals("(headers 1)", decoder.decode(payload.data(), payload.size(),
+						response.headers), 0);
+					break;
+				case Http2::DATA: {
+					response.body.append(payload);
+					if (header.length > 0) {
+						string increment;
+						Http2::appendUint32(increment, header.length);
+						sendHttp2Frame(Http2::WINDOW_UPDATE, 0, 0, increment);
+						sendHttp2Frame(Http2::WINDOW_UPDATE, 0, header.streamId, increment);
+					}
+					break;
+				}
+				case Http2::RST_STREAM:
+					response.reset = true;
+					response.resetCode = Http2::decodeUint32(payload.data());
+					if (response.resetCode != Http2::NO_ERROR) {
+						done++;
+					}
+					continue;
+				default:
+					responses.erase(header.streamId);
+					continue;
+				}
+
+				if (header.flags & Http2::FLAG_END_STREAM) {
+					done++;
+				}
+			}
+			return responses;
+		}
 	};
 
-	DEFINE_TEST_GROUP_WITH_LIMIT(ServerKit_HttpServerTest, 120);
+	DEFINE_TEST_GROUP_WITH_LIMIT(ServerKit_HttpServerTest, 125);
 
 
 	/***** Valid HTTP header parsing *****/
@@ -1977,4 +2126,226 @@ namespace tut {
 			result = getActiveClientCount() == 0;
 		);
 	}
+
+
+	/***** HTTP/2 *****/
+
+	TEST_METHOD(110) {
+		set_test_name("It serves HTTP/2 requests from clients with prior knowledge");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "GET", "/", true, "foo", "bar");
+		map<boost::uint32_t, Http2Response> responses = readHttp2Responses();
+		Http2Response &response = responses[1];
+
+		ensure("(1)", !response.reset);
+		ensure_equals("(2)", response.header(":status"), "200");
+		ensure_equals("(3)", response.header("content-type"), "text/plain");
+		ensure_equals("(4)", response.header("content-length"), "16");
+		ensure_equals("(5)", response.header("connection"), "");
+		ensure_equals("(6)", response.header("status"), "");
+		ensure_equals("(7)", response.body, "hello /\nFoo: bar");
+	}
+
+	TEST_METHOD(111) {
+		set_test_name("It passes HTTP/2 request bodies");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "POST", "/body_test", false);
+		sendHttp2Frame(Http2::DATA, 0, 1, "hello ");
+		sendHttp2Frame(Http2::DATA, Http2::FLAG_END_STREAM, 1, "world");
+		map<boost::uint32_t, Http2Response> responses = readHttp2Responses();
+
+		ensure_equals("(1)", responses[1].header(":status"), "200");
+		ensure_equals("(2)", responses[1].body, "11 bytes: hello world");
+	}
+
+	TEST_METHOD(112) {
+		set_test_name("It serves concurrent HTTP/2 streams over one connection");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "GET", "/one");
+		sendHttp2Request(3, "GET", "/two");
+		map<boost::uint32_t, Http2Response> responses = readHttp2Responses(2);
+
+		ensure_equals("(1)", responses[1].body, "hello /one");
+		ensure_equals("(2)", responses[3].body, "hello /two");
+		ensure_equals("(3)", getTotalRequestsBegun(), 2u);
+	}
+
+	TEST_METHOD(113) {
+		set_test_name("It respects the HTTP/2 client's flow control window");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "GET", "/large_response", true, "size", "100000");
+
+		string payload;
+		unsigned int total = 0;
+		Http2::FrameHeader header = readHttp2NonControlFrame(payload);
+		ensure_equals<int>("(1)", header.type, Http2::HEADERS);
+		while (total < Http2::DEFAULT_WINDOW_SIZE) {
+			header = readHttp2NonControlFrame(payload);
+			ensure_equals<int>("(2)", header.type, Http2::DATA);
+			ensure("(3)", header.length <= Http2::DEFAULT_MAX_FRAME_SIZE);
+			total += header.length;
+		}
+		ensure_equals("(4)", total, (unsigned int) Http2::DEFAULT_WINDOW_SIZE);
+		SHOULD_NEVER_HAPPEN(100,
+			result = hasResponseData();
+		);
+
+		string increment;
+		Http2::appendUint32(increment, 100000);
+		sendHttp2Frame(Http2::WINDOW_UPDATE, 0, 0, increment);
+		sendHttp2Frame(Http2::WINDOW_UPDATE, 0, 1, increment);
+		while (!(header.flags & Http2::FLAG_END_STREAM)) {
+			header = readHttp2NonControlFrame(payload);
+			ensure_equals<int>("(5)", header.type, Http2::DATA);
+			total += header.length;
+		}
+		ensure_equals("(6)", total, 100000u);
+	}
+
+	TEST_METHOD(114) {
+		set_test_name("It acknowledges HTTP/2 PING frames");
+
+		connectWithHttp2();
+		sendHttp2Frame(Http2::PING, 0, 0, "12345678");
+
+		string payload;
+		Http2::FrameHeader header = readHttp2NonControlFrame(payload);
+		ensure_equals<int>("(1)", header.type, Http2::PING);
+		ensure_equals<int>("(2)", header.flags, Http2::FLAG_ACK);
+		ensure_equals("(3)", payload, "12345678");
+	}
+
+	TEST_METHOD(115) {
+		set_test_name("It resets malformed HTTP/2 requests without closing the connection");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "GET", "");
+		map<boost::uint32_t, Http2Response> responses = readHttp2Responses();
+		ensure("(1)", responses[1].reset);
+		ensure_equals("(2)", responses[1].resetCode, (boost::uint32_t) Http2::PROTOCOL_ERROR);
+
+		sendHttp2Request(3, "GET", "/", true, "foo", "bar\r\nInjected: 1");
+		responses = readHttp2Responses();
+		ensure("(3)", responses[3].reset);
+		ensure_equals("(4)", responses[3].resetCode, (boost::uint32_t) Http2::PROTOCOL_ERROR);
+
+		sendHttp2Request(5, "GET", "/");
+		responses = readHttp2Responses();
+		ensure_equals("(5)", responses[5].body, "hello /");
+		ensure_equals("(6)", getTotalRequestsBegun(), 1u);
+	}
+
+	TEST_METHOD(116) {
+		set_test_name("It closes HTTP/2 connections with GOAWAY on protocol errors");
+
+		connectToServer();
+		writeExact(fd, StaticString(Http2::CLIENT_PREFACE, Http2::CLIENT_PREFACE_SIZE));
+		// The preface must be followed by SETTINGS.
+		sendHttp2Frame(Http2::PING, 0, 0, "12345678");
+
+		string payload;
+		Http2::FrameHeader header = readHttp2NonControlFrame(payload);
+		ensure_equals<int>("(1)", header.type, Http2::GOAWAY);
+		ensure_equals("(2)", Http2::decodeUint32(payload.data() + 4),
+			(boost::uint32_t) Http2::PROTOCOL_ERROR);
+		ensure_equals("(3)", readAll(fd, 1024).first, "");
+		EVENTUALLY(5,
+			result = getActiveClientCount() == 0;
+		);
+	}
+
+	TEST_METHOD(117) {
+		set_test_name("It sends GOAWAY to HTTP/2 clients when shutting down");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "GET", "/");
+		readHttp2Responses();
+		shutdownServer();
+
+		string payload;
+		Http2::FrameHeader header = readHttp2NonControlFrame(payload);
+		ensure_equals<int>("(1)", header.type, Http2::GOAWAY);
+		ensure_equals("(2)", Http2::decodeUint32(payload.data()), 1u);
+		ensure_equals("(3)", Http2::decodeUint32(payload.data() + 4),
+			(boost::uint32_t) Http2::NO_ERROR);
+		ensure_equals("(4)", readAll(fd, 1024).first, "");
+	}
+
+	TEST_METHOD(118) {
+		set_test_name("It closes HTTP/2 connections that keep resetting streams (rapid reset)");
+
+		connectWithHttp2();
+		string cancel;
+		Http2::appendUint32(cancel, Http2::CANCEL);
+		for (unsigned int i = 0; i < Http2Session::STREAM_RESET_BUDGET; i++) {
+			boost::uint32_t streamId = 2 * i + 1;
+			sendHttp2Request(streamId, "POST", "/body_test", false);
+			sendHttp2Frame(Http2::RST_STREAM, 0, streamId, cancel);
+		}
+
+		string payload;
+		Http2::FrameHeader header = readHttp2NonControlFrame(payload);
+		ensure_equals<int>("(1)", header.type, Http2::GOAWAY);
+		ensure_equals("(2)", Http2::decodeUint32(payload.data() + 4),
+			(boost::uint32_t) Http2::ENHANCE_YOUR_CALM);
+		ensure_equals("(3)", readAll(fd, 1024).first, "");
+		EVENTUALLY(5,
+			result = getActiveClientCount() == 0;
+		);
+	}
+
+	static void ignoreExecError(const char **command, int errcode) {
+		// Do nothing.
+	}
+
+	TEST_METHOD(119) {
+		set_test_name("It interoperates with curl over HTTP/2");
+
+		const char *versionCommand[] = { "curl", "--version", NULL };
+		SubprocessInfo info;
+		SubprocessOutput output;
+		runCommandAndCaptureOutput(versionCommand, info, output, 1024 * 16, true,
+			boost::function<void ()>(), ignoreExecError);
+		if (output.data.find("HTTP2") == string::npos) {
+			// curl is not installed or was built without HTTP/2 support.
+			return;
+		}
+
+		startLoop();
+		output.data.clear();
+		const char *getCommand[] = { "curl", "-s", "--http2-prior-knowledge",
+			"--unix-socket", "tmp.server", "-H", "Foo: bar",
+			"-w", "\n%{http_version}", "http://localhost/", NULL };
+		runCommandAndCaptureOutput(getCommand, info, output, 1024 * 16);
+		ensure_equals("(1)", output.data, "hello /\nFoo: bar\n2");
+
+		output.data.clear();
+		const char *postCommand[] = { "curl", "-s", "--http2-prior-knowledge",
+			"--unix-socket", "tmp.server", "--data-binary", "hello world",
+			"-w", "\n%{http_version}", "http://localhost/body_test", NULL };
+		runCommandAndCaptureOutput(postCommand, info, output, 1024 * 16);
+		ensure_equals("(2)", output.data, "11 bytes: hello world\n2");
+		ensure_equals("(3)", getTotalRequestsBegun(), 2u);
+	}
+
+	TEST_METHOD(120) {
+		set_test_name("An error in one HTTP/2 response resets that stream only");
+
+		connectWithHttp2();
+		sendHttp2Request(1, "GET", "/response_error_test");
+		sendHttp2Request(3, "GET", "/");
+		map<boost::uint32_t, Http2Response> responses = readHttp2Responses(2);
+		ensure("(1)", responses[1].reset);
+		ensure_equals("(2)", responses[1].resetCode, (boost::uint32_t) Http2::INTERNAL_ERROR);
+		ensure_equals("(3)", responses[3].body, "hello /");
+
+		sendHttp2Request(5, "GET", "/");
+		responses = readHttp2Responses();
+		ensure_equals("(4)", responses[5].body, "hello /");
+		ensure_equals("(5)", getActiveClientCount(), 1u);
+	}
 }
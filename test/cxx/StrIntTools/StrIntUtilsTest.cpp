@@ -48,4 +48,12 @@ namespace tut {
 		string result = escapeHTML(s);
 		ensure_equals(result, "h?llo");
 	}
+
+	TEST_METHOD(5) {
+		set_test_name("escapePrometheusLabelValue escapes backslashes, quotes and newlines");
+		ensure_equals(escapePrometheusLabelValue("/srv/app (production)"),
+			"/srv/app (production)");
+		ensure_equals(escapePrometheusLabelValue("a\\b\"c\nd"), "a\\\\b\\\"c\\nd");
+		ensure_equals(escapePrometheusLabelValue(""), "");
+	}
 }
@@ -0,0 +1,199 @@
+#include <TestSupport.h>
+#include <SystemTools/CpuTopology.h>
+#include <FileTools/FileManip.h>
+#include <boost/thread.hpp>
+#ifdef __linux__
+	#include <sys/syscall.h>
+#endif
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct SystemTools_CpuTopologyTest: public TestBase {
+		vector<unsigned int> cpus;
+
+		SystemTools_CpuTopologyTest() {
+			removeDirTree("tmp.topology");
+			makeDirTree("tmp.topology");
+		}
+
+		~SystemTools_CpuTopologyTest() {
+			removeDirTree("tmp.topology");
+		}
+
+		void createNode(const string &name, const string &cpulist) {
+			makeDirTree("tmp.topology/" + name);
+			createFile("tmp.topology/" + name + "/cpulist", cpulist + "\n");
+		}
+
+		#ifdef __linux__
+			boost::mutex threadSyncher;
+			boost::condition_variable threadCond;
+			pid_t threadId;
+			bool threadDone;
+
+			void threadMain() {
+				boost::unique_lock<boost::mutex> l(threadSyncher);
+				threadId = (pid_t) syscall(SYS_gettid);
+				threadCond.notify_all();
+				while (!threadDone) {
+					threadCond.wait(l);
+				}
+			}
+
+			string getThreadAffinity(pid_t tid) {
+				cpu_set_t set;
+				vector<unsigned int> result;
+
+				CPU_ZERO(&set);
+				if (sched_getaffinity(tid, sizeof(set), &set) != 0) {
+					return "error";
+				}
+				for (unsigned int i = 0; i < CPU_SETSIZE; i++) {
+					if (CPU_ISSET(i, &set)) {
+						result.push_back(i);
+					}
+				}
+				return CpuTopology::formatCpuList(result);
+			}
+		#endif
+
+		vector<unsigned int> range(unsigned int begin, unsigned int end) {
+			vector<unsigned int> result;
+			for (unsigned int i = begin; i < end; i++) {
+				result.push_back(i);
+			}
+			return result;
+		}
+	};
+
+	DEFINE_TEST_GROUP(SystemTools_CpuTopologyTest);
+
+	/***** Parsing and formatting *****/
+
+	TEST_METHOD(1) {
+		set_test_name("parseCpuList() parses single CPUs and ranges");
+		ensure(CpuTopology::parseCpuList("0-3,8,10-11\n", cpus));
+		ensure_equals(cpus.size(), 7u);
+		ensure_equals(cpus[0], 0u);
+		ensure_equals(cpus[3], 3u);
+		ensure_equals(cpus[4], 8u);
+		ensure_equals(cpus[5], 10u);
+		ensure_equals(cpus[6], 11u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("parseCpuList() rejects malformed lists");
+		ensure("(1)", !CpuTopology::parseCpuList("a", cpus));
+		ensure("(2)", !CpuTopology::parseCpuList("3-1", cpus));
+		ensure("(3)", !CpuTopology::parseCpuList("1,,2", cpus));
+		ensure("(4)", !CpuTopology::parseCpuList("1 2", cpus));
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("parseCpuList() accepts the empty list of memory-only nodes");
+		cpus.push_back(1);
+		ensure(CpuTopology::parseCpuList("\n", cpus));
+		ensure(cpus.empty());
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("formatCpuList() collapses consecutive CPUs into ranges");
+		ensure(CpuTopology::parseCpuList("8,0-3,10,11", cpus));
+		ensure_equals(CpuTopology::formatCpuList(cpus), "0-3,8,10-11");
+		ensure_equals(CpuTopology::formatCpuList(range(5, 6)), "5");
+	}
+
+	/***** Detection *****/
+
+	TEST_METHOD(5) {
+		set_test_name("detect() reads the nodes from sysfs, sorted by node number");
+		createNode("node1", "4-7");
+		createNode("node0", "0-3");
+		createNode("possible", "0");
+		CpuTopology topology = CpuTopology::detect("tmp.topology", range(0, 8));
+		ensure_equals(topology.getNodeCount(), 2u);
+		ensure_equals(topology.getNode(0).id, 0u);
+		ensure_equals(CpuTopology::formatCpuList(topology.getNode(0).cpus), "0-3");
+		ensure_equals(topology.getNode(1).id, 1u);
+		ensure_equals(CpuTopology::formatCpuList(topology.getNode(1).cpus), "4-7");
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("detect() leaves out CPUs and nodes that the process may not use");
+		createNode("node0", "0-3");
+		createNode("node1", "4-7");
+		createNode("node2", "8-11");
+		createNode("node3", "");
+		CpuTopology topology = CpuTopology::detect("tmp.topology", range(2, 8));
+		ensure_equals(topology.getNodeCount(), 2u);
+		ensure_equals(CpuTopology::formatCpuList(topology.getNode(0).cpus), "2-3");
+		ensure_equals(CpuTopology::formatCpuList(topology.getNode(1).cpus), "4-7");
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("detect() falls back to a single node if sysfs has no NUMA information");
+		CpuTopology topology = CpuTopology::detect("tmp.topology/nonexistant", range(0, 4));
+		ensure_equals(topology.getNodeCount(), 1u);
+		ensure_equals(CpuTopology::formatCpuList(topology.getNode(0).cpus), "0-3");
+	}
+
+	#ifdef __linux__
+		TEST_METHOD(8) {
+			set_test_name("setProcessAffinity() binds all threads of a process if asked to");
+			vector<unsigned int> allowedCpus, target;
+			ensure(CpuTopology::parseCpuList(getThreadAffinity(getpid()), allowedCpus));
+			target.push_back(allowedCpus.back());
+
+			threadId = 0;
+			threadDone = false;
+			boost::thread thread(boost::bind(&SystemTools_CpuTopologyTest::threadMain, this));
+			{
+				boost::unique_lock<boost::mutex> l(threadSyncher);
+				while (threadId == 0) {
+					threadCond.wait(l);
+				}
+			}
+
+			ensure_equals("(1)", CpuTopology::setProcessAffinity(0, target, true), 0);
+			string mainAffinity = getThreadAffinity(getpid());
+			string threadAffinity = getThreadAffinity(threadId);
+			ensure_equals("(2)", CpuTopology::setProcessAffinity(0, allowedCpus, true), 0);
+			{
+				boost::lock_guard<boost::mutex> l(threadSyncher);
+				threadDone = true;
+				threadCond.notify_all();
+			}
+			thread.join();
+
+			ensure_equals("(3)", mainAffinity, CpuTopology::formatCpuList(target));
+			ensure_equals("(4)", threadAffinity, CpuTopology::formatCpuList(target));
+			ensure_equals("(5)", getThreadAffinity(getpid()),
+				CpuTopology::formatCpuList(allowedCpus));
+		}
+	#endif
+
+	/***** Thread placement *****/
+
+	TEST_METHOD(10) {
+		set_test_name("getThreadPlacement() spreads threads over nodes, then over CPUs");
+		createNode("node0", "0-1");
+		createNode("node1", "2-3");
+		CpuTopology topology = CpuTopology::detect("tmp.topology", range(0, 4));
+		unsigned int node, cpu;
+
+		topology.getThreadPlacement(0, node, cpu);
+		ensure_equals("(1)", node, 0u);
+		ensure_equals("(2)", cpu, 0u);
+		topology.getThreadPlacement(1, node, cpu);
+		ensure_equals("(3)", node, 1u);
+		ensure_equals("(4)", cpu, 2u);
+		topology.getThreadPlacement(2, node, cpu);
+		ensure_equals("(5)", node, 0u);
+		ensure_equals("(6)", cpu, 1u);
+		topology.getThreadPlacement(5, node, cpu);
+		ensure_equals("(7)", node, 1u);
+		ensure_equals("(8)", cpu, 2u);
+	}
+}
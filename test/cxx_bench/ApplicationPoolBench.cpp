@@ -0,0 +1,140 @@
+#include <BenchSupport.h>
+#include <boost/make_shared.hpp>
+#include <Shared/Fundamentals/Initialization.h>
+#include <Core/ApplicationPool/Pool.h>
+#include <Core/SpawningKit/Factory.h>
+#include <SystemTools/SystemTime.h>
+#include <Utils.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Bench;
+using namespace Passenger::ApplicationPool2;
+
+namespace {
+	/**
+	 * A pool with a single dummy-spawned process, set up the same way
+	 * test/cxx/Core/ApplicationPool/PoolTest.cpp does. Every checkout
+	 * below is served immediately by that process, so the numbers reflect
+	 * the cost of the checkout path itself rather than of spawning.
+	 */
+	struct PoolFixture {
+		WrapperRegistry::Registry wrapperRegistry;
+		SpawningKit::Context::Schema skContextSchema;
+		SpawningKit::Context skContext;
+		Context context;
+		PoolPtr pool;
+		Options options;
+		GetCallback callback;
+		AbstractSessionPtr session;
+
+		PoolFixture()
+			: skContext(skContextSchema)
+		{
+			wrapperRegistry.finalize();
+			skContext.resourceLocator = Agent::Fundamentals::context->resourceLocator;
+			skContext.wrapperRegistry = &wrapperRegistry;
+			skContext.integrationMode = "standalone";
+			skContext.spawnDir = getSystemTempDir();
+			skContext.finalize();
+			context.spawningKitFactory = boost::make_shared<SpawningKit::Factory>(&skContext);
+			context.finalize();
+			pool = boost::make_shared<Pool>(&context);
+			pool->initialize();
+
+			options.spawnMethod = "dummy";
+			options.appRoot = "stub/rack";
+			options.appType = "ruby";
+			options.appStartCommand = "ruby start.rb";
+			options.startupFile = "start.rb";
+			options.loadShellEnvvars = false;
+			// Like the Controller's per-app-group option caches: persisted
+			// once and then shared by every request.
+			options = options.copyAndPersist();
+			options.ownedByCaller = true;
+
+			callback.func = checkedOut;
+			callback.userData = this;
+
+			// Spawn the process up front.
+			Ticket ticket;
+			pool->get(options, &ticket).reset();
+		}
+
+		~PoolFixture() {
+			session.reset();
+			pool->destroy();
+			pool.reset();
+		}
+
+		static void checkedOut(const AbstractSessionPtr &session, const ExceptionPtr &e,
+			void *userData)
+		{
+			PoolFixture *self = static_cast<PoolFixture *>(userData);
+			if (e != NULL) {
+				rethrowException(e);
+			}
+			self->session = session;
+		}
+	};
+}
+
+
+/***** ApplicationPool2::Pool checkout *****/
+
+// What every request paid before the Controller started sharing the
+// per-app-group Options: an assignment of the whole Options struct.
+BENCHMARK(PoolCheckout, CopyOptions) {
+	PoolFixture fixture;
+	Options reqOptions;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		reqOptions = fixture.options;
+		doNotOptimize(reqOptions);
+	}
+	state.stop();
+}
+
+// The old checkout: copy the Options into the request, then check out
+// a session using that copy.
+BENCHMARK(PoolCheckout, AsyncGetWithCopiedOptions) {
+	PoolFixture fixture;
+	Options reqOptions;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		reqOptions = fixture.options;
+		reqOptions.currentTime = SystemTime::getUsec();
+		fixture.pool->asyncGet(reqOptions, fixture.callback);
+		fixture.session.reset();
+	}
+	state.stop();
+}
+
+// The Controller's checkout: shared Options, with the checkout time read
+// before the pool lock is taken.
+BENCHMARK(PoolCheckout, AsyncGetWithSharedOptions) {
+	PoolFixture fixture;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.pool->asyncGet(fixture.options, fixture.callback, true,
+			SystemTime::getUsec());
+		fixture.session.reset();
+	}
+	state.stop();
+}
+
+// Shared Options without a checkout time, so that the pool has to read
+// the clock itself while holding the lock.
+BENCHMARK(PoolCheckout, AsyncGetWithSharedOptionsNoTime) {
+	PoolFixture fixture;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.pool->asyncGet(fixture.options, fixture.callback);
+		fixture.session.reset();
+	}
+	state.stop();
+}
@@ -0,0 +1,109 @@
+#include <BenchSupport.h>
+#include <FileTools/FileManip.h>
+#include <StrIntTools/StrIntUtils.h>
+#include <Utils.h>
+
+namespace Passenger {
+namespace Bench {
+
+
+vector<Benchmark> &
+getBenchmarks() {
+	// Function-local so that registrars in other translation units
+	// can safely use it during static initialization.
+	static vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+string
+StubHttpRequest::toHttp() const {
+	string result = method + " " + uri + " HTTP/1.1\r\n";
+	vector< pair<string, string> >::const_iterator it, end = headers.end();
+
+	for (it = headers.begin(); it != end; it++) {
+		result.append(it->first);
+		result.append(": ");
+		result.append(it->second);
+		result.append("\r\n");
+	}
+	result.append("\r\n");
+	return result;
+}
+
+static string
+unquoteYamlValue(const StaticString &value) {
+	if (value.size() < 2 || value[0] != '"' || value[value.size() - 1] != '"') {
+		return value;
+	}
+
+	string result;
+	for (string::size_type i = 1; i < value.size() - 1; i++) {
+		if (value[i] == '\\' && i + 1 < value.size() - 1) {
+			i++;
+		}
+		result.append(1, value[i]);
+	}
+	return result;
+}
+
+/**
+ * Converts a CGI variable name like HTTP_ACCEPT_ENCODING to a header name
+ * like Accept-Encoding.
+ */
+static string
+cgiNameToHeaderName(const StaticString &name) {
+	string result;
+	bool startOfWord = true;
+
+	for (string::size_type i = 0; i < name.size(); i++) {
+		if (name[i] == '_') {
+			result.append(1, '-');
+			startOfWord = true;
+		} else if (startOfWord) {
+			result.append(1, name[i]);
+			startOfWord = false;
+		} else {
+			result.append(1, (char) tolower(name[i]));
+		}
+	}
+	return result;
+}
+
+static StubHttpRequest
+loadStubHttpRequest() {
+	StubHttpRequest result;
+	vector<string> lines;
+	vector<string>::const_iterator it;
+
+	split(unsafeReadFile("stub/http_request.yml"), '\n', lines);
+	for (it = lines.begin(); it != lines.end(); it++) {
+		string::size_type pos = it->find(": ");
+		if (pos == string::npos) {
+			continue;
+		}
+
+		StaticString name(it->data(), pos);
+		string value = unquoteYamlValue(strip(it->substr(pos + 2)));
+		if (startsWith(name, "HTTP_")) {
+			result.headers.push_back(make_pair(
+				cgiNameToHeaderName(name.substr(sizeof("HTTP_") - 1)),
+				value));
+		} else if (name == "REQUEST_METHOD") {
+			result.method = value;
+		} else if (name == "REQUEST_URI") {
+			result.uri = value;
+		}
+	}
+
+	return result;
+}
+
+const StubHttpRequest &
+getStubHttpRequest() {
+	static StubHttpRequest request = loadStubHttpRequest();
+	return request;
+}
+
+
+} // namespace Bench
+} // namespace Passenger
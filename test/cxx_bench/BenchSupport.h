@@ -0,0 +1,144 @@
+#ifndef _BENCH_SUPPORT_H_
+#define _BENCH_SUPPORT_H_
+
+/*
+ * Microbenchmark support. A benchmark is defined with
+ *
+ *     BENCHMARK(GroupName, BenchmarkName) {
+ *         ...setup...
+ *         state.start();
+ *         for (unsigned long long i = 0; i < state.iterations; i++) {
+ *             ...code to measure...
+ *         }
+ *         state.stop();
+ *     }
+ *
+ * The runner in CxxBenchMain.cpp calls the function repeatedly with
+ * increasing iteration counts until one run takes long enough to be
+ * measured reliably, and then collects a number of samples from which
+ * it reports statistics.
+ */
+
+#include <boost/cstdint.hpp>
+#include <string>
+#include <vector>
+#include <utility>
+#include <time.h>
+
+namespace Passenger {
+namespace Bench {
+
+using namespace std;
+
+
+inline boost::uint64_t
+monotonicNsec() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (boost::uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * Prevents the compiler from optimizing away the computation of `value`.
+ */
+template<typename T>
+inline void
+doNotOptimize(const T &value) {
+	__asm__ __volatile__("" : : "g"(&value) : "memory");
+}
+
+
+class State {
+private:
+	boost::uint64_t startTime;
+	boost::uint64_t elapsed;
+	boost::uint64_t bytesPerIteration;
+
+public:
+	const unsigned long long iterations;
+
+	State(unsigned long long _iterations)
+		: startTime(0),
+		  elapsed(0),
+		  bytesPerIteration(0),
+		  iterations(_iterations)
+		{ }
+
+	void start() {
+		startTime = monotonicNsec();
+	}
+
+	void stop() {
+		elapsed += monotonicNsec() - startTime;
+	}
+
+	/**
+	 * Declares how many bytes of input one iteration processes, so that
+	 * throughput is reported in addition to time per iteration.
+	 */
+	void setBytesPerIteration(boost::uint64_t bytes) {
+		bytesPerIteration = bytes;
+	}
+
+	boost::uint64_t getElapsedNsec() const {
+		return elapsed;
+	}
+
+	boost::uint64_t getBytesPerIteration() const {
+		return bytesPerIteration;
+	}
+};
+
+typedef void (*BenchmarkFunction)(State &state);
+
+struct Benchmark {
+	const char *group;
+	const char *name;
+	BenchmarkFunction function;
+
+	string getFullName() const {
+		return string(group) + "." + name;
+	}
+};
+
+vector<Benchmark> &getBenchmarks();
+
+struct BenchmarkRegistrar {
+	BenchmarkRegistrar(const char *group, const char *name, BenchmarkFunction function) {
+		Benchmark benchmark;
+		benchmark.group = group;
+		benchmark.name = name;
+		benchmark.function = function;
+		getBenchmarks().push_back(benchmark);
+	}
+};
+
+#define BENCHMARK(group, name) \
+	static void _benchmark_ ## group ## _ ## name(Passenger::Bench::State &state); \
+	static Passenger::Bench::BenchmarkRegistrar _benchmarkRegistrar_ ## group ## _ ## name( \
+		#group, #name, _benchmark_ ## group ## _ ## name); \
+	static void _benchmark_ ## group ## _ ## name(Passenger::Bench::State &state)
+
+
+/****** Repeatable inputs ******/
+
+struct StubHttpRequest {
+	string method;
+	string uri;
+	vector< pair<string, string> > headers;
+
+	/** Serializes the request in HTTP/1.1 format. */
+	string toHttp() const;
+};
+
+/**
+ * Loads test/stub/http_request.yml, which is in CGI environment format,
+ * and converts it to an HTTP request.
+ */
+const StubHttpRequest &getStubHttpRequest();
+
+
+} // namespace Bench
+} // namespace Passenger
+
+#endif /* _BENCH_SUPPORT_H_ */
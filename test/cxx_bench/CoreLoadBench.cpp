@@ -0,0 +1,877 @@
+/*
+ * End-to-end load benchmark for the Core.
+ *
+ * Boots Controllers and an application Pool in-process, the same way
+ * CoreMain.cpp does, but with a spawner that launches bench_stub_app
+ * (StubApp.cpp) instead of a real application. A built-in load generator
+ * then sends requests over a Unix domain socket and measures throughput and
+ * latency, while the Controllers' per-phase latency histograms show where
+ * the time inside the Core went.
+ *
+ * Every combination of the requested controller thread counts and app
+ * socket types is measured with a freshly booted Core.
+ */
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#include <limits.h>
+
+#include <Shared/Fundamentals/Initialization.h>
+#include <BackgroundEventLoop.h>
+#include <ServerKit/Server.h>
+#include <ServerKit/AcceptLoadBalancer.h>
+#include <Core/Controller.h>
+#include <Core/ApplicationPool/Pool.h>
+#include <Core/SpawningKit/Factory.h>
+#include <Core/SpawningKit/Spawner.h>
+#include <WrapperRegistry/Registry.h>
+#include <Algorithms/LatencyHistogram.h>
+#include <ConfigKit/ConfigKit.h>
+#include <LoggingKit/LoggingKit.h>
+#include <FileDescriptor.h>
+#include <FileTools/FileManip.h>
+#include <FileTools/PathManip.h>
+#include <IOTools/IOUtils.h>
+#include <ProcessManagement/Utils.h>
+#include <StrIntTools/StrIntUtils.h>
+#include <SystemTools/SystemTime.h>
+#include <jsoncpp/json.h>
+
+using namespace std;
+using namespace boost;
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace Passenger::ApplicationPool2;
+
+
+/****** Configuration ******/
+
+static unsigned int clientConcurrency = 16;
+static unsigned int durationSec = 5;
+static unsigned int warmupSec = 1;
+/** Total request rate for the open-loop mode. 0 means closed-loop. */
+static unsigned int requestRate = 0;
+static vector<unsigned int> controllerThreadCounts;
+static vector<string> appSocketTypes;
+static string appProtocol = "session";
+static unsigned int appProcesses = 2;
+static unsigned int appConcurrency = 0;
+static unsigned int responseBodySize = 128;
+static unsigned int appDelayUsec = 0;
+static string stubAppPath;
+static string jsonOutputPath;
+static string passengerRoot;
+static string logLevel = "warn";
+
+
+/****** Stub app spawner ******/
+
+/**
+ * Like DummySpawner, but launches a real bench_stub_app process that
+ * listens on a socket created by the spawner. Because the socket is
+ * already listening when the process starts, no handshake is necessary.
+ */
+class StubAppSpawner: public SpawningKit::Spawner {
+private:
+	string socketType;
+	string workDir;
+	boost::atomic<unsigned int> count;
+	boost::mutex syncher;
+	vector<pid_t> pids;
+
+	int createServer(unsigned int number, string &address) {
+		if (socketType == "unix") {
+			string path = workDir + "/app." + toString(number) + ".sock";
+			address = "unix:" + path;
+			return createUnixServer(path, 1024, true, __FILE__, __LINE__);
+		} else {
+			int fd = createTcpServer("127.0.0.1", 0, 1024, __FILE__, __LINE__);
+			struct sockaddr_in addr;
+			socklen_t len = sizeof(addr);
+			if (getsockname(fd, (struct sockaddr *) &addr, &len) == -1) {
+				int e = errno;
+				safelyClose(fd);
+				throw SystemException("Cannot query the stub app's TCP port", e);
+			}
+			address = "tcp://127.0.0.1:" + toString(ntohs(addr.sin_port));
+			return fd;
+		}
+	}
+
+public:
+	StubAppSpawner(SpawningKit::Context *context, const string &_socketType,
+		const string &_workDir)
+		: Spawner(context),
+		  socketType(_socketType),
+		  workDir(_workDir),
+		  count(1)
+		{ }
+
+	virtual SpawningKit::Result spawn(const SpawningKit::AppPoolOptions &options) {
+		TRACE_POINT();
+		SpawningKit::Config config;
+		Json::Value extraArgs;
+		setConfigFromAppPoolOptions(&config, extraArgs, options);
+
+		unsigned int number = count.fetch_add(1, boost::memory_order_relaxed);
+		SpawningKit::Result result;
+		SpawningKit::Result::Socket socket;
+		string address;
+		FileDescriptor serverFd(createServer(number, address), __FILE__, __LINE__);
+
+		result.initialize(*context, &config);
+
+		// Prepare everything before forking so that the child
+		// only has to call async-signal-safe functions.
+		string bodySize = toString(responseBodySize);
+		string delay = toString(appDelayUsec);
+		pid_t pid = syscalls::fork();
+		if (pid == 0) {
+			resetSignalHandlersAndMask();
+			dup2(serverFd, 3);
+			closeAllFileDescriptors(3);
+			execl(stubAppPath.c_str(), stubAppPath.c_str(),
+				"--fd", "3",
+				"--protocol", appProtocol.c_str(),
+				"--body-size", bodySize.c_str(),
+				"--delay-usec", delay.c_str(),
+				(char *) 0);
+			int e = errno;
+			fprintf(stderr, "Cannot execute %s: %s (errno=%d)\n",
+				stubAppPath.c_str(), strerror(e), e);
+			_exit(1);
+		} else if (pid == -1) {
+			int e = errno;
+			throw SystemException("Cannot fork a new process", e);
+		}
+
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			pids.push_back(pid);
+		}
+
+		socket.address = address;
+		socket.protocol = appProtocol;
+		socket.concurrency = appConcurrency;
+		socket.acceptHttpRequests = true;
+
+		result.pid = pid;
+		result.type = SpawningKit::Result::GENERIC;
+		result.spawnEndTime = SystemTime::getUsec();
+		result.spawnEndTimeMonotonic = SystemTime::getMonotonicUsec();
+		result.sockets.push_back(socket);
+
+		vector<StaticString> internalFieldErrors;
+		vector<StaticString> appSuppliedFieldErrors;
+		if (!result.validate(internalFieldErrors, appSuppliedFieldErrors)) {
+			throw RuntimeException("Invalid stub app spawn result: "
+				+ toString(internalFieldErrors) + ", "
+				+ toString(appSuppliedFieldErrors));
+		}
+		return result;
+	}
+
+	virtual bool cleanable() const {
+		return true;
+	}
+
+	/** Kills and reaps all stub app processes that are still around. */
+	void killAll() {
+		boost::lock_guard<boost::mutex> l(syncher);
+		vector<pid_t>::const_iterator it;
+
+		for (it = pids.begin(); it != pids.end(); it++) {
+			syscalls::kill(*it, SIGKILL);
+			syscalls::waitpid(*it, NULL, 0);
+		}
+		pids.clear();
+	}
+};
+
+typedef boost::shared_ptr<StubAppSpawner> StubAppSpawnerPtr;
+
+class StubAppFactory: public SpawningKit::Factory {
+public:
+	StubAppSpawnerPtr spawner;
+
+	StubAppFactory(SpawningKit::Context *context, const string &socketType,
+		const string &workDir)
+		: SpawningKit::Factory(context),
+		  spawner(boost::make_shared<StubAppSpawner>(context, socketType, workDir))
+		{ }
+
+	virtual SpawningKit::SpawnerPtr create(const SpawningKit::AppPoolOptions &options) {
+		return spawner;
+	}
+};
+
+
+/****** In-process Core ******/
+
+/**
+ * Controllers, event loops and an application pool, set up like
+ * initializeNonPrivilegedWorkingObjects() in CoreMain.cpp.
+ */
+class CoreInstance {
+private:
+	struct ThreadWorkingObjects {
+		BackgroundEventLoop *bgloop;
+		ServerKit::Context *serverKitContext;
+		Controller *controller;
+	};
+
+	WrapperRegistry::Registry wrapperRegistry;
+	ServerKit::Schema serverKitSchema;
+	ControllerSchema controllerSchema;
+	ControllerSingleAppModeSchema singleAppModeSchema;
+	Json::Value singleAppModeConfig;
+	SpawningKit::Context::Schema spawningKitContextSchema;
+	SpawningKit::Context spawningKitContext;
+	boost::shared_ptr<StubAppFactory> factory;
+	ApplicationPool2::Context appPoolContext;
+	ServerKit::AcceptLoadBalancer<Controller> loadBalancer;
+	vector<ThreadWorkingObjects> threadWorkingObjects;
+	int serverFd;
+
+	static void deleteController(Controller *controller) {
+		delete controller;
+	}
+
+	static void getServerState(Controller *controller, Controller::State *state) {
+		*state = controller->serverState;
+	}
+
+	static void getLatencyStatsSnapshot(Controller *controller,
+		LatencyStats::Snapshot *snapshot)
+	{
+		*snapshot = controller->getLatencyStatsSnapshot();
+	}
+
+public:
+	PoolPtr appPool;
+	const string serverAddress;
+
+	CoreInstance(ResourceLocator *resourceLocator, const string &workDir,
+		const string &appSocketType, unsigned int nthreads)
+		: singleAppModeSchema(&wrapperRegistry),
+		  spawningKitContext(spawningKitContextSchema),
+		  serverFd(-1),
+		  serverAddress(workDir + "/core.sock")
+	{
+		wrapperRegistry.finalize();
+
+		singleAppModeConfig["app_root"] = "stub/rack";
+		singleAppModeConfig["app_type"] = "rack";
+		singleAppModeConfig["startup_file"] = "none";
+
+		spawningKitContext.resourceLocator = resourceLocator;
+		spawningKitContext.wrapperRegistry = &wrapperRegistry;
+		spawningKitContext.integrationMode = "standalone";
+		spawningKitContext.finalize();
+
+		factory = boost::make_shared<StubAppFactory>(&spawningKitContext,
+			appSocketType, workDir);
+		appPoolContext.spawningKitFactory = factory;
+		appPoolContext.finalize();
+		appPool = boost::make_shared<Pool>(&appPoolContext);
+		appPool->initialize();
+		appPool->setMax(appProcesses);
+
+		serverFd = createUnixServer(serverAddress, 1024, true, __FILE__, __LINE__);
+
+		for (unsigned int i = 0; i < nthreads; i++) {
+			ThreadWorkingObjects two;
+			Json::Value controllerConfig;
+
+			controllerConfig["thread_number"] = i + 1;
+			controllerConfig["multi_app"] = false;
+			controllerConfig["default_server_name"] = "localhost";
+			controllerConfig["default_server_port"] = 80;
+			controllerConfig["user_switching"] = false;
+			controllerConfig["default_min_instances"] = appProcesses;
+			controllerConfig["default_max_request_queue_size"] = 0;
+
+			two.bgloop = new BackgroundEventLoop(true, true);
+			two.serverKitContext = new ServerKit::Context(serverKitSchema);
+			two.serverKitContext->libev = two.bgloop->safe;
+			two.serverKitContext->libuv = two.bgloop->libuv_loop;
+			two.serverKitContext->initialize();
+
+			two.controller = new Controller(two.serverKitContext,
+				controllerSchema, controllerConfig, ConfigKit::DummyTranslator(),
+				&singleAppModeSchema, &singleAppModeConfig,
+				ConfigKit::DummyTranslator());
+			two.controller->resourceLocator = resourceLocator;
+			two.controller->wrapperRegistry = &wrapperRegistry;
+			two.controller->appPool = appPool;
+			two.controller->initialize();
+			threadWorkingObjects.push_back(two);
+		}
+
+		if (nthreads == 1) {
+			threadWorkingObjects[0].controller->listen(serverFd);
+		} else {
+			loadBalancer.listen(serverFd);
+			for (unsigned int i = 0; i < nthreads; i++) {
+				loadBalancer.servers.push_back(threadWorkingObjects[i].controller);
+			}
+		}
+		for (unsigned int i = 0; i < nthreads; i++) {
+			threadWorkingObjects[i].controller->createSpareClients();
+			threadWorkingObjects[i].bgloop->start("Main event loop: thread "
+				+ toString(i + 1), 0);
+		}
+		if (nthreads > 1) {
+			loadBalancer.start();
+		}
+	}
+
+	~CoreInstance() {
+		vector<ThreadWorkingObjects>::iterator it, end = threadWorkingObjects.end();
+
+		if (threadWorkingObjects.size() > 1) {
+			loadBalancer.shutdown();
+		}
+		appPool->prepareForShutdown();
+
+		for (it = threadWorkingObjects.begin(); it != end; it++) {
+			it->bgloop->safe->runSync(boost::bind(&Controller::shutdown,
+				it->controller, true));
+		}
+		for (it = threadWorkingObjects.begin(); it != end; it++) {
+			Controller::State state;
+			do {
+				it->bgloop->safe->runSync(boost::bind(getServerState,
+					it->controller, &state));
+				if (state != Controller::FINISHED_SHUTDOWN) {
+					syscalls::usleep(10000);
+				}
+			} while (state != Controller::FINISHED_SHUTDOWN);
+			it->bgloop->safe->runSync(boost::bind(deleteController, it->controller));
+			it->bgloop->stop();
+			delete it->serverKitContext;
+			delete it->bgloop;
+		}
+
+		appPool->destroy();
+		appPool.reset();
+		factory->spawner->killAll();
+		safelyClose(serverFd);
+		unlink(serverAddress.c_str());
+	}
+
+	void resetLatencyStats() {
+		vector<ThreadWorkingObjects>::iterator it, end = threadWorkingObjects.end();
+		for (it = threadWorkingObjects.begin(); it != end; it++) {
+			it->bgloop->safe->runSync(boost::bind(&Controller::resetLatencyStats,
+				it->controller));
+		}
+	}
+
+	LatencyStats::Snapshot getLatencyStatsSnapshot() {
+		vector<ThreadWorkingObjects>::iterator it, end = threadWorkingObjects.end();
+		LatencyStats::Snapshot result;
+
+		for (it = threadWorkingObjects.begin(); it != end; it++) {
+			LatencyStats::Snapshot snapshot;
+			it->bgloop->safe->runSync(boost::bind(getLatencyStatsSnapshot,
+				it->controller, &snapshot));
+			result.merge(snapshot);
+		}
+		return result;
+	}
+};
+
+
+/****** Load generator ******/
+
+struct ClientStats {
+	/** Client-observed latency in microseconds. */
+	LatencyHistogram latency;
+	unsigned long long requests;
+	unsigned long long errors;
+
+	ClientStats()
+		: requests(0),
+		  errors(0)
+		{ }
+
+	void merge(const ClientStats &other) {
+		latency.merge(other.latency);
+		requests += other.requests;
+		errors += other.errors;
+	}
+};
+
+/**
+ * Sends one request and reads the response. Returns whether a complete
+ * 200 response was received; `keepAlive` tells whether the connection
+ * can be reused.
+ */
+static bool
+performRequest(int fd, bool &keepAlive) {
+	static const StaticString request(
+		"GET /bench HTTP/1.1\r\n"
+		"Host: localhost\r\n"
+		"\r\n");
+	char buf[16 * 1024];
+	string header;
+	string::size_type headerEnd;
+	ssize_t ret;
+
+	keepAlive = false;
+	try {
+		writeExact(fd, request);
+	} catch (const SystemException &) {
+		return false;
+	}
+
+	while ((headerEnd = header.find("\r\n\r\n")) == string::npos) {
+		ret = syscalls::read(fd, buf, sizeof(buf));
+		if (ret <= 0) {
+			return false;
+		}
+		header.append(buf, ret);
+	}
+
+	unsigned long long bodyRead = header.size() - headerEnd - 4;
+	header.resize(headerEnd + 2);
+	if (!startsWith(header, "HTTP/1.1 200 ")) {
+		return false;
+	}
+
+	string lowercaseHeader = header;
+	unsigned long long contentLength = 0;
+	string::size_type pos;
+	for (pos = 0; pos < lowercaseHeader.size(); pos++) {
+		lowercaseHeader[pos] = tolower(lowercaseHeader[pos]);
+	}
+	if ((pos = lowercaseHeader.find("\r\ncontent-length:")) == string::npos) {
+		// The stub app always sends a Content-Length, which the
+		// Controller passes through.
+		return false;
+	}
+	contentLength = stringToULL(lowercaseHeader.substr(pos
+		+ sizeof("\r\ncontent-length:") - 1));
+	keepAlive = lowercaseHeader.find("\r\nconnection: close\r\n") == string::npos;
+
+	while (bodyRead < contentLength) {
+		ret = syscalls::read(fd, buf, std::min<unsigned long long>(sizeof(buf),
+			contentLength - bodyRead));
+		if (ret <= 0) {
+			keepAlive = false;
+			return false;
+		}
+		bodyRead += ret;
+	}
+	return true;
+}
+
+/**
+ * In closed-loop mode every client sends its next request as soon as it has
+ * received the previous response. In open-loop mode every client sends
+ * requests according to a fixed schedule, and latency is measured from the
+ * time at which a request was scheduled to be sent. That way the latency
+ * includes the time that a request would have waited behind a slow one,
+ * which closed-loop measurements hide.
+ */
+static void
+clientThreadMain(const string &serverAddress, unsigned int clientNumber,
+	MonotonicTimeUsec startTime, MonotonicTimeUsec endTime, ClientStats *stats)
+{
+	FileDescriptor connection;
+	double interval = 0;
+	unsigned long long i = 0;
+
+	if (requestRate > 0) {
+		interval = 1000000.0 * clientConcurrency / requestRate;
+	}
+
+	while (!boost::this_thread::interruption_requested()) {
+		MonotonicTimeUsec now = SystemTime::getMonotonicUsec();
+		MonotonicTimeUsec scheduledTime;
+
+		if (interval > 0) {
+			// Stagger the clients so that they do not send in bursts.
+			scheduledTime = startTime + (MonotonicTimeUsec)
+				((i + (double) clientNumber / clientConcurrency) * interval);
+			if (scheduledTime >= endTime) {
+				break;
+			}
+			if (scheduledTime > now) {
+				syscalls::usleep(scheduledTime - now);
+			}
+		} else {
+			if (now >= endTime) {
+				break;
+			}
+			scheduledTime = now;
+		}
+		i++;
+
+		if (connection == -1) {
+			try {
+				connection.assign(connectToUnixServer(serverAddress, __FILE__, __LINE__),
+					__FILE__, __LINE__);
+			} catch (const SystemException &) {
+				stats->errors++;
+				continue;
+			}
+			struct timeval timeout = { 10, 0 };
+			setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		}
+
+		bool keepAlive;
+		if (performRequest(connection, keepAlive)) {
+			stats->latency.record(SystemTime::getMonotonicUsec() - scheduledTime);
+			stats->requests++;
+		} else {
+			stats->errors++;
+		}
+		if (!keepAlive) {
+			connection.close();
+		}
+	}
+}
+
+static ClientStats
+generateLoad(const string &serverAddress, unsigned int seconds) {
+	vector<ClientStats> stats(clientConcurrency);
+	vector<oxt::thread *> threads;
+	MonotonicTimeUsec startTime = SystemTime::getMonotonicUsec();
+	MonotonicTimeUsec endTime = startTime + seconds * 1000000ull;
+	ClientStats result;
+	unsigned int i;
+
+	for (i = 0; i < clientConcurrency; i++) {
+		threads.push_back(new oxt::thread(boost::bind(clientThreadMain,
+			serverAddress, i, startTime, endTime, &stats[i]),
+			"Load generator client " + toString(i + 1), 256 * 1024));
+	}
+	for (i = 0; i < clientConcurrency; i++) {
+		threads[i]->join();
+		delete threads[i];
+		result.merge(stats[i]);
+	}
+	return result;
+}
+
+
+/****** Reporting ******/
+
+struct RunResult {
+	string appSocketType;
+	unsigned int controllerThreads;
+	double elapsedSec;
+	ClientStats clientStats;
+	LatencyStats::Snapshot phaseStats;
+};
+
+static void
+printHistogramRow(const char *name, const LatencyHistogram &histogram) {
+	printf("  %-18s %10llu %10llu %10llu %10llu %10llu %10llu\n", name,
+		(unsigned long long) histogram.getCount(),
+		(unsigned long long) histogram.valueAtPercentile(50),
+		(unsigned long long) histogram.valueAtPercentile(90),
+		(unsigned long long) histogram.valueAtPercentile(99),
+		(unsigned long long) histogram.valueAtPercentile(99.9),
+		(unsigned long long) histogram.getMax());
+}
+
+static void
+printRunResult(const RunResult &result) {
+	const ClientStats &stats = result.clientStats;
+
+	printf("%s app sockets, %u controller thread(s):\n",
+		result.appSocketType.c_str(), result.controllerThreads);
+	printf("  %llu requests in %.2f sec: %.1f req/sec, %llu errors\n",
+		stats.requests, result.elapsedSec, stats.requests / result.elapsedSec,
+		stats.errors);
+	printf("  %-18s %10s %10s %10s %10s %10s %10s\n", "Latency (usec)",
+		"Count", "p50", "p90", "p99", "p99.9", "Max");
+	printHistogramRow("client", stats.latency);
+	for (unsigned int i = 0; i < LatencyStats::PHASE_COUNT; i++) {
+		printHistogramRow(LatencyStats::getPhaseName((LatencyStats::Phase) i),
+			result.phaseStats.total.histograms[i]);
+	}
+	printf("\n");
+	fflush(stdout);
+}
+
+static Json::Value
+histogramToJson(const LatencyHistogram &histogram) {
+	Json::Value doc;
+	doc["count"] = (Json::UInt64) histogram.getCount();
+	doc["p50_usec"] = (Json::UInt64) histogram.valueAtPercentile(50);
+	doc["p90_usec"] = (Json::UInt64) histogram.valueAtPercentile(90);
+	doc["p99_usec"] = (Json::UInt64) histogram.valueAtPercentile(99);
+	doc["p999_usec"] = (Json::UInt64) histogram.valueAtPercentile(99.9);
+	doc["max_usec"] = (Json::UInt64) histogram.getMax();
+	return doc;
+}
+
+static Json::Value
+resultsToJson(const vector<RunResult> &results) {
+	Json::Value doc;
+	Json::Value runs(Json::arrayValue);
+
+	doc["timestamp"] = (Json::UInt64) time(NULL);
+	doc["client_concurrency"] = clientConcurrency;
+	doc["duration_sec"] = durationSec;
+	doc["mode"] = (requestRate > 0) ? "open_loop" : "closed_loop";
+	if (requestRate > 0) {
+		doc["request_rate"] = requestRate;
+	}
+	doc["app_protocol"] = appProtocol;
+	doc["app_processes"] = appProcesses;
+	doc["app_concurrency"] = appConcurrency;
+	doc["response_body_size"] = responseBodySize;
+	doc["app_delay_usec"] = appDelayUsec;
+
+	for (unsigned int i = 0; i < results.size(); i++) {
+		const RunResult &result = results[i];
+		Json::Value run;
+
+		run["app_socket_type"] = result.appSocketType;
+		run["controller_threads"] = result.controllerThreads;
+		run["elapsed_sec"] = result.elapsedSec;
+		run["requests"] = (Json::UInt64) result.clientStats.requests;
+		run["errors"] = (Json::UInt64) result.clientStats.errors;
+		run["requests_per_sec"] = result.clientStats.requests / result.elapsedSec;
+		run["client_latency"] = histogramToJson(result.clientStats.latency);
+		run["phases"] = result.phaseStats.inspectAsJson()["total"];
+		runs.append(run);
+	}
+
+	doc["runs"] = runs;
+	return doc;
+}
+
+
+/****** Main ******/
+
+static RunResult
+runBenchmark(ResourceLocator *resourceLocator, const string &workDir,
+	const string &appSocketType, unsigned int controllerThreads)
+{
+	CoreInstance core(resourceLocator, workDir, appSocketType, controllerThreads);
+	RunResult result;
+
+	// Warm up until all app processes have been spawned, so that
+	// spawning does not show up in the measurements.
+	MonotonicTimeUsec deadline = SystemTime::getMonotonicUsec() + 30 * 1000000ull;
+	do {
+		generateLoad(core.serverAddress, warmupSec);
+	} while (core.appPool->getProcessCount() < appProcesses
+		&& SystemTime::getMonotonicUsec() < deadline);
+	core.resetLatencyStats();
+
+	MonotonicTimeUsec startTime = SystemTime::getMonotonicUsec();
+	result.clientStats = generateLoad(core.serverAddress, durationSec);
+	result.elapsedSec = (SystemTime::getMonotonicUsec() - startTime) / 1000000.0;
+	result.appSocketType = appSocketType;
+	result.controllerThreads = controllerThreads;
+	result.phaseStats = core.getLatencyStatsSnapshot();
+	return result;
+}
+
+static void
+usage(int exitCode) {
+	printf("Usage: ./core_load_bench [options]\n");
+	printf("Runs an end-to-end load benchmark against an in-process Core.\n");
+	printf("Must be run from the 'test' directory.\n\n");
+	printf("Options:\n");
+	printf("  -c CLIENTS      Number of concurrent client connections (default: %u).\n",
+		clientConcurrency);
+	printf("  -d SECONDS      Duration of each measurement (default: %u).\n", durationSec);
+	printf("  -w SECONDS      Warmup duration before each measurement (default: %u).\n",
+		warmupSec);
+	printf("  -r RATE         Send RATE requests per second in total (open-loop).\n");
+	printf("                  By default, clients send requests back-to-back (closed-loop).\n");
+	printf("  -t THREADS      Comma-separated controller_threads counts (default: 1,2).\n");
+	printf("  -s TYPES        Comma-separated app socket types: unix, tcp (default: unix,tcp).\n");
+	printf("  -P PROTOCOL     App protocol: session or http (default: %s).\n",
+		appProtocol.c_str());
+	printf("  -p PROCESSES    Number of app processes (default: %u).\n", appProcesses);
+	printf("  -a CONCURRENCY  Concurrency of each app process; 0 is unlimited (default: %u).\n",
+		appConcurrency);
+	printf("  -b BYTES        Response body size (default: %u).\n", responseBodySize);
+	printf("  -D USEC         Time that the app spends on each request (default: %u).\n",
+		appDelayUsec);
+	printf("  -A PATH         Path to bench_stub_app (default: next to this program).\n");
+	printf("  -j FILE         Also write the results as JSON to FILE.\n");
+	printf("  -l LEVEL        Log level (default: warn).\n");
+	printf("  -h              Print this usage information.\n");
+	exit(exitCode);
+}
+
+static const char *
+requireArgument(const char *argv[], int i) {
+	if (argv[i + 1] == NULL) {
+		fprintf(stderr, "*** ERROR: %s must be followed by an argument.\n", argv[i]);
+		exit(1);
+	}
+	return argv[i + 1];
+}
+
+static void
+parseUintList(const StaticString &value, vector<unsigned int> &result) {
+	vector<string> components;
+	split(value, ',', components);
+	result.clear();
+	for (unsigned int i = 0; i < components.size(); i++) {
+		result.push_back(std::max(1u, stringToUint(components[i])));
+	}
+}
+
+static void
+parseOptions(int argc, const char *argv[], ConfigKit::Store &config) {
+	Json::Value updates;
+	char path[PATH_MAX + 1];
+	getcwd(path, PATH_MAX);
+	updates["passenger_root"] = passengerRoot = extractDirName(path);
+
+	stubAppPath = absolutizePath(extractDirName(argv[0])) + "/bench_stub_app";
+	controllerThreadCounts.push_back(1);
+	controllerThreadCounts.push_back(2);
+	appSocketTypes.push_back("unix");
+	appSocketTypes.push_back("tcp");
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-h") == 0) {
+			usage(0);
+		} else if (strcmp(argv[i], "-c") == 0) {
+			clientConcurrency = std::max(1u, stringToUint(requireArgument(argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "-d") == 0) {
+			durationSec = std::max(1u, stringToUint(requireArgument(argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "-w") == 0) {
+			warmupSec = std::max(1u, stringToUint(requireArgument(argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "-r") == 0) {
+			requestRate = stringToUint(requireArgument(argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-t") == 0) {
+			parseUintList(requireArgument(argv, i), controllerThreadCounts);
+			i++;
+		} else if (strcmp(argv[i], "-s") == 0) {
+			appSocketTypes.clear();
+			split(requireArgument(argv, i), ',', appSocketTypes);
+			for (unsigned int j = 0; j < appSocketTypes.size(); j++) {
+				if (appSocketTypes[j] != "unix" && appSocketTypes[j] != "tcp") {
+					fprintf(stderr, "*** ERROR: Invalid app socket type: %s\n",
+						appSocketTypes[j].c_str());
+					exit(1);
+				}
+			}
+			i++;
+		} else if (strcmp(argv[i], "-P") == 0) {
+			appProtocol = requireArgument(argv, i);
+			if (appProtocol != "session" && appProtocol != "http") {
+				fprintf(stderr, "*** ERROR: Invalid app protocol: %s\n",
+					appProtocol.c_str());
+				exit(1);
+			}
+			i++;
+		} else if (strcmp(argv[i], "-p") == 0) {
+			appProcesses = std::max(1u, stringToUint(requireArgument(argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "-a") == 0) {
+			appConcurrency = stringToUint(requireArgument(argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-b") == 0) {
+			responseBodySize = stringToUint(requireArgument(argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-D") == 0) {
+			appDelayUsec = stringToUint(requireArgument(argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-A") == 0) {
+			stubAppPath = absolutizePath(requireArgument(argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-j") == 0) {
+			jsonOutputPath = requireArgument(argv, i);
+			i++;
+		} else if (strcmp(argv[i], "-l") == 0) {
+			logLevel = requireArgument(argv, i);
+			i++;
+		} else {
+			fprintf(stderr, "*** ERROR: Unknown option: %s\n", argv[i]);
+			fprintf(stderr, "Please pass -h for a list of valid options.\n");
+			exit(1);
+		}
+	}
+
+	vector<ConfigKit::Error> errors;
+	if (!config.update(updates, errors)) {
+		fprintf(stderr, "*** ERROR: Invalid configuration: %s\n",
+			ConfigKit::toString(errors).c_str());
+		exit(1);
+	}
+}
+
+int
+main(int argc, char *argv[]) {
+	using namespace Agent::Fundamentals;
+
+	ConfigKit::Schema *schema = new ConfigKit::Schema();
+	schema->add("passenger_root", ConfigKit::STRING_TYPE, ConfigKit::REQUIRED);
+	schema->finalize();
+	ConfigKit::Store *config = new ConfigKit::Store(*schema);
+	initializeAgent(argc, &argv, "CoreLoadBench", *config,
+		ConfigKit::DummyTranslator(), parseOptions);
+	LoggingKit::setLevel(LoggingKit::parseLevel(logLevel));
+
+	if (!fileExists(stubAppPath)) {
+		fprintf(stderr, "*** ERROR: %s does not exist.\n", stubAppPath.c_str());
+		return 1;
+	}
+
+	char workDirTemplate[] = "/tmp/passenger-core-load-bench.XXXXXX";
+	if (mkdtemp(workDirTemplate) == NULL) {
+		int e = errno;
+		fprintf(stderr, "*** ERROR: Cannot create a temporary directory: %s\n",
+			strerror(e));
+		return 1;
+	}
+	string workDir = workDirTemplate;
+
+	printf("%u clients, %s, %s protocol, %u app process(es)"
+		" with concurrency %u, %u byte responses\n\n",
+		clientConcurrency,
+		(requestRate > 0) ? ("open loop at " + toString(requestRate) + " req/sec").c_str()
+			: "closed loop",
+		appProtocol.c_str(), appProcesses, appConcurrency, responseBodySize);
+
+	vector<RunResult> results;
+	for (unsigned int i = 0; i < appSocketTypes.size(); i++) {
+		for (unsigned int j = 0; j < controllerThreadCounts.size(); j++) {
+			results.push_back(runBenchmark(context->resourceLocator, workDir,
+				appSocketTypes[i], controllerThreadCounts[j]));
+			printRunResult(results.back());
+		}
+	}
+
+	if (!jsonOutputPath.empty()) {
+		createFile(jsonOutputPath, resultsToJson(results).toStyledString());
+	}
+
+	removeDirTree(workDir);
+	shutdownAgent(schema, config);
+	return 0;
+}
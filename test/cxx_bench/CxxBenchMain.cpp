@@ -0,0 +1,303 @@
+#include <BenchSupport.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits.h>
+#include <unistd.h>
+
+#include <Shared/Fundamentals/Initialization.h>
+#include <ConfigKit/ConfigKit.h>
+#include <FileTools/FileManip.h>
+#include <FileTools/PathManip.h>
+#include <StrIntTools/StrIntUtils.h>
+#include <jsoncpp/json.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Bench;
+
+
+struct Result {
+	const Benchmark *benchmark;
+	unsigned long long iterations;
+	boost::uint64_t bytesPerIteration;
+	/** Nanoseconds per iteration, one entry per sample, sorted. */
+	vector<double> samples;
+	double min, max, mean, median, stddev;
+};
+
+/** Benchmark name prefixes that the user wants to run. Empty means all. */
+static vector<string> filters;
+static unsigned int samplesPerBenchmark = 15;
+static unsigned int minSampleTimeMsec = 20;
+static string jsonOutputPath;
+/** Where the human readable table goes. stderr if the JSON goes to stdout. */
+static FILE *tableOutput = stdout;
+
+
+static void
+usage(int exitCode) {
+	printf("Usage: ./bench [options]\n");
+	printf("Runs the microbenchmarks for the C++ components.\n\n");
+	printf("Options:\n");
+	printf("  -g NAME         Only run benchmarks whose GROUP.NAME starts with NAME.\n");
+	printf("                  You can specify -g multiple times.\n");
+	printf("  -n SAMPLES      Number of samples to take per benchmark (default: %u).\n",
+		samplesPerBenchmark);
+	printf("  -t MSEC         Minimum duration of a single sample (default: %u).\n",
+		minSampleTimeMsec);
+	printf("  -j FILE         Also write the results as JSON to FILE. Use '-' for stdout.\n");
+	printf("  -L              List all benchmarks and exit.\n");
+	printf("  -h              Print this usage information.\n");
+	exit(exitCode);
+}
+
+static void
+listBenchmarks() {
+	const vector<Benchmark> &benchmarks = getBenchmarks();
+	for (unsigned int i = 0; i < benchmarks.size(); i++) {
+		printf("%s\n", benchmarks[i].getFullName().c_str());
+	}
+	exit(0);
+}
+
+static const char *
+requireArgument(const char *argv[], int i) {
+	if (argv[i + 1] == NULL) {
+		fprintf(stderr, "*** ERROR: %s must be followed by an argument.\n", argv[i]);
+		exit(1);
+	}
+	return argv[i + 1];
+}
+
+static void
+parseOptions(int argc, const char *argv[], ConfigKit::Store &config) {
+	// Benchmarks are run from the test directory, like the unit tests. Some
+	// of them spawn (dummy) apps, which requires a ResourceLocator.
+	Json::Value updates;
+	char path[PATH_MAX + 1];
+	getcwd(path, PATH_MAX);
+	updates["passenger_root"] = extractDirName(path);
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-h") == 0) {
+			usage(0);
+		} else if (strcmp(argv[i], "-L") == 0) {
+			listBenchmarks();
+		} else if (strcmp(argv[i], "-g") == 0) {
+			filters.push_back(requireArgument(argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-n") == 0) {
+			samplesPerBenchmark = std::max(1u, stringToUint(requireArgument(argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "-t") == 0) {
+			minSampleTimeMsec = std::max(1u, stringToUint(requireArgument(argv, i)));
+			i++;
+		} else if (strcmp(argv[i], "-j") == 0) {
+			jsonOutputPath = requireArgument(argv, i);
+			i++;
+		} else {
+			fprintf(stderr, "*** ERROR: Unknown option: %s\n", argv[i]);
+			fprintf(stderr, "Please pass -h for a list of valid options.\n");
+			exit(1);
+		}
+	}
+
+	vector<ConfigKit::Error> errors;
+	if (!config.update(updates, errors)) {
+		fprintf(stderr, "*** ERROR: Invalid configuration: %s\n",
+			ConfigKit::toString(errors).c_str());
+		exit(1);
+	}
+}
+
+static bool
+shouldRun(const Benchmark &benchmark) {
+	if (filters.empty()) {
+		return true;
+	}
+
+	string name = benchmark.getFullName();
+	for (unsigned int i = 0; i < filters.size(); i++) {
+		if (startsWith(name, filters[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static State
+runOnce(const Benchmark &benchmark, unsigned long long iterations) {
+	State state(iterations);
+	benchmark.function(state);
+	return state;
+}
+
+/**
+ * Finds an iteration count for which a single run takes at least
+ * `minSampleTimeMsec`, so that timer resolution and overhead are negligible.
+ */
+static unsigned long long
+calibrate(const Benchmark &benchmark) {
+	boost::uint64_t minSampleTime = (boost::uint64_t) minSampleTimeMsec * 1000000;
+	unsigned long long iterations = 1;
+
+	while (true) {
+		boost::uint64_t elapsed = runOnce(benchmark, iterations).getElapsedNsec();
+		if (elapsed >= minSampleTime || iterations >= 1000000000ull) {
+			return iterations;
+		}
+
+		unsigned long long next;
+		if (elapsed == 0) {
+			next = iterations * 100;
+		} else {
+			// Aim slightly above the minimum so that the next round
+			// is likely to be the last one.
+			next = (unsigned long long) (iterations * 1.2 * minSampleTime / elapsed);
+		}
+		iterations = std::min(std::max(next, iterations * 2), 1000000000ull);
+	}
+}
+
+static Result
+runBenchmark(const Benchmark &benchmark) {
+	Result result;
+	unsigned int i;
+
+	result.benchmark = &benchmark;
+	result.iterations = calibrate(benchmark);
+	// Warm up caches and allocator free lists.
+	result.bytesPerIteration = runOnce(benchmark, result.iterations).getBytesPerIteration();
+
+	for (i = 0; i < samplesPerBenchmark; i++) {
+		State state(runOnce(benchmark, result.iterations));
+		result.samples.push_back((double) state.getElapsedNsec() / result.iterations);
+	}
+	sort(result.samples.begin(), result.samples.end());
+
+	double sum = 0, squaredDeviationSum = 0;
+	for (i = 0; i < result.samples.size(); i++) {
+		sum += result.samples[i];
+	}
+	result.mean = sum / result.samples.size();
+	for (i = 0; i < result.samples.size(); i++) {
+		squaredDeviationSum += (result.samples[i] - result.mean)
+			* (result.samples[i] - result.mean);
+	}
+	result.stddev = (result.samples.size() > 1)
+		? sqrt(squaredDeviationSum / (result.samples.size() - 1))
+		: 0;
+	result.min = result.samples.front();
+	result.max = result.samples.back();
+	if (result.samples.size() % 2 == 0) {
+		result.median = (result.samples[result.samples.size() / 2 - 1]
+			+ result.samples[result.samples.size() / 2]) / 2;
+	} else {
+		result.median = result.samples[result.samples.size() / 2];
+	}
+
+	return result;
+}
+
+static double
+megabytesPerSec(const Result &result) {
+	return result.bytesPerIteration / result.median * 1000000000.0 / 1024 / 1024;
+}
+
+static void
+printHeader() {
+	fprintf(tableOutput, "%-44s %12s %12s %12s %8s %12s\n", "Benchmark", "Median ns", "Min ns",
+		"Mean ns", "RSD %", "MB/s");
+}
+
+static void
+printResult(const Result &result) {
+	char throughput[32] = "-";
+	if (result.bytesPerIteration > 0) {
+		snprintf(throughput, sizeof(throughput), "%.1f", megabytesPerSec(result));
+	}
+	fprintf(tableOutput, "%-44s %12.1f %12.1f %12.1f %8.2f %12s\n",
+		result.benchmark->getFullName().c_str(),
+		result.median, result.min, result.mean,
+		result.mean > 0 ? result.stddev / result.mean * 100 : 0.0,
+		throughput);
+	fflush(tableOutput);
+}
+
+static Json::Value
+resultsToJson(const vector<Result> &results) {
+	Json::Value doc;
+	Json::Value benchmarks(Json::arrayValue);
+
+	doc["timestamp"] = (Json::UInt64) time(NULL);
+	doc["samples_per_benchmark"] = samplesPerBenchmark;
+	doc["min_sample_time_msec"] = minSampleTimeMsec;
+
+	for (unsigned int i = 0; i < results.size(); i++) {
+		const Result &result = results[i];
+		Json::Value entry;
+		Json::Value samples(Json::arrayValue);
+
+		entry["group"] = result.benchmark->group;
+		entry["name"] = result.benchmark->name;
+		entry["iterations"] = (Json::UInt64) result.iterations;
+		entry["ns_per_iteration"]["median"] = result.median;
+		entry["ns_per_iteration"]["min"] = result.min;
+		entry["ns_per_iteration"]["max"] = result.max;
+		entry["ns_per_iteration"]["mean"] = result.mean;
+		entry["ns_per_iteration"]["stddev"] = result.stddev;
+		if (result.bytesPerIteration > 0) {
+			entry["bytes_per_iteration"] = (Json::UInt64) result.bytesPerIteration;
+			entry["mb_per_sec"] = megabytesPerSec(result);
+		}
+		for (unsigned int j = 0; j < result.samples.size(); j++) {
+			samples.append(result.samples[j]);
+		}
+		entry["samples"] = samples;
+		benchmarks.append(entry);
+	}
+
+	doc["benchmarks"] = benchmarks;
+	return doc;
+}
+
+int
+main(int argc, char *argv[]) {
+	using namespace Agent::Fundamentals;
+
+	ConfigKit::Schema *schema = new ConfigKit::Schema();
+	schema->add("passenger_root", ConfigKit::STRING_TYPE, ConfigKit::REQUIRED);
+	schema->finalize();
+	ConfigKit::Store *config = new ConfigKit::Store(*schema);
+	initializeAgent(argc, &argv, "CxxBenchMain", *config,
+		ConfigKit::DummyTranslator(), parseOptions);
+
+	const vector<Benchmark> &benchmarks = getBenchmarks();
+	vector<Result> results;
+
+	if (jsonOutputPath == "-") {
+		tableOutput = stderr;
+	}
+	printHeader();
+	for (unsigned int i = 0; i < benchmarks.size(); i++) {
+		if (shouldRun(benchmarks[i])) {
+			results.push_back(runBenchmark(benchmarks[i]));
+			printResult(results.back());
+		}
+	}
+
+	if (jsonOutputPath == "-") {
+		printf("%s", resultsToJson(results).toStyledString().c_str());
+	} else if (!jsonOutputPath.empty()) {
+		createFile(jsonOutputPath, resultsToJson(results).toStyledString());
+	}
+
+	shutdownAgent(schema, config);
+	return 0;
+}
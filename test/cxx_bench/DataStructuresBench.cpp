@@ -0,0 +1,164 @@
+#include <BenchSupport.h>
+#include <MemoryKit/palloc.h>
+#include <ServerKit/HeaderTable.h>
+#include <DataStructures/StringKeyTable.h>
+#include <DataStructures/HashedStaticString.h>
+#include <StrIntTools/StrIntUtils.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Bench;
+using namespace Passenger::ServerKit;
+
+namespace {
+	vector<HashedStaticString> createStubHeaderKeys(vector<string> &storage) {
+		const StubHttpRequest &request = getStubHttpRequest();
+		vector<HashedStaticString> keys;
+		unsigned int i;
+
+		storage.clear();
+		for (i = 0; i < request.headers.size(); i++) {
+			storage.push_back(request.headers[i].first);
+			convertLowerCase((const unsigned char *) storage.back().data(),
+				(unsigned char *) &storage.back()[0], storage.back().size());
+		}
+		for (i = 0; i < storage.size(); i++) {
+			keys.push_back(storage[i]);
+		}
+		return keys;
+	}
+}
+
+
+/***** HeaderTable *****/
+
+BENCHMARK(HeaderTable, InsertRequestHeaders) {
+	const StubHttpRequest &request = getStubHttpRequest();
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+	HeaderTable table;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		for (unsigned int j = 0; j < request.headers.size(); j++) {
+			table.insert(pool, request.headers[j].first, request.headers[j].second);
+		}
+		doNotOptimize(table);
+		table.clear();
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+	state.stop();
+
+	psg_destroy_pool(pool);
+}
+
+BENCHMARK(HeaderTable, Lookup) {
+	const StubHttpRequest &request = getStubHttpRequest();
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+	HeaderTable table;
+	vector<string> storage;
+	vector<HashedStaticString> keys = createStubHeaderKeys(storage);
+	HashedStaticString missingKey("x-missing-header");
+
+	for (unsigned int j = 0; j < request.headers.size(); j++) {
+		table.insert(pool, request.headers[j].first, request.headers[j].second);
+	}
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		for (unsigned int j = 0; j < keys.size(); j++) {
+			doNotOptimize(table.lookup(keys[j]));
+		}
+		doNotOptimize(table.lookup(missingKey));
+	}
+	state.stop();
+
+	table.clear();
+	psg_destroy_pool(pool);
+}
+
+
+/***** StringKeyTable *****/
+
+BENCHMARK(StringKeyTable, Insert) {
+	vector<string> storage;
+	vector<HashedStaticString> keys;
+	StringKeyTable<int> table;
+	unsigned int j;
+
+	for (j = 0; j < 64; j++) {
+		storage.push_back("/var/www/app" + toString(j) + "/public");
+	}
+	for (j = 0; j < storage.size(); j++) {
+		keys.push_back(storage[j]);
+	}
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		for (j = 0; j < keys.size(); j++) {
+			table.insert(keys[j], (int) j);
+		}
+		doNotOptimize(table);
+		table.clear();
+	}
+	state.stop();
+}
+
+BENCHMARK(StringKeyTable, Lookup) {
+	vector<string> storage;
+	vector<HashedStaticString> keys;
+	StringKeyTable<int> table;
+	unsigned int j;
+
+	for (j = 0; j < 64; j++) {
+		storage.push_back("/var/www/app" + toString(j) + "/public");
+	}
+	for (j = 0; j < storage.size(); j++) {
+		keys.push_back(storage[j]);
+		table.insert(keys[j], (int) j);
+	}
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		for (j = 0; j < keys.size(); j++) {
+			int *value;
+			doNotOptimize(table.lookup(keys[j], &value));
+		}
+	}
+	state.stop();
+}
+
+
+/***** HashedStaticString *****/
+
+BENCHMARK(HashedStaticString, HashHeaderName) {
+	StaticString key("content-type");
+
+	state.setBytesPerIteration(key.size());
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		doNotOptimize(key);
+		HashedStaticString hashed(key);
+		doNotOptimize(hashed);
+	}
+	state.stop();
+}
+
+BENCHMARK(HashedStaticString, HashRequestHeaders) {
+	const StubHttpRequest &request = getStubHttpRequest();
+	boost::uint64_t size = 0;
+	unsigned int j;
+
+	for (j = 0; j < request.headers.size(); j++) {
+		size += request.headers[j].second.size();
+	}
+
+	state.setBytesPerIteration(size);
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		for (j = 0; j < request.headers.size(); j++) {
+			HashedStaticString hashed(request.headers[j].second);
+			doNotOptimize(hashed);
+		}
+	}
+	state.stop();
+}
@@ -0,0 +1,89 @@
+#include <BenchSupport.h>
+#include <Constants.h>
+#include <MemoryKit/palloc.h>
+#include <MemoryKit/mbuf.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Bench;
+using namespace Passenger::MemoryKit;
+
+
+/***** palloc *****/
+
+BENCHMARK(Palloc, SmallAllocationsAndReset) {
+	psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		// Roughly the allocation pattern of parsing a request with
+		// a dozen headers.
+		for (unsigned int j = 0; j < 32; j++) {
+			doNotOptimize(psg_pnalloc(pool, 24 + j));
+		}
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+	state.stop();
+
+	psg_destroy_pool(pool);
+}
+
+BENCHMARK(Palloc, CreateAndDestroyPool) {
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		psg_pool_t *pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		doNotOptimize(psg_palloc(pool, 64));
+		psg_destroy_pool(pool);
+	}
+	state.stop();
+}
+
+
+/***** mbuf *****/
+
+BENCHMARK(Mbuf, GetAndRelease) {
+	struct mbuf_pool pool;
+	pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+	mbuf_pool_init(&pool);
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		mbuf buffer(mbuf_get(&pool));
+		doNotOptimize(buffer.start);
+	}
+	state.stop();
+
+	mbuf_pool_deinit(&pool);
+}
+
+BENCHMARK(Mbuf, GetWithSizeAndRelease) {
+	struct mbuf_pool pool;
+	pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+	mbuf_pool_init(&pool);
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		mbuf buffer(mbuf_get_with_size(&pool, 1024));
+		doNotOptimize(buffer.start);
+	}
+	state.stop();
+
+	mbuf_pool_deinit(&pool);
+}
+
+BENCHMARK(Mbuf, SubsetRefcounting) {
+	struct mbuf_pool pool;
+	pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+	mbuf_pool_init(&pool);
+	mbuf buffer(mbuf_get(&pool));
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		mbuf subset(buffer, 16, 128);
+		doNotOptimize(subset.start);
+	}
+	state.stop();
+
+	buffer = mbuf();
+	mbuf_pool_deinit(&pool);
+}
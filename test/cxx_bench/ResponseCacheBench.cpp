@@ -0,0 +1,184 @@
+#include <BenchSupport.h>
+#include <time.h>
+#include <ServerKit/HttpRequest.h>
+#include <MemoryKit/palloc.h>
+#include <Core/Controller/Request.h>
+#include <Core/Controller/AppResponse.h>
+#include <Core/ResponseCache.h>
+#include <StrIntTools/StrIntUtils.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Bench;
+using namespace Passenger::Core;
+using namespace Passenger::ServerKit;
+
+namespace {
+	typedef ResponseCache<Request> ResponseCacheType;
+
+	const unsigned int NUM_PATHS = 8;
+
+	/**
+	 * Sets up requests the same way test/cxx/Core/ResponseCacheTest.cpp does,
+	 * minus the fields that the response cache does not look at.
+	 */
+	struct ResponseCacheFixture {
+		ResponseCacheType responseCache;
+		Request req;
+		Core::ControllerSchema schema;
+		ConfigKit::Store config;
+		string today;
+		string paths[NUM_PATHS];
+
+		ResponseCacheFixture()
+			: config(schema)
+		{
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			config["multi_app"] = false;
+			config["default_server_name"] = "localhost";
+			config["default_server_port"] = "80";
+			req.config.reset(new ControllerRequestConfig(config));
+
+			time_t the_time = time(NULL);
+			struct tm the_tm;
+			char buf[64];
+			gmtime_r(&the_time, &the_tm);
+			today.assign(buf, strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &the_tm));
+
+			for (unsigned int i = 0; i < NUM_PATHS; i++) {
+				paths[i] = "/products/" + toString(i) + "/reviews";
+			}
+		}
+
+		~ResponseCacheFixture() {
+			req.headers.clear();
+			req.appResponse.headers.clear();
+			psg_destroy_pool(req.pool);
+		}
+
+		void reset(const string &path, bool cacheableResponse) {
+			req.headers.clear();
+			req.secureHeaders.clear();
+			req.appResponse.headers.clear();
+			req.appResponse.secureHeaders.clear();
+			psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+
+			req.httpState = Request::COMPLETE;
+			req.bodyType  = Request::RBT_NO_BODY;
+			req.method    = HTTP_GET;
+			psg_lstr_init(&req.path);
+			psg_lstr_append(&req.path, req.pool, path.data(), path.size());
+			req.https     = false;
+			req.hasPragmaHeader = false;
+			req.host = createLString("foo.com");
+			req.cacheKey = HashedStaticString();
+			req.cacheControl = NULL;
+			req.varyCookie = NULL;
+
+			req.appResponse.httpState  = AppResponse::COMPLETE;
+			req.appResponse.bodyType   = AppResponse::RBT_CONTENT_LENGTH;
+			req.appResponse.aux.bodyInfo.contentLength = 5;
+			req.appResponse.statusCode = 200;
+			req.appResponse.date       = NULL;
+			req.appResponse.setCookie  = NULL;
+			req.appResponse.cacheControl  = NULL;
+			req.appResponse.expiresHeader = NULL;
+			req.appResponse.lastModifiedHeader = NULL;
+
+			insertAppResponseHeader(createHeader("date", today));
+			if (cacheableResponse) {
+				insertAppResponseHeader(createHeader("cache-control",
+					"public,max-age=99999"));
+			}
+		}
+
+		LString *createLString(const StaticString &value) {
+			LString *str = (LString *) psg_palloc(req.pool, sizeof(LString));
+			psg_lstr_init(str);
+			psg_lstr_append(str, req.pool, value.data(), value.size());
+			return str;
+		}
+
+		Header *createHeader(const HashedStaticString &key, const StaticString &val) {
+			Header *header = (Header *) psg_palloc(req.pool, sizeof(Header));
+			psg_lstr_init(&header->key);
+			psg_lstr_init(&header->origKey);
+			psg_lstr_init(&header->val);
+			psg_lstr_append(&header->key, req.pool, key.data(), key.size());
+			psg_lstr_append(&header->origKey, req.pool, key.data(), key.size());
+			psg_lstr_append(&header->val, req.pool, val.data(), val.size());
+			header->hash = key.hash();
+			return header;
+		}
+
+		void insertAppResponseHeader(Header *header) {
+			req.appResponse.headers.insert(&header, req.pool);
+		}
+
+		bool store(const string &path) {
+			static const StaticString headers =
+				"content-length: 5\r\n"
+				"cache-control: public,max-age=99999\r\n";
+
+			reset(path, true);
+			return responseCache.prepareRequest(this, &req)
+				&& responseCache.requestAllowsStoring(&req)
+				&& responseCache.prepareRequestForStoring(&req)
+				&& responseCache.store(&req, time(NULL), headers.size(), 5).valid();
+		}
+	};
+}
+
+
+BENCHMARK(ResponseCache, PrepareRequest) {
+	ResponseCacheFixture fixture;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.reset(fixture.paths[i % NUM_PATHS], false);
+		doNotOptimize(fixture.responseCache.prepareRequest(&fixture, &fixture.req));
+	}
+	state.stop();
+}
+
+BENCHMARK(ResponseCache, FetchHit) {
+	ResponseCacheFixture fixture;
+	ev_tstamp now = time(NULL);
+
+	for (unsigned int i = 0; i < NUM_PATHS; i++) {
+		fixture.store(fixture.paths[i]);
+	}
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.reset(fixture.paths[i % NUM_PATHS], false);
+		fixture.responseCache.prepareRequest(&fixture, &fixture.req);
+		ResponseCacheType::Entry entry(fixture.responseCache.fetch(&fixture.req, now));
+		doNotOptimize(entry);
+	}
+	state.stop();
+}
+
+BENCHMARK(ResponseCache, FetchMiss) {
+	ResponseCacheFixture fixture;
+	ev_tstamp now = time(NULL);
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.reset(fixture.paths[i % NUM_PATHS], false);
+		fixture.responseCache.prepareRequest(&fixture, &fixture.req);
+		ResponseCacheType::Entry entry(fixture.responseCache.fetch(&fixture.req, now));
+		doNotOptimize(entry);
+	}
+	state.stop();
+}
+
+BENCHMARK(ResponseCache, Store) {
+	ResponseCacheFixture fixture;
+
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		doNotOptimize(fixture.store(fixture.paths[i % NUM_PATHS]));
+	}
+	state.stop();
+}
@@ -0,0 +1,174 @@
+#include <BenchSupport.h>
+#include <ServerKit/Context.h>
+#include <ServerKit/HttpRequest.h>
+#include <ServerKit/HttpHeaderParser.h>
+#include <ServerKit/HttpChunkedBodyParser.h>
+#include <MemoryKit/mbuf.h>
+#include <StrIntTools/StrIntUtils.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Bench;
+using namespace Passenger::ServerKit;
+
+namespace {
+	struct ParserFixture {
+		ServerKit::Schema schema;
+		ServerKit::Context context;
+		HttpHeaderParserState state;
+		HttpRequest req;
+
+		ParserFixture()
+			: context(schema)
+		{
+			// Context's destructor deinitializes the mbuf pool, but we
+			// do not call initialize() because we have no event loop.
+			context.mbuf_pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+			MemoryKit::mbuf_pool_init(&context.mbuf_pool);
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		}
+
+		~ParserFixture() {
+			psg_destroy_pool(req.pool);
+		}
+
+		/** Mirrors HttpServer::reinitializeRequest(). */
+		void reinitializeRequest() {
+			req.httpMajor = 1;
+			req.httpMinor = 0;
+			req.httpState = HttpRequest::PARSING_HEADERS;
+			req.bodyType  = HttpRequest::RBT_NO_BODY;
+			req.method    = HTTP_GET;
+			req.wantKeepAlive = false;
+			req.parserState.headerParser = &state;
+			psg_lstr_init(&req.path);
+			req.aux.bodyInfo.contentLength = 0;
+			req.queryStringIndex = -1;
+			createParser().initialize();
+		}
+
+		/** Mirrors HttpServer::deinitializeRequest(). */
+		void deinitializeRequest() {
+			psg_lstr_deinit(&req.path);
+			releaseHeaders(req.headers);
+			releaseHeaders(req.secureHeaders);
+			psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+		}
+
+		void releaseHeaders(HeaderTable &table) {
+			HeaderTable::Iterator it(table);
+			while (*it != NULL) {
+				psg_lstr_deinit(&it->header->key);
+				psg_lstr_deinit(&it->header->origKey);
+				psg_lstr_deinit(&it->header->val);
+				it.next();
+			}
+			table.clear();
+		}
+
+		HttpHeaderParser<HttpRequest> createParser() {
+			return HttpHeaderParser<HttpRequest>(&context, &state, &req, req.pool);
+		}
+
+		/**
+		 * The parser references the mbuf block that the headers live in,
+		 * so the input must be in a real mbuf instead of a dumb wrapper.
+		 */
+		MemoryKit::mbuf createInput(const string &data) {
+			MemoryKit::mbuf buffer(MemoryKit::mbuf_get_with_size(&context.mbuf_pool,
+				data.size()));
+			memcpy(buffer.start, data.data(), data.size());
+			return MemoryKit::mbuf(buffer, 0, data.size());
+		}
+	};
+
+	unsigned int formatLoggingPrefix(char *buf, unsigned int bufsize, void *userData) {
+		return 0;
+	}
+
+	string createChunkedBody(unsigned int chunkSize, unsigned int chunkCount) {
+		string chunk(chunkSize, 'x');
+		string result;
+
+		for (unsigned int i = 0; i < chunkCount; i++) {
+			result.append(integerToHex(chunkSize));
+			result.append("\r\n");
+			result.append(chunk);
+			result.append("\r\n");
+		}
+		result.append("0\r\n\r\n");
+		return result;
+	}
+
+	void benchmarkChunkedBodyParser(State &state, const string &body) {
+		HttpChunkedBodyParserState parserState;
+		HttpChunkedBodyParser parser(&parserState, formatLoggingPrefix, NULL);
+
+		state.setBytesPerIteration(body.size());
+		state.start();
+		for (unsigned long long i = 0; i < state.iterations; i++) {
+			const char *pos = body.data();
+			const char *end = body.data() + body.size();
+
+			parser.initialize();
+			while (pos < end) {
+				HttpChunkedEvent event(parser.feed(
+					MemoryKit::mbuf(pos, end - pos), false));
+				pos += event.consumed;
+				if (event.type == HttpChunkedEvent::END
+				 || event.type == HttpChunkedEvent::ERROR)
+				{
+					break;
+				}
+			}
+			doNotOptimize(parserState);
+		}
+		state.stop();
+	}
+}
+
+
+/***** HttpHeaderParser *****/
+
+BENCHMARK(HttpHeaderParser, StubRequest) {
+	ParserFixture fixture;
+	string data = getStubHttpRequest().toHttp();
+	MemoryKit::mbuf input(fixture.createInput(data));
+
+	state.setBytesPerIteration(data.size());
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.reinitializeRequest();
+		fixture.createParser().feed(input);
+		doNotOptimize(fixture.req.httpState);
+		fixture.deinitializeRequest();
+	}
+	state.stop();
+}
+
+BENCHMARK(HttpHeaderParser, MinimalRequest) {
+	ParserFixture fixture;
+	string data = "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+	MemoryKit::mbuf input(fixture.createInput(data));
+
+	state.setBytesPerIteration(data.size());
+	state.start();
+	for (unsigned long long i = 0; i < state.iterations; i++) {
+		fixture.reinitializeRequest();
+		fixture.createParser().feed(input);
+		doNotOptimize(fixture.req.httpState);
+		fixture.deinitializeRequest();
+	}
+	state.stop();
+}
+
+
+/***** HttpChunkedBodyParser *****/
+
+BENCHMARK(HttpChunkedBodyParser, SmallChunks) {
+	benchmarkChunkedBodyParser(state, createChunkedBody(64, 256));
+}
+
+BENCHMARK(HttpChunkedBodyParser, LargeChunks) {
+	benchmarkChunkedBodyParser(state, createChunkedBody(16 * 1024, 4));
+}
@@ -0,0 +1,287 @@
+/*
+ * A minimal native web application for the Core load benchmark
+ * (CoreLoadBench.cpp). It serves every request with a fixed response, so
+ * that benchmark results reflect the Core instead of an application
+ * runtime.
+ *
+ * The spawner passes an already listening server socket on the file
+ * descriptor given by --fd. Every accepted connection is handled by its
+ * own thread, which serves requests on it until the peer closes it.
+ * Both the 'session' protocol and the 'http' protocol are supported.
+ *
+ * This program deliberately depends on nothing but libc and pthreads.
+ */
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+
+using namespace std;
+
+enum Protocol {
+	SESSION_PROTOCOL,
+	HTTP_PROTOCOL
+};
+
+static Protocol protocol = SESSION_PROTOCOL;
+static string responseHeader;
+static string responseHeaderWithClose;
+static string responseBody;
+static unsigned int delayUsec = 0;
+
+
+class Connection {
+private:
+	int fd;
+	char buf[16 * 1024];
+	size_t bufStart, bufEnd;
+
+	/** Reads more data into the buffer. Returns false on EOF or error. */
+	bool fill() {
+		if (bufStart == bufEnd) {
+			bufStart = bufEnd = 0;
+		} else if (bufEnd == sizeof(buf)) {
+			memmove(buf, buf + bufStart, bufEnd - bufStart);
+			bufEnd -= bufStart;
+			bufStart = 0;
+			if (bufEnd == sizeof(buf)) {
+				fprintf(stderr, "StubApp: request header too large\n");
+				return false;
+			}
+		}
+
+		ssize_t ret;
+		do {
+			ret = read(fd, buf + bufEnd, sizeof(buf) - bufEnd);
+		} while (ret == -1 && errno == EINTR);
+		if (ret <= 0) {
+			return false;
+		}
+		bufEnd += ret;
+		return true;
+	}
+
+	bool readExact(string *output, size_t size) {
+		while (size > 0) {
+			if (bufStart == bufEnd && !fill()) {
+				return false;
+			}
+			size_t n = min(size, bufEnd - bufStart);
+			if (output != NULL) {
+				output->append(buf + bufStart, n);
+			}
+			bufStart += n;
+			size -= n;
+		}
+		return true;
+	}
+
+	bool writeExact(const char *data, size_t size) {
+		while (size > 0) {
+			ssize_t ret = write(fd, data, size);
+			if (ret == -1) {
+				if (errno == EINTR) {
+					continue;
+				}
+				return false;
+			}
+			data += ret;
+			size -= ret;
+		}
+		return true;
+	}
+
+	/**
+	 * Reads a session protocol header: a 32-bit big-endian size, followed
+	 * by NUL-separated names and values.
+	 */
+	bool readSessionRequest(unsigned long long *contentLength, bool *keepAlive) {
+		string sizeBytes, header;
+		if (!readExact(&sizeBytes, 4)) {
+			return false;
+		}
+		const unsigned char *p = (const unsigned char *) sizeBytes.data();
+		size_t size = ((size_t) p[0] << 24) | ((size_t) p[1] << 16)
+			| ((size_t) p[2] << 8) | (size_t) p[3];
+		if (!readExact(&header, size)) {
+			return false;
+		}
+
+		const char *pos = header.data();
+		const char *end = header.data() + header.size();
+		*contentLength = 0;
+		*keepAlive = true;
+		while (pos < end) {
+			const char *name = pos;
+			const char *value = name + strnlen(name, end - name) + 1;
+			if (value >= end) {
+				break;
+			}
+			if (strcmp(name, "CONTENT_LENGTH") == 0) {
+				*contentLength = strtoull(value, NULL, 10);
+			}
+			pos = value + strnlen(value, end - value) + 1;
+		}
+		return true;
+	}
+
+	bool readHttpRequest(unsigned long long *contentLength, bool *keepAlive) {
+		const char *headerEnd;
+		while ((headerEnd = (const char *) memmem(buf + bufStart, bufEnd - bufStart,
+			"\r\n\r\n", 4)) == NULL)
+		{
+			if (!fill()) {
+				return false;
+			}
+		}
+
+		// The Core sends "Connection: close" to apps that speak HTTP.
+		string header(buf + bufStart, headerEnd + 4 - (buf + bufStart));
+		bufStart += header.size();
+		*contentLength = 0;
+		*keepAlive = true;
+
+		string::size_type lineStart = header.find("\r\n") + 2;
+		while (lineStart < header.size() - 2) {
+			string::size_type lineEnd = header.find("\r\n", lineStart);
+			string line = header.substr(lineStart, lineEnd - lineStart);
+			if (strncasecmp(line.c_str(), "Content-Length:", 15) == 0) {
+				*contentLength = strtoull(line.c_str() + 15, NULL, 10);
+			} else if (strncasecmp(line.c_str(), "Connection:", 11) == 0
+				&& strcasestr(line.c_str() + 11, "close") != NULL)
+			{
+				*keepAlive = false;
+			}
+			lineStart = lineEnd + 2;
+		}
+		return true;
+	}
+
+public:
+	Connection(int _fd)
+		: fd(_fd),
+		  bufStart(0),
+		  bufEnd(0)
+		{ }
+
+	~Connection() {
+		close(fd);
+	}
+
+	void serve() {
+		while (true) {
+			unsigned long long contentLength;
+			bool keepAlive, ok;
+
+			if (protocol == SESSION_PROTOCOL) {
+				ok = readSessionRequest(&contentLength, &keepAlive);
+			} else {
+				ok = readHttpRequest(&contentLength, &keepAlive);
+			}
+			if (!ok || !readExact(NULL, contentLength)) {
+				return;
+			}
+
+			if (delayUsec > 0) {
+				usleep(delayUsec);
+			}
+
+			const string &header = keepAlive ? responseHeader : responseHeaderWithClose;
+			if (!writeExact(header.data(), header.size())
+			 || !writeExact(responseBody.data(), responseBody.size())
+			 || !keepAlive)
+			{
+				return;
+			}
+		}
+	}
+};
+
+
+static void *
+connectionThreadMain(void *arg) {
+	Connection *connection = (Connection *) arg;
+	connection->serve();
+	delete connection;
+	return NULL;
+}
+
+static void
+usage(int exitCode) {
+	fprintf(stderr, "Usage: bench_stub_app --fd FD [--protocol session|http]"
+		" [--body-size BYTES] [--delay-usec USEC]\n");
+	exit(exitCode);
+}
+
+int
+main(int argc, char *argv[]) {
+	int serverFd = -1;
+	unsigned int bodySize = 128;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--fd") == 0 && i + 1 < argc) {
+			serverFd = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--protocol") == 0 && i + 1 < argc) {
+			i++;
+			if (strcmp(argv[i], "session") == 0) {
+				protocol = SESSION_PROTOCOL;
+			} else if (strcmp(argv[i], "http") == 0) {
+				protocol = HTTP_PROTOCOL;
+			} else {
+				usage(1);
+			}
+		} else if (strcmp(argv[i], "--body-size") == 0 && i + 1 < argc) {
+			bodySize = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--delay-usec") == 0 && i + 1 < argc) {
+			delayUsec = atoi(argv[++i]);
+		} else {
+			usage(1);
+		}
+	}
+	if (serverFd == -1) {
+		usage(1);
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+
+	char contentLength[32];
+	snprintf(contentLength, sizeof(contentLength), "%u", bodySize);
+	responseHeader = string("HTTP/1.1 200 OK\r\n"
+		"Status: 200 OK\r\n"
+		"Content-Type: text/plain\r\n"
+		"Content-Length: ") + contentLength + "\r\n";
+	responseHeaderWithClose = responseHeader + "Connection: close\r\n\r\n";
+	responseHeader.append("\r\n");
+	responseBody.assign(bodySize, 'x');
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	pthread_attr_setstacksize(&attr, 128 * 1024);
+
+	while (true) {
+		int fd = accept(serverFd, NULL, NULL);
+		if (fd == -1) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			perror("StubApp: accept()");
+			return 1;
+		}
+
+		pthread_t thread;
+		Connection *connection = new Connection(fd);
+		if (pthread_create(&thread, &attr, connectionThreadMain, connection) != 0) {
+			fprintf(stderr, "StubApp: cannot create thread\n");
+			delete connection;
+		}
+	}
+}
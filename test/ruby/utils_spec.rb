@@ -23,6 +23,42 @@ module PhusionPassenger
     expect(split_by_null_into_hash("\0\0")).to eq("" => "")
   end
 
+  specify "#parse_session_headers works" do
+    expect(parse_session_headers("")).to eq({})
+    expect(parse_session_headers("foo\0bar\0")).to eq("foo" => "bar")
+    expect(parse_session_headers("foo\0\0bar\0baz\0")).to eq("foo" => "", "bar" => "baz")
+    expect(parse_session_headers("foo\0bar\0baz")).to eq("foo" => "bar")
+    expect(parse_session_headers("\0\0")).to eq("" => "")
+  end
+
+  specify "#parse_session_headers returns frozen keys and unfrozen values" do
+    headers = parse_session_headers("REQUEST_METHOD\0GET\0")
+    expect(headers.keys[0]).to be_frozen
+    expect(headers["REQUEST_METHOD"]).not_to be_frozen
+  end
+
+  if defined?(NativeSupport)
+    specify "#parse_session_headers shares keys between calls" do
+      headers1 = parse_session_headers("HTTP_HOST\0foo\0")
+      headers2 = parse_session_headers("HTTP_HOST\0bar\0")
+      expect(headers1.keys[0]).to equal(headers2.keys[0])
+    end
+
+    specify "NativeSupport.generate_headers_array works" do
+      result = NativeSupport.generate_headers_array(200,
+        "Content-Type" => "text/html",
+        "Set-Cookie" => "a=1\nb=2\n",
+        "X-Empty" => "",
+        "X-Number" => 1,
+        "rack.hijack" => lambda { })
+      expect(result.join).to eq("HTTP/1.1 200 Whatever\r\n" \
+        "Content-Type: text/html\r\n" \
+        "Set-Cookie: a=1\r\n" \
+        "Set-Cookie: b=2\r\n" \
+        "X-Number: 1\r\n")
+    end
+  end
+
   ######################
 end
 